@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+using oneapi::math::transpose;
+
+// batch_size products C_i = A_i * B_i of n x n matrices stored with constant strides
+template <typename fp>
+void gemm_batch(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0), batch_size = state.range(1);
+    const std::int64_t stride = n * n;
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, stride * batch_size, -1.0, 1.0),
+        b(queue, stride * batch_size, -1.0, 1.0), c(queue, stride * batch_size);
+    const fp alpha(1), beta(0);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::gemm_batch, transpose::nontrans,
+                   transpose::nontrans, n, n, n, alpha, a.data(), n, stride, b.data(), n, stride,
+                   beta, c.data(), n, stride, batch_size);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n * n * n * batch_size);
+    bench_set_bytes(state, 3.0 * sizeof(fp) * stride * batch_size);
+}
+
+// batch_size products C_i = op(A_i) * B_i with A_i m x m and B_i and C_i m x n, m taking the sizes
+// of the small-matrix kernels of gemm_batch around their bounds of 8, 16 and 32. op is the
+// identity when the trans argument is 0, otherwise the conjugate transpose for complex types and
+// the transpose for real ones.
+template <typename fp>
+void gemm_batch_small(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t m = state.range(0), n = state.range(1), batch_size = state.range(2);
+    const transpose op = bench_real<fp>::is_complex ? transpose::conjtrans : transpose::trans;
+    const transpose transa = state.range(3) == 0 ? transpose::nontrans : op;
+    const std::int64_t stride_a = m * m, stride_c = m * n;
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, stride_a * batch_size, -1.0, 1.0),
+        b(queue, stride_c * batch_size, -1.0, 1.0), c(queue, stride_c * batch_size);
+    const fp alpha(1), beta(0);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::gemm_batch, transa,
+                   transpose::nontrans, m, n, m, alpha, a.data(), m, stride_a, b.data(), m,
+                   stride_c, beta, c.data(), m, stride_c, batch_size);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * m * m * n * batch_size);
+    bench_set_bytes(state, sizeof(fp) * (stride_a + 2.0 * stride_c) * batch_size);
+}
+
+// batch_size products y_i = A_i * x_i with A_i n x n
+template <typename fp>
+void gemv_batch(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0), batch_size = state.range(1);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, n * n * batch_size, -1.0, 1.0),
+        x(queue, n * batch_size, -1.0, 1.0), y(queue, n * batch_size);
+    const fp alpha(1), beta(0);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::gemv_batch, transpose::nontrans,
+                   n, n, alpha, a.data(), n, n * n, x.data(), 1, n, beta, y.data(), 1, n,
+                   batch_size);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n * n * batch_size);
+    bench_set_bytes(state, sizeof(fp) * (n * n + 2.0 * n) * batch_size);
+}
+
+// batch_size updates y_i = alpha * x_i + y_i of length n
+template <typename fp>
+void axpy_batch(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0), batch_size = state.range(1);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> x(queue, n * batch_size, -1.0, 1.0), y(queue, n * batch_size, -1.0, 1.0);
+    const fp alpha(0.5);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::axpy_batch, n, alpha, x.data(),
+                   1, n, y.data(), 1, n, batch_size);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n * batch_size);
+    bench_set_bytes(state, 3.0 * sizeof(fp) * n * batch_size);
+}
+
+// Small problems in large batches, the case batched routines exist for
+template <typename fp, typename Bench>
+void register_batch(sycl::device* dev, const char* routine, Bench bench) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, routine).c_str(), bench, dev)
+        ->ArgsProduct({ { 4, 8, 16, 32, 64 }, { 64, 1024, 16384 } })
+        ->ArgNames({ "n", "batch" })
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+// Sizes of the small-matrix kernels of gemm_batch, for comparing them with the general path
+template <typename fp>
+void register_gemm_batch_small(sycl::device* dev) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, "blas/gemm_batch_small").c_str(),
+                                 gemm_batch_small<fp>, dev)
+        ->ArgsProduct({ { 5, 8, 13, 16, 27, 32 }, { 8, 32 }, { 1024, 16384 }, { 0, 1 } })
+        ->ArgNames({ "m", "n", "batch", "trans" })
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+void register_blas_batch(sycl::device* dev) {
+    register_batch<float>(dev, "blas/gemm_batch", gemm_batch<float>);
+    register_batch<double>(dev, "blas/gemm_batch", gemm_batch<double>);
+    register_batch<std::complex<float>>(dev, "blas/gemm_batch", gemm_batch<std::complex<float>>);
+    register_batch<std::complex<double>>(dev, "blas/gemm_batch",
+                                         gemm_batch<std::complex<double>>);
+    register_gemm_batch_small<float>(dev);
+    register_gemm_batch_small<double>(dev);
+    register_gemm_batch_small<std::complex<float>>(dev);
+    register_gemm_batch_small<std::complex<double>>(dev);
+    register_batch<float>(dev, "blas/gemv_batch", gemv_batch<float>);
+    register_batch<double>(dev, "blas/gemv_batch", gemv_batch<double>);
+    register_batch<float>(dev, "blas/axpy_batch", axpy_batch<float>);
+    register_batch<double>(dev, "blas/axpy_batch", axpy_batch<double>);
+}
+
+BENCH_REGISTER(register_blas_batch);
+
+} // anonymous namespace
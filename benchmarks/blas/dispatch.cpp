@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+#include "oneapi/math/detail/dispatch_profiler.hpp"
+#include "oneapi/math/detail/get_device_id.hpp"
+
+// Host-side cost of dispatching tiny BLAS calls. The time of an iteration is the time spent in the
+// oneMath call until it returns, the kernel completion is reported separately as completion_ns.
+// Comparing bench_main_blas_rt with bench_main_blas_ct gives the cost of the run-time dispatch;
+// with ENABLE_DISPATCH_PROFILING the calls are also broken down into the dispatch stages, the
+// remainder being reported as other_ns. Note that the compile-time calls go through the backend
+// selection of the unit tests, which queries the device on every call.
+
+namespace {
+
+using bench_clock = std::chrono::steady_clock;
+
+template <typename Call>
+void run_dispatch(benchmark::State& state, sycl::queue& queue, Call call) {
+    namespace detail = oneapi::math::detail;
+
+    auto run = [&] {
+        call();
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+
+    detail::reset_dispatch_profile();
+    double dispatch_ns = 0.0, completion_ns = 0.0;
+    for (auto _ : state) {
+        auto start = bench_clock::now();
+        call();
+        auto submitted = bench_clock::now();
+        queue.wait_and_throw();
+        auto completed = bench_clock::now();
+
+        std::chrono::duration<double, std::nano> dispatch = submitted - start;
+        std::chrono::duration<double, std::nano> completion = completed - start;
+        state.SetIterationTime(dispatch.count() * 1e-9);
+        dispatch_ns += dispatch.count();
+        completion_ns += completion.count();
+    }
+
+    state.counters["completion_ns"] =
+        benchmark::Counter(completion_ns, benchmark::Counter::kAvgIterations);
+    if constexpr (detail::dispatch_profiling_enabled) {
+        const auto& profile = detail::thread_dispatch_profile();
+        double staged_ns = 0.0;
+        for (std::size_t stage = 0; stage < profile.size(); ++stage) {
+            double ns = static_cast<double>(profile[stage].nanoseconds);
+            staged_ns += ns;
+            state.counters[std::string(detail::dispatch_stage_name(
+                               static_cast<detail::dispatch_stage>(stage))) +
+                           "_ns"] = benchmark::Counter(ns, benchmark::Counter::kAvgIterations);
+        }
+        state.counters["other_ns"] =
+            benchmark::Counter(dispatch_ns - staged_ns, benchmark::Counter::kAvgIterations);
+    }
+}
+
+// Device lookup done by every run-time call
+void get_device_id(benchmark::State& state, sycl::device* dev) {
+    sycl::queue queue(*dev, bench_exception_handler());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(oneapi::math::get_device_id(queue));
+    }
+}
+
+// Submission of an empty kernel, the lower bound of any call
+void empty_submit(benchmark::State& state, sycl::device* dev) {
+    sycl::queue queue(*dev, bench_exception_handler());
+    run_dispatch(state, queue, [&] { queue.single_task([]() {}); });
+}
+
+void axpy(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<float> x(queue, n, -1.0, 1.0), y(queue, n, -1.0, 1.0);
+
+    run_dispatch(state, queue, [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::axpy, n, 0.5f, x.data(), 1,
+                   y.data(), 1);
+    });
+}
+
+void dot(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<float> x(queue, n, -1.0, 1.0), y(queue, n, -1.0, 1.0), result(queue, 1);
+
+    run_dispatch(state, queue, [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::dot, n, x.data(), 1, y.data(),
+                   1, result.data());
+    });
+}
+
+void gemm(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<float> a(queue, n * n, -1.0, 1.0), b(queue, n * n, -1.0, 1.0),
+        c(queue, n * n, -1.0, 1.0);
+
+    run_dispatch(state, queue, [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::gemm,
+                   oneapi::math::transpose::nontrans, oneapi::math::transpose::nontrans, n, n, n,
+                   1.0f, a.data(), n, b.data(), n, 0.0f, c.data(), n);
+    });
+}
+
+void register_blas_dispatch(sycl::device* dev) {
+    benchmark::RegisterBenchmark(bench_name(dev, "dispatch/get_device_id", "").c_str(),
+                                 get_device_id, dev);
+    benchmark::RegisterBenchmark(bench_name(dev, "dispatch/empty_submit", "").c_str(),
+                                 empty_submit, dev)
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(bench_name<float>(dev, "dispatch/axpy").c_str(), axpy, dev)
+        ->Arg(1)
+        ->Arg(64)
+        ->Arg(4096)
+        ->ArgName("n")
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(bench_name<float>(dev, "dispatch/dot").c_str(), dot, dev)
+        ->Arg(1)
+        ->Arg(64)
+        ->Arg(4096)
+        ->ArgName("n")
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(bench_name<float>(dev, "dispatch/gemm").c_str(), gemm, dev)
+        ->Arg(1)
+        ->Arg(4)
+        ->Arg(16)
+        ->ArgName("n")
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+BENCH_REGISTER(register_blas_dispatch);
+
+} // anonymous namespace
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+// y = alpha * x + y
+template <typename fp>
+void axpy(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> x(queue, n, -1.0, 1.0), y(queue, n, -1.0, 1.0);
+    const fp alpha(0.5);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::axpy, n, alpha, x.data(), 1,
+                   y.data(), 1);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n);
+    bench_set_bytes(state, 3.0 * sizeof(fp) * n);
+}
+
+// result = x . y
+template <typename fp>
+void dot(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> x(queue, n, -1.0, 1.0), y(queue, n, -1.0, 1.0), result(queue, 1);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::dot, n, x.data(), 1, y.data(), 1,
+                   result.data());
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, 2.0 * n);
+    bench_set_bytes(state, 2.0 * sizeof(fp) * n);
+}
+
+// result = ||x||_2
+template <typename fp>
+void nrm2(benchmark::State& state, sycl::device* dev) {
+    using fp_real = bench_real_t<fp>;
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> x(queue, n, -1.0, 1.0);
+    device_vector<fp_real> result(queue, 1);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::nrm2, n, x.data(), 1,
+                   result.data());
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n);
+    bench_set_bytes(state, sizeof(fp) * n);
+}
+
+template <typename fp, typename Bench>
+void register_level1(sycl::device* dev, const char* routine, Bench bench) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, routine).c_str(), bench, dev)
+        ->RangeMultiplier(16)
+        ->Range(1 << 10, 1 << 24)
+        ->ArgName("n")
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+void register_blas_level1(sycl::device* dev) {
+    register_level1<float>(dev, "blas/axpy", axpy<float>);
+    register_level1<double>(dev, "blas/axpy", axpy<double>);
+    register_level1<std::complex<float>>(dev, "blas/axpy", axpy<std::complex<float>>);
+    register_level1<std::complex<double>>(dev, "blas/axpy", axpy<std::complex<double>>);
+    register_level1<float>(dev, "blas/dot", dot<float>);
+    register_level1<double>(dev, "blas/dot", dot<double>);
+    register_level1<float>(dev, "blas/nrm2", nrm2<float>);
+    register_level1<double>(dev, "blas/nrm2", nrm2<double>);
+    register_level1<std::complex<float>>(dev, "blas/nrm2", nrm2<std::complex<float>>);
+    register_level1<std::complex<double>>(dev, "blas/nrm2", nrm2<std::complex<double>>);
+}
+
+BENCH_REGISTER(register_blas_level1);
+
+} // anonymous namespace
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+using oneapi::math::diag;
+using oneapi::math::side;
+using oneapi::math::transpose;
+using oneapi::math::uplo;
+
+// y = alpha * A * x + beta * y with A n x n
+template <typename fp>
+void gemv(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, n * n, -1.0, 1.0), x(queue, n, -1.0, 1.0), y(queue, n, -1.0, 1.0);
+    const fp alpha(1), beta(1);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::gemv, transpose::nontrans, n, n,
+                   alpha, a.data(), n, x.data(), 1, beta, y.data(), 1);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n * n);
+    bench_set_bytes(state, sizeof(fp) * (n * n + 3.0 * n));
+}
+
+// Solves A * x = b in place with A n x n lower triangular. The diagonal is taken as unit so that
+// repeated solves stay bounded.
+template <typename fp>
+void trsv(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, n * n, -1.0 / n, 1.0 / n), x(queue, n, -1.0, 1.0);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::trsv, uplo::lower,
+                   transpose::nontrans, diag::unit, n, a.data(), n, x.data(), 1);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n * n / 2);
+    bench_set_bytes(state, sizeof(fp) * (n * n / 2.0 + 2.0 * n));
+}
+
+template <typename fp, typename Bench>
+void register_level2(sycl::device* dev, const char* routine, Bench bench) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, routine).c_str(), bench, dev)
+        ->RangeMultiplier(4)
+        ->Range(64, 1 << 14)
+        ->ArgName("n")
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+void register_blas_level2(sycl::device* dev) {
+    register_level2<float>(dev, "blas/gemv", gemv<float>);
+    register_level2<double>(dev, "blas/gemv", gemv<double>);
+    register_level2<std::complex<float>>(dev, "blas/gemv", gemv<std::complex<float>>);
+    register_level2<std::complex<double>>(dev, "blas/gemv", gemv<std::complex<double>>);
+    register_level2<float>(dev, "blas/trsv", trsv<float>);
+    register_level2<double>(dev, "blas/trsv", trsv<double>);
+}
+
+BENCH_REGISTER(register_blas_level2);
+
+} // anonymous namespace
@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+using oneapi::math::diag;
+using oneapi::math::side;
+using oneapi::math::transpose;
+using oneapi::math::uplo;
+
+// C = alpha * A * B + beta * C with A m x k, B k x n and C m x n
+template <typename fp>
+void gemm(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t m = state.range(0), n = state.range(1), k = state.range(2);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, m * k, -1.0, 1.0), b(queue, k * n, -1.0, 1.0),
+        c(queue, m * n, -1.0, 1.0);
+    const fp alpha(1), beta(0);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::gemm, transpose::nontrans,
+                   transpose::nontrans, m, n, k, alpha, a.data(), m, b.data(), k, beta, c.data(),
+                   m);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * m * n * k);
+    bench_set_bytes(state, sizeof(fp) * (m * k + k * n + 2.0 * m * n));
+}
+
+// Solves A * X = alpha * B in place with A n x n lower triangular with unit diagonal and B n x n
+template <typename fp>
+void trsm(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, n * n, -1.0 / n, 1.0 / n), b(queue, n * n, -1.0, 1.0);
+    const fp alpha(1);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::trsm, side::left, uplo::lower,
+                   transpose::nontrans, diag::unit, n, n, alpha, a.data(), n, b.data(), n);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n * n * n / 2);
+    bench_set_bytes(state, sizeof(fp) * (n * n / 2.0 + 2.0 * n * n));
+}
+
+// C = alpha * A * A^T + beta * C with A n x k and C n x n lower triangular
+template <typename fp>
+void syrk(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0), k = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, n * k, -1.0, 1.0), c(queue, n * n, -1.0, 1.0);
+    const fp alpha(1), beta(0);
+
+    auto run = [&] {
+        BENCH_CALL(BLAS, queue, oneapi::math::blas::column_major::syrk, uplo::lower,
+                   transpose::nontrans, n, k, alpha, a.data(), n, beta, c.data(), n);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, bench_fma_flops<fp>() * n * (n + 1) / 2 * k);
+    bench_set_bytes(state, sizeof(fp) * (n * k + 2.0 * n * (n + 1) / 2));
+}
+
+template <typename fp, typename Bench>
+void register_square(sycl::device* dev, const char* routine, Bench bench) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, routine).c_str(), bench, dev)
+        ->RangeMultiplier(2)
+        ->Range(64, 4096)
+        ->ArgName("n")
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+template <typename fp>
+void register_gemm(sycl::device* dev) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    auto* bench = benchmark::RegisterBenchmark(bench_name<fp>(dev, "blas/gemm").c_str(),
+                                               gemm<fp>, dev);
+    // square problems, then tall-skinny and short-wide shapes
+    for (std::int64_t s = 64; s <= 4096; s *= 2) {
+        bench->Args({ s, s, s });
+    }
+    bench->Args({ 1 << 16, 64, 64 })
+        ->Args({ 64, 64, 1 << 16 })
+        ->Args({ 4096, 4096, 64 })
+        ->ArgNames({ "m", "n", "k" })
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+void register_blas_level3(sycl::device* dev) {
+    register_gemm<float>(dev);
+    register_gemm<double>(dev);
+    register_gemm<std::complex<float>>(dev);
+    register_gemm<std::complex<double>>(dev);
+    register_square<float>(dev, "blas/trsm", trsm<float>);
+    register_square<double>(dev, "blas/trsm", trsm<double>);
+    register_square<float>(dev, "blas/syrk", syrk<float>);
+    register_square<double>(dev, "blas/syrk", syrk<double>);
+}
+
+BENCH_REGISTER(register_blas_level3);
+
+} // anonymous namespace
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+namespace dft = oneapi::math::dft;
+
+template <dft::precision precision, dft::domain domain>
+void commit(dft::descriptor<precision, domain>& desc, sycl::queue& queue) {
+#ifdef CALL_RT_API
+    desc.commit(queue);
+#else
+    TEST_RUN_CT_SELECT_NO_ARGS(queue, desc.commit);
+#endif
+}
+
+template <typename fp>
+constexpr dft::precision precision_of() {
+    return std::is_same_v<fp, float> ? dft::precision::SINGLE : dft::precision::DOUBLE;
+}
+
+// batch in-place complex forward transforms of length n; the flop count is the conventional
+// 5 n log2(n) of a radix-2 transform
+template <typename fp>
+void complex_forward(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0), batch = state.range(1);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<std::complex<fp>> data(queue, n * batch, -1.0, 1.0);
+
+    dft::descriptor<precision_of<fp>(), dft::domain::COMPLEX> desc(n);
+    desc.set_value(dft::config_param::PLACEMENT, dft::config_value::INPLACE);
+    desc.set_value(dft::config_param::NUMBER_OF_TRANSFORMS, batch);
+    desc.set_value(dft::config_param::FWD_DISTANCE, n);
+    desc.set_value(dft::config_param::BWD_DISTANCE, n);
+
+    auto run = [&] {
+        dft::compute_forward(desc, data.data());
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, [&] {
+            commit(desc, queue);
+            run();
+        }))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, 5.0 * n * std::log2(static_cast<double>(n)) * batch);
+    bench_set_bytes(state, 2.0 * sizeof(std::complex<fp>) * n * batch);
+}
+
+// batch out-of-place real forward transforms of length n into n / 2 + 1 complex values
+template <typename fp>
+void real_forward(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0), batch = state.range(1);
+    const std::int64_t n_complex = n / 2 + 1;
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> in(queue, n * batch, -1.0, 1.0);
+    device_vector<std::complex<fp>> out(queue, n_complex * batch);
+
+    dft::descriptor<precision_of<fp>(), dft::domain::REAL> desc(n);
+    desc.set_value(dft::config_param::PLACEMENT, dft::config_value::NOT_INPLACE);
+    desc.set_value(dft::config_param::CONJUGATE_EVEN_STORAGE, dft::config_value::COMPLEX_COMPLEX);
+    desc.set_value(dft::config_param::NUMBER_OF_TRANSFORMS, batch);
+    desc.set_value(dft::config_param::FWD_DISTANCE, n);
+    desc.set_value(dft::config_param::BWD_DISTANCE, n_complex);
+
+    auto run = [&] {
+        dft::compute_forward(desc, in.data(), out.data());
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, [&] {
+            commit(desc, queue);
+            run();
+        }))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_flops(state, 2.5 * n * std::log2(static_cast<double>(n)) * batch);
+    bench_set_bytes(state, (sizeof(fp) * n + sizeof(std::complex<fp>) * n_complex) * batch);
+}
+
+// Large single transforms and batches of small ones
+template <typename fp, typename Bench>
+void register_dft(sycl::device* dev, const char* routine, Bench bench) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, routine).c_str(), bench, dev)
+        ->Args({ 64, 16384 })
+        ->Args({ 1024, 1024 })
+        ->Args({ 4096, 256 })
+        ->Args({ 1 << 16, 16 })
+        ->Args({ 1 << 20, 1 })
+        ->Args({ 1 << 22, 1 })
+        ->ArgNames({ "n", "batch" })
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+void register_dft_benchmarks(sycl::device* dev) {
+    register_dft<float>(dev, "dft/complex_forward", complex_forward<float>);
+    register_dft<double>(dev, "dft/complex_forward", complex_forward<double>);
+    register_dft<float>(dev, "dft/real_forward", real_forward<float>);
+    register_dft<double>(dev, "dft/real_forward", real_forward<double>);
+}
+
+BENCH_REGISTER(register_dft_benchmarks);
+
+} // anonymous namespace
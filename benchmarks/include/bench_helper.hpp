@@ -0,0 +1,244 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BENCH_HELPER_HPP_
+#define _BENCH_HELPER_HPP_
+
+#include <cctype>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "oneapi/math.hpp"
+// The compile-time backend selection is shared with the unit tests so that both pick the same
+// backend for a device
+#include "test_helper.hpp"
+
+// Calls a oneMath function through the run-time dispatcher or through the compile-time backend
+// enabled for the queue's device. DOMAIN is the suffix of the TEST_RUN_<DOMAIN>_CT_SELECT macro.
+#ifdef CALL_RT_API
+#define BENCH_CALL(DOMAIN, q, func, ...) func(q, __VA_ARGS__)
+#define BENCH_DISPATCH                   "run-time"
+#else
+#define BENCH_CALL(DOMAIN, q, func, ...) TEST_RUN_##DOMAIN##_CT_SELECT(q, func, __VA_ARGS__)
+#define BENCH_DISPATCH                   "compile-time"
+#endif
+
+// Every benchmark source registers a function that adds its benchmarks for one device; main calls
+// them for each device selected for the run.
+using bench_registration = void (*)(sycl::device* dev);
+
+std::vector<bench_registration>& bench_registrations();
+
+#define BENCH_REGISTER(fn) \
+    static const bool fn##_registered = (bench_registrations().push_back(fn), true)
+
+template <typename T>
+struct bench_real {
+    using type = T;
+    static constexpr bool is_complex = false;
+};
+template <typename T>
+struct bench_real<std::complex<T>> {
+    using type = T;
+    static constexpr bool is_complex = true;
+};
+template <typename T>
+using bench_real_t = typename bench_real<T>::type;
+
+template <typename T>
+struct bench_type_name;
+template <>
+struct bench_type_name<float> {
+    static constexpr const char* value = "float";
+};
+template <>
+struct bench_type_name<double> {
+    static constexpr const char* value = "double";
+};
+template <>
+struct bench_type_name<std::complex<float>> {
+    static constexpr const char* value = "complex<float>";
+};
+template <>
+struct bench_type_name<std::complex<double>> {
+    static constexpr const char* value = "complex<double>";
+};
+template <>
+struct bench_type_name<std::int32_t> {
+    static constexpr const char* value = "int32";
+};
+template <>
+struct bench_type_name<std::uint32_t> {
+    static constexpr const char* value = "uint32";
+};
+
+// Benchmark names read <domain>/<routine><<type>>/<device>/<arguments...>
+inline std::string bench_name(sycl::device* dev, const std::string& routine,
+                              const std::string& type) {
+    std::string dev_name = dev->get_info<sycl::info::device::name>();
+    for (auto& c : dev_name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)))
+            c = '_';
+    }
+    return routine + (type.empty() ? "" : "<" + type + ">") + "/" + dev_name;
+}
+
+template <typename T>
+std::string bench_name(sycl::device* dev, const std::string& routine) {
+    return bench_name(dev, routine, bench_type_name<T>::value);
+}
+
+inline bool bench_double_supported(sycl::device* dev) {
+    return dev->get_info<sycl::info::device::double_fp_config>().size() != 0;
+}
+
+template <typename T>
+bool bench_type_supported(sycl::device* dev) {
+    if constexpr (std::is_same_v<bench_real_t<T>, double>) {
+        return bench_double_supported(dev);
+    }
+    else {
+        return true;
+    }
+}
+
+inline auto bench_exception_handler() {
+    return [](sycl::exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (sycl::exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception:\n" << e.what() << std::endl;
+            }
+        }
+    };
+}
+
+// Device allocation filled with values drawn from [lower, upper) on the host
+template <typename T>
+class device_vector {
+public:
+    device_vector(sycl::queue& queue, std::int64_t n) : queue_(queue), n_(n) {
+        data_ = sycl::malloc_device<T>(n_ == 0 ? 1 : n_, queue_);
+    }
+
+    device_vector(sycl::queue& queue, std::int64_t n, double lower, double upper)
+            : device_vector(queue, n) {
+        std::vector<T> host(n_);
+        std::mt19937 generator(777);
+        std::uniform_real_distribution<double> distribution(lower, upper);
+        for (auto& x : host) {
+            if constexpr (bench_real<T>::is_complex) {
+                using fp_real = bench_real_t<T>;
+                fp_real re = static_cast<fp_real>(distribution(generator));
+                x = T(re, static_cast<fp_real>(distribution(generator)));
+            }
+            else {
+                x = static_cast<T>(distribution(generator));
+            }
+        }
+        copy_from(host);
+    }
+
+    device_vector(const device_vector&) = delete;
+    device_vector& operator=(const device_vector&) = delete;
+
+    ~device_vector() {
+        sycl::free(data_, queue_);
+    }
+
+    void copy_from(const std::vector<T>& host) {
+        queue_.copy(host.data(), data_, n_).wait();
+    }
+
+    void copy_from(const device_vector& other) {
+        queue_.copy(other.data_, data_, n_).wait();
+    }
+
+    T* data() {
+        return data_;
+    }
+
+    std::int64_t size() const {
+        return n_;
+    }
+
+private:
+    sycl::queue& queue_;
+    std::int64_t n_;
+    T* data_;
+};
+
+// Runs the call once outside of the timed loop. Returns false and marks the benchmark as skipped
+// when the backend does not implement it or the call fails.
+template <typename Run>
+bool bench_warmup(benchmark::State& state, Run&& run) {
+    try {
+        run();
+    }
+    catch (const oneapi::math::unimplemented& e) {
+        state.SkipWithError((std::string("unimplemented: ") + e.what()).c_str());
+        return false;
+    }
+    catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return false;
+    }
+    return true;
+}
+
+// Real operations in one multiply-add on T
+template <typename T>
+constexpr double bench_fma_flops() {
+    return bench_real<T>::is_complex ? 8.0 : 2.0;
+}
+
+// Report the floating-point operations, bytes moved and samples produced by one iteration as
+// rates: FLOPS is shown in GFLOP/s for large problems, bytes_per_second and items_per_second are
+// the usual Google Benchmark counters.
+inline void bench_set_flops(benchmark::State& state, double flops) {
+    state.counters["FLOPS"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+inline void bench_set_bytes(benchmark::State& state, double bytes) {
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(bytes * static_cast<double>(state.iterations())));
+}
+
+inline void bench_set_samples(benchmark::State& state, double samples) {
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(samples * static_cast<double>(state.iterations())));
+}
+
+#endif // _BENCH_HELPER_HPP_
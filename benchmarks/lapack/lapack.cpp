@@ -0,0 +1,186 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+namespace lapack = oneapi::math::lapack;
+using oneapi::math::uplo;
+
+// Hermitian positive definite n x n matrix: random entries in [-1, 1) with n added to the diagonal
+template <typename fp>
+std::vector<fp> hpd_matrix(std::int64_t n) {
+    std::vector<fp> a(n * n);
+    std::mt19937 generator(777);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = j; i < n; i++) {
+            fp value = static_cast<fp>(distribution(generator));
+            if constexpr (bench_real<fp>::is_complex) {
+                if (i != j)
+                    value += fp(0, static_cast<bench_real_t<fp>>(distribution(generator)));
+            }
+            if (i == j)
+                value += fp(static_cast<bench_real_t<fp>>(n));
+            a[i + j * n] = value;
+            if constexpr (bench_real<fp>::is_complex) {
+                a[j + i * n] = std::conj(value);
+            }
+            else {
+                a[j + i * n] = value;
+            }
+        }
+    }
+    return a;
+}
+
+// Every factorization works in place, so the matrix is restored from a pristine copy before each
+// iteration with the timer paused
+template <typename fp, typename Factor>
+void run_factorization(benchmark::State& state, sycl::queue& queue, device_vector<fp>& a,
+                       device_vector<fp>& a0, Factor&& factor) {
+    auto run = [&] {
+        factor();
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        state.PauseTiming();
+        a.copy_from(a0);
+        state.ResumeTiming();
+        run();
+    }
+}
+
+// LU factorization with partial pivoting of an n x n matrix
+template <typename fp>
+void getrf(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a0(queue, n * n, -1.0, 1.0), a(queue, n * n);
+    device_vector<std::int64_t> ipiv(queue, n);
+    a.copy_from(a0);
+
+    std::int64_t scratchpad_size = 0;
+    if (!bench_warmup(state, [&] {
+            BENCH_CALL(LAPACK, queue, scratchpad_size = lapack::getrf_scratchpad_size<fp>, n, n,
+                       n);
+        }))
+        return;
+    device_vector<fp> scratchpad(queue, scratchpad_size);
+
+    run_factorization(state, queue, a, a0, [&] {
+        BENCH_CALL(LAPACK, queue, lapack::getrf, n, n, a.data(), n, ipiv.data(),
+                   scratchpad.data(), scratchpad_size);
+    });
+    bench_set_flops(state, bench_fma_flops<fp>() / 2.0 * (2.0 / 3.0) * n * n * n);
+    bench_set_bytes(state, 2.0 * sizeof(fp) * n * n);
+}
+
+// Cholesky factorization of an n x n Hermitian positive definite matrix
+template <typename fp>
+void potrf(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a0(queue, n * n), a(queue, n * n);
+    a0.copy_from(hpd_matrix<fp>(n));
+    a.copy_from(a0);
+
+    std::int64_t scratchpad_size = 0;
+    if (!bench_warmup(state, [&] {
+            BENCH_CALL(LAPACK, queue, scratchpad_size = lapack::potrf_scratchpad_size<fp>,
+                       uplo::lower, n, n);
+        }))
+        return;
+    device_vector<fp> scratchpad(queue, scratchpad_size);
+
+    run_factorization(state, queue, a, a0, [&] {
+        BENCH_CALL(LAPACK, queue, lapack::potrf, uplo::lower, n, a.data(), n, scratchpad.data(),
+                   scratchpad_size);
+    });
+    bench_set_flops(state, bench_fma_flops<fp>() / 2.0 * (1.0 / 3.0) * n * n * n);
+    bench_set_bytes(state, sizeof(fp) * n * n);
+}
+
+// QR factorization of an m x n matrix with m = 2 n
+template <typename fp>
+void geqrf(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t n = state.range(0), m = 2 * n;
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a0(queue, m * n, -1.0, 1.0), a(queue, m * n), tau(queue, n);
+    a.copy_from(a0);
+
+    std::int64_t scratchpad_size = 0;
+    if (!bench_warmup(state, [&] {
+            BENCH_CALL(LAPACK, queue, scratchpad_size = lapack::geqrf_scratchpad_size<fp>, m, n,
+                       m);
+        }))
+        return;
+    device_vector<fp> scratchpad(queue, scratchpad_size);
+
+    run_factorization(state, queue, a, a0, [&] {
+        BENCH_CALL(LAPACK, queue, lapack::geqrf, m, n, a.data(), m, tau.data(), scratchpad.data(),
+                   scratchpad_size);
+    });
+    bench_set_flops(state, bench_fma_flops<fp>() * n * n * (m - n / 3.0));
+    bench_set_bytes(state, 2.0 * sizeof(fp) * m * n);
+}
+
+template <typename fp, typename Bench>
+void register_lapack(sycl::device* dev, const char* routine, Bench bench) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, routine).c_str(), bench, dev)
+        ->RangeMultiplier(2)
+        ->Range(64, 8192)
+        ->ArgName("n")
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+}
+
+template <typename fp>
+void register_factorizations(sycl::device* dev) {
+    register_lapack<fp>(dev, "lapack/getrf", getrf<fp>);
+    register_lapack<fp>(dev, "lapack/potrf", potrf<fp>);
+    register_lapack<fp>(dev, "lapack/geqrf", geqrf<fp>);
+}
+
+void register_lapack_benchmarks(sycl::device* dev) {
+    register_factorizations<float>(dev);
+    register_factorizations<double>(dev);
+    register_factorizations<std::complex<float>>(dev);
+    register_factorizations<std::complex<double>>(dev);
+}
+
+BENCH_REGISTER(register_lapack_benchmarks);
+
+} // anonymous namespace
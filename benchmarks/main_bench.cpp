@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "bench_helper.hpp"
+#include "oneapi/math/detail/config.hpp"
+
+std::vector<bench_registration>& bench_registrations() {
+    static std::vector<bench_registration> registrations;
+    return registrations;
+}
+
+void print_error_code(sycl::exception const& e) {
+#ifdef __HIPSYCL__
+    std::cout << "Backend status: " << e.code() << std::endl;
+#else
+    std::cout << "OpenCL status: " << e.code() << std::endl;
+#endif
+}
+
+// Selects the devices the same way as the unit tests: one device per name, skipping the devices
+// that no enabled backend supports
+static std::list<sycl::device> select_devices() {
+    std::set<std::string> unique_devices;
+    std::list<sycl::device> devices;
+
+    for (auto plat : sycl::platform::get_platforms()) {
+        for (auto dev : plat.get_devices()) {
+            try {
+                unsigned int vendor_id =
+                    static_cast<unsigned int>(dev.get_info<sycl::info::device::vendor_id>());
+                /* Do not benchmark the OpenCL backend on Intel GPU */
+                if (dev.is_gpu() &&
+                    plat.get_info<sycl::info::platform::name>().find("OpenCL") !=
+                        std::string::npos &&
+                    vendor_id == INTEL_ID)
+                    continue;
+                if (!unique_devices.insert(dev.get_info<sycl::info::device::name>()).second)
+                    continue;
+#if !defined(ONEMATH_ENABLE_MKLCPU_BACKEND) &&                                             \
+    !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_INTEL_CPU) &&                             \
+    !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) && !defined(ONEMATH_ENABLE_NETLIB_BACKEND) && \
+    !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
+                if (dev.is_cpu())
+                    continue;
+#endif
+#if !defined(ONEMATH_ENABLE_MKLGPU_BACKEND) &&                 \
+    !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_INTEL_GPU) && \
+    !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) && !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
+                if (dev.is_gpu() && vendor_id == INTEL_ID)
+                    continue;
+#endif
+#if !defined(ONEMATH_ENABLE_CUBLAS_BACKEND) && !defined(ONEMATH_ENABLE_CURAND_BACKEND) && \
+    !defined(ONEMATH_ENABLE_CUSOLVER_BACKEND) &&                                          \
+    !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_NVIDIA_GPU) &&                           \
+    !defined(ONEMATH_ENABLE_CUFFT_BACKEND) && !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) && \
+    !defined(ONEMATH_ENABLE_CUSPARSE_BACKEND) && !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
+                if (dev.is_gpu() && vendor_id == NVIDIA_ID)
+                    continue;
+#endif
+#if !defined(ONEMATH_ENABLE_ROCBLAS_BACKEND) && !defined(ONEMATH_ENABLE_ROCRAND_BACKEND) && \
+    !defined(ONEMATH_ENABLE_ROCSOLVER_BACKEND) &&                                           \
+    !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_AMD_GPU) &&                                \
+    !defined(ONEMATH_ENABLE_ROCFFT_BACKEND) && !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) &&  \
+    !defined(ONEMATH_ENABLE_ROCSPARSE_BACKEND) && !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
+                if (dev.is_gpu() && vendor_id == AMD_ID)
+                    continue;
+#endif
+                if (!dev.is_accelerator())
+                    devices.push_back(dev);
+            }
+            catch (std::exception const& e) {
+                std::cout << "Exception while accessing device: " << e.what() << "\n";
+            }
+        }
+    }
+    return devices;
+}
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    auto devices = select_devices();
+    std::string device_names;
+    for (auto& dev : devices) {
+        for (auto registration : bench_registrations()) {
+            registration(&dev);
+        }
+        device_names += (device_names.empty() ? "" : ", ") +
+                        dev.get_info<sycl::info::device::name>();
+    }
+
+    // Recorded in the context of the JSON output so that runs can be told apart when comparing
+    // releases
+    benchmark::AddCustomContext("onemath_dispatch", BENCH_DISPATCH);
+    benchmark::AddCustomContext("onemath_devices", device_names);
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
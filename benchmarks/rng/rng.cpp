@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <memory>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+namespace rng = oneapi::math::rng;
+
+// Generates n samples of Distr with Engine into device memory; reported as samples per second and
+// bytes written per second
+template <typename Engine, typename Distr>
+void generate(benchmark::State& state, sycl::device* dev) {
+    using result_type = typename Distr::result_type;
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<result_type> r(queue, n);
+
+    std::unique_ptr<Engine> engine;
+    auto make_engine = [&](auto selector, std::uint32_t seed) {
+        engine = std::make_unique<Engine>(selector, seed);
+    };
+    const Distr distr{};
+
+    auto run = [&] {
+        rng::generate(distr, *engine, n, r.data());
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, [&] {
+            BENCH_CALL(RNG, queue, make_engine, 777);
+            if (!engine)
+                throw oneapi::math::unimplemented("rng", "engine", "no backend for the device");
+            run();
+        }))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_samples(state, static_cast<double>(n));
+    bench_set_bytes(state, static_cast<double>(sizeof(result_type)) * n);
+}
+
+template <typename Engine, typename Distr>
+void register_generate(sycl::device* dev, const char* engine, const char* distr) {
+    if (!bench_type_supported<typename Distr::result_type>(dev))
+        return;
+    const std::string routine = std::string("rng/") + engine + "/" + distr;
+    benchmark::RegisterBenchmark(
+        bench_name<typename Distr::result_type>(dev, routine).c_str(), generate<Engine, Distr>, dev)
+        ->RangeMultiplier(16)
+        ->Range(1 << 12, 1 << 26)
+        ->ArgName("n")
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+template <typename Engine>
+void register_engine(sycl::device* dev, const char* engine) {
+    register_generate<Engine, rng::uniform<float>>(dev, engine, "uniform");
+    register_generate<Engine, rng::uniform<double>>(dev, engine, "uniform");
+    register_generate<Engine, rng::uniform<std::int32_t>>(dev, engine, "uniform");
+    register_generate<Engine, rng::gaussian<float>>(dev, engine, "gaussian");
+    register_generate<Engine, rng::gaussian<double>>(dev, engine, "gaussian");
+    register_generate<Engine, rng::lognormal<float>>(dev, engine, "lognormal");
+    register_generate<Engine, rng::exponential<float>>(dev, engine, "exponential");
+    register_generate<Engine, rng::bernoulli<std::int32_t>>(dev, engine, "bernoulli");
+    register_generate<Engine, rng::poisson<std::int32_t>>(dev, engine, "poisson");
+    register_generate<Engine, rng::bits<std::uint32_t>>(dev, engine, "bits");
+}
+
+void register_rng_benchmarks(sycl::device* dev) {
+    register_engine<rng::philox4x32x10>(dev, "philox4x32x10");
+    register_engine<rng::mrg32k3a>(dev, "mrg32k3a");
+}
+
+BENCH_REGISTER(register_rng_benchmarks);
+
+} // anonymous namespace
@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+namespace sparse = oneapi::math::sparse;
+using oneapi::math::transpose;
+
+// CSR matrix of the 27-point stencil on an nx x nx x nx grid, the matrix of the sparse examples
+template <typename fp>
+struct stencil_matrix {
+    std::int64_t nrows;
+    std::vector<std::int32_t> ia, ja;
+    std::vector<fp> a;
+
+    explicit stencil_matrix(std::int64_t nx) : nrows(nx * nx * nx) {
+        ia.reserve(nrows + 1);
+        ja.reserve(27 * nrows);
+        a.reserve(27 * nrows);
+        ia.push_back(0);
+        for (std::int64_t iz = 0; iz < nx; iz++) {
+            for (std::int64_t iy = 0; iy < nx; iy++) {
+                for (std::int64_t ix = 0; ix < nx; ix++) {
+                    const std::int64_t row = (iz * nx + iy) * nx + ix;
+                    for (std::int64_t sz = -1; sz <= 1; sz++) {
+                        for (std::int64_t sy = -1; sy <= 1; sy++) {
+                            for (std::int64_t sx = -1; sx <= 1; sx++) {
+                                if (iz + sz < 0 || iz + sz >= nx || iy + sy < 0 ||
+                                    iy + sy >= nx || ix + sx < 0 || ix + sx >= nx)
+                                    continue;
+                                const std::int64_t col = row + (sz * nx + sy) * nx + sx;
+                                ja.push_back(static_cast<std::int32_t>(col));
+                                a.push_back(col == row ? fp(26) : fp(-1));
+                            }
+                        }
+                    }
+                    ia.push_back(static_cast<std::int32_t>(ja.size()));
+                }
+            }
+        }
+    }
+
+    std::int64_t nnz() const {
+        return static_cast<std::int64_t>(ja.size());
+    }
+};
+
+// Device copy of a stencil matrix behind a CSR handle
+template <typename fp>
+struct device_csr {
+    stencil_matrix<fp> host;
+    device_vector<std::int32_t> ia, ja;
+    device_vector<fp> a;
+    sparse::matrix_handle_t handle = nullptr;
+
+    device_csr(sycl::queue& queue, std::int64_t nx)
+            : host(nx),
+              ia(queue, host.nrows + 1),
+              ja(queue, host.nnz()),
+              a(queue, host.nnz()) {
+        ia.copy_from(host.ia);
+        ja.copy_from(host.ja);
+        a.copy_from(host.a);
+        BENCH_CALL(SPARSE, queue, sparse::init_csr_matrix, &handle, host.nrows, host.nrows,
+                   host.nnz(), oneapi::math::index_base::zero, ia.data(), ja.data(), a.data());
+        BENCH_CALL(SPARSE, queue, sparse::set_matrix_property, handle,
+                   sparse::matrix_property::sorted);
+    }
+};
+
+// y = A * x with A the stencil matrix on an nx^3 grid
+template <typename fp>
+void spmv(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t nx = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    const fp alpha(1), beta(0);
+    sparse::matrix_view A_view;
+    const sparse::spmv_alg alg = sparse::spmv_alg::default_alg;
+
+    std::unique_ptr<device_csr<fp>> A;
+    std::unique_ptr<device_vector<fp>> x, y;
+    sparse::dense_vector_handle_t x_handle = nullptr, y_handle = nullptr;
+    sparse::spmv_descr_t descr = nullptr;
+    void* workspace = nullptr;
+
+    auto run = [&] {
+        BENCH_CALL(SPARSE, queue, sparse::spmv, transpose::nontrans, &alpha, A_view, A->handle,
+                   x_handle, &beta, y_handle, alg, descr);
+        queue.wait_and_throw();
+    };
+    const bool ready = bench_warmup(state, [&] {
+        A = std::make_unique<device_csr<fp>>(queue, nx);
+        const std::int64_t n = A->host.nrows;
+        x = std::make_unique<device_vector<fp>>(queue, n, -1.0, 1.0);
+        y = std::make_unique<device_vector<fp>>(queue, n);
+        BENCH_CALL(SPARSE, queue, sparse::init_dense_vector, &x_handle, n, x->data());
+        BENCH_CALL(SPARSE, queue, sparse::init_dense_vector, &y_handle, n, y->data());
+        BENCH_CALL(SPARSE, queue, sparse::init_spmv_descr, &descr);
+        std::size_t workspace_size = 0;
+        BENCH_CALL(SPARSE, queue, sparse::spmv_buffer_size, transpose::nontrans, &alpha, A_view,
+                   A->handle, x_handle, &beta, y_handle, alg, descr, workspace_size);
+        workspace = sycl::malloc_device(workspace_size == 0 ? 1 : workspace_size, queue);
+        BENCH_CALL(SPARSE, queue, sparse::spmv_optimize, transpose::nontrans, &alpha, A_view,
+                   A->handle, x_handle, &beta, y_handle, alg, descr, workspace);
+        run();
+    });
+    if (ready) {
+        for (auto _ : state) {
+            run();
+        }
+        const double nnz = static_cast<double>(A->host.nnz());
+        bench_set_flops(state, 2.0 * nnz);
+        bench_set_bytes(state, (sizeof(fp) + sizeof(std::int32_t)) * nnz +
+                                   (sizeof(std::int32_t) + 2.0 * sizeof(fp)) * A->host.nrows);
+    }
+
+    if (descr)
+        BENCH_CALL(SPARSE, queue, sparse::release_spmv_descr, descr);
+    if (x_handle)
+        BENCH_CALL(SPARSE, queue, sparse::release_dense_vector, x_handle);
+    if (y_handle)
+        BENCH_CALL(SPARSE, queue, sparse::release_dense_vector, y_handle);
+    if (A && A->handle)
+        BENCH_CALL(SPARSE, queue, sparse::release_sparse_matrix, A->handle);
+    queue.wait();
+    if (workspace)
+        sycl::free(workspace, queue);
+}
+
+// C = A * B with A the stencil matrix on an nx^3 grid and B dense with ncols columns
+template <typename fp>
+void spmm(benchmark::State& state, sycl::device* dev) {
+    const std::int64_t nx = state.range(0), ncols = state.range(1);
+    sycl::queue queue(*dev, bench_exception_handler());
+    const fp alpha(1), beta(0);
+    sparse::matrix_view A_view;
+    const sparse::spmm_alg alg = sparse::spmm_alg::default_alg;
+    const auto layout = oneapi::math::layout::col_major;
+
+    std::unique_ptr<device_csr<fp>> A;
+    std::unique_ptr<device_vector<fp>> B, C;
+    sparse::dense_matrix_handle_t B_handle = nullptr, C_handle = nullptr;
+    sparse::spmm_descr_t descr = nullptr;
+    void* workspace = nullptr;
+
+    auto run = [&] {
+        BENCH_CALL(SPARSE, queue, sparse::spmm, transpose::nontrans, transpose::nontrans, &alpha,
+                   A_view, A->handle, B_handle, &beta, C_handle, alg, descr);
+        queue.wait_and_throw();
+    };
+    const bool ready = bench_warmup(state, [&] {
+        A = std::make_unique<device_csr<fp>>(queue, nx);
+        const std::int64_t n = A->host.nrows;
+        B = std::make_unique<device_vector<fp>>(queue, n * ncols, -1.0, 1.0);
+        C = std::make_unique<device_vector<fp>>(queue, n * ncols);
+        BENCH_CALL(SPARSE, queue, sparse::init_dense_matrix, &B_handle, n, ncols, n, layout,
+                   B->data());
+        BENCH_CALL(SPARSE, queue, sparse::init_dense_matrix, &C_handle, n, ncols, n, layout,
+                   C->data());
+        BENCH_CALL(SPARSE, queue, sparse::init_spmm_descr, &descr);
+        std::size_t workspace_size = 0;
+        BENCH_CALL(SPARSE, queue, sparse::spmm_buffer_size, transpose::nontrans,
+                   transpose::nontrans, &alpha, A_view, A->handle, B_handle, &beta, C_handle, alg,
+                   descr, workspace_size);
+        workspace = sycl::malloc_device(workspace_size == 0 ? 1 : workspace_size, queue);
+        BENCH_CALL(SPARSE, queue, sparse::spmm_optimize, transpose::nontrans, transpose::nontrans,
+                   &alpha, A_view, A->handle, B_handle, &beta, C_handle, alg, descr, workspace);
+        run();
+    });
+    if (ready) {
+        for (auto _ : state) {
+            run();
+        }
+        const double nnz = static_cast<double>(A->host.nnz());
+        bench_set_flops(state, 2.0 * nnz * ncols);
+        bench_set_bytes(state, (sizeof(fp) + sizeof(std::int32_t)) * nnz +
+                                   2.0 * sizeof(fp) * A->host.nrows * ncols);
+    }
+
+    if (descr)
+        BENCH_CALL(SPARSE, queue, sparse::release_spmm_descr, descr);
+    if (B_handle)
+        BENCH_CALL(SPARSE, queue, sparse::release_dense_matrix, B_handle);
+    if (C_handle)
+        BENCH_CALL(SPARSE, queue, sparse::release_dense_matrix, C_handle);
+    if (A && A->handle)
+        BENCH_CALL(SPARSE, queue, sparse::release_sparse_matrix, A->handle);
+    queue.wait();
+    if (workspace)
+        sycl::free(workspace, queue);
+}
+
+template <typename fp>
+void register_sparse(sycl::device* dev) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, "sparse_blas/spmv").c_str(), spmv<fp>, dev)
+        ->Arg(16)
+        ->Arg(32)
+        ->Arg(64)
+        ->Arg(128)
+        ->ArgName("nx")
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(bench_name<fp>(dev, "sparse_blas/spmm").c_str(), spmm<fp>, dev)
+        ->ArgsProduct({ { 16, 32, 64 }, { 8, 64 } })
+        ->ArgNames({ "nx", "ncols" })
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+}
+
+void register_sparse_blas_benchmarks(sycl::device* dev) {
+    register_sparse<float>(dev);
+    register_sparse<double>(dev);
+}
+
+BENCH_REGISTER(register_sparse_blas_benchmarks);
+
+} // anonymous namespace
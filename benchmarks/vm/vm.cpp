@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "bench_helper.hpp"
+
+namespace {
+
+namespace vm = oneapi::math::vm;
+
+#ifdef CALL_RT_API
+#define VM_BENCH_FUNCTION(func)                            \
+    [](sycl::queue& queue, std::int64_t n, auto... args) { \
+        func(queue, n, args...);                           \
+    }
+#else
+#define VM_BENCH_FUNCTION(func)                            \
+    [](sycl::queue& queue, std::int64_t n, auto... args) { \
+        TEST_RUN_VM_CT_SELECT(queue, func, n, args...);    \
+    }
+#endif
+
+// y = f(a) on n elements drawn from [lower, upper) in the given accuracy mode
+template <typename fp, typename Function>
+void unary(benchmark::State& state, sycl::device* dev, vm::mode mode, double lower, double upper,
+           Function function) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, n, lower, upper), y(queue, n);
+
+    auto run = [&] {
+        function(queue, n, static_cast<const fp*>(a.data()), y.data(),
+                 std::vector<sycl::event>{}, mode);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_samples(state, static_cast<double>(n));
+    bench_set_bytes(state, 2.0 * sizeof(fp) * n);
+}
+
+// y = f(a, b) on n element pairs drawn from [lower, upper) in the given accuracy mode
+template <typename fp, typename Function>
+void binary(benchmark::State& state, sycl::device* dev, vm::mode mode, double lower,
+            double upper, Function function) {
+    const std::int64_t n = state.range(0);
+    sycl::queue queue(*dev, bench_exception_handler());
+    device_vector<fp> a(queue, n, lower, upper), b(queue, n, lower, upper), y(queue, n);
+
+    auto run = [&] {
+        function(queue, n, static_cast<const fp*>(a.data()), static_cast<const fp*>(b.data()),
+                 y.data(), std::vector<sycl::event>{}, mode);
+        queue.wait_and_throw();
+    };
+    if (!bench_warmup(state, run))
+        return;
+    for (auto _ : state) {
+        run();
+    }
+    bench_set_samples(state, static_cast<double>(n));
+    bench_set_bytes(state, 3.0 * sizeof(fp) * n);
+}
+
+template <typename fp, int arity, typename Function>
+void register_vm(sycl::device* dev, const char* routine, double lower, double upper,
+                 Function function) {
+    if (!bench_type_supported<fp>(dev))
+        return;
+    for (auto [mode, mode_name] : { std::pair{ vm::mode::ha, "ha" },
+                                    std::pair{ vm::mode::la, "la" },
+                                    std::pair{ vm::mode::ep, "ep" } }) {
+        const std::string name = bench_name<fp>(dev, std::string(routine) + "/" + mode_name);
+        auto bench = [=, mode = mode](benchmark::State& state) {
+            if constexpr (arity == 1)
+                unary<fp>(state, dev, mode, lower, upper, function);
+            else
+                binary<fp>(state, dev, mode, lower, upper, function);
+        };
+        benchmark::RegisterBenchmark(name.c_str(), bench)
+            ->RangeMultiplier(16)
+            ->Range(1 << 10, 1 << 26)
+            ->ArgName("n")
+            ->UseRealTime()
+            ->Unit(benchmark::kMicrosecond);
+    }
+}
+
+template <typename fp>
+void register_vm_type(sycl::device* dev) {
+    register_vm<fp, 1>(dev, "vm/exp", -20.0, 20.0, VM_BENCH_FUNCTION(vm::exp));
+    register_vm<fp, 1>(dev, "vm/log", 0.1, 100.0, VM_BENCH_FUNCTION(vm::log));
+    register_vm<fp, 1>(dev, "vm/erf", -5.0, 5.0, VM_BENCH_FUNCTION(vm::erf));
+    register_vm<fp, 2>(dev, "vm/pow", 0.1, 10.0, VM_BENCH_FUNCTION(vm::pow));
+}
+
+void register_vm_benchmarks(sycl::device* dev) {
+    register_vm_type<float>(dev);
+    register_vm_type<double>(dev);
+}
+
+BENCH_REGISTER(register_vm_benchmarks);
+
+} // anonymous namespace
@@ -27,5 +27,6 @@
 #include "oneapi/math/lapack.hpp"
 #include "oneapi/math/rng.hpp"
 #include "oneapi/math/sparse_blas.hpp"
+#include "oneapi/math/vm.hpp"
 
 #endif //_ONEMATH_HPP_
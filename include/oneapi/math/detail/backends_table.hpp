@@ -41,7 +41,7 @@ namespace oneapi {
 namespace math {
 
 enum class device : uint16_t { x86cpu, intelgpu, nvidiagpu, amdgpu, generic_device };
-enum class domain : uint16_t { blas, dft, lapack, rng, sparse_blas };
+enum class domain : uint16_t { blas, dft, lapack, rng, sparse_blas, vm };
 
 static std::map<domain, std::map<device, std::vector<const char*>>> libraries = {
     { domain::blas,
@@ -210,6 +210,44 @@ static std::map<domain, std::map<device, std::vector<const char*>>> libraries =
           {
 #ifdef ONEMATH_ENABLE_ROCSPARSE_BACKEND
               LIB_NAME("sparse_blas_rocsparse")
+#endif
+          } } } },
+
+    { domain::vm,
+      { { device::x86cpu,
+          {
+#ifdef ONEMATH_ENABLE_MKLCPU_BACKEND
+              LIB_NAME("vm_mklcpu"),
+#endif
+#ifdef ONEMATH_ENABLE_GENERIC_VM_BACKEND
+              LIB_NAME("vm_generic"),
+#endif
+          } },
+        { device::intelgpu,
+          {
+#ifdef ONEMATH_ENABLE_MKLGPU_BACKEND
+              LIB_NAME("vm_mklgpu"),
+#endif
+#ifdef ONEMATH_ENABLE_GENERIC_VM_BACKEND
+              LIB_NAME("vm_generic"),
+#endif
+          } },
+        { device::amdgpu,
+          {
+#ifdef ONEMATH_ENABLE_GENERIC_VM_BACKEND
+              LIB_NAME("vm_generic"),
+#endif
+          } },
+        { device::nvidiagpu,
+          {
+#ifdef ONEMATH_ENABLE_GENERIC_VM_BACKEND
+              LIB_NAME("vm_generic"),
+#endif
+          } },
+        { device::generic_device,
+          {
+#ifdef ONEMATH_ENABLE_GENERIC_VM_BACKEND
+              LIB_NAME("vm_generic"),
 #endif
           } } } },
 };
@@ -219,7 +257,8 @@ static std::map<domain, const char*> table_names = { { domain::blas, "onemath_bl
                                                      { domain::dft, "onemath_dft_table" },
                                                      { domain::rng, "onemath_rng_table" },
                                                      { domain::sparse_blas,
-                                                       "onemath_sparse_blas_table" } };
+                                                       "onemath_sparse_blas_table" },
+                                                     { domain::vm, "onemath_vm_table" } };
 
 } //namespace math
 } //namespace oneapi
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_DISPATCH_PROFILER_HPP_
+#define _ONEMATH_DISPATCH_PROFILER_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "oneapi/math/detail/config.hpp"
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+// Layers a oneMath call goes through before its kernels are enqueued
+enum class dispatch_stage : std::size_t {
+    get_device_id, // device lookup of the run-time API
+    table_lookup, // function table lookup of the loader
+    argument_conversion, // conversion of the arguments to the backend types
+    submit, // backend call up to the return of the submission
+    count
+};
+
+inline const char* dispatch_stage_name(dispatch_stage stage) {
+    switch (stage) {
+        case dispatch_stage::get_device_id: return "get_device_id";
+        case dispatch_stage::table_lookup: return "table_lookup";
+        case dispatch_stage::argument_conversion: return "argument_conversion";
+        case dispatch_stage::submit: return "submit";
+        default: return "unknown";
+    }
+}
+
+struct dispatch_stage_stats {
+    std::uint64_t calls = 0;
+    std::uint64_t nanoseconds = 0;
+};
+
+using dispatch_profile =
+    std::array<dispatch_stage_stats, static_cast<std::size_t>(dispatch_stage::count)>;
+
+#ifdef ONEMATH_ENABLE_DISPATCH_PROFILING
+constexpr bool dispatch_profiling_enabled = true;
+#else
+constexpr bool dispatch_profiling_enabled = false;
+#endif
+
+// Time accumulated by the calls made from the current thread. The inline function gives a single
+// instance across the loader and the backend libraries.
+inline dispatch_profile& thread_dispatch_profile() {
+    thread_local dispatch_profile profile{};
+    return profile;
+}
+
+inline void reset_dispatch_profile() {
+    thread_dispatch_profile() = dispatch_profile{};
+}
+
+// Adds the time from its construction to stop() or its destruction to a stage of the current
+// thread's profile. Does nothing unless ONEMATH_ENABLE_DISPATCH_PROFILING is defined.
+class dispatch_timer {
+public:
+    explicit dispatch_timer(dispatch_stage stage) {
+#ifdef ONEMATH_ENABLE_DISPATCH_PROFILING
+        stage_ = stage;
+        start_ = std::chrono::steady_clock::now();
+#else
+        (void)stage;
+#endif
+    }
+
+    dispatch_timer(const dispatch_timer&) = delete;
+    dispatch_timer& operator=(const dispatch_timer&) = delete;
+
+    ~dispatch_timer() {
+        stop();
+    }
+
+    void stop() {
+#ifdef ONEMATH_ENABLE_DISPATCH_PROFILING
+        if (stopped_)
+            return;
+        stopped_ = true;
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_);
+        auto& stats = thread_dispatch_profile()[static_cast<std::size_t>(stage_)];
+        ++stats.calls;
+        stats.nanoseconds += static_cast<std::uint64_t>(elapsed.count());
+#endif
+    }
+
+private:
+#ifdef ONEMATH_ENABLE_DISPATCH_PROFILING
+    dispatch_stage stage_;
+    std::chrono::steady_clock::time_point start_;
+    bool stopped_ = false;
+#endif
+};
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_DISPATCH_PROFILER_HPP_
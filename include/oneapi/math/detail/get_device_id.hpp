@@ -27,6 +27,7 @@
 #endif
 
 #include "oneapi/math/detail/backends_table.hpp"
+#include "oneapi/math/detail/dispatch_profiler.hpp"
 #include "oneapi/math/exceptions.hpp"
 
 #define INTEL_ID  32902
@@ -41,6 +42,7 @@ namespace oneapi {
 namespace math {
 
 inline oneapi::math::device get_device_id(sycl::queue& queue) {
+    detail::dispatch_timer timer(detail::dispatch_stage::get_device_id);
     oneapi::math::device device_id;
     if (queue.get_device().is_cpu())
         device_id = device::x86cpu;
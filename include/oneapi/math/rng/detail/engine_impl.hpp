@@ -96,6 +96,38 @@ public:
     virtual void generate(const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
                           std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) = 0;
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) = 0;
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) = 0;
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) = 0;
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) = 0;
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) = 0;
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) = 0;
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) = 0;
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) = 0;
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) = 0;
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) = 0;
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) = 0;
 
@@ -168,6 +200,44 @@ public:
         const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
         std::uint32_t* r, const std::vector<sycl::event>& dependencies) = 0;
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) = 0;
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) = 0;
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) = 0;
 
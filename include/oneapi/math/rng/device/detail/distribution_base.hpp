@@ -24,6 +24,7 @@
 
 #include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/rng/device/types.hpp"
+#include "oneapi/math/vm/types.hpp"
 
 namespace oneapi::math::rng::device {
 
@@ -32,6 +33,23 @@ namespace detail {
 template <typename DistrType>
 class distribution_base {};
 
+// Accuracy of the elementary functions evaluated by the transform of a generation method. The
+// *_ep methods trade about half of the mantissa bits for throughput of the transform stage.
+template <typename Method>
+inline constexpr oneapi::math::vm::mode transform_mode = oneapi::math::vm::mode::ha;
+
+template <>
+inline constexpr oneapi::math::vm::mode transform_mode<gaussian_method::box_muller2_ep> =
+    oneapi::math::vm::mode::ep;
+
+template <>
+inline constexpr oneapi::math::vm::mode transform_mode<lognormal_method::box_muller2_ep> =
+    oneapi::math::vm::mode::ep;
+
+template <>
+inline constexpr oneapi::math::vm::mode transform_mode<exponential_method::icdf_ep> =
+    oneapi::math::vm::mode::ep;
+
 } // namespace detail
 
 // declarations of distribution classes
@@ -44,6 +62,10 @@ class gaussian;
 template <typename RealType = float, typename Method = lognormal_method::by_default>
 class lognormal;
 
+template <std::int32_t Dimen, typename RealType = float,
+          typename Method = multivariate_normal_method::by_default>
+class multivariate_normal;
+
 template <typename UIntType = std::uint32_t>
 class uniform_bits;
 
@@ -81,5 +103,6 @@ class geometric;
 #include "oneapi/math/rng/device/detail/geometric_impl.hpp"
 #include "oneapi/math/rng/device/detail/beta_impl.hpp"
 #include "oneapi/math/rng/device/detail/gamma_impl.hpp"
+#include "oneapi/math/rng/device/detail/multivariate_normal_impl.hpp"
 
 #endif // ONEMATH_RNG_DISTRIBUTION_BASE_HPP_
@@ -70,11 +70,11 @@ protected:
                                   sycl::vec<RealType, EngineType::vec_size>>::type {
         auto res = engine.generate(RealType(0), RealType(1));
         if constexpr (EngineType::vec_size == 1) {
-            res = ln_wrapper(res);
+            res = ln_wrapper<transform_mode<Method>>(res);
         }
         else {
             for (int i = 0; i < EngineType::vec_size; ++i) {
-                res[i] = ln_wrapper(res[i]);
+                res[i] = ln_wrapper<transform_mode<Method>>(res[i]);
             }
         }
         res = a_ - res * beta_;
@@ -99,7 +99,7 @@ protected:
     template <typename EngineType>
     RealType generate_single(EngineType& engine) {
         RealType res = engine.generate_single(RealType(0), RealType(1));
-        res = ln_wrapper(res);
+        res = ln_wrapper<transform_mode<Method>>(res);
         res = a_ - res * beta_;
         if constexpr (std::is_same<Method, exponential_method::icdf_accurate>::value) {
 #ifndef __HIPSYCL__
@@ -35,9 +35,9 @@ constexpr inline double sqrt2<double>() {
     return 0x1.6A09E667F3BCDP+0; // 1.414213562
 }
 
-template <typename RealType>
-class distribution_base<
-    oneapi::math::rng::device::gaussian<RealType, gaussian_method::box_muller2>> {
+// box_muller2 and box_muller2_ep, which only differ by the accuracy of the transform
+template <typename RealType, typename Method>
+class distribution_base<oneapi::math::rng::device::gaussian<RealType, Method>> {
 public:
     struct param_type {
         param_type(RealType mean, RealType stddev) : mean_(mean), stddev_(stddev) {}
@@ -77,6 +77,8 @@ public:
     }
 
 protected:
+    static constexpr oneapi::math::vm::mode vm_mode_ = transform_mode<Method>;
+
     template <typename EngineType>
     __attribute__((always_inline)) inline auto generate(EngineType& engine) ->
         typename std::conditional<EngineType::vec_size == 1, RealType,
@@ -88,15 +90,15 @@ protected:
             if (!flag_) {
                 u1 = engine.generate(RealType(0), RealType(1));
                 u2 = engine.generate(RealType(0), RealType(1));
-                u1_transformed = ln_wrapper(u1);
+                u1_transformed = ln_wrapper<vm_mode_>(u1);
                 u1_transformed = sqrt_wrapper(static_cast<RealType>(-2.0) * u1_transformed);
-                res = u1_transformed * sinpi_wrapper(RealType(2) * u2) * stddev_ + mean_;
+                res = u1_transformed * sinpi_wrapper<vm_mode_>(RealType(2) * u2) * stddev_ + mean_;
                 u1_transformed_ = u1_transformed;
                 u2_ = u2;
                 flag_ = true;
                 return res;
             }
-            res = u1_transformed_ * cospi_wrapper(RealType(2) * u2_) * stddev_ + mean_;
+            res = u1_transformed_ * cospi_wrapper<vm_mode_>(RealType(2) * u2_) * stddev_ + mean_;
             flag_ = false;
             return res;
         }
@@ -110,19 +112,19 @@ protected:
                 for (std::int32_t i = 0; i < EngineType::vec_size - tail; i += 2) {
                     u1 = uniform_res[i];
                     u2 = uniform_res[i + 1];
-                    u1_transformed = ln_wrapper(u1);
+                    u1_transformed = ln_wrapper<vm_mode_>(u1);
                     u1_transformed = sqrt_wrapper(static_cast<RealType>(-2.0) * u1_transformed);
-                    sin = sincospi_wrapper(RealType(2.0) * u2, cos);
+                    sin = sincospi_wrapper<vm_mode_>(RealType(2.0) * u2, cos);
                     res[i] = (u1_transformed * sin) * stddev_ + mean_;
                     res[i + 1] = (u1_transformed * cos) * stddev_ + mean_;
                 }
                 if constexpr (tail) {
                     u1 = uniform_res[EngineType::vec_size - 1];
                     u2 = engine.generate_single(RealType(0), RealType(1));
-                    u1_transformed = ln_wrapper(u1);
+                    u1_transformed = ln_wrapper<vm_mode_>(u1);
                     u1_transformed = sqrt_wrapper(static_cast<RealType>(-2.0) * u1_transformed);
-                    res[EngineType::vec_size - 1] =
-                        u1_transformed * sinpi_wrapper(RealType(2) * u2) * stddev_ + mean_;
+                    sin = sinpi_wrapper<vm_mode_>(RealType(2) * u2);
+                    res[EngineType::vec_size - 1] = u1_transformed * sin * stddev_ + mean_;
                     u1_transformed_ = u1_transformed;
                     u2_ = u2;
                     flag_ = true;
@@ -130,26 +132,26 @@ protected:
                 return res;
             }
 
-            res[0] = u1_transformed_ * cospi_wrapper(RealType(2) * u2_) * stddev_ + mean_;
+            res[0] = u1_transformed_ * cospi_wrapper<vm_mode_>(RealType(2) * u2_) * stddev_ + mean_;
             flag_ = false;
             constexpr std::int32_t tail = (EngineType::vec_size - 1) % 2;
 #pragma unroll
             for (std::int32_t i = 1; i < EngineType::vec_size - tail; i += 2) {
                 u1 = engine.generate_single(RealType(0), RealType(1));
                 u2 = engine.generate_single(RealType(0), RealType(1));
-                u1_transformed = ln_wrapper(u1);
+                u1_transformed = ln_wrapper<vm_mode_>(u1);
                 u1_transformed = sqrt_wrapper(static_cast<RealType>(-2.0) * u1_transformed);
-                sin = sincospi_wrapper(RealType(2.0) * u2, cos);
+                sin = sincospi_wrapper<vm_mode_>(RealType(2.0) * u2, cos);
                 res[i] = (u1_transformed * sin) * stddev_ + mean_;
                 res[i + 1] = (u1_transformed * cos) * stddev_ + mean_;
             }
             if constexpr (tail) {
                 u1 = engine.generate_single(RealType(0), RealType(1));
                 u2 = engine.generate_single(RealType(0), RealType(1));
-                u1_transformed = ln_wrapper(u1);
+                u1_transformed = ln_wrapper<vm_mode_>(u1);
                 u1_transformed = sqrt_wrapper(static_cast<RealType>(-2.0) * u1_transformed);
                 res[EngineType::vec_size - 1] =
-                    u1_transformed * sinpi_wrapper(RealType(2) * u2) * stddev_ + mean_;
+                    u1_transformed * sinpi_wrapper<vm_mode_>(RealType(2) * u2) * stddev_ + mean_;
                 u1_transformed_ = u1_transformed;
                 u2_ = u2;
                 flag_ = true;
@@ -165,15 +167,15 @@ protected:
         if (!flag_) {
             u1 = engine.generate_single(RealType(0), RealType(1));
             u2 = engine.generate_single(RealType(0), RealType(1));
-            u1_transformed = ln_wrapper(u1);
+            u1_transformed = ln_wrapper<vm_mode_>(u1);
             u1_transformed = sqrt_wrapper(static_cast<RealType>(-2.0) * u1_transformed);
-            res = u1_transformed * sinpi_wrapper(RealType(2) * u2) * stddev_ + mean_;
+            res = u1_transformed * sinpi_wrapper<vm_mode_>(RealType(2) * u2) * stddev_ + mean_;
             u1_transformed_ = u1_transformed;
             u2_ = u2;
             flag_ = true;
             return res;
         }
-        res = u1_transformed_ * cospi_wrapper(RealType(2) * u2_) * stddev_ + mean_;
+        res = u1_transformed_ * cospi_wrapper<vm_mode_>(RealType(2) * u2_) * stddev_ + mean_;
         flag_ = false;
         return res;
     }
@@ -186,14 +188,14 @@ protected:
 
     friend class distribution_base<
         oneapi::math::rng::device::lognormal<RealType, lognormal_method::box_muller2>>;
+    friend class distribution_base<
+        oneapi::math::rng::device::lognormal<RealType, lognormal_method::box_muller2_ep>>;
     friend class distribution_base<
         oneapi::math::rng::device::poisson<std::int32_t, poisson_method::devroye>>;
     friend class distribution_base<
         oneapi::math::rng::device::poisson<std::uint32_t, poisson_method::devroye>>;
 };
 
-#if MKL_RNG_USE_BINARY_CODE
-
 template <typename RealType>
 class distribution_base<oneapi::math::rng::device::gaussian<RealType, gaussian_method::icdf>> {
 public:
@@ -263,7 +265,6 @@ protected:
     RealType mean_;
     RealType stddev_;
 };
-#endif
 
 } // namespace oneapi::math::rng::device::detail
 
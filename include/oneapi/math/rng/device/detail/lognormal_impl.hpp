@@ -20,6 +20,8 @@
 #ifndef ONEMATH_RNG_DEVICE_LOGNORMAL_IMPL_HPP_
 #define ONEMATH_RNG_DEVICE_LOGNORMAL_IMPL_HPP_
 
+#include "vm_wrappers.hpp"
+
 namespace oneapi::math::rng::device::detail {
 
 template <typename RealType, typename Method>
@@ -85,16 +87,20 @@ protected:
         typename std::conditional<EngineType::vec_size == 1, RealType,
                                   sycl::vec<RealType, EngineType::vec_size>>::type {
         auto res = gaussian_.generate(engine);
-        return sycl::exp(res) * scale_ + displ_;
+        return exp_wrapper<transform_mode<Method>>(res) * scale_ + displ_;
     }
 
     template <typename EngineType>
     RealType generate_single(EngineType& engine) {
         RealType res = gaussian_.generate_single(engine);
-        return sycl::exp(res) * scale_ + displ_;
+        return exp_wrapper<transform_mode<Method>>(res) * scale_ + displ_;
     }
 
-    distribution_base<oneapi::math::rng::device::gaussian<RealType, gaussian_method::box_muller2>>
+    using gaussian_method_type =
+        std::conditional_t<std::is_same_v<Method, lognormal_method::box_muller2_ep>,
+                           gaussian_method::box_muller2_ep, gaussian_method::box_muller2>;
+
+    distribution_base<oneapi::math::rng::device::gaussian<RealType, gaussian_method_type>>
         gaussian_;
     RealType displ_;
     RealType scale_;
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef ONEMATH_RNG_DEVICE_MULTIVARIATE_NORMAL_IMPL_HPP_
+#define ONEMATH_RNG_DEVICE_MULTIVARIATE_NORMAL_IMPL_HPP_
+
+#include <array>
+
+#include "vm_wrappers.hpp"
+
+namespace oneapi::math::rng::device::detail {
+
+// The Cholesky factor is kept as the packed lower triangle, row by row, so that a Dimen = 16
+// distribution holds 136 instead of 256 factor elements in registers
+template <std::int32_t Dimen>
+constexpr inline std::int32_t packed_lower_size() {
+    return Dimen * (Dimen + 1) / 2;
+}
+
+template <std::int32_t Dimen, typename RealType>
+class distribution_base<oneapi::math::rng::device::multivariate_normal<
+    Dimen, RealType, multivariate_normal_method::box_muller2>> {
+public:
+    struct param_type {
+        param_type(const std::array<RealType, Dimen>& mean,
+                   const std::array<RealType, Dimen * Dimen>& cholesky_factor)
+                : mean_(mean),
+                  cholesky_factor_(cholesky_factor) {}
+        std::array<RealType, Dimen> mean_;
+        std::array<RealType, Dimen * Dimen> cholesky_factor_;
+    };
+
+    distribution_base(const std::array<RealType, Dimen>& mean,
+                      const std::array<RealType, Dimen * Dimen>& cholesky_factor) {
+        set_params(mean, cholesky_factor);
+    }
+
+    std::array<RealType, Dimen> mean() const {
+        std::array<RealType, Dimen> mean;
+        for (std::int32_t i = 0; i < Dimen; i++) {
+            mean[i] = mean_[i];
+        }
+        return mean;
+    }
+
+    std::array<RealType, Dimen * Dimen> cholesky_factor() const {
+        std::array<RealType, Dimen * Dimen> t{};
+        for (std::int32_t i = 0; i < Dimen; i++) {
+            for (std::int32_t j = 0; j <= i; j++) {
+                t[i * Dimen + j] = t_[i * (i + 1) / 2 + j];
+            }
+        }
+        return t;
+    }
+
+    param_type param() const {
+        return param_type(mean(), cholesky_factor());
+    }
+
+    void param(const param_type& pt) {
+        set_params(pt.mean_, pt.cholesky_factor_);
+    }
+
+protected:
+    void set_params(const std::array<RealType, Dimen>& mean,
+                    const std::array<RealType, Dimen * Dimen>& cholesky_factor) {
+#ifndef __SYCL_DEVICE_ONLY__
+        for (std::int32_t i = 0; i < Dimen; i++) {
+            if (cholesky_factor[i * Dimen + i] <= RealType(0)) {
+                throw oneapi::math::invalid_argument("rng", "multivariate_normal",
+                                                     "cholesky_factor diagonal element <= 0");
+            }
+        }
+#endif
+        for (std::int32_t i = 0; i < Dimen; i++) {
+            mean_[i] = mean[i];
+            for (std::int32_t j = 0; j <= i; j++) {
+                t_[i * (i + 1) / 2 + j] = cholesky_factor[i * Dimen + j];
+            }
+        }
+    }
+
+    // Box-Muller needs an even number of uniforms; the spare normal of an odd Dimen is dropped
+    // so that every call consumes the same amount of the engine sequence
+    template <typename EngineType>
+    __attribute__((always_inline)) inline void generate_uniforms(EngineType& engine,
+                                                                 RealType* u) {
+        constexpr std::int32_t n_uniforms = 2 * ((Dimen + 1) / 2);
+        if constexpr (EngineType::vec_size == 1) {
+#pragma unroll
+            for (std::int32_t i = 0; i < n_uniforms; i++) {
+                u[i] = engine.generate(RealType(0), RealType(1));
+            }
+        }
+        else {
+            constexpr std::int32_t n_full = n_uniforms / EngineType::vec_size;
+#pragma unroll
+            for (std::int32_t b = 0; b < n_full; b++) {
+                auto uniform_res = engine.generate(RealType(0), RealType(1));
+#pragma unroll
+                for (std::int32_t i = 0; i < EngineType::vec_size; i++) {
+                    u[b * EngineType::vec_size + i] = uniform_res[i];
+                }
+            }
+#pragma unroll
+            for (std::int32_t i = n_full * EngineType::vec_size; i < n_uniforms; i++) {
+                u[i] = engine.generate_single(RealType(0), RealType(1));
+            }
+        }
+    }
+
+    template <typename EngineType>
+    __attribute__((always_inline)) inline std::array<RealType, Dimen> generate(
+        EngineType& engine) {
+        constexpr std::int32_t n_pairs = (Dimen + 1) / 2;
+        RealType u[2 * n_pairs];
+        RealType z[2 * n_pairs];
+        generate_uniforms(engine, u);
+
+#pragma unroll
+        for (std::int32_t i = 0; i < n_pairs; i++) {
+            RealType u1_transformed = ln_wrapper(u[2 * i]);
+            u1_transformed = sqrt_wrapper(static_cast<RealType>(-2.0) * u1_transformed);
+            RealType cos;
+            RealType sin = sincospi_wrapper(RealType(2.0) * u[2 * i + 1], cos);
+            z[2 * i] = u1_transformed * sin;
+            z[2 * i + 1] = u1_transformed * cos;
+        }
+
+        // x = mean + T * z with T lower triangular, fully unrolled for the compile-time Dimen
+        std::array<RealType, Dimen> res;
+#pragma unroll
+        for (std::int32_t i = 0; i < Dimen; i++) {
+            RealType x = mean_[i];
+#pragma unroll
+            for (std::int32_t j = 0; j <= i; j++) {
+                x = sycl::fma(t_[i * (i + 1) / 2 + j], z[j], x);
+            }
+            res[i] = x;
+        }
+        return res;
+    }
+
+    RealType mean_[Dimen];
+    RealType t_[packed_lower_size<Dimen>()];
+};
+
+} // namespace oneapi::math::rng::device::detail
+
+#endif // ONEMATH_RNG_DEVICE_MULTIVARIATE_NORMAL_IMPL_HPP_
@@ -350,6 +350,161 @@ protected:
     double lambda_;
 };
 
+// Implementation of Poisson distribution with poisson_method::ptrd uses 2 methods depending on
+// lambda parameter:
+//    - inverse CDF table lookup for small lambdas (lambda < 10)
+//    - PTRD (transformed rejection with decomposition) [3] for lambda >= 10
+// Both methods consume uniform random numbers only, the expected number of iterations of the
+// PTRD rejection loop is bounded by ~1.13 for any lambda >= 10.
+//
+// References:
+// [3] Hormann, W. The transformed rejection method for generating Poisson random variables.
+// Insurance: Mathematics and Economics 12, 1 (1993), 39-45
+
+#define RNG_POISSON_PTRD_LAMBDA_BOUND 10.0
+
+struct poisson_ptrd_parameters {
+    void set_lambda(double lambda) {
+        if (lambda >= RNG_POISSON_PTRD_LAMBDA_BOUND) {
+            log_lambda_ = sycl::log(lambda);
+            b_ = 0.931 + 2.53 * sycl::sqrt(lambda);
+            a_ = -0.059 + 0.02483 * b_;
+            inv_alpha_ = 1.1239 + 1.1328 / (b_ - 3.4);
+            v_r_ = 0.9277 - 3.6224 / (b_ - 2.0);
+        }
+        else {
+            prob[0] = sycl::exp(-lambda);
+            double tmp = prob[0];
+            for (int i = 1; i < RNG_POISSON_N_PRECOMPUTED_CDF; ++i) {
+                tmp *= lambda / (double)i;
+                prob[i] = prob[i - 1] + tmp;
+            }
+        }
+    }
+
+    double prob[RNG_POISSON_N_PRECOMPUTED_CDF];
+    double log_lambda_ = 0.0;
+    double a_ = 0.0;
+    double b_ = 0.0;
+    double inv_alpha_ = 0.0;
+    double v_r_ = 0.0;
+};
+
+template <typename IntType>
+class distribution_base<oneapi::math::rng::device::poisson<IntType, poisson_method::ptrd>> {
+public:
+    struct param_type {
+        param_type(double lambda) : lambda_(lambda) {}
+        double lambda_;
+    };
+
+    distribution_base(double lambda) : lambda_(lambda) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (lambda_ <= 0.0) {
+            throw oneapi::math::invalid_argument("rng", "poisson", "lambda <= 0");
+        }
+#endif
+        params_.set_lambda(lambda_);
+    }
+
+    double lambda() const {
+        return lambda_;
+    }
+
+    param_type param() const {
+        return param_type(lambda_);
+    }
+
+    void param(const param_type& pt) {
+#ifndef __SYCL_DEVICE_ONLY__
+        if (pt.lambda_ <= 0.0) {
+            throw oneapi::math::invalid_argument("rng", "poisson", "lambda <= 0");
+        }
+#endif
+        lambda_ = pt.lambda_;
+        params_.set_lambda(lambda_);
+    }
+
+protected:
+    IntType get_one_num_small_lambdas(double uniform_var) {
+        IntType res = 0;
+        for (; res < RNG_POISSON_N_PRECOMPUTED_CDF; ++res) {
+            if (uniform_var < params_.prob[res]) {
+                return res;
+            }
+        }
+        // in case uniform_var is still bigger than CDF[31] compute additional CDF coefficients
+        double prob_less_than_k = params_.prob[--res];
+        double prob_that_k = prob_less_than_k - params_.prob[res - 1];
+        do {
+            prob_that_k *= lambda_ / (double)(res++ + 1);
+            prob_less_than_k += prob_that_k;
+        } while (uniform_var >= prob_less_than_k);
+
+        return res;
+    }
+
+    template <typename EngineType>
+    IntType get_one_num_ptrd(EngineType& engine) {
+        const double max_inttype_val = static_cast<double>((std::numeric_limits<IntType>::max)());
+        double k;
+        while (true) {
+            const double u = engine.generate_single(0.0, 1.0) - 0.5;
+            const double v = engine.generate_single(0.0, 1.0);
+            const double us = 0.5 - sycl::fabs(u);
+            k = sycl::floor((2.0 * params_.a_ / us + params_.b_) * u + lambda_ + 0.43);
+            // squeeze: immediate acceptance in the center of the distribution
+            if (us >= 0.07 && v <= params_.v_r_) {
+                break;
+            }
+            if (k < 0.0 || k > max_inttype_val || (us < 0.013 && v > us)) {
+                continue;
+            }
+            const double log_v =
+                sycl::log(v * params_.inv_alpha_ / (params_.a_ / (us * us) + params_.b_));
+            if (log_v <= -lambda_ + k * params_.log_lambda_ - sycl::lgamma(k + 1.0)) {
+                break;
+            }
+        }
+        return static_cast<IntType>(k);
+    }
+
+    template <typename EngineType>
+    auto generate(EngineType& engine) ->
+        typename std::conditional<EngineType::vec_size == 1, IntType,
+                                  sycl::vec<IntType, EngineType::vec_size>>::type {
+        if constexpr (EngineType::vec_size == 1) {
+            return generate_single(engine);
+        }
+        else {
+            sycl::vec<IntType, EngineType::vec_size> res;
+            if (lambda_ < RNG_POISSON_PTRD_LAMBDA_BOUND) {
+                auto uniform_var = engine.generate(0.0, 1.0);
+                for (int i = 0; i < EngineType::vec_size; ++i) {
+                    res[i] = get_one_num_small_lambdas(uniform_var[i]);
+                }
+            }
+            else {
+                for (int i = 0; i < EngineType::vec_size; ++i) {
+                    res[i] = get_one_num_ptrd(engine);
+                }
+            }
+            return res;
+        }
+    }
+
+    template <typename EngineType>
+    IntType generate_single(EngineType& engine) {
+        if (lambda_ < RNG_POISSON_PTRD_LAMBDA_BOUND) {
+            return get_one_num_small_lambdas(engine.generate_single(0.0, 1.0));
+        }
+        return get_one_num_ptrd(engine);
+    }
+
+    poisson_ptrd_parameters params_;
+    double lambda_;
+};
+
 } // namespace oneapi::math::rng::device::detail
 
 #endif // ONEMATH_RNG_DEVICE_POISSON_IMPL_HPP_
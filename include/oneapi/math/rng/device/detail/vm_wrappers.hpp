@@ -21,31 +21,39 @@
 #define ONEMATH_RNG_DEVICE_VM_WRAPPERS_HPP_
 
 #include <cmath>
+#include <limits>
+
+#include "oneapi/math/vm/detail/math_impl.hpp"
+#include "oneapi/math/vm/detail/special_impl.hpp"
+#include "oneapi/math/vm/types.hpp"
 
 namespace oneapi::math::rng::device::detail {
 
-template <typename DataType>
+// The wrappers evaluate the elementary functions of the distribution transforms with the accuracy
+// of Mode, see oneapi/math/vm/detail/math_impl.hpp. sqrt is exact in every mode.
+
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType sqrt_wrapper(DataType a) {
     return sycl::sqrt(a);
 }
 
-template <typename DataType>
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType sinpi_wrapper(DataType a) {
-    return sycl::sinpi(a);
+    return oneapi::math::vm::detail::sinpi_impl<Mode>(a);
 }
 
-template <typename DataType>
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType cospi_wrapper(DataType a) {
-    return sycl::cospi(a);
+    return oneapi::math::vm::detail::cospi_impl<Mode>(a);
 }
 
-template <typename DataType>
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType sincospi_wrapper(DataType a, DataType& b) {
-    b = sycl::cospi(a);
-    return sycl::sinpi(a);
+    b = oneapi::math::vm::detail::cospi_impl<Mode>(a);
+    return oneapi::math::vm::detail::sinpi_impl<Mode>(a);
 }
 
-template <typename DataType>
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType ln_wrapper(DataType a) {
     if (a == DataType(0)) {
         if constexpr (std::is_same_v<DataType, double>)
@@ -53,22 +61,38 @@ static inline DataType ln_wrapper(DataType a) {
         else
             return -0x1.9D1DA0P+6f; // ln(0.14012984e-44) = -103.278929
     }
-    return sycl::log(a);
+    return oneapi::math::vm::detail::log_impl<Mode>(a);
 }
 
-template <typename DataType>
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType pow_wrapper(DataType a, DataType b) {
-    return sycl::pow(a, b);
+    return oneapi::math::vm::detail::pow_impl<Mode>(a, b);
 }
 
-template <typename DataType>
+// The uniform numbers on [-1, 1) include -1, which is mapped to erfinv of the next number above it
+// rather than to -inf
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
+static inline DataType erf_inv_wrapper(DataType a) {
+    if (a == DataType(-1)) {
+        a = -(DataType(1) - std::numeric_limits<DataType>::epsilon() / DataType(2));
+    }
+    return oneapi::math::vm::detail::erfinv_impl<Mode>(a);
+}
+
+// powr is only defined for a >= 0, where ep pow is exp(b * log(a)) as well
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType powr_wrapper(DataType a, DataType b) {
-    return sycl::powr(a, b);
+    if constexpr (Mode == oneapi::math::vm::mode::ep) {
+        return oneapi::math::vm::detail::pow_impl<Mode>(a, b);
+    }
+    else {
+        return sycl::powr(a, b);
+    }
 }
 
-template <typename DataType>
+template <oneapi::math::vm::mode Mode = oneapi::math::vm::mode::ha, typename DataType>
 static inline DataType exp_wrapper(DataType a) {
-    return sycl::exp(a);
+    return oneapi::math::vm::detail::exp_impl<Mode>(a);
 }
 } // namespace oneapi::math::rng::device::detail
 
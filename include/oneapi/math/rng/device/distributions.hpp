@@ -20,6 +20,7 @@
 #ifndef ONEMATH_RNG_DEVICE_DISTRIBUTIONS_HPP_
 #define ONEMATH_RNG_DEVICE_DISTRIBUTIONS_HPP_
 
+#include <array>
 #include <limits>
 
 #include "oneapi/math/rng/device/detail/distribution_base.hpp"
@@ -122,6 +123,7 @@ private:
 //
 // Supported methods:
 //      oneapi::math::rng::device::gaussian_method::box_muller2
+//      oneapi::math::rng::device::gaussian_method::box_muller2_ep
 //      oneapi::math::rng::device::gaussian_method::icdf
 //
 // Input arguments:
@@ -131,15 +133,10 @@ private:
 template <typename RealType, typename Method>
 class gaussian : detail::distribution_base<gaussian<RealType, Method>> {
 public:
-    static_assert(std::is_same<Method, gaussian_method::box_muller2>::value
-#if MKL_RNG_USE_BINARY_CODE
-                      || std::is_same<Method, gaussian_method::icdf>::value
-#endif
-                  ,
+    static_assert(std::is_same<Method, gaussian_method::box_muller2>::value ||
+                      std::is_same<Method, gaussian_method::box_muller2_ep>::value ||
+                      std::is_same<Method, gaussian_method::icdf>::value,
                   "oneMath: rng/gaussian: method is incorrect");
-#if !MKL_RNG_USE_BINARY_CODE
-    static_assert(!std::is_same<Method, gaussian_method::icdf>::value, "icdf method not supported");
-#endif
     static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
                   "oneMath: rng/gaussian: type is not supported");
 
@@ -189,6 +186,7 @@ public:
 //
 // Supported methods:
 //      oneapi::math::rng::device::lognormal_method::box_muller2
+//      oneapi::math::rng::device::lognormal_method::box_muller2_ep
 //
 // Input arguments:
 //      m     - mean of the subject normal distribution. 0.0 by default
@@ -199,7 +197,8 @@ public:
 template <typename RealType, typename Method>
 class lognormal : detail::distribution_base<lognormal<RealType, Method>> {
 public:
-    static_assert(std::is_same<Method, lognormal_method::box_muller2>::value,
+    static_assert(std::is_same<Method, lognormal_method::box_muller2>::value ||
+                      std::is_same<Method, lognormal_method::box_muller2_ep>::value,
                   "oneMath: rng/lognormal: method is incorrect");
 
     static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
@@ -252,6 +251,90 @@ public:
     friend typename Distr::result_type generate_single(Distr& distr, Engine& engine);
 };
 
+// Class template oneapi::math::rng::device::multivariate_normal
+//
+// Represents continuous multivariate normal random number distribution. Every call to generate()
+// returns one Dimen-dimensional vector mean + T * z, where z holds Dimen independent standard
+// normal numbers and T is the lower triangular Cholesky factor of the covariance matrix. The
+// factor is kept in registers and applied as the normal numbers are produced, so correlated
+// vectors need a single pass over memory.
+//
+// Supported dimensions:
+//      1 <= Dimen <= 16
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::math::rng::device::multivariate_normal_method::box_muller2
+//
+// Input arguments:
+//      mean            - mean vector. Zero vector by default
+//      cholesky_factor - lower triangular Cholesky factor of the covariance matrix, Dimen * Dimen
+//                        elements in row-major order. Elements above the diagonal are ignored.
+//                        Identity matrix by default
+//
+template <std::int32_t Dimen, typename RealType, typename Method>
+class multivariate_normal
+        : detail::distribution_base<multivariate_normal<Dimen, RealType, Method>> {
+public:
+    static_assert(std::is_same<Method, multivariate_normal_method::box_muller2>::value,
+                  "oneMath: rng/multivariate_normal: method is incorrect");
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "oneMath: rng/multivariate_normal: type is not supported");
+    static_assert(Dimen >= 1 && Dimen <= 16,
+                  "oneMath: rng/multivariate_normal: dimension is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+    static constexpr std::int32_t dimen = Dimen;
+    using param_type = typename detail::distribution_base<
+        multivariate_normal<Dimen, RealType, Method>>::param_type;
+
+    multivariate_normal()
+            : detail::distribution_base<multivariate_normal<Dimen, RealType, Method>>(
+                  std::array<RealType, Dimen>{}, identity()) {}
+
+    explicit multivariate_normal(const std::array<RealType, Dimen>& mean,
+                                 const std::array<RealType, Dimen * Dimen>& cholesky_factor)
+            : detail::distribution_base<multivariate_normal<Dimen, RealType, Method>>(
+                  mean, cholesky_factor) {}
+    explicit multivariate_normal(const param_type& pt)
+            : detail::distribution_base<multivariate_normal<Dimen, RealType, Method>>(
+                  pt.mean_, pt.cholesky_factor_) {}
+
+    std::array<RealType, Dimen> mean() const {
+        return detail::distribution_base<multivariate_normal<Dimen, RealType, Method>>::mean();
+    }
+
+    std::array<RealType, Dimen * Dimen> cholesky_factor() const {
+        return detail::distribution_base<
+            multivariate_normal<Dimen, RealType, Method>>::cholesky_factor();
+    }
+
+    param_type param() const {
+        return detail::distribution_base<multivariate_normal<Dimen, RealType, Method>>::param();
+    }
+
+    void param(const param_type& pt) {
+        detail::distribution_base<multivariate_normal<Dimen, RealType, Method>>::param(pt);
+    }
+
+    template <std::int32_t D, typename R, typename M, typename Engine>
+    friend auto generate(multivariate_normal<D, R, M>& distr, Engine& engine) ->
+        std::array<R, D>;
+
+private:
+    static std::array<RealType, Dimen * Dimen> identity() {
+        std::array<RealType, Dimen * Dimen> t{};
+        for (std::int32_t i = 0; i < Dimen; i++) {
+            t[i * Dimen + i] = RealType(1);
+        }
+        return t;
+    }
+};
+
 // Class template oneapi::math::rng::device::beta
 //
 // Represents continuous beta random number distribution
@@ -466,6 +549,7 @@ private:
 // Supported methods:
 //      oneapi::math::rng::device::exponential_method::icdf
 //      oneapi::math::rng::device::exponential_method::icdf_accurate
+//      oneapi::math::rng::device::exponential_method::icdf_ep
 //
 // Input arguments:
 //      displ - displacement. 0.0 by default
@@ -475,7 +559,8 @@ template <typename RealType, typename Method>
 class exponential : detail::distribution_base<exponential<RealType, Method>> {
 public:
     static_assert(std::is_same<Method, exponential_method::icdf>::value ||
-                      std::is_same<Method, exponential_method::icdf_accurate>::value,
+                      std::is_same<Method, exponential_method::icdf_accurate>::value ||
+                      std::is_same<Method, exponential_method::icdf_ep>::value,
                   "oneMath: rng/exponential: method is incorrect");
 
     static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
@@ -530,14 +615,20 @@ public:
 //
 // Supported methods:
 //      oneapi::math::rng::device::poisson_method::devroye
+//      oneapi::math::rng::device::poisson_method::ptrd
 //
 // Input arguments:
 //      lambda - mean value. 1.0 by default
 //
+// Note: poisson_method::ptrd uses uniform random numbers only and has a bounded expected number
+// of rejection loop iterations. Its parameters setup is cheap, so lambda may be changed for every
+// generated element via param(), e.g. to sample with per-element rates
+//
 template <typename IntType, typename Method>
 class poisson : detail::distribution_base<poisson<IntType, Method>> {
 public:
-    static_assert(std::is_same<Method, poisson_method::devroye>::value,
+    static_assert(std::is_same<Method, poisson_method::devroye>::value ||
+                      std::is_same<Method, poisson_method::ptrd>::value,
                   "oneMath: rng/poisson: method is incorrect");
 
     static_assert(std::is_same<IntType, std::int32_t>::value ||
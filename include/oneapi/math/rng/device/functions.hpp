@@ -22,6 +22,8 @@
 
 #include <sycl/sycl.hpp>
 
+#include <array>
+
 #include "oneapi/math/rng/device/detail/distribution_base.hpp"
 
 namespace oneapi::math::rng::device {
@@ -35,6 +37,13 @@ auto generate(Distr& distr, Engine& engine) ->
     return distr.generate(engine);
 }
 
+// multivariate_normal returns one Dimen-dimensional vector per call for any engine vec_size
+template <std::int32_t Dimen, typename RealType, typename Method, typename Engine>
+auto generate(multivariate_normal<Dimen, RealType, Method>& distr, Engine& engine) ->
+    std::array<RealType, Dimen> {
+    return distr.generate(engine);
+}
+
 // SERVICE FUNCTIONS
 
 template <typename Engine>
@@ -32,23 +32,32 @@ using by_default = standard;
 
 namespace gaussian_method {
 struct box_muller2 {};
+struct box_muller2_ep {};
 struct icdf {};
 using by_default = box_muller2;
 } // namespace gaussian_method
 
+namespace multivariate_normal_method {
+struct box_muller2 {};
+using by_default = box_muller2;
+} // namespace multivariate_normal_method
+
 namespace lognormal_method {
 struct box_muller2 {};
+struct box_muller2_ep {};
 using by_default = box_muller2;
 } // namespace lognormal_method
 
 namespace exponential_method {
 struct icdf {};
 struct icdf_accurate {};
+struct icdf_ep {};
 using by_default = icdf;
 } // namespace exponential_method
 
 namespace poisson_method {
 struct devroye {};
+struct ptrd {};
 using by_default = devroye;
 } // namespace poisson_method
 
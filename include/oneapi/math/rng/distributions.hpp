@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <vector>
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -351,6 +352,343 @@ private:
     double lambda_;
 };
 
+// Class template oneapi::math::rng::exponential
+//
+// Represents continuous exponential random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::math::rng::exponential_method::icdf
+//
+// Input arguments:
+//      a    - displacement. 0.0 by default
+//      beta - scalefactor. 1.0 by default
+//
+// Backend support:
+//      The cuRAND and rocRAND backends have no native exponential generator: the numbers are
+//      computed from the uniform output of the library by a second kernel
+
+namespace exponential_method {
+struct icdf {};
+using by_default = icdf;
+} // namespace exponential_method
+
+template <typename RealType = float, typename Method = exponential_method::by_default>
+class exponential {
+public:
+    static_assert(std::is_same<Method, exponential_method::icdf>::value,
+                  "rng exponential distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng exponential distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    exponential() : exponential(static_cast<RealType>(0.0), static_cast<RealType>(1.0)) {}
+
+    explicit exponential(RealType a, RealType beta) : a_(a), beta_(beta) {
+        if (beta <= static_cast<RealType>(0.0)) {
+            throw oneapi::math::invalid_argument("rng", "exponential", "beta <= 0");
+        }
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+private:
+    RealType a_;
+    RealType beta_;
+};
+
+// Class template oneapi::math::rng::gamma
+//
+// Represents continuous gamma random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::math::rng::gamma_method::marsaglia
+//
+// Input arguments:
+//      alpha - shape. 1.0 by default
+//      a     - displacement. 0.0 by default
+//      beta  - scalefactor. 1.0 by default
+//
+// Backend support:
+//      Not implemented by the cuRAND and rocRAND backends, which throw
+//      oneapi::math::unimplemented
+
+namespace gamma_method {
+struct marsaglia {};
+using by_default = marsaglia;
+} // namespace gamma_method
+
+template <typename RealType = float, typename Method = gamma_method::by_default>
+class gamma {
+public:
+    static_assert(std::is_same<Method, gamma_method::marsaglia>::value,
+                  "rng gamma distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng gamma distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    gamma()
+            : gamma(static_cast<RealType>(1.0), static_cast<RealType>(0.0),
+                    static_cast<RealType>(1.0)) {}
+
+    explicit gamma(RealType alpha, RealType a, RealType beta) : alpha_(alpha), a_(a), beta_(beta) {
+        if (alpha <= static_cast<RealType>(0.0)) {
+            throw oneapi::math::invalid_argument("rng", "gamma", "alpha <= 0");
+        }
+        if (beta <= static_cast<RealType>(0.0)) {
+            throw oneapi::math::invalid_argument("rng", "gamma", "beta <= 0");
+        }
+    }
+
+    RealType alpha() const {
+        return alpha_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+private:
+    RealType alpha_;
+    RealType a_;
+    RealType beta_;
+};
+
+// Class template oneapi::math::rng::beta
+//
+// Represents continuous beta random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::math::rng::beta_method::cja
+//
+// Input arguments:
+//      p - shape. 1.0 by default
+//      q - shape. 1.0 by default
+//      a - displacement. 0.0 by default
+//      b - scalefactor. 1.0 by default
+//
+// Backend support:
+//      Not implemented by the cuRAND and rocRAND backends, which throw
+//      oneapi::math::unimplemented
+
+namespace beta_method {
+struct cja {};
+using by_default = cja;
+} // namespace beta_method
+
+template <typename RealType = float, typename Method = beta_method::by_default>
+class beta {
+public:
+    static_assert(std::is_same<Method, beta_method::cja>::value,
+                  "rng beta distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng beta distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    beta()
+            : beta(static_cast<RealType>(1.0), static_cast<RealType>(1.0),
+                   static_cast<RealType>(0.0), static_cast<RealType>(1.0)) {}
+
+    explicit beta(RealType p, RealType q, RealType a, RealType b) : p_(p), q_(q), a_(a), b_(b) {
+        if (p <= static_cast<RealType>(0.0)) {
+            throw oneapi::math::invalid_argument("rng", "beta", "p <= 0");
+        }
+        if (q <= static_cast<RealType>(0.0)) {
+            throw oneapi::math::invalid_argument("rng", "beta", "q <= 0");
+        }
+        if (b <= static_cast<RealType>(0.0)) {
+            throw oneapi::math::invalid_argument("rng", "beta", "b <= 0");
+        }
+    }
+
+    RealType p() const {
+        return p_;
+    }
+
+    RealType q() const {
+        return q_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType b() const {
+        return b_;
+    }
+
+private:
+    RealType p_;
+    RealType q_;
+    RealType a_;
+    RealType b_;
+};
+
+// Class template oneapi::math::rng::geometric
+//
+// Represents discrete geometric random number distribution
+//
+// Supported types:
+//      std::uint32_t
+//      std::int32_t
+//
+// Supported methods:
+//      oneapi::math::rng::geometric_method::icdf
+//
+// Input arguments:
+//      p - success probability of a trial. 0.5 by default
+//
+// Backend support:
+//      The cuRAND and rocRAND backends have no native geometric generator: the numbers are
+//      computed from the uniform output of the library by a second kernel
+
+namespace geometric_method {
+struct icdf {};
+using by_default = icdf;
+} // namespace geometric_method
+
+template <typename IntType = std::uint32_t, typename Method = geometric_method::by_default>
+class geometric {
+public:
+    static_assert(std::is_same<Method, geometric_method::icdf>::value,
+                  "rng geometric method is incorrect");
+
+    static_assert(std::is_same<IntType, std::int32_t>::value ||
+                      std::is_same<IntType, std::uint32_t>::value,
+                  "rng geometric type is not supported");
+
+    using method_type = Method;
+    using result_type = IntType;
+
+    geometric() : geometric(0.5f) {}
+
+    explicit geometric(float p) : p_(p) {
+        if ((p >= 1.0f) || (p <= 0.0f)) {
+            throw oneapi::math::invalid_argument("rng", "geometric", "p >= 1 or p <= 0");
+        }
+    }
+
+    float p() const {
+        return p_;
+    }
+
+private:
+    float p_;
+};
+
+// Class template oneapi::math::rng::multivariate_normal
+//
+// Represents continuous multivariate normal random number distribution. Each output vector is
+// mean + T * z, where z holds dimen independent standard normal numbers and T is the lower
+// triangular Cholesky factor of the covariance matrix. The transform is applied while the
+// vectors are generated, so no separate triangular multiplication pass is needed.
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::math::rng::multivariate_normal_method::box_muller2
+//
+// Input arguments:
+//      dimen           - dimension of the output vectors
+//      mean            - mean vector, dimen elements
+//      cholesky_factor - lower triangular Cholesky factor of the covariance matrix, dimen * dimen
+//                        elements in row-major order. Elements above the diagonal are ignored
+//
+// The n argument of generate() counts vectors: the output holds n * dimen numbers, one vector
+// after another.
+
+namespace multivariate_normal_method {
+struct box_muller2 {};
+using by_default = box_muller2;
+} // namespace multivariate_normal_method
+
+template <typename RealType = float, typename Method = multivariate_normal_method::by_default>
+class multivariate_normal {
+public:
+    static_assert(std::is_same<Method, multivariate_normal_method::box_muller2>::value,
+                  "rng multivariate_normal method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng multivariate_normal type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    explicit multivariate_normal(std::int32_t dimen, std::vector<RealType> mean,
+                                 std::vector<RealType> cholesky_factor)
+            : dimen_(dimen),
+              mean_(std::move(mean)),
+              cholesky_factor_(std::move(cholesky_factor)) {
+        if (dimen <= 0) {
+            throw oneapi::math::invalid_argument("rng", "multivariate_normal", "dimen <= 0");
+        }
+        if (mean_.size() != static_cast<std::size_t>(dimen)) {
+            throw oneapi::math::invalid_argument("rng", "multivariate_normal",
+                                                 "mean size is not equal to dimen");
+        }
+        if (cholesky_factor_.size() != static_cast<std::size_t>(dimen) * dimen) {
+            throw oneapi::math::invalid_argument("rng", "multivariate_normal",
+                                                 "cholesky_factor size is not equal to dimen^2");
+        }
+        for (std::int32_t i = 0; i < dimen; i++) {
+            if (cholesky_factor_[i * dimen + i] <= static_cast<RealType>(0.0)) {
+                throw oneapi::math::invalid_argument(
+                    "rng", "multivariate_normal",
+                    "cholesky_factor diagonal element is incorrect, element <= 0.0");
+            }
+        }
+    }
+
+    std::int32_t dimen() const {
+        return dimen_;
+    }
+
+    const std::vector<RealType>& mean() const {
+        return mean_;
+    }
+
+    const std::vector<RealType>& cholesky_factor() const {
+        return cholesky_factor_;
+    }
+
+private:
+    std::int32_t dimen_;
+    std::vector<RealType> mean_;
+    std::vector<RealType> cholesky_factor_;
+};
+
 // Class template oneapi::math::rng::bits
 //
 // Represents bits of underlying random number engine
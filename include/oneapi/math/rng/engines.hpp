@@ -134,6 +134,9 @@ private:
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
 
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
     template <typename Distr, typename Engine>
     friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
                          sycl::buffer<typename Distr::result_type, 1>& r);
@@ -223,6 +226,9 @@ private:
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
 
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
     template <typename Distr, typename Engine>
     friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
                          sycl::buffer<typename Distr::result_type, 1>& r);
@@ -28,6 +28,7 @@
 #endif
 
 #include "oneapi/math/exceptions.hpp"
+#include "oneapi/math/rng/distributions.hpp"
 #include "oneapi/math/types.hpp"
 
 namespace oneapi {
@@ -46,6 +47,17 @@ inline void generate_precondition(const Distr& /*distr*/, Engine& /*engine*/, st
 #endif
 }
 
+template <typename RealType, typename Method, typename Engine>
+inline void generate_precondition(const multivariate_normal<RealType, Method>& distr,
+                                  Engine& /*engine*/, std::int64_t n,
+                                  sycl::buffer<RealType, 1>& r) {
+#ifndef ONEMATH_DISABLE_PREDICATES
+    if (n < 0 || n * distr.dimen() > r.size()) {
+        throw oneapi::math::invalid_argument("rng", "generate", "n");
+    }
+#endif
+}
+
 // USM APIs
 
 template <typename Distr, typename Engine>
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_STATS_HPP_
+#define _ONEMATH_STATS_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "oneapi/math/detail/export.hpp"
+
+// The counters are kept by the run-time dispatcher, which is only built with BUILD_SHARED_LIBS
+#ifndef ONEMATH_BUILD_SHARED_LIBS
+#error "oneapi/math/stats.hpp requires oneMath built with BUILD_SHARED_LIBS=ON"
+#endif
+
+namespace oneapi {
+namespace math {
+namespace stats {
+
+// Counters accumulated by the run-time dispatcher for one backend function, e.g.
+// column_major_sgemm_usm_sycl of libonemath_blas_mklgpu.so.
+// flops and bytes are estimated from the standard BLAS and LAPACK operation counts and the sizes
+// of the operands; they are left at 0 for the functions without a formula.
+struct routine_stats {
+    std::string domain;
+    std::string routine;
+    std::string backend;
+    std::uint64_t calls = 0;
+    std::uint64_t flops = 0;
+    std::uint64_t bytes = 0;
+};
+
+// Counters of every function called through the run-time dispatcher since the start of the
+// program or the last reset(), summed over all threads
+ONEMATH_EXPORT std::vector<routine_stats> snapshot();
+
+// Restarts the counters returned by snapshot() from 0
+ONEMATH_EXPORT void reset();
+
+} // namespace stats
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_STATS_HPP_
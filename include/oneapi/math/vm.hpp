@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_VM_HPP_
+#define _ONEMATH_VM_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "oneapi/math/detail/config.hpp"
+#include "oneapi/math/vm/types.hpp"
+
+#ifdef ONEMATH_ENABLE_MKLCPU_BACKEND
+#include "oneapi/math/vm/detail/mklcpu/vm_ct.hpp"
+#endif
+#ifdef ONEMATH_ENABLE_MKLGPU_BACKEND
+#include "oneapi/math/vm/detail/mklgpu/vm_ct.hpp"
+#endif
+#ifdef ONEMATH_ENABLE_GENERIC_VM_BACKEND
+#include "oneapi/math/vm/detail/generic/vm_ct.hpp"
+#endif
+
+#include "oneapi/math/vm/detail/vm_rt.hpp"
+#include "oneapi/math/vm/expression.hpp"
+
+#endif //_ONEMATH_VM_HPP_
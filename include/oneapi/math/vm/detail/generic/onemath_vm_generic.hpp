@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_VM_GENERIC_HPP_
+#define _ONEMATH_VM_GENERIC_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/detail/export.hpp"
+#include "oneapi/math/vm/types.hpp"
+
+namespace oneapi {
+namespace math {
+namespace vm {
+namespace generic {
+
+#include "oneapi/math/vm/detail/onemath_vm_backends.hxx"
+
+} // namespace generic
+} // namespace vm
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_VM_GENERIC_HPP_
@@ -0,0 +1,382 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_VM_MATH_IMPL_HPP_
+#define _ONEMATH_VM_MATH_IMPL_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/vm/types.hpp"
+
+// Device implementations of the elementary functions for every vm::mode. They are shared by the
+// generic VM backend and by the transforms of the device RNG distributions.
+//
+// ha (and not_defined) evaluates the full precision sycl:: built-ins. la and ep evaluate exp and
+// log with their own table and polynomial approximations, truncated to the accuracy of the mode;
+// pow and sinpi / cospi are relaxed in ep only. sqrt and the divisions are exact in every mode.
+
+namespace oneapi {
+namespace math {
+namespace vm {
+namespace detail {
+
+template <typename T>
+struct is_vec : std::false_type {};
+
+template <typename T, int N>
+struct is_vec<sycl::vec<T, N>> : std::true_type {};
+
+template <typename T>
+struct element_type {
+    using type = T;
+};
+
+template <typename T, int N>
+struct element_type<sycl::vec<T, N>> {
+    using type = T;
+};
+
+template <oneapi::math::vm::mode Mode>
+constexpr bool is_relaxed =
+    Mode == oneapi::math::vm::mode::la || Mode == oneapi::math::vm::mode::ep;
+
+template <typename T, typename F>
+inline T per_lane(const T& a, F f) {
+    T res;
+#pragma unroll
+    for (int i = 0; i < static_cast<int>(T::size()); i++) {
+        res[i] = f(a[i]);
+    }
+    return res;
+}
+
+template <typename T, typename F>
+inline T per_lane(const T& a, const T& b, F f) {
+    T res;
+#pragma unroll
+    for (int i = 0; i < static_cast<int>(T::size()); i++) {
+        res[i] = f(a[i], b[i]);
+    }
+    return res;
+}
+
+template <typename T>
+struct fp_consts;
+
+template <>
+struct fp_consts<float> {
+    using bits_type = std::uint32_t;
+    static constexpr int mantissa_bits = 23;
+    static constexpr int exponent_bias = 127;
+    static constexpr int denorm_shift = 24;
+    static constexpr float denorm_scale = 0x1.0P+24f;
+    static constexpr float sqrt2 = 0x1.6A09E6P+0f;
+    static constexpr float pi = 0x1.921FB6P+1f;
+    // ln(2) split so that e * ln2_hi is exact for every exponent e
+    static constexpr float ln2_hi = 0x1.62E400P-1f;
+    static constexpr float ln2_lo = 0x1.7F7D1CP-20f;
+    // ln(2) / 16 split so that k * ln2_16_hi is exact for every reduction index k
+    static constexpr float ln2_16_hi = 0x1.62E000P-5f;
+    static constexpr float ln2_16_lo = 0x1.0BFBE8P-19f;
+    static constexpr float inv_ln2_16 = 0x1.715476P+4f;
+    static constexpr float exp_overflow = 0x1.62E430P+6f; // ln(FLT_MAX)
+    static constexpr float exp_underflow = -0x1.9FE368P+6f; // ln(FLT_TRUE_MIN / 2)
+    static constexpr float trig_limit = 0x1.0P+22f;
+    // 2^(j / 16), j = 0, ..., 15
+    static constexpr float exp2_table[16] = {
+        0x1.000000P+0f, 0x1.0B5586P+0f, 0x1.172B84P+0f, 0x1.2387A6P+0f,
+        0x1.306FE0P+0f, 0x1.3DEA64P+0f, 0x1.4BFDAEP+0f, 0x1.5AB07EP+0f,
+        0x1.6A09E6P+0f, 0x1.7A1148P+0f, 0x1.8ACE54P+0f, 0x1.9C4918P+0f,
+        0x1.AE89FAP+0f, 0x1.C199BEP+0f, 0x1.D5818EP+0f, 0x1.EA4AFAP+0f,
+    };
+};
+
+template <>
+struct fp_consts<double> {
+    using bits_type = std::uint64_t;
+    static constexpr int mantissa_bits = 52;
+    static constexpr int exponent_bias = 1023;
+    static constexpr int denorm_shift = 54;
+    static constexpr double denorm_scale = 0x1.0P+54;
+    static constexpr double sqrt2 = 0x1.6A09E667F3BCDP+0;
+    static constexpr double pi = 0x1.921FB54442D18P+1;
+    static constexpr double ln2_hi = 0x1.62E42FEFA3800P-1;
+    static constexpr double ln2_lo = 0x1.EF35793C76730P-45;
+    static constexpr double ln2_16_hi = 0x1.62E42FEFA0000P-5;
+    static constexpr double ln2_16_lo = 0x1.CF79ABC9E3B3AP-44;
+    static constexpr double inv_ln2_16 = 0x1.71547652B82FEP+4;
+    static constexpr double exp_overflow = 0x1.62E42FEFA39EFP+9; // ln(DBL_MAX)
+    static constexpr double exp_underflow = -0x1.74910D52D3051P+9; // ln(DBL_TRUE_MIN / 2)
+    static constexpr double trig_limit = 0x1.0P+22;
+    static constexpr double exp2_table[16] = {
+        0x1.0000000000000P+0, 0x1.0B5586CF9890FP+0, 0x1.172B83C7D517BP+0, 0x1.2387A6E756238P+0,
+        0x1.306FE0A31B715P+0, 0x1.3DEA64C123422P+0, 0x1.4BFDAD5362A27P+0, 0x1.5AB07DD485429P+0,
+        0x1.6A09E667F3BCDP+0, 0x1.7A11473EB0187P+0, 0x1.8ACE5422AA0DBP+0, 0x1.9C49182A3F090P+0,
+        0x1.AE89F995AD3ADP+0, 0x1.C199BDD85529CP+0, 0x1.D5818DCFBA487P+0, 0x1.EA4AFA2A490DAP+0,
+    };
+};
+
+template <typename T>
+constexpr T inv_factorial(int n) {
+    return n <= 1 ? T(1) : inv_factorial<T>(n - 1) / T(n);
+}
+
+// e^r - 1 for |r| <= ln(2) / 32. The Taylor degree is the smallest one that meets the accuracy
+// of the mode: 2 and 3 for single precision ep and la, 4 and 7 for double precision.
+template <oneapi::math::vm::mode Mode, typename T>
+inline T expm1_poly(T r) {
+    constexpr bool ep = Mode == oneapi::math::vm::mode::ep;
+    constexpr int degree = std::is_same_v<T, float> ? (ep ? 2 : 3) : (ep ? 4 : 7);
+    T p = inv_factorial<T>(degree);
+#pragma unroll
+    for (int i = degree - 1; i >= 2; i--) {
+        p = inv_factorial<T>(i) + r * p;
+    }
+    return r + r * r * p;
+}
+
+// exp(a) = 2^(k / 16) * e^r with k = rint(16 * a / ln(2)) and |r| <= ln(2) / 32
+template <oneapi::math::vm::mode Mode, typename T>
+inline T exp_scalar(T a) {
+    using consts = fp_consts<T>;
+    if (a != a) {
+        return a + a;
+    }
+    if (a > consts::exp_overflow) {
+        return std::numeric_limits<T>::infinity();
+    }
+    if (a < consts::exp_underflow) {
+        return T(0);
+    }
+    T kf = sycl::rint(a * consts::inv_ln2_16);
+    int k = static_cast<int>(kf);
+    T r = (a - kf * consts::ln2_16_hi) - kf * consts::ln2_16_lo;
+    T t = consts::exp2_table[k & 15];
+    return sycl::ldexp(t + t * expm1_poly<Mode>(r), k >> 4);
+}
+
+// R(s) = 2 s^2 / 3 + 2 s^4 / 5 + ... so that log(1 + u) = 2 s + s R(s) with s = u / (2 + u),
+// |s| <= 0.1716. The series is cut after 2 and 4 terms for single precision ep and la, after 4
+// and 9 terms for double precision.
+template <oneapi::math::vm::mode Mode, typename T>
+inline T log_series(T s) {
+    constexpr bool ep = Mode == oneapi::math::vm::mode::ep;
+    constexpr int terms = std::is_same_v<T, float> ? (ep ? 2 : 4) : (ep ? 4 : 9);
+    T s2 = s * s;
+    T res = T(2) / T(2 * terms + 1);
+#pragma unroll
+    for (int i = terms - 1; i >= 1; i--) {
+        res = T(2) / T(2 * i + 1) + s2 * res;
+    }
+    return s2 * res;
+}
+
+// log(a) = e * ln(2) + log(1 + u) with a = 2^e * (1 + u) and sqrt(2) / 2 < 1 + u <= sqrt(2)
+template <oneapi::math::vm::mode Mode, typename T>
+inline T log_scalar(T a) {
+    using consts = fp_consts<T>;
+    using bits_type = typename consts::bits_type;
+    if (a != a) {
+        return a + a;
+    }
+    if (a < T(0)) {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    if (a == T(0)) {
+        return -std::numeric_limits<T>::infinity();
+    }
+    if (a == std::numeric_limits<T>::infinity()) {
+        return a;
+    }
+    int e = 0;
+    if (a < std::numeric_limits<T>::min()) {
+        a *= consts::denorm_scale;
+        e = -consts::denorm_shift;
+    }
+    constexpr bits_type mantissa_mask = (bits_type(1) << consts::mantissa_bits) - 1;
+    constexpr bits_type one_bits = bits_type(consts::exponent_bias) << consts::mantissa_bits;
+    bits_type bits = sycl::bit_cast<bits_type>(a);
+    e += static_cast<int>(bits >> consts::mantissa_bits) - consts::exponent_bias;
+    T m = sycl::bit_cast<T>((bits & mantissa_mask) | one_bits);
+    if (m > consts::sqrt2) {
+        m *= T(0.5);
+        e++;
+    }
+    // u is exact, so the rounding errors only affect the small correction terms
+    T u = m - T(1);
+    T hfsq = T(0.5) * u * u;
+    T s = u / (T(2) + u);
+    T log1p_u = u - (hfsq - s * (hfsq + log_series<Mode>(s)));
+    T ef = static_cast<T>(e);
+    return ef * consts::ln2_hi + (ef * consts::ln2_lo + log1p_u);
+}
+
+// sin(pi * r) and cos(pi * r) for |r| <= 1/4, truncated to about half of the mantissa bits:
+// up to t^5 and t^6 in single precision, t^9 and t^10 in double precision, t = pi * r
+template <typename T>
+inline T sinpi_poly_ep(T r) {
+    constexpr int terms = std::is_same_v<T, float> ? 2 : 4;
+    T t = r * fp_consts<T>::pi;
+    T t2 = t * t;
+    T p = (terms % 2 ? T(-1) : T(1)) * inv_factorial<T>(2 * terms + 1);
+#pragma unroll
+    for (int i = terms - 1; i >= 1; i--) {
+        p = (i % 2 ? T(-1) : T(1)) * inv_factorial<T>(2 * i + 1) + t2 * p;
+    }
+    return t + t * t2 * p;
+}
+
+template <typename T>
+inline T cospi_poly_ep(T r) {
+    constexpr int terms = std::is_same_v<T, float> ? 3 : 5;
+    T t = r * fp_consts<T>::pi;
+    T t2 = t * t;
+    T p = (terms % 2 ? T(-1) : T(1)) * inv_factorial<T>(2 * terms);
+#pragma unroll
+    for (int i = terms - 1; i >= 1; i--) {
+        p = (i % 2 ? T(-1) : T(1)) * inv_factorial<T>(2 * i) + t2 * p;
+    }
+    return T(1) + t2 * p;
+}
+
+// a = r + q / 2 with |r| <= 1/4, so that sinpi(a) and cospi(a) are +-sin(pi * r) or +-cos(pi * r)
+// depending on the quadrant q
+template <typename T>
+inline T sinpi_scalar_ep(T a) {
+    if (!(sycl::fabs(a) < fp_consts<T>::trig_limit)) {
+        return sycl::sinpi(a);
+    }
+    T qf = sycl::rint(a * T(2));
+    T r = a - qf * T(0.5);
+    switch (static_cast<int>(qf) & 3) {
+        case 0: return sinpi_poly_ep(r);
+        case 1: return cospi_poly_ep(r);
+        case 2: return -sinpi_poly_ep(r);
+        default: return -cospi_poly_ep(r);
+    }
+}
+
+template <typename T>
+inline T cospi_scalar_ep(T a) {
+    if (!(sycl::fabs(a) < fp_consts<T>::trig_limit)) {
+        return sycl::cospi(a);
+    }
+    T qf = sycl::rint(a * T(2));
+    T r = a - qf * T(0.5);
+    switch (static_cast<int>(qf) & 3) {
+        case 0: return cospi_poly_ep(r);
+        case 1: return -sinpi_poly_ep(r);
+        case 2: return -cospi_poly_ep(r);
+        default: return sinpi_poly_ep(r);
+    }
+}
+
+// In ep, pow(a, b) = exp(b * log(a)) for a positive finite a and a finite b. log is evaluated in
+// la so that its error is not amplified by |b * log(a)| beyond the ep accuracy of exp.
+template <typename T>
+inline T pow_scalar_ep(T a, T b) {
+    constexpr T inf = std::numeric_limits<T>::infinity();
+    if (a > T(0) && a < inf && sycl::fabs(b) < inf) {
+        T y = b * log_scalar<oneapi::math::vm::mode::la>(a);
+        return exp_scalar<oneapi::math::vm::mode::ep>(y);
+    }
+    return sycl::pow(a, b);
+}
+
+// Entry points, accepting scalars and sycl::vec arguments
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T exp_impl(const T& a) {
+    if constexpr (!is_relaxed<Mode>) {
+        return sycl::exp(a);
+    }
+    else if constexpr (is_vec<T>::value) {
+        return per_lane(a, [](auto x) { return exp_scalar<Mode>(x); });
+    }
+    else {
+        return exp_scalar<Mode>(a);
+    }
+}
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T log_impl(const T& a) {
+    if constexpr (!is_relaxed<Mode>) {
+        return sycl::log(a);
+    }
+    else if constexpr (is_vec<T>::value) {
+        return per_lane(a, [](auto x) { return log_scalar<Mode>(x); });
+    }
+    else {
+        return log_scalar<Mode>(a);
+    }
+}
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T pow_impl(const T& a, const T& b) {
+    if constexpr (Mode != oneapi::math::vm::mode::ep) {
+        return sycl::pow(a, b);
+    }
+    else if constexpr (is_vec<T>::value) {
+        return per_lane(a, b, [](auto x, auto y) { return pow_scalar_ep(x, y); });
+    }
+    else {
+        return pow_scalar_ep(a, b);
+    }
+}
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T sinpi_impl(const T& a) {
+    if constexpr (Mode != oneapi::math::vm::mode::ep) {
+        return sycl::sinpi(a);
+    }
+    else if constexpr (is_vec<T>::value) {
+        return per_lane(a, [](auto x) { return sinpi_scalar_ep(x); });
+    }
+    else {
+        return sinpi_scalar_ep(a);
+    }
+}
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T cospi_impl(const T& a) {
+    if constexpr (Mode != oneapi::math::vm::mode::ep) {
+        return sycl::cospi(a);
+    }
+    else if constexpr (is_vec<T>::value) {
+        return per_lane(a, [](auto x) { return cospi_scalar_ep(x); });
+    }
+    else {
+        return cospi_scalar_ep(a);
+    }
+}
+
+} // namespace detail
+} // namespace vm
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_VM_MATH_IMPL_HPP_
@@ -0,0 +1,1092 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+ONEMATH_EXPORT void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                        sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                        sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event add(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, const float* b, std::int64_t incb, float* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event add(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                            sycl::buffer<float, 1>& y,
+                            oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                            sycl::buffer<double, 1>& y,
+                            oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                            std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                            oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                            std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                            oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                            sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                            oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                            sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                            oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                               sycl::buffer<float, 1>& y,
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                               sycl::buffer<double, 1>& y,
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                               std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                               std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                               sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                               sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                        sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                        sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, const float* b, std::int64_t incb, float* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         sycl::buffer<float, 1>& y,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         sycl::buffer<double, 1>& y,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a,
+                                std::int64_t inca, float* y, std::int64_t incy,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a,
+                                std::int64_t inca, double* y, std::int64_t incy,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                const std::int64_t* index,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                const std::int64_t* index,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                        sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                        sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, const float* b, std::int64_t incb, float* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                        sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                        sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, const float* b, std::int64_t incb, float* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                               std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                               float* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                               double* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         sycl::buffer<float, 1>& y,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         sycl::buffer<double, 1>& y,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a,
+                                std::int64_t inca, float* y, std::int64_t incy,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a,
+                                std::int64_t inca, double* y, std::int64_t incy,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                         oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                const std::int64_t* index,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                const std::int64_t* index,
+                                const std::vector<sycl::event>& dependencies = {},
+                                oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void abs(sycl::queue& queue, std::int64_t n,
+                        sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                               float* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                               double* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                        sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                        sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event abs(sycl::queue& queue, std::int64_t n, const float* a_re,
+                               const float* a_im, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event abs(sycl::queue& queue, std::int64_t n, const double* a_re,
+                               const double* a_im, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void arg(sycl::queue& queue, std::int64_t n,
+                        sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                               float* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                               double* y, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                        sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                        sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event arg(sycl::queue& queue, std::int64_t n, const float* a_re,
+                               const float* a_im, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event arg(sycl::queue& queue, std::int64_t n, const double* a_re,
+                               const double* a_im, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<std::complex<float>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<std::complex<double>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::complex<float>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::complex<double>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a, float* y_re,
+                               float* y_im, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a, double* y_re,
+                               double* y_im, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                        sycl::buffer<std::complex<float>, 1>& b,
+                        sycl::buffer<std::complex<float>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n,
+                        sycl::buffer<std::complex<double>, 1>& a,
+                        sycl::buffer<std::complex<double>, 1>& b,
+                        sycl::buffer<std::complex<double>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                               const std::complex<float>* b, std::complex<float>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                               const std::complex<double>* b, std::complex<double>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                        sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+                        sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re,
+                        sycl::buffer<float, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                        sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+                        sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+                        sycl::buffer<double, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const float* a_re,
+                               const float* a_im, const float* b_re, const float* b_im, float* y_re,
+                               float* y_im, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event div(sycl::queue& queue, std::int64_t n, const double* a_re,
+                               const double* a_im, const double* b_re, const double* b_im,
+                               double* y_re, double* y_im,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                        sycl::buffer<std::complex<float>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n,
+                        sycl::buffer<std::complex<double>, 1>& a,
+                        sycl::buffer<std::complex<double>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                               std::complex<float>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                               std::complex<double>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                        sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+                        sycl::buffer<float, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                        sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+                        sycl::buffer<double, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a_re,
+                               const float* a_im, float* y_re, float* y_im,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a_re,
+                               const double* a_im, double* y_re, double* y_im,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                        sycl::buffer<std::complex<float>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n,
+                        sycl::buffer<std::complex<double>, 1>& a,
+                        sycl::buffer<std::complex<double>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                               std::complex<float>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                               std::complex<double>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                        sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+                        sycl::buffer<float, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                        sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+                        sycl::buffer<double, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const float* a_re,
+                               const float* a_im, float* y_re, float* y_im,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event log(sycl::queue& queue, std::int64_t n, const double* a_re,
+                               const double* a_im, double* y_re, double* y_im,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                        sycl::buffer<std::complex<float>, 1>& b,
+                        sycl::buffer<std::complex<float>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n,
+                        sycl::buffer<std::complex<double>, 1>& a,
+                        sycl::buffer<std::complex<double>, 1>& b,
+                        sycl::buffer<std::complex<double>, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                               const std::complex<float>* b, std::complex<float>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                               const std::complex<double>* b, std::complex<double>* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                        sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+                        sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re,
+                        sycl::buffer<float, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                        sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+                        sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+                        sycl::buffer<double, 1>& y_im,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a_re,
+                               const float* a_im, const float* b_re, const float* b_im, float* y_re,
+                               float* y_im, const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
+
+ONEMATH_EXPORT sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a_re,
+                               const double* a_im, const double* b_re, const double* b_im,
+                               double* y_re, double* y_im,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined);
@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_VM_SPECIAL_IMPL_HPP_
+#define _ONEMATH_VM_SPECIAL_IMPL_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/vm/detail/math_impl.hpp"
+#include "oneapi/math/vm/types.hpp"
+
+// Device implementations of the special functions that have no sycl:: built-in: erfinv, cdfnorm
+// and cdfnorminv. They are shared by the generic VM backend and by the icdf transform of the
+// device gaussian distribution; erf, erfc, lgamma and tgamma are the sycl:: built-ins.
+//
+// erfinv and cdfnorminv use the polynomials of M. Giles, "Approximating the erfinv function", in
+// w = -log((1 - x) * (1 + x)), extended with a rational approximation of the far tail that
+// cdfnorminv reaches for p down to the smallest denormal. The mode only selects the accuracy of
+// the log and exp evaluated on the way, see math_impl.hpp.
+
+namespace oneapi {
+namespace math {
+namespace vm {
+namespace detail {
+
+// Coefficients in Horner order, highest degree first. Each range is approximated in w or in
+// sqrt(w), shifted to the middle of the range; the tail is p(t) / q(t) with
+// t = sqrt(w) - tail_shift.
+template <typename T>
+struct erfinv_table;
+
+template <>
+struct erfinv_table<float> {
+    static constexpr float central_limit = 5.0f;
+    static constexpr float central_shift = 2.5f;
+    static constexpr float central[9] = {
+        0x1.E2CB10P-26f,  0x1.70966CP-22f,  -0x1.D8E6AEP-19f, -0x1.26B582P-18f, 0x1.CA65B6P-13f,
+        -0x1.48A810P-10f, -0x1.11C9DEP-8f,  0x1.F91EC6P-3f,   0x1.805C5EP+0f,
+    };
+    static constexpr float intermediate_limit = 16.0f;
+    static constexpr float intermediate_shift = 3.0f;
+    static constexpr float intermediate[9] = {
+        -0x1.A3E136P-13f, 0x1.A76AD6P-14f,  0x1.61B8E4P-10f,  -0x1.E17BCEP-9f,  0x1.7824F6P-8f,
+        -0x1.F38BAEP-8f,  0x1.354AFCP-7f,   0x1.006DB6P+0f,   0x1.6A9EFCP+1f,
+    };
+    static constexpr float tail_shift = 4.0f;
+    static constexpr float tail_p[4] = {
+        0x1.4A5ECCP-5f, 0x1.2386CEP-1f, 0x1.4A81D8P+1f, 0x1.EB7E08P+1f,
+    };
+    static constexpr float tail_q[4] = {
+        0x1.BDDD40P-21f, 0x1.4A06DEP-5f,  0x1.A361BAP-2f,  0x1.000000P+0f,
+    };
+    static constexpr float inv_sqrt2_hi = 0x1.6A09E6P-1f;
+    static constexpr float inv_sqrt2_lo = 0x1.9FCEF4P-27f;
+    static constexpr float two_over_sqrtpi = 0x1.20DD76P+0f;
+};
+
+template <>
+struct erfinv_table<double> {
+    static constexpr double central_limit = 6.25;
+    static constexpr double central_shift = 3.125;
+    static constexpr double central[23] = {
+        -0x1.135D2E746E627P-68, -0x1.8DDF93324D327P-63, 0x1.7B83EEF0B7C9FP-60,
+        0x1.9BA72CD589B91P-57,  -0x1.33689090A6B96P-53, 0x1.82E11898132E0P-56,
+        0x1.DE4ACFD9E26BAP-48,  -0x1.6D33EED66C487P-45, -0x1.6F2167040D8E2P-44,
+        0x1.72A22C2D77E20P-39,  -0x1.C8859C4E5C0AFP-37, -0x1.DC583D118A561P-35,
+        0x1.20F47CCF46B3CP-30,  -0x1.1A9E38DC84D60P-28, -0x1.F36CD6D3D46A9P-26,
+        0x1.C6B4F5D03B787P-22,  -0x1.6E8A5434AE8A2P-20, -0x1.D1D1F7B8736F6P-17,
+        0x1.879C2A212F024P-13,  -0x1.845769484FCA8P-11, -0x1.8B6C33114F909P-8,
+        0x1.EBD80D9B13E28P-3,   0x1.A755E7C99AE86P+0,
+    };
+    static constexpr double intermediate_limit = 16.0;
+    static constexpr double intermediate_shift = 3.25;
+    static constexpr double intermediate[19] = {
+        0x1.3040F87DBD932P-29,  0x1.85CBE52878635P-24,  -0x1.2777453DD3955P-22,
+        0x1.395ABCD554C6CP-26,  0x1.936388A3790ADP-20,  -0x1.0D5DB812B5083P-18,
+        0x1.8860CD5D652F6P-19,  0x1.A29A0CACDFB23P-17,  -0x1.8CEF1F80281F2P-15,
+        0x1.1E684D0B9188AP-14,  0x1.932CD54C8A222P-16,  -0x1.7448A89EF8AA3P-12,
+        0x1.F3CC55AD40C25P-11,  -0x1.BA924132F38B1P-10, 0x1.468EECA533CF8P-9,
+        -0x1.EBADABB891BBDP-9,  0x1.5FFCFE5B76AFCP-8,   0x1.0158A6D641D39P+0,
+        0x1.8ABCC380D5A48P+1,
+    };
+    // sqrt(w) < far_limit, which erfinv never leaves in double precision
+    static constexpr double far_limit = 6.0;
+    static constexpr double far_shift = 5.0;
+    static constexpr double far[17] = {
+        -0x1.DCEC3A7785389P-36, -0x1.18FEEC0E38727P-32, 0x1.9E6BF2DDA45E3P-30,
+        -0x1.0468FB24E2F5FP-28, 0x1.05AC6A8FBA182P-27,  -0x1.0102E495FB9C0P-26,
+        0x1.F4C20E1334AF8P-26,  -0x1.22D220FDF9C3EP-24, 0x1.EBC8BB824CB54P-23,
+        -0x1.0A8D40EA372CCP-20, 0x1.2FBD29D093D2BP-18,  -0x1.4A3497E1E0FACP-16,
+        0x1.3EBF4EB00938FP-14,  -0x1.C2F36A8FC5D53P-13, -0x1.22EA5DF04047CP-13,
+        0x1.02A30D1FBA0DCP+0,   0x1.3664DDD1AD7FBP+2,
+    };
+    static constexpr double tail_shift = 6.0;
+    static constexpr double tail_p[8] = {
+        0x1.32C515A1D5C72P-24, 0x1.6988854E04080P-17, 0x1.223B3506F6AEEP-11, 0x1.B3E8E8753A5EAP-7,
+        0x1.58DC798B21C9AP-3,  0x1.286DC710890F5P+0,  0x1.064C0DB532774P+2,  0x1.7708D123A9940P+2,
+    };
+    static constexpr double tail_q[8] = {
+        0x1.AC43813344BB5P-51, 0x1.32C4AB500737BP-24, 0x1.5B28A428959F8P-17, 0x1.01CA6225AEC06P-11,
+        0x1.53EBA8BEAB41CP-7,  0x1.B5BA04227E130P-4,  0x1.0DE0A56B934D2P-1,  0x1.0000000000000P+0,
+    };
+    static constexpr double inv_sqrt2_hi = 0x1.6A09E667F3BCDP-1;
+    static constexpr double inv_sqrt2_lo = -0x1.BDD3413B26456P-55;
+    static constexpr double two_over_sqrtpi = 0x1.20DD750429B6DP+0;
+};
+
+template <typename T, std::size_t N>
+inline T horner(const T (&c)[N], T t) {
+    T p = c[0];
+#pragma unroll
+    for (std::size_t i = 1; i < N; i++) {
+        p = c[i] + p * t;
+    }
+    return p;
+}
+
+// erfinv(x) for |x| < 1, given w = -log((1 - x) * (1 + x)) which the callers evaluate without
+// cancellation
+template <typename T>
+inline T erfinv_from_w(T x, T w) {
+    using table = erfinv_table<T>;
+    if (w < table::central_limit) {
+        return x * horner(table::central, w - table::central_shift);
+    }
+    T s = sycl::sqrt(w);
+    if (w < table::intermediate_limit) {
+        return x * horner(table::intermediate, s - table::intermediate_shift);
+    }
+    if constexpr (std::is_same_v<T, double>) {
+        if (s < table::far_limit) {
+            return x * horner(table::far, s - table::far_shift);
+        }
+    }
+    T t = s - table::tail_shift;
+    return sycl::copysign(horner(table::tail_p, t) / horner(table::tail_q, t), x);
+}
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T erfinv_scalar(T a) {
+    if (!(sycl::fabs(a) < T(1))) {
+        // +-1, |a| > 1 and NaN
+        return sycl::fabs(a) == T(1) ? sycl::copysign(std::numeric_limits<T>::infinity(), a)
+                                     : std::numeric_limits<T>::quiet_NaN();
+    }
+    T w = -log_impl<Mode>((T(1) - a) * (T(1) + a));
+    return erfinv_from_w(a, w);
+}
+
+// cdfnorminv(p) = sqrt(2) * erfinv(2 * p - 1), where (1 - x) * (1 + x) = 4 * p * (1 - p) keeps
+// the full relative accuracy of p in both tails
+template <oneapi::math::vm::mode Mode, typename T>
+inline T cdfnorminv_scalar(T p) {
+    if (!(p > T(0) && p < T(1))) {
+        if (p == T(0)) {
+            return -std::numeric_limits<T>::infinity();
+        }
+        return p == T(1) ? std::numeric_limits<T>::infinity()
+                         : std::numeric_limits<T>::quiet_NaN();
+    }
+    T w = -log_impl<Mode>(T(4) * p * (T(1) - p));
+    return fp_consts<T>::sqrt2 * erfinv_from_w(T(2) * p - T(1), w);
+}
+
+// Entry points, accepting scalars and sycl::vec arguments
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T erfinv_impl(const T& a) {
+    if constexpr (is_vec<T>::value) {
+        return per_lane(a, [](auto x) { return erfinv_scalar<Mode>(x); });
+    }
+    else {
+        return erfinv_scalar<Mode>(a);
+    }
+}
+
+template <oneapi::math::vm::mode Mode, typename T>
+inline T cdfnorminv_impl(const T& a) {
+    if constexpr (is_vec<T>::value) {
+        return per_lane(a, [](auto x) { return cdfnorminv_scalar<Mode>(x); });
+    }
+    else {
+        return cdfnorminv_scalar<Mode>(a);
+    }
+}
+
+// cdfnorm(a) = erfc(z) / 2 with z = -a / sqrt(2). Outside ep the rounding error z_lo of z is
+// corrected with erfc(z + z_lo) ~ erfc(z) - 2 / sqrt(pi) * exp(-z^2) * z_lo, which would
+// otherwise be amplified by up to 2 * z^2 in the tail. a is clamped for z_lo only: beyond |a| = 40
+// the correction underflows anyway, and infinite arguments would turn it into a NaN.
+template <oneapi::math::vm::mode Mode, typename T>
+inline T cdfnorm_impl(const T& a) {
+    using table = erfinv_table<typename element_type<T>::type>;
+    T z = -a * table::inv_sqrt2_hi;
+    if constexpr (Mode == oneapi::math::vm::mode::ep) {
+        return T(0.5) * sycl::erfc(z);
+    }
+    else {
+        T a_c = sycl::clamp(a, T(-40), T(40));
+        T z_lo = sycl::fma(-a_c, T(table::inv_sqrt2_hi), a_c * table::inv_sqrt2_hi) -
+                 a_c * table::inv_sqrt2_lo;
+        T correction = table::two_over_sqrtpi * exp_impl<Mode>(-z * z) * z_lo;
+        return T(0.5) * (sycl::erfc(z) - correction);
+    }
+}
+
+} // namespace detail
+} // namespace vm
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_VM_SPECIAL_IMPL_HPP_
@@ -0,0 +1,1525 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+static inline void add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, mode);
+}
+static inline void add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, mode);
+}
+static inline sycl::event add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline sycl::event add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline void add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& b,
+                       std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline void add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+                       std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, const float* b, std::int64_t incb,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, const double* b,
+                              std::int64_t incb, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline void add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline void add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline sycl::event add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event add(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::add(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline void cdfnorm(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                           sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, mode);
+}
+static inline void cdfnorm(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                           sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event cdfnorm(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event cdfnorm(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void cdfnorm(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                           sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                           std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void cdfnorm(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                           sycl::buffer<double, 1>& a, std::int64_t inca,
+                           sycl::buffer<double, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event cdfnorm(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a,
+    std::int64_t inca, float* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, inca, y, incy,
+                                                 dependencies, mode);
+}
+static inline sycl::event cdfnorm(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a,
+    std::int64_t inca, double* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, inca, y, incy,
+                                                 dependencies, mode);
+}
+static inline void cdfnorm(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                           sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                           sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void cdfnorm(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                           sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                           sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event cdfnorm(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, index, dependencies,
+                                                 mode);
+}
+static inline sycl::event cdfnorm(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorm(selector.get_queue(), n, a, y, index, dependencies,
+                                                 mode);
+}
+static inline void cdfnorminv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, mode);
+}
+static inline void cdfnorminv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event cdfnorminv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, dependencies,
+                                                    mode);
+}
+static inline sycl::event cdfnorminv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, dependencies,
+                                                    mode);
+}
+static inline void cdfnorminv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              sycl::buffer<float, 1>& a, std::int64_t inca,
+                              sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void cdfnorminv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              sycl::buffer<double, 1>& a, std::int64_t inca,
+                              sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event cdfnorminv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a,
+    std::int64_t inca, float* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+static inline sycl::event cdfnorminv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a,
+    std::int64_t inca, double* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+static inline void cdfnorminv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void cdfnorminv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event cdfnorminv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, index,
+                                                    dependencies, mode);
+}
+static inline sycl::event cdfnorminv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cdfnorminv(selector.get_queue(), n, a, y, index,
+                                                    dependencies, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& b,
+                       std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+                       std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, const float* b, std::int64_t incb,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, const double* b,
+                              std::int64_t incb, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline void erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, mode);
+}
+static inline void erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline void erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event erf(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erf(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline void erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, mode);
+}
+static inline void erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                        std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                        std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const float* a, std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, inca, y, incy,
+                                              dependencies, mode);
+}
+static inline sycl::event erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, inca, y, incy,
+                                              dependencies, mode);
+}
+static inline void erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const float* a, float* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, index, dependencies,
+                                              mode);
+}
+static inline sycl::event erfc(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const double* a, double* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfc(selector.get_queue(), n, a, y, index, dependencies,
+                                              mode);
+}
+static inline void erfinv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, mode);
+}
+static inline void erfinv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event erfinv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event erfinv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void erfinv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                          std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void erfinv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                          std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event erfinv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a,
+    std::int64_t inca, float* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, inca, y, incy,
+                                                dependencies, mode);
+}
+static inline sycl::event erfinv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a,
+    std::int64_t inca, double* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, inca, y, incy,
+                                                dependencies, mode);
+}
+static inline void erfinv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                          sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void erfinv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                          sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event erfinv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, index, dependencies,
+                                                mode);
+}
+static inline sycl::event erfinv(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::erfinv(selector.get_queue(), n, a, y, index, dependencies,
+                                                mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline void inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, mode);
+}
+static inline void inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline void inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event inv(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::inv(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline void lgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, mode);
+}
+static inline void lgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event lgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event lgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void lgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                          std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void lgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                          std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event lgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a,
+    std::int64_t inca, float* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, inca, y, incy,
+                                                dependencies, mode);
+}
+static inline sycl::event lgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a,
+    std::int64_t inca, double* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, inca, y, incy,
+                                                dependencies, mode);
+}
+static inline void lgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                          sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void lgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                          sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event lgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, index, dependencies,
+                                                mode);
+}
+static inline sycl::event lgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::lgamma(selector.get_queue(), n, a, y, index, dependencies,
+                                                mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                       std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, inca, y, incy,
+                                             dependencies, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, index, dependencies,
+                                             mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& b,
+                       std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+                       std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, const float* b, std::int64_t incb,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, const double* b,
+                              std::int64_t incb, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline void pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, mode);
+}
+static inline void pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, mode);
+}
+static inline sycl::event pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline sycl::event pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline void pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& b,
+                       std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline void pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+                       std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::int64_t inca, const float* b, std::int64_t incb,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline sycl::event pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::int64_t inca, const double* b,
+                              std::int64_t incb, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, inca, b, incb, y, incy,
+                                             dependencies, mode);
+}
+static inline void pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline void pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, index, mode);
+}
+static inline sycl::event pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, const float* b, float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline sycl::event pow(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, const double* b, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::pow(selector.get_queue(), n, a, b, y, index, dependencies,
+                                             mode);
+}
+static inline void sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, mode);
+}
+static inline void sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                        std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                        std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const float* a, std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, inca, y, incy,
+                                              dependencies, mode);
+}
+static inline sycl::event sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, inca, y, incy,
+                                              dependencies, mode);
+}
+static inline void sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                        sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                        sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const float* a, float* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, index, dependencies,
+                                              mode);
+}
+static inline sycl::event sqrt(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                               const double* a, double* y, const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::sqrt(selector.get_queue(), n, a, y, index, dependencies,
+                                              mode);
+}
+static inline void tgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, mode);
+}
+static inline void tgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event tgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event tgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void tgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                          std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline void tgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                          std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, inca, y, incy, mode);
+}
+static inline sycl::event tgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a,
+    std::int64_t inca, float* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, inca, y, incy,
+                                                dependencies, mode);
+}
+static inline sycl::event tgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a,
+    std::int64_t inca, double* y, std::int64_t incy,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, inca, y, incy,
+                                                dependencies, mode);
+}
+static inline void tgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                          sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, index, mode);
+}
+static inline void tgamma(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                          sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, index, mode);
+}
+static inline sycl::event tgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const float* a, float* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, index, dependencies,
+                                                mode);
+}
+static inline sycl::event tgamma(
+    backend_selector<backend::VM_BACKEND> selector, std::int64_t n, const double* a, double* y,
+    const std::int64_t* index, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::tgamma(selector.get_queue(), n, a, y, index, dependencies,
+                                                mode);
+}
+static inline void abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a, y, mode);
+}
+static inline void abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<float>* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<double>* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a_re, a_im, y, mode);
+}
+static inline void abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a_re, a_im, y, mode);
+}
+static inline sycl::event abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a_re, const float* a_im, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a_re, a_im, y, dependencies,
+                                             mode);
+}
+static inline sycl::event abs(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a_re, const double* a_im, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::abs(selector.get_queue(), n, a_re, a_im, y, dependencies,
+                                             mode);
+}
+static inline void arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a, y, mode);
+}
+static inline void arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<float>* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<double>* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a_re, a_im, y, mode);
+}
+static inline void arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a_re, a_im, y, mode);
+}
+static inline sycl::event arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a_re, const float* a_im, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a_re, a_im, y, dependencies,
+                                             mode);
+}
+static inline sycl::event arg(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a_re, const double* a_im, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::arg(selector.get_queue(), n, a_re, a_im, y, dependencies,
+                                             mode);
+}
+static inline void cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y, mode);
+}
+static inline void cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y_re,
+                       sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y_re, y_im, mode);
+}
+static inline void cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y_re,
+                       sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y_re, y_im, mode);
+}
+static inline sycl::event cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a, float* y_re, float* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y_re, y_im, dependencies,
+                                             mode);
+}
+static inline sycl::event cis(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a, double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::cis(selector.get_queue(), n, a, y_re, y_im, dependencies,
+                                             mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& b,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& b,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<float>* a, const std::complex<float>* b,
+                              std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<double>* a, const std::complex<double>* b,
+                              std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im,
+                       sycl::buffer<float, 1>& b_re, sycl::buffer<float, 1>& b_im,
+                       sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re, y_im,
+                                      mode);
+}
+static inline void div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+                       sycl::buffer<double, 1>& b_re, sycl::buffer<double, 1>& b_im,
+                       sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re, y_im,
+                                      mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a_re, const float* a_im, const float* b_re,
+                              const float* b_im, float* y_re, float* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re,
+                                             y_im, dependencies, mode);
+}
+static inline sycl::event div(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a_re, const double* a_im, const double* b_re,
+                              const double* b_im, double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::div(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re,
+                                             y_im, dependencies, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<float>* a, std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<double>* a, std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im,
+                       sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a_re, a_im, y_re, y_im, mode);
+}
+static inline void exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+                       sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a_re, a_im, y_re, y_im, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a_re, const float* a_im, float* y_re, float* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a_re, a_im, y_re, y_im,
+                                             dependencies, mode);
+}
+static inline sycl::event exp(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a_re, const double* a_im, double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::exp(selector.get_queue(), n, a_re, a_im, y_re, y_im,
+                                             dependencies, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<float>* a, std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<double>* a, std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a, y, dependencies, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im,
+                       sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a_re, a_im, y_re, y_im, mode);
+}
+static inline void log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+                       sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a_re, a_im, y_re, y_im, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a_re, const float* a_im, float* y_re, float* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a_re, a_im, y_re, y_im,
+                                             dependencies, mode);
+}
+static inline sycl::event log(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a_re, const double* a_im, double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::log(selector.get_queue(), n, a_re, a_im, y_re, y_im,
+                                             dependencies, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& b,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& b,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<float>* a, const std::complex<float>* b,
+                              std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const std::complex<double>* a, const std::complex<double>* b,
+                              std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a, b, y, dependencies, mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im,
+                       sycl::buffer<float, 1>& b_re, sycl::buffer<float, 1>& b_im,
+                       sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re, y_im,
+                                      mode);
+}
+static inline void mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                       sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+                       sycl::buffer<double, 1>& b_re, sycl::buffer<double, 1>& b_im,
+                       sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re, y_im,
+                                      mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const float* a_re, const float* a_im, const float* b_re,
+                              const float* b_im, float* y_re, float* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re,
+                                             y_im, dependencies, mode);
+}
+static inline sycl::event mul(backend_selector<backend::VM_BACKEND> selector, std::int64_t n,
+                              const double* a_re, const double* a_im, const double* b_re,
+                              const double* b_im, double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return oneapi::math::vm::VM_BACKEND::mul(selector.get_queue(), n, a_re, a_im, b_re, b_im, y_re,
+                                             y_im, dependencies, mode);
+}
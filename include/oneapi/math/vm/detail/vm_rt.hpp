@@ -0,0 +1,1364 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_VM_RT_HPP_
+#define _ONEMATH_VM_RT_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/detail/get_device_id.hpp"
+#include "oneapi/math/vm/detail/vm_loader.hpp"
+#include "oneapi/math/vm/types.hpp"
+
+namespace oneapi {
+namespace math {
+namespace vm {
+
+static inline void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::add(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::add(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::add(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::add(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                       sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::add(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                       sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::add(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::add(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline sycl::event add(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                              std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::add(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::add(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::add(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::add(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::add(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorm(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorm(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorm(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorm(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorm(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorm(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorm(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorm(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                           sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorm(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                           sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                           oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorm(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorm(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event cdfnorm(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorm(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& y,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorminv(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& y,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorminv(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorminv(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorminv(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorminv(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorminv(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorminv(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorminv(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorminv(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cdfnorminv(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorminv(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event cdfnorminv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cdfnorminv(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                       sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                       sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                              std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erf(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erf(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erf(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erf(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erf(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erf(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erf(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erf(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erf(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erf(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erf(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erf(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfc(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfc(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfc(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfc(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfc(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfc(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfc(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfc(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfc(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfc(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfc(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfc(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          sycl::buffer<float, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfinv(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          sycl::buffer<double, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfinv(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfinv(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfinv(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfinv(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfinv(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfinv(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfinv(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfinv(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::erfinv(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfinv(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event erfinv(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::erfinv(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::inv(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::inv(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::inv(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::inv(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::inv(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::inv(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::inv(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::inv(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::inv(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::inv(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::inv(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::inv(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          sycl::buffer<float, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::lgamma(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          sycl::buffer<double, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::lgamma(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::lgamma(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::lgamma(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::lgamma(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::lgamma(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::lgamma(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::lgamma(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::lgamma(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::lgamma(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::lgamma(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event lgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::lgamma(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, double* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                              const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                       sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                       sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                              std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::pow(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::pow(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::pow(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::pow(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                       sycl::buffer<float, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::pow(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                       sycl::buffer<double, 1>& y, std::int64_t incy,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::pow(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, mode);
+}
+static inline sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                              const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::pow(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::int64_t inca, const double* b, std::int64_t incb, double* y,
+                              std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::pow(get_device_id(queue), queue, n, a, inca, b, incb, y, incy, dependencies,
+                       mode);
+}
+static inline void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::pow(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                       sycl::buffer<std::int64_t, 1>& index,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::pow(get_device_id(queue), queue, n, a, b, y, index, mode);
+}
+static inline sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                              float* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::pow(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b,
+                              double* y, const std::int64_t* index,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::pow(get_device_id(queue), queue, n, a, b, y, index, dependencies, mode);
+}
+static inline void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::sqrt(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::sqrt(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::sqrt(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::sqrt(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::sqrt(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::sqrt(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a,
+                               std::int64_t inca, float* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::sqrt(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a,
+                               std::int64_t inca, double* y, std::int64_t incy,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::sqrt(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                        sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::sqrt(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                        sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                        oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::sqrt(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::sqrt(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                               const std::int64_t* index,
+                               const std::vector<sycl::event>& dependencies = {},
+                               oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::sqrt(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          sycl::buffer<float, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::tgamma(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          sycl::buffer<double, 1>& y,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::tgamma(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::tgamma(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::tgamma(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::tgamma(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::tgamma(get_device_id(queue), queue, n, a, inca, y, incy, mode);
+}
+static inline sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::tgamma(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+    std::int64_t incy, const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::tgamma(get_device_id(queue), queue, n, a, inca, y, incy, dependencies, mode);
+}
+static inline void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::tgamma(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::tgamma(get_device_id(queue), queue, n, a, y, index, mode);
+}
+static inline sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const float* a, float* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::tgamma(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline sycl::event tgamma(
+    sycl::queue& queue, std::int64_t n, const double* a, double* y, const std::int64_t* index,
+    const std::vector<sycl::event>& dependencies = {},
+    oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::tgamma(get_device_id(queue), queue, n, a, y, index, dependencies, mode);
+}
+static inline void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::abs(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::abs(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                              float* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::abs(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                              double* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::abs(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                       sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::abs(get_device_id(queue), queue, n, a_re, a_im, y, mode);
+}
+static inline void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                       sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::abs(get_device_id(queue), queue, n, a_re, a_im, y, mode);
+}
+static inline sycl::event abs(sycl::queue& queue, std::int64_t n, const float* a_re,
+                              const float* a_im, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::abs(get_device_id(queue), queue, n, a_re, a_im, y, dependencies, mode);
+}
+static inline sycl::event abs(sycl::queue& queue, std::int64_t n, const double* a_re,
+                              const double* a_im, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::abs(get_device_id(queue), queue, n, a_re, a_im, y, dependencies, mode);
+}
+static inline void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::arg(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::arg(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                              float* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::arg(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                              double* y, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::arg(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                       sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::arg(get_device_id(queue), queue, n, a_re, a_im, y, mode);
+}
+static inline void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                       sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::arg(get_device_id(queue), queue, n, a_re, a_im, y, mode);
+}
+static inline sycl::event arg(sycl::queue& queue, std::int64_t n, const float* a_re,
+                              const float* a_im, float* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::arg(get_device_id(queue), queue, n, a_re, a_im, y, dependencies, mode);
+}
+static inline sycl::event arg(sycl::queue& queue, std::int64_t n, const double* a_re,
+                              const double* a_im, double* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::arg(get_device_id(queue), queue, n, a_re, a_im, y, dependencies, mode);
+}
+static inline void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cis(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cis(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a,
+                              std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cis(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a,
+                              std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cis(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cis(get_device_id(queue), queue, n, a, y_re, y_im, mode);
+}
+static inline void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::cis(get_device_id(queue), queue, n, a, y_re, y_im, mode);
+}
+static inline sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a, float* y_re,
+                              float* y_im, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cis(get_device_id(queue), queue, n, a, y_re, y_im, dependencies, mode);
+}
+static inline sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a, double* y_re,
+                              double* y_im, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::cis(get_device_id(queue), queue, n, a, y_re, y_im, dependencies, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& b,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& b,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                              const std::complex<float>* b, std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                              const std::complex<double>* b, std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                       sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+                       sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re,
+                       sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im, mode);
+}
+static inline void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                       sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+                       sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+                       sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::div(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const float* a_re,
+                              const float* a_im, const float* b_re, const float* b_im, float* y_re,
+                              float* y_im, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im,
+                       dependencies, mode);
+}
+static inline sycl::event div(sycl::queue& queue, std::int64_t n, const double* a_re,
+                              const double* a_im, const double* b_re, const double* b_im,
+                              double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::div(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im,
+                       dependencies, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                              std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                              std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                       sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+                       sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, mode);
+}
+static inline void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                       sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+                       sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::exp(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a_re,
+                              const float* a_im, float* y_re, float* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, dependencies, mode);
+}
+static inline sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a_re,
+                              const double* a_im, double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::exp(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, dependencies, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a, y, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                              std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                              std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a, y, dependencies, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                       sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+                       sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, mode);
+}
+static inline void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                       sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+                       sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::log(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const float* a_re,
+                              const float* a_im, float* y_re, float* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, dependencies, mode);
+}
+static inline sycl::event log(sycl::queue& queue, std::int64_t n, const double* a_re,
+                              const double* a_im, double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::log(get_device_id(queue), queue, n, a_re, a_im, y_re, y_im, dependencies, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                       sycl::buffer<std::complex<float>, 1>& b,
+                       sycl::buffer<std::complex<float>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                       sycl::buffer<std::complex<double>, 1>& b,
+                       sycl::buffer<std::complex<double>, 1>& y,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a, b, y, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                              const std::complex<float>* b, std::complex<float>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                              const std::complex<double>* b, std::complex<double>* y,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a, b, y, dependencies, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                       sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+                       sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re,
+                       sycl::buffer<float, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im, mode);
+}
+static inline void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                       sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+                       sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+                       sycl::buffer<double, 1>& y_im,
+                       oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::mul(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a_re,
+                              const float* a_im, const float* b_re, const float* b_im, float* y_re,
+                              float* y_im, const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im,
+                       dependencies, mode);
+}
+static inline sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a_re,
+                              const double* a_im, const double* b_re, const double* b_im,
+                              double* y_re, double* y_im,
+                              const std::vector<sycl::event>& dependencies = {},
+                              oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::mul(get_device_id(queue), queue, n, a_re, a_im, b_re, b_im, y_re, y_im,
+                       dependencies, mode);
+}
+
+} // namespace vm
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_VM_RT_HPP_
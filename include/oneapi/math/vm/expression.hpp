@@ -0,0 +1,567 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_VM_EXPRESSION_HPP_
+#define _ONEMATH_VM_EXPRESSION_HPP_
+
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/exceptions.hpp"
+#include "oneapi/math/vm/detail/math_impl.hpp"
+#include "oneapi/math/vm/detail/special_impl.hpp"
+#include "oneapi/math/vm/types.hpp"
+
+// Fused element-wise expressions. vm::input wraps a vector argument, a USM pointer or a buffer
+// with a BLAS-style increment; the arithmetic operators and the vm functions applied to
+// expressions build a tree that vm::eval evaluates in a single kernel, e.g.
+//
+//     vm::eval(queue, n, y, a * vm::exp(b * vm::input(x) + c));
+//
+// reads x and writes y once instead of making a memory pass per operation. The kernel runs on any
+// SYCL device with the device implementations shared with the generic VM backend, so the result
+// does not depend on the backends enabled in the build.
+
+namespace oneapi {
+namespace math {
+namespace vm {
+namespace detail {
+
+struct expression_tag {};
+
+template <typename E>
+constexpr bool is_expression_v = std::is_base_of_v<expression_tag, E>;
+
+// Every work-item evaluates a block of 64 bytes as a sycl::vec, as in the generic VM backend
+template <typename T>
+constexpr int expression_width = 64 / sizeof(T);
+
+inline std::int64_t first_element(std::int64_t n, std::int64_t inc) {
+    return inc < 0 ? (1 - n) * inc : 0;
+}
+
+inline void check_expression_inc(std::int64_t inc) {
+    if (inc == 0) {
+        throw oneapi::math::invalid_argument("vm", "eval", "increment == 0");
+    }
+}
+
+template <typename T>
+inline void check_expression_size(std::int64_t n, std::int64_t inc, sycl::buffer<T, 1>& buf) {
+    if (n > 0 && static_cast<std::int64_t>(buf.size()) < 1 + (n - 1) * std::abs(inc)) {
+        throw oneapi::math::invalid_argument("vm", "eval", "buffer size < 1 + (n - 1) * |inc|");
+    }
+}
+
+// Vector seen by the kernel; Data is a USM pointer or an accessor. A negative increment walks
+// the vector backwards from its last element, as in BLAS.
+template <typename T, typename Data>
+struct vector_node : expression_tag {
+    using value_type = T;
+
+    vector_node(Data data, std::int64_t n, std::int64_t inc)
+            : data(data),
+              offset(first_element(n, inc)),
+              inc(inc) {}
+
+    decltype(auto) operator[](std::int64_t i) const {
+        return data[offset + i * inc];
+    }
+
+    template <oneapi::math::vm::mode Mode, typename V>
+    V eval(std::int64_t i) const {
+        if constexpr (is_vec<V>::value) {
+            V v;
+#pragma unroll
+            for (int k = 0; k < static_cast<int>(V::size()); k++) {
+                v[k] = (*this)[i + k];
+            }
+            return v;
+        }
+        else {
+            return (*this)[i];
+        }
+    }
+
+    Data data;
+    std::int64_t offset;
+    std::int64_t inc;
+};
+
+template <typename T>
+struct usm_input : expression_tag {
+    using value_type = T;
+
+    usm_input(const T* x, std::int64_t incx) : x(x), incx(incx) {}
+
+    void check(std::int64_t n) const {
+        check_expression_inc(incx);
+    }
+
+    vector_node<T, const T*> bind(sycl::handler& cgh, std::int64_t n) const {
+        return { x, n, incx };
+    }
+
+    const T* x;
+    std::int64_t incx;
+};
+
+template <typename T>
+struct buffer_input : expression_tag {
+    using value_type = T;
+
+    buffer_input(sycl::buffer<T, 1>& x, std::int64_t incx) : x(x), incx(incx) {}
+
+    void check(std::int64_t n) const {
+        check_expression_inc(incx);
+        check_expression_size(n, incx, x);
+    }
+
+    auto bind(sycl::handler& cgh, std::int64_t n) const {
+        auto x_acc = x.template get_access<sycl::access::mode::read>(cgh);
+        return vector_node<T, decltype(x_acc)>(x_acc, n, incx);
+    }
+
+    mutable sycl::buffer<T, 1> x;
+    std::int64_t incx;
+};
+
+template <typename T>
+struct constant_node : expression_tag {
+    using value_type = T;
+
+    explicit constant_node(T value) : value(value) {}
+
+    void check(std::int64_t n) const {}
+
+    constant_node bind(sycl::handler& cgh, std::int64_t n) const {
+        return *this;
+    }
+
+    template <oneapi::math::vm::mode Mode, typename V>
+    V eval(std::int64_t i) const {
+        return V(value);
+    }
+
+    T value;
+};
+
+template <typename Fn, typename A>
+struct unary_node : expression_tag {
+    using value_type = typename A::value_type;
+
+    explicit unary_node(const A& a) : a(a) {}
+
+    void check(std::int64_t n) const {
+        a.check(n);
+    }
+
+    auto bind(sycl::handler& cgh, std::int64_t n) const {
+        return unary_node<Fn, decltype(a.bind(cgh, n))>(a.bind(cgh, n));
+    }
+
+    template <oneapi::math::vm::mode Mode, typename V>
+    V eval(std::int64_t i) const {
+        return Fn::template apply<Mode>(a.template eval<Mode, V>(i));
+    }
+
+    A a;
+};
+
+template <typename Fn, typename A, typename B>
+struct binary_node : expression_tag {
+    static_assert(std::is_same_v<typename A::value_type, typename B::value_type>,
+                  "vm expressions cannot mix precisions");
+    using value_type = typename A::value_type;
+
+    binary_node(const A& a, const B& b) : a(a), b(b) {}
+
+    void check(std::int64_t n) const {
+        a.check(n);
+        b.check(n);
+    }
+
+    auto bind(sycl::handler& cgh, std::int64_t n) const {
+        using bound_a = decltype(a.bind(cgh, n));
+        using bound_b = decltype(b.bind(cgh, n));
+        return binary_node<Fn, bound_a, bound_b>(a.bind(cgh, n), b.bind(cgh, n));
+    }
+
+    template <oneapi::math::vm::mode Mode, typename V>
+    V eval(std::int64_t i) const {
+        return Fn::template apply<Mode>(a.template eval<Mode, V>(i), b.template eval<Mode, V>(i));
+    }
+
+    A a;
+    B b;
+};
+
+// Operators of the expression nodes, templated on the accuracy mode like the operators of the
+// generic VM backend
+struct add_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a, const V& b) {
+        return a + b;
+    }
+};
+
+struct sub_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a, const V& b) {
+        return a - b;
+    }
+};
+
+struct mul_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a, const V& b) {
+        return a * b;
+    }
+};
+
+struct div_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a, const V& b) {
+        return a / b;
+    }
+};
+
+struct pow_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a, const V& b) {
+        return pow_impl<Mode>(a, b);
+    }
+};
+
+struct neg_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return -a;
+    }
+};
+
+struct cdfnorm_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return cdfnorm_impl<Mode>(a);
+    }
+};
+
+struct cdfnorminv_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return cdfnorminv_impl<Mode>(a);
+    }
+};
+
+struct erf_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return sycl::erf(a);
+    }
+};
+
+struct erfc_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return sycl::erfc(a);
+    }
+};
+
+struct erfinv_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return erfinv_impl<Mode>(a);
+    }
+};
+
+struct exp_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return exp_impl<Mode>(a);
+    }
+};
+
+struct inv_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return V(1) / a;
+    }
+};
+
+struct lgamma_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return sycl::lgamma(a);
+    }
+};
+
+struct log_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return log_impl<Mode>(a);
+    }
+};
+
+struct sqrt_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return sycl::sqrt(a);
+    }
+};
+
+struct tgamma_fn {
+    template <oneapi::math::vm::mode Mode, typename V>
+    static V apply(const V& a) {
+        return sycl::tgamma(a);
+    }
+};
+
+// Arithmetic scalars combined with an expression become constants of its precision
+template <typename A, typename B>
+constexpr bool is_operand_pair_v =
+    (is_expression_v<A> || is_expression_v<B>) && (is_expression_v<A> || std::is_arithmetic_v<A>) &&
+    (is_expression_v<B> || std::is_arithmetic_v<B>);
+
+template <typename A, typename B>
+using common_value_t = typename std::conditional_t<is_expression_v<A>, A, B>::value_type;
+
+template <typename T, typename X>
+inline auto as_operand(const X& x) {
+    if constexpr (is_expression_v<X>) {
+        return x;
+    }
+    else {
+        return constant_node<T>(static_cast<T>(x));
+    }
+}
+
+template <typename Fn, typename A, typename B>
+inline auto make_binary(const A& a, const B& b) {
+    using T = common_value_t<A, B>;
+    using operand_a = decltype(as_operand<T>(a));
+    using operand_b = decltype(as_operand<T>(b));
+    return binary_node<Fn, operand_a, operand_b>(as_operand<T>(a), as_operand<T>(b));
+}
+
+template <typename A, typename B, typename = std::enable_if_t<is_operand_pair_v<A, B>>>
+inline auto operator+(const A& a, const B& b) {
+    return make_binary<add_fn>(a, b);
+}
+
+template <typename A, typename B, typename = std::enable_if_t<is_operand_pair_v<A, B>>>
+inline auto operator-(const A& a, const B& b) {
+    return make_binary<sub_fn>(a, b);
+}
+
+template <typename A, typename B, typename = std::enable_if_t<is_operand_pair_v<A, B>>>
+inline auto operator*(const A& a, const B& b) {
+    return make_binary<mul_fn>(a, b);
+}
+
+template <typename A, typename B, typename = std::enable_if_t<is_operand_pair_v<A, B>>>
+inline auto operator/(const A& a, const B& b) {
+    return make_binary<div_fn>(a, b);
+}
+
+template <typename A, typename = std::enable_if_t<is_expression_v<A>>>
+inline auto operator-(const A& a) {
+    return unary_node<neg_fn, A>(a);
+}
+
+template <oneapi::math::vm::mode Mode, typename T, typename Out, typename Expr>
+inline void eval_block(std::int64_t block, std::int64_t n, const Out& y, const Expr& expr) {
+    constexpr int width = expression_width<T>;
+    const std::int64_t first = block * width;
+    if (first + width <= n) {
+        sycl::vec<T, width> vy = expr.template eval<Mode, sycl::vec<T, width>>(first);
+#pragma unroll
+        for (int i = 0; i < width; i++) {
+            y[first + i] = vy[i];
+        }
+    }
+    else {
+        for (std::int64_t i = first; i < n; i++) {
+            y[i] = expr.template eval<Mode, T>(i);
+        }
+    }
+}
+
+// Calls f with the mode as a std::integral_constant; not_defined is ha
+template <typename F>
+inline auto dispatch_expression_mode(oneapi::math::vm::mode mode, F f) {
+    switch (mode) {
+        case oneapi::math::vm::mode::la:
+            return f(std::integral_constant<oneapi::math::vm::mode, oneapi::math::vm::mode::la>{});
+        case oneapi::math::vm::mode::ep:
+            return f(std::integral_constant<oneapi::math::vm::mode, oneapi::math::vm::mode::ep>{});
+        default:
+            return f(std::integral_constant<oneapi::math::vm::mode, oneapi::math::vm::mode::ha>{});
+    }
+}
+
+// bind_output(cgh) returns the pointer or the accessor the kernel writes y through
+template <typename T, typename Expr, typename BindOutput>
+sycl::event submit_expression(sycl::queue& queue, std::int64_t n, std::int64_t incy,
+                              const Expr& expr, BindOutput bind_output,
+                              const std::vector<sycl::event>& dependencies,
+                              oneapi::math::vm::mode mode) {
+    static_assert(std::is_same_v<typename Expr::value_type, T>,
+                  "the precision of the expression must match the precision of y");
+    if (n < 0) {
+        throw oneapi::math::invalid_argument("vm", "eval", "n < 0");
+    }
+    check_expression_inc(incy);
+    expr.check(n);
+    return dispatch_expression_mode(mode, [&](auto m) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto y_out = bind_output(cgh);
+            auto y = vector_node<T, decltype(y_out)>(y_out, n, incy);
+            auto e = expr.bind(cgh, n);
+            constexpr int width = expression_width<T>;
+            cgh.parallel_for(sycl::range<1>((n + width - 1) / width), [=](sycl::id<1> id) {
+                eval_block<decltype(m)::value, T>(id[0], n, y, e);
+            });
+        });
+    });
+}
+
+} // namespace detail
+
+// Expression leaves
+
+template <typename T>
+detail::usm_input<T> input(const T* x, std::int64_t incx = 1) {
+    return { x, incx };
+}
+
+template <typename T>
+detail::buffer_input<T> input(sycl::buffer<T, 1>& x, std::int64_t incx = 1) {
+    return { x, incx };
+}
+
+// Expression functions
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto cdfnorm(const A& a) {
+    return detail::unary_node<detail::cdfnorm_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto cdfnorminv(const A& a) {
+    return detail::unary_node<detail::cdfnorminv_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto erf(const A& a) {
+    return detail::unary_node<detail::erf_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto erfc(const A& a) {
+    return detail::unary_node<detail::erfc_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto erfinv(const A& a) {
+    return detail::unary_node<detail::erfinv_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto exp(const A& a) {
+    return detail::unary_node<detail::exp_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto inv(const A& a) {
+    return detail::unary_node<detail::inv_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto lgamma(const A& a) {
+    return detail::unary_node<detail::lgamma_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto log(const A& a) {
+    return detail::unary_node<detail::log_fn, A>(a);
+}
+
+template <typename A, typename B, typename = std::enable_if_t<detail::is_operand_pair_v<A, B>>>
+auto pow(const A& a, const B& b) {
+    return detail::make_binary<detail::pow_fn>(a, b);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto sqrt(const A& a) {
+    return detail::unary_node<detail::sqrt_fn, A>(a);
+}
+
+template <typename A, typename = std::enable_if_t<detail::is_expression_v<A>>>
+auto tgamma(const A& a) {
+    return detail::unary_node<detail::tgamma_fn, A>(a);
+}
+
+// Evaluates y[i * incy] = expr[i] for i < n in a single kernel
+
+template <typename T, typename Expr, typename = std::enable_if_t<detail::is_expression_v<Expr>>>
+void eval(sycl::queue& queue, std::int64_t n, sycl::buffer<T, 1>& y, std::int64_t incy,
+          const Expr& expr, oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    detail::check_expression_size(n, incy, y);
+    detail::submit_expression<T>(
+        queue, n, incy, expr,
+        [&](sycl::handler& cgh) { return y.template get_access<sycl::access::mode::write>(cgh); },
+        {}, mode);
+}
+
+template <typename T, typename Expr, typename = std::enable_if_t<detail::is_expression_v<Expr>>>
+void eval(sycl::queue& queue, std::int64_t n, sycl::buffer<T, 1>& y, const Expr& expr,
+          oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    eval(queue, n, y, 1, expr, mode);
+}
+
+template <typename T, typename Expr, typename = std::enable_if_t<detail::is_expression_v<Expr>>>
+sycl::event eval(sycl::queue& queue, std::int64_t n, T* y, std::int64_t incy, const Expr& expr,
+                 const std::vector<sycl::event>& dependencies = {},
+                 oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return detail::submit_expression<T>(
+        queue, n, incy, expr, [=](sycl::handler& cgh) { return y; }, dependencies, mode);
+}
+
+template <typename T, typename Expr, typename = std::enable_if_t<detail::is_expression_v<Expr>>>
+sycl::event eval(sycl::queue& queue, std::int64_t n, T* y, const Expr& expr,
+                 const std::vector<sycl::event>& dependencies = {},
+                 oneapi::math::vm::mode mode = oneapi::math::vm::mode::not_defined) {
+    return eval(queue, n, y, 1, expr, dependencies, mode);
+}
+
+} // namespace vm
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_VM_EXPRESSION_HPP_
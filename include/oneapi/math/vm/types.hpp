@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_VM_TYPES_HPP_
+#define _ONEMATH_VM_TYPES_HPP_
+
+#include <cstdint>
+
+namespace oneapi {
+namespace math {
+namespace vm {
+
+// Accuracy of the vector math functions, following the oneMKL VM convention:
+//   ha - high accuracy, at most 1 ulp
+//   la - low accuracy, at most 4 ulp
+//   ep - enhanced performance, about half of the mantissa bits are correct
+// not_defined selects the default accuracy of the backend, which is ha for every backend.
+enum class mode : std::uint32_t { not_defined = 0, la = 1, ha = 2, ep = 3 };
+
+} // namespace vm
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_VM_TYPES_HPP_
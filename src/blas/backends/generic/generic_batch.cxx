@@ -54,7 +54,10 @@ void gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex, float beta,
                 sycl::buffer<float, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "gemv_batch", "");
+    detail::check_device_support<float>(queue, "gemv_batch");
+    detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea), lda,
+                       is_column_major(), detail::strided(detail::in(x), stridex), incx, beta,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
@@ -62,7 +65,10 @@ void gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex, double beta,
                 sycl::buffer<double, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "gemv_batch", "");
+    detail::check_device_support<double>(queue, "gemv_batch");
+    detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea), lda,
+                       is_column_major(), detail::strided(detail::in(x), stridex), incx, beta,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
@@ -71,7 +77,10 @@ void gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t
                 std::int64_t incx, std::int64_t stridex, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "gemv_batch", "");
+    detail::check_device_support<std::complex<float>>(queue, "gemv_batch");
+    detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea), lda,
+                       is_column_major(), detail::strided(detail::in(x), stridex), incx, beta,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
@@ -80,7 +89,10 @@ void gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t
                 std::int64_t incx, std::int64_t stridex, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "gemv_batch", "");
+    detail::check_device_support<std::complex<double>>(queue, "gemv_batch");
+    detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea), lda,
+                       is_column_major(), detail::strided(detail::in(x), stridex), incx, beta,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m, std::int64_t n,
@@ -88,7 +100,11 @@ void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "dgmm_batch", "");
+    detail::check_device_support<float>(queue, "dgmm_batch");
+    detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                       detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                       batch_size, {});
 }
 
 void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m, std::int64_t n,
@@ -96,7 +112,11 @@ void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "dgmm_batch", "");
+    detail::check_device_support<double>(queue, "dgmm_batch");
+    detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                       detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                       batch_size, {});
 }
 
 void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m, std::int64_t n,
@@ -104,7 +124,11 @@ void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t
                 sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "dgmm_batch", "");
+    detail::check_device_support<std::complex<float>>(queue, "dgmm_batch");
+    detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                       detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                       batch_size, {});
 }
 
 void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m, std::int64_t n,
@@ -112,58 +136,76 @@ void dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t
                 sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "dgmm_batch", "");
+    detail::check_device_support<std::complex<double>>(queue, "dgmm_batch");
+    detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                       detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                       batch_size, {});
 }
 
 void axpy_batch(sycl::queue& queue, std::int64_t n, float alpha, sycl::buffer<float, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    CALL_GENERIC_BLAS_FN(::blas::_axpy_batch, queue, n, alpha, x, incx, stridex, y, incy, stridey,
-                         batch_size);
+    detail::check_device_support<float>(queue, "axpy_batch");
+    detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void axpy_batch(sycl::queue& queue, std::int64_t n, double alpha, sycl::buffer<double, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    CALL_GENERIC_BLAS_FN(::blas::_axpy_batch, queue, n, alpha, x, incx, stridex, y, incy, stridey,
-                         batch_size);
+    detail::check_device_support<double>(queue, "axpy_batch");
+    detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void axpy_batch(sycl::queue& queue, std::int64_t n, std::complex<float> alpha,
                 sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "axpy_batch", "");
+    detail::check_device_support<std::complex<float>>(queue, "axpy_batch");
+    detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void axpy_batch(sycl::queue& queue, std::int64_t n, std::complex<double> alpha,
                 sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "axpy_batch", "");
+    detail::check_device_support<std::complex<double>>(queue, "axpy_batch");
+    detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 void copy_batch(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<float, 1>& y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    throw unimplemented("blas", "copy_batch", "");
+    detail::check_device_support<float>(queue, "copy_batch");
+    detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void copy_batch(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<double, 1>& y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    throw unimplemented("blas", "copy_batch", "");
+    detail::check_device_support<double>(queue, "copy_batch");
+    detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void copy_batch(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<float>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    throw unimplemented("blas", "copy_batch", "");
+    detail::check_device_support<std::complex<float>>(queue, "copy_batch");
+    detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void copy_batch(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<double>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    throw unimplemented("blas", "copy_batch", "");
+    detail::check_device_support<std::complex<double>>(queue, "copy_batch");
+    detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                       detail::strided(detail::inout(y), stridey), incy, batch_size, {});
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -172,6 +214,15 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<float, 1>& b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
+    if (detail::is_small_gemm(m, k)) {
+        detail::check_device_support<float>(queue, "gemm_batch");
+        detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                           detail::strided(detail::in(a), stride_a), lda,
+                           detail::strided(detail::in(b), stride_b), ldb, beta,
+                           detail::strided(detail::inout(c), stride_c), ldc, is_column_major(),
+                           batch_size, {});
+        return;
+    }
     CALL_GENERIC_BLAS_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a,
                          lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -182,6 +233,15 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<double, 1>& b, std::int64_t ldb, std::int64_t stride_b, double beta,
                 sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
+    if (detail::is_small_gemm(m, k)) {
+        detail::check_device_support<double>(queue, "gemm_batch");
+        detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                           detail::strided(detail::in(a), stride_a), lda,
+                           detail::strided(detail::in(b), stride_b), ldb, beta,
+                           detail::strided(detail::inout(c), stride_c), ldc, is_column_major(),
+                           batch_size, {});
+        return;
+    }
     CALL_GENERIC_BLAS_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a,
                          lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -192,7 +252,12 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for complex");
+    detail::check_device_support<std::complex<float>>(queue, "gemm_batch");
+    detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                       detail::strided(detail::in(a), stride_a), lda,
+                       detail::strided(detail::in(b), stride_b), ldb, beta,
+                       detail::strided(detail::inout(c), stride_c), ldc, is_column_major(),
+                       batch_size, {});
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -201,7 +266,12 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for complex");
+    detail::check_device_support<std::complex<double>>(queue, "gemm_batch");
+    detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                       detail::strided(detail::in(a), stride_a), lda,
+                       detail::strided(detail::in(b), stride_b), ldb, beta,
+                       detail::strided(detail::inout(c), stride_c), ldc, is_column_major(),
+                       batch_size, {});
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -447,7 +517,11 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::i
                        std::int64_t stridex, float beta, float* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<float>(queue, "gemv_batch");
+    return detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea),
+                              lda, is_column_major(), detail::strided(detail::in(x), stridex), incx,
+                              beta, detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m,
@@ -456,7 +530,11 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::i
                        std::int64_t stridex, double beta, double* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<double>(queue, "gemv_batch");
+    return detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea),
+                              lda, is_column_major(), detail::strided(detail::in(x), stridex), incx,
+                              beta, detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m,
@@ -465,7 +543,11 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::i
                        std::int64_t incx, std::int64_t stridex, std::complex<float> beta,
                        std::complex<float>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "gemv_batch");
+    return detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea),
+                              lda, is_column_major(), detail::strided(detail::in(x), stridex), incx,
+                              beta, detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m,
@@ -474,7 +556,11 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::i
                        std::int64_t incx, std::int64_t stridex, std::complex<double> beta,
                        std::complex<double>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "gemv_batch");
+    return detail::gemv_batch(queue, trans, m, n, alpha, detail::strided(detail::in(a), stridea),
+                              lda, is_column_major(), detail::strided(detail::in(x), stridex), incx,
+                              beta, detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::int64_t* m,
@@ -482,7 +568,15 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::
                        const float** x, std::int64_t* incx, float* beta, float** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<float>(queue, "gemv_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemv_batch(queue, trans[g], m[g], n[g], alpha[g],
+                                      detail::pointers(a + first), lda[g], is_column_major(),
+                                      detail::pointers(x + first), incx[g], beta[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::int64_t* m,
@@ -490,7 +584,15 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::
                        const double** x, std::int64_t* incx, double* beta, double** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<double>(queue, "gemv_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemv_batch(queue, trans[g], m[g], n[g], alpha[g],
+                                      detail::pointers(a + first), lda[g], is_column_major(),
+                                      detail::pointers(x + first), incx[g], beta[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::int64_t* m,
@@ -499,7 +601,15 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::
                        std::complex<float>* beta, std::complex<float>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "gemv_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemv_batch(queue, trans[g], m[g], n[g], alpha[g],
+                                      detail::pointers(a + first), lda[g], is_column_major(),
+                                      detail::pointers(x + first), incx[g], beta[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::int64_t* m,
@@ -508,7 +618,15 @@ sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose* trans, std::
                        std::complex<double>* beta, std::complex<double>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "gemv_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemv_batch(queue, trans[g], m[g], n[g], alpha[g],
+                                      detail::pointers(a + first), lda[g], is_column_major(),
+                                      detail::pointers(x + first), incx[g], beta[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m,
@@ -516,7 +634,11 @@ sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::i
                        const float* x, std::int64_t incx, std::int64_t stridex, float* c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<float>(queue, "dgmm_batch");
+    return detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                              detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                              batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m,
@@ -524,7 +646,11 @@ sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::i
                        const double* x, std::int64_t incx, std::int64_t stridex, double* c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<double>(queue, "dgmm_batch");
+    return detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                              detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                              batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m,
@@ -533,7 +659,11 @@ sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::i
                        std::int64_t stridex, std::complex<float>* c, std::int64_t ldc,
                        std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "dgmm_batch");
+    return detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                              detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                              batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m,
@@ -542,21 +672,39 @@ sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::i
                        std::int64_t stridex, std::complex<double>* c, std::int64_t ldc,
                        std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "dgmm_batch");
+    return detail::dgmm_batch(queue, left_right, m, n, detail::strided(detail::in(a), stridea), lda,
+                              detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(c), stridec), ldc, is_column_major(),
+                              batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side* left_right, std::int64_t* m,
                        std::int64_t* n, const float** a, std::int64_t* lda, const float** x,
                        std::int64_t* incx, float** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<float>(queue, "dgmm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::dgmm_batch(queue, left_right[g], m[g], n[g], detail::pointers(a + first),
+                                      lda[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side* left_right, std::int64_t* m,
                        std::int64_t* n, const double** a, std::int64_t* lda, const double** x,
                        std::int64_t* incx, double** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<double>(queue, "dgmm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::dgmm_batch(queue, left_right[g], m[g], n[g], detail::pointers(a + first),
+                                      lda[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side* left_right, std::int64_t* m,
@@ -564,7 +712,14 @@ sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side* left_right, std::
                        const std::complex<float>** x, std::int64_t* incx, std::complex<float>** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "dgmm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::dgmm_batch(queue, left_right[g], m[g], n[g], detail::pointers(a + first),
+                                      lda[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side* left_right, std::int64_t* m,
@@ -572,115 +727,192 @@ sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side* left_right, std::
                        const std::complex<double>** x, std::int64_t* incx, std::complex<double>** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dgmm_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "dgmm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::dgmm_batch(queue, left_right[g], m[g], n[g], detail::pointers(a + first),
+                                      lda[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t* n, float* alpha, const float** x,
                        std::int64_t* incx, float** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "axpy_batch", " for USM");
+    detail::check_device_support<float>(queue, "axpy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::axpy_batch(queue, n[g], alpha[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t* n, double* alpha, const double** x,
                        std::int64_t* incx, double** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "axpy_batch", " for USM");
+    detail::check_device_support<double>(queue, "axpy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::axpy_batch(queue, n[g], alpha[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t* n, std::complex<float>* alpha,
                        const std::complex<float>** x, std::int64_t* incx, std::complex<float>** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "axpy_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "axpy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::axpy_batch(queue, n[g], alpha[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t* n, std::complex<double>* alpha,
                        const std::complex<double>** x, std::int64_t* incx, std::complex<double>** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "axpy_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "axpy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::axpy_batch(queue, n[g], alpha[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t n, float alpha, const float* x,
                        std::int64_t incx, std::int64_t stridex, float* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    CALL_GENERIC_BLAS_USM_FN(::blas::_axpy_batch, queue, n, alpha, x, incx, stridex, y, incy,
-                             stridey, batch_size, dependencies);
+    detail::check_device_support<float>(queue, "axpy_batch");
+    return detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t n, double alpha, const double* x,
                        std::int64_t incx, std::int64_t stridex, double* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    CALL_GENERIC_BLAS_USM_FN(::blas::_axpy_batch, queue, n, alpha, x, incx, stridex, y, incy,
-                             stridey, batch_size, dependencies);
+    detail::check_device_support<double>(queue, "axpy_batch");
+    return detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t n, std::complex<float> alpha,
                        const std::complex<float>* x, std::int64_t incx, std::int64_t stridex,
                        std::complex<float>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "axpy_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "axpy_batch");
+    return detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event axpy_batch(sycl::queue& queue, std::int64_t n, std::complex<double> alpha,
                        const std::complex<double>* x, std::int64_t incx, std::int64_t stridex,
                        std::complex<double>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "axpy_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "axpy_batch");
+    return detail::axpy_batch(queue, n, alpha, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t* n, const float** x, std::int64_t* incx,
                        float** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<float>(queue, "copy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::copy_batch(queue, n[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t* n, const double** x, std::int64_t* incx,
                        double** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<double>(queue, "copy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::copy_batch(queue, n[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t* n, const std::complex<float>** x,
                        std::int64_t* incx, std::complex<float>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "copy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::copy_batch(queue, n[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t* n, const std::complex<double>** x,
                        std::int64_t* incx, std::complex<double>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "copy_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::copy_batch(queue, n[g], detail::pointers(x + first), incx[g],
+                                      detail::pointers(y + first), incy[g], group_size[g],
+                                      dependencies);
+        });
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t n, const float* x, std::int64_t incx,
                        std::int64_t stridex, float* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<float>(queue, "copy_batch");
+    return detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t n, const double* x, std::int64_t incx,
                        std::int64_t stridex, double* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<double>(queue, "copy_batch");
+    return detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t n, const std::complex<float>* x,
                        std::int64_t incx, std::int64_t stridex, std::complex<float>* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "copy_batch");
+    return detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event copy_batch(sycl::queue& queue, std::int64_t n, const std::complex<double>* x,
                        std::int64_t incx, std::int64_t stridex, std::complex<double>* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "copy_batch");
+    return detail::copy_batch(queue, n, detail::strided(detail::in(x), stridex), incx,
+                              detail::strided(detail::inout(y), stridey), incy, batch_size,
+                              dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -689,7 +921,15 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        const float** b, std::int64_t* ldb, float* beta, float** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    detail::check_device_support<float>(queue, "gemm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemm_batch(queue, transa[g], transb[g], m[g], n[g], k[g], alpha[g],
+                                      detail::pointers(a + first), lda[g],
+                                      detail::pointers(b + first), ldb[g], beta[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -698,7 +938,15 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        const double** b, std::int64_t* ldb, double* beta, double** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    detail::check_device_support<double>(queue, "gemm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemm_batch(queue, transa[g], transb[g], m[g], n[g], k[g], alpha[g],
+                                      detail::pointers(a + first), lda[g],
+                                      detail::pointers(b + first), ldb[g], beta[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -708,7 +956,15 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        std::complex<float>* beta, std::complex<float>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "gemm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemm_batch(queue, transa[g], transb[g], m[g], n[g], k[g], alpha[g],
+                                      detail::pointers(a + first), lda[g],
+                                      detail::pointers(b + first), ldb[g], beta[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -718,7 +974,15 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        std::complex<double>* beta, std::complex<double>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "gemm_batch");
+    return detail::for_each_group(
+        queue, group_count, group_size, dependencies, [&](std::int64_t g, std::int64_t first) {
+            return detail::gemm_batch(queue, transa[g], transb[g], m[g], n[g], k[g], alpha[g],
+                                      detail::pointers(a + first), lda[g],
+                                      detail::pointers(b + first), ldb[g], beta[g],
+                                      detail::pointers(c + first), ldc[g], is_column_major(),
+                                      group_size[g], dependencies);
+        });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -764,6 +1028,14 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t stride_b, float beta, float* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
+    if (detail::is_small_gemm(m, k)) {
+        detail::check_device_support<float>(queue, "gemm_batch");
+        return detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                                  detail::strided(detail::in(a), stride_a), lda,
+                                  detail::strided(detail::in(b), stride_b), ldb, beta,
+                                  detail::strided(detail::inout(c), stride_c), ldc,
+                                  is_column_major(), batch_size, dependencies);
+    }
     CALL_GENERIC_BLAS_USM_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha,
                              a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
                              dependencies);
@@ -776,6 +1048,14 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t stride_b, double beta, double* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
+    if (detail::is_small_gemm(m, k)) {
+        detail::check_device_support<double>(queue, "gemm_batch");
+        return detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                                  detail::strided(detail::in(a), stride_a), lda,
+                                  detail::strided(detail::in(b), stride_b), ldb, beta,
+                                  detail::strided(detail::inout(c), stride_c), ldc,
+                                  is_column_major(), batch_size, dependencies);
+    }
     CALL_GENERIC_BLAS_USM_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha,
                              a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
                              dependencies);
@@ -788,7 +1068,12 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
                        std::complex<float>* c, std::int64_t ldc, std::int64_t stride_c,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    detail::check_device_support<std::complex<float>>(queue, "gemm_batch");
+    return detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                              detail::strided(detail::in(a), stride_a), lda,
+                              detail::strided(detail::in(b), stride_b), ldb, beta,
+                              detail::strided(detail::inout(c), stride_c), ldc, is_column_major(),
+                              batch_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -798,7 +1083,12 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
                        std::complex<double>* c, std::int64_t ldc, std::int64_t stride_c,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    detail::check_device_support<std::complex<double>>(queue, "gemm_batch");
+    return detail::gemm_batch(queue, transa, transb, m, n, k, alpha,
+                              detail::strided(detail::in(a), stride_a), lda,
+                              detail::strided(detail::in(b), stride_b), ldb, beta,
+                              detail::strided(detail::inout(c), stride_c), ldc, is_column_major(),
+                              batch_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -0,0 +1,361 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GENERIC_BLAS_BATCH_KERNELS_HPP_
+#define _GENERIC_BLAS_BATCH_KERNELS_HPP_
+
+#include <type_traits>
+
+#include "oneapi/math/types.hpp"
+#include "generic_level2_kernels.hpp"
+
+// Batched routines of the generic backend. Every call is a single launch whose range spans the
+// whole batch, with one work-item per element, or column, of the results, so that the many small
+// problems of a batch cost one kernel instead of one each. The items of the group API are
+// launched once per group.
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace generic {
+namespace detail {
+
+// Items of a batch stored stride elements apart in the vector view data. bind(cgh) returns the
+// function giving a reference to the element at offset of item b.
+template <typename V>
+struct strided_batch {
+    V data;
+    std::int64_t stride;
+
+    auto bind(sycl::handler& cgh) const {
+        return [e = data.bind(cgh), stride = stride](std::int64_t b,
+                                                     std::int64_t offset) -> decltype(auto) {
+            return e(b * stride + offset);
+        };
+    }
+};
+
+// Items of a batch given by an array of USM pointers
+template <typename T>
+struct pointer_batch {
+    T* const* data;
+
+    auto bind(sycl::handler&) const {
+        return [data = data](std::int64_t b, std::int64_t offset) -> T& {
+            return data[b][offset];
+        };
+    }
+};
+
+template <typename V>
+inline strided_batch<V> strided(V data, std::int64_t stride) {
+    return { data, stride };
+}
+
+template <typename T>
+inline pointer_batch<T> pointers(T* const* data) {
+    return { data };
+}
+
+// Runs launch(g, first) for every group g of the group API, first being the index of its first
+// item in the arrays of pointers, and returns the event of all the groups
+template <typename Launch>
+sycl::event for_each_group(sycl::queue& queue, std::int64_t group_count,
+                           const std::int64_t* group_size,
+                           const std::vector<sycl::event>& dependencies, Launch launch) {
+    std::vector<sycl::event> events;
+    std::int64_t first = 0;
+    for (std::int64_t g = 0; g < group_count; ++g) {
+        if (group_size[g] > 0)
+            events.push_back(launch(g, first));
+        first += group_size[g];
+    }
+    if (events.empty())
+        return no_op(queue, dependencies);
+    return events.size() == 1 ? events[0] : no_op(queue, events);
+}
+
+// Runs f(b, i) for i in [0, n) in every item b of the batch
+template <typename F>
+sycl::event for_each_in_batch(sycl::queue& queue, std::int64_t n, std::int64_t batch_size,
+                              const std::vector<sycl::event>& dependencies, F bind_f) {
+    if (n <= 0 || batch_size <= 0)
+        return no_op(queue, dependencies);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto f = bind_f(cgh);
+        cgh.parallel_for(sycl::range<2>(batch_size, n),
+                         [=](sycl::item<2> item) { f(item[0], item[1]); });
+    });
+}
+
+// y_b = alpha * x_b + y_b
+template <typename T, typename X, typename Y>
+sycl::event axpy_batch(sycl::queue& queue, std::int64_t n, T alpha, X x, std::int64_t incx, Y y,
+                       std::int64_t incy, std::int64_t batch_size,
+                       const std::vector<sycl::event>& dependencies) {
+    return for_each_in_batch(queue, n, batch_size, dependencies, [&](sycl::handler& cgh) {
+        return [=, xe = x.bind(cgh), ye = y.bind(cgh)](std::int64_t b, std::int64_t i) {
+            auto&& yi = ye(b, vector_offset(i, n, incy));
+            yi = mul(alpha, T(xe(b, vector_offset(i, n, incx)))) + yi;
+        };
+    });
+}
+
+// y_b = x_b
+template <typename X, typename Y>
+sycl::event copy_batch(sycl::queue& queue, std::int64_t n, X x, std::int64_t incx, Y y,
+                       std::int64_t incy, std::int64_t batch_size,
+                       const std::vector<sycl::event>& dependencies) {
+    return for_each_in_batch(queue, n, batch_size, dependencies, [&](sycl::handler& cgh) {
+        return [=, xe = x.bind(cgh), ye = y.bind(cgh)](std::int64_t b, std::int64_t i) {
+            ye(b, vector_offset(i, n, incy)) = xe(b, vector_offset(i, n, incx));
+        };
+    });
+}
+
+// y_b = alpha * op(A_b) * x_b + beta * y_b, each work-item computing one element of y_b. y_b is
+// not read when beta is zero.
+template <typename T, typename A, typename X, typename Y>
+sycl::event gemv_batch(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m,
+                       std::int64_t n, T alpha, A a, std::int64_t lda, bool column_major, X x,
+                       std::int64_t incx, T beta, Y y, std::int64_t incy, std::int64_t batch_size,
+                       const std::vector<sycl::event>& dependencies) {
+    const bool nontrans = trans == oneapi::math::transpose::nontrans;
+    const bool conj = trans == oneapi::math::transpose::conjtrans;
+    const std::int64_t len_x = nontrans ? n : m;
+    const std::int64_t len_y = nontrans ? m : n;
+    const general_storage storage{ lda, column_major };
+    return for_each_in_batch(queue, len_y, batch_size, dependencies, [&](sycl::handler& cgh) {
+        return [=, ae = a.bind(cgh), xe = x.bind(cgh), ye = y.bind(cgh)](std::int64_t b,
+                                                                         std::int64_t i) {
+            T sum = T(0);
+            for (std::int64_t j = 0; j < len_x; ++j) {
+                T a_ij = ae(b, nontrans ? storage.offset(i, j) : storage.offset(j, i));
+                if (conj)
+                    a_ij = conjugate(a_ij);
+                sum += mul(a_ij, T(xe(b, vector_offset(j, len_x, incx))));
+            }
+            auto&& yi = ye(b, vector_offset(i, len_y, incy));
+            yi = beta == T(0) ? mul(alpha, sum) : mul(alpha, sum) + mul(beta, T(yi));
+        };
+    });
+}
+
+// C_b = diag(x_b) * A_b on the left, A_b * diag(x_b) on the right, for m x n matrices A_b and C_b.
+// Consecutive work-items write consecutive elements of C_b.
+template <typename A, typename X, typename C>
+sycl::event dgmm_batch(sycl::queue& queue, oneapi::math::side left_right, std::int64_t m,
+                       std::int64_t n, A a, std::int64_t lda, X x, std::int64_t incx, C c,
+                       std::int64_t ldc, bool column_major, std::int64_t batch_size,
+                       const std::vector<sycl::event>& dependencies) {
+    const bool left = left_right == oneapi::math::side::left;
+    const std::int64_t len_x = left ? m : n;
+    const general_storage a_storage{ lda, column_major };
+    const general_storage c_storage{ ldc, column_major };
+    // Elements of C_b in memory order, the rows of a column or the columns of a row
+    const std::int64_t inner = column_major ? m : n;
+    return for_each_in_batch(queue, m * n, batch_size, dependencies, [&](sycl::handler& cgh) {
+        return [=, ae = a.bind(cgh), xe = x.bind(cgh), ce = c.bind(cgh)](std::int64_t b,
+                                                                         std::int64_t k) {
+            const std::int64_t i = column_major ? k % inner : k / inner;
+            const std::int64_t j = column_major ? k / inner : k % inner;
+            const auto x_k = xe(b, vector_offset(left ? i : j, len_x, incx));
+            ce(b, c_storage.offset(i, j)) = mul(x_k, ae(b, a_storage.offset(i, j)));
+        };
+    });
+}
+
+// Element (r, c) of op(X_b) for the item b of a batch of general matrices
+template <typename T, typename E>
+inline T op_element(const E& xe, std::int64_t b, const general_storage& storage,
+                    oneapi::math::transpose op, std::int64_t r, std::int64_t c) {
+    if (op == oneapi::math::transpose::nontrans)
+        return xe(b, storage.offset(r, c));
+    const T x = xe(b, storage.offset(c, r));
+    return op == oneapi::math::transpose::conjtrans ? conjugate(x) : x;
+}
+
+// Largest m and k of the small gemm kernels
+constexpr std::int64_t small_gemm_max = 32;
+
+inline bool is_small_gemm(std::int64_t m, std::int64_t k) {
+    return m <= small_gemm_max && k <= small_gemm_max;
+}
+
+// Work-items of a work-group of the small gemm kernels, and bytes of local memory it holds the
+// operands op(A_b) in
+constexpr std::int64_t small_gemm_group_size = 64;
+constexpr std::int64_t small_gemm_local_bytes = 16384;
+
+// C_b = alpha * op(A_b) * op(B_b) + beta * C_b for m <= M and k <= K. A work-group computes up to
+// small_gemm_group_size columns of C_b for one or more items b: op(A_b) is first copied to local
+// memory, then each work-item computes a column of C_b in private memory, over loops unrolled at
+// compile time, reading op(A_b) from local memory and its column of op(B_b) once.
+template <int M, int K, typename T, typename A, typename B, typename C>
+sycl::event small_gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
+                             oneapi::math::transpose transb, std::int64_t m, std::int64_t n,
+                             std::int64_t k, T alpha, A a, std::int64_t lda, B b,
+                             std::int64_t ldb, T beta, C c, std::int64_t ldc, bool column_major,
+                             std::int64_t batch_size,
+                             const std::vector<sycl::event>& dependencies) {
+    const general_storage a_storage{ lda, column_major };
+    const general_storage b_storage{ ldb, column_major };
+    const general_storage c_storage{ ldc, column_major };
+    // Columns of C_b and items per work-group
+    const std::int64_t a_size = m * k;
+    const std::int64_t cols = std::min(n, small_gemm_group_size);
+    const std::int64_t items = std::max<std::int64_t>(
+        1, std::min<std::int64_t>(small_gemm_group_size / cols,
+                                  small_gemm_local_bytes /
+                                      std::max<std::int64_t>(a_size * sizeof(T), 1)));
+    const std::int64_t item_groups = (batch_size + items - 1) / items;
+    const std::int64_t col_groups = (n + cols - 1) / cols;
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto ae = a.bind(cgh);
+        auto be = b.bind(cgh);
+        auto ce = c.bind(cgh);
+        sycl::local_accessor<T, 1> a_local(
+            sycl::range<1>(std::max<std::int64_t>(items * a_size, 1)), cgh);
+        cgh.parallel_for(
+            sycl::nd_range<2>(sycl::range<2>(item_groups * items, col_groups * cols),
+                              sycl::range<2>(items, cols)),
+            [=](sycl::nd_item<2> item) {
+                const std::int64_t first = item.get_group(0) * items;
+                // Consecutive work-items load consecutive elements of the columns of op(A_b)
+                for (std::int64_t e = item.get_local_linear_id(); e < items * a_size;
+                     e += items * cols) {
+                    const std::int64_t p = e / a_size;
+                    const std::int64_t i = e % m;
+                    const std::int64_t l = (e % a_size) / m;
+                    if (first + p < batch_size)
+                        a_local[e] = op_element<T>(ae, first + p, a_storage, transa, i, l);
+                }
+                sycl::group_barrier(item.get_group());
+
+                const std::int64_t p = item.get_local_id(0);
+                const std::int64_t mat = first + p;
+                const std::int64_t j = item.get_global_id(1);
+                if (mat >= batch_size || j >= n)
+                    return;
+                T acc[M];
+#pragma unroll
+                for (int i = 0; i < M; ++i) {
+                    acc[i] = T(0);
+                }
+#pragma unroll
+                for (int l = 0; l < K; ++l) {
+                    if (l < k) {
+                        const T b_lj = op_element<T>(be, mat, b_storage, transb, l, j);
+#pragma unroll
+                        for (int i = 0; i < M; ++i) {
+                            if (i < m)
+                                acc[i] += mul(T(a_local[p * a_size + l * m + i]), b_lj);
+                        }
+                    }
+                }
+#pragma unroll
+                for (int i = 0; i < M; ++i) {
+                    if (i < m) {
+                        auto&& c_ij = ce(mat, c_storage.offset(i, j));
+                        c_ij = beta == T(0) ? mul(alpha, acc[i])
+                                            : mul(alpha, acc[i]) + mul(beta, T(c_ij));
+                    }
+                }
+            });
+    });
+}
+
+// C_b = alpha * op(A_b) * op(B_b) + beta * C_b for any size, each work-item computing one element
+// of C_b
+template <typename T, typename A, typename B, typename C>
+sycl::event gemm_batch_elements(sycl::queue& queue, oneapi::math::transpose transa,
+                                oneapi::math::transpose transb, std::int64_t m, std::int64_t n,
+                                std::int64_t k, T alpha, A a, std::int64_t lda, B b,
+                                std::int64_t ldb, T beta, C c, std::int64_t ldc,
+                                bool column_major, std::int64_t batch_size,
+                                const std::vector<sycl::event>& dependencies) {
+    const general_storage a_storage{ lda, column_major };
+    const general_storage b_storage{ ldb, column_major };
+    const general_storage c_storage{ ldc, column_major };
+    return for_each_in_batch(queue, m * n, batch_size, dependencies, [&](sycl::handler& cgh) {
+        return [=, ae = a.bind(cgh), be = b.bind(cgh), ce = c.bind(cgh)](std::int64_t item,
+                                                                         std::int64_t e) {
+            const std::int64_t i = e % m;
+            const std::int64_t j = e / m;
+            T sum = T(0);
+            for (std::int64_t l = 0; l < k; ++l) {
+                sum += mul(op_element<T>(ae, item, a_storage, transa, i, l),
+                           op_element<T>(be, item, b_storage, transb, l, j));
+            }
+            auto&& c_ij = ce(item, c_storage.offset(i, j));
+            c_ij = beta == T(0) ? mul(alpha, sum) : mul(alpha, sum) + mul(beta, T(c_ij));
+        };
+    });
+}
+
+// Calls launch with the sizes of the small gemm kernel for m and k, as integral constants
+template <int M, typename Launch>
+sycl::event with_small_gemm_k(std::int64_t k, Launch& launch) {
+    if (k <= 8)
+        return launch(std::integral_constant<int, M>(), std::integral_constant<int, 8>());
+    if (k <= 16)
+        return launch(std::integral_constant<int, M>(), std::integral_constant<int, 16>());
+    return launch(std::integral_constant<int, M>(), std::integral_constant<int, 32>());
+}
+
+template <typename Launch>
+sycl::event with_small_gemm_size(std::int64_t m, std::int64_t k, Launch& launch) {
+    if (m <= 8)
+        return with_small_gemm_k<8>(k, launch);
+    if (m <= 16)
+        return with_small_gemm_k<16>(k, launch);
+    return with_small_gemm_k<32>(k, launch);
+}
+
+// C_b = alpha * op(A_b) * op(B_b) + beta * C_b, with the small gemm kernel of the smallest sizes
+// holding m and k when they are at most small_gemm_max
+template <typename T, typename A, typename B, typename C>
+sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
+                       oneapi::math::transpose transb, std::int64_t m, std::int64_t n,
+                       std::int64_t k, T alpha, A a, std::int64_t lda, B b, std::int64_t ldb,
+                       T beta, C c, std::int64_t ldc, bool column_major, std::int64_t batch_size,
+                       const std::vector<sycl::event>& dependencies) {
+    if (m <= 0 || n <= 0 || batch_size <= 0)
+        return no_op(queue, dependencies);
+    if (!is_small_gemm(m, k)) {
+        return gemm_batch_elements(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                   ldc, column_major, batch_size, dependencies);
+    }
+    auto launch = [&](auto m_size, auto k_size) {
+        return small_gemm_batch<decltype(m_size)::value, decltype(k_size)::value>(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, column_major,
+            batch_size, dependencies);
+    };
+    return with_small_gemm_size(m, k, launch);
+}
+
+} // namespace detail
+} // namespace generic
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif // _GENERIC_BLAS_BATCH_KERNELS_HPP_
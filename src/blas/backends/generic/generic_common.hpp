@@ -23,6 +23,7 @@
 #include "onemath_sycl_blas.hpp"
 #include "oneapi/math/types.hpp"
 #include "oneapi/math/exceptions.hpp"
+#include "oneapi/math/detail/dispatch_profiler.hpp"
 
 #include <tuple>
 #include <utility>
@@ -195,10 +196,15 @@ struct throw_if_unsupported_by_device {
             " generic BLAS function requiring fp64 support", __VA_ARGS__);                      \
         detail::throw_if_unsupported_by_device<sycl::buffer<sycl::half>, sycl::aspect::fp16>{}( \
             " generic BLAS function requiring fp16 support", __VA_ARGS__);                      \
+        oneapi::math::detail::dispatch_timer conversion_timer(                                  \
+            oneapi::math::detail::dispatch_stage::argument_conversion);                         \
         auto args = detail::convert_to_generic_type(__VA_ARGS__);                               \
+        conversion_timer.stop();                                                                \
         auto fn = [](auto&&... targs) {                                                         \
             genericFunc(std::forward<decltype(targs)>(targs)...);                               \
         };                                                                                      \
+        oneapi::math::detail::dispatch_timer submit_timer(                                      \
+            oneapi::math::detail::dispatch_stage::submit);                                      \
         try {                                                                                   \
             std::apply(fn, args);                                                               \
         }                                                                                       \
@@ -216,10 +222,15 @@ struct throw_if_unsupported_by_device {
             " generic BLAS function requiring fp64 support", __VA_ARGS__);        \
         detail::throw_if_unsupported_by_device<sycl::half, sycl::aspect::fp16>{}( \
             " generic BLAS function requiring fp16 support", __VA_ARGS__);        \
+        oneapi::math::detail::dispatch_timer conversion_timer(                    \
+            oneapi::math::detail::dispatch_stage::argument_conversion);           \
         auto args = detail::convert_to_generic_type(__VA_ARGS__);                 \
+        conversion_timer.stop();                                                  \
         auto fn = [](auto&&... targs) {                                           \
             return genericFunc(std::forward<decltype(targs)>(targs)...).back();   \
         };                                                                        \
+        oneapi::math::detail::dispatch_timer submit_timer(                        \
+            oneapi::math::detail::dispatch_stage::submit);                        \
         try {                                                                     \
             return std::apply(fn, args);                                          \
         }                                                                         \
@@ -0,0 +1,759 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GENERIC_BLAS_KERNELS_HPP_
+#define _GENERIC_BLAS_KERNELS_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/exceptions.hpp"
+
+// SYCL kernels run by the generic backend in place of onemath_sycl_blas, for the routines it does
+// not provide or where its kernels are ill-suited.
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace generic {
+namespace detail {
+
+// Throws unsupported_device when the device of the queue cannot run kernels on T
+template <typename T>
+inline void check_device_support(sycl::queue& queue, const std::string& function) {
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>) {
+        if (!queue.get_device().has(sycl::aspect::fp64))
+            throw unsupported_device("blas", function, queue.get_device());
+    }
+}
+
+// Temporary device allocation of n elements for the kernels of function, released by free_after
+template <typename T>
+inline T* scratch_alloc(sycl::queue& queue, std::size_t n, const std::string& function) {
+    T* data = sycl::malloc_device<T>(n, queue);
+    if (!data)
+        throw device_bad_alloc("blas", function, queue.get_device());
+    return data;
+}
+
+// Frees temporary allocations once event is complete, without waiting for it
+template <typename... T>
+inline void free_after(sycl::queue& queue, const sycl::event& event, T*... data) {
+    queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(event);
+        cgh.host_task([=, context = queue.get_context()]() { (sycl::free(data, context), ...); });
+    });
+}
+
+// Offset of the i-th element of a vector of n elements with increment inc, starting from the
+// end of the vector when inc is negative
+inline std::int64_t vector_offset(std::int64_t i, std::int64_t n, std::int64_t inc) {
+    return inc >= 0 ? i * inc : (n - 1 - i) * -inc;
+}
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+
+// Arithmetic on the real and imaginary parts: the std::complex operators may call library
+// helpers that are not available on every device, and the parts of interleaved data are
+// processed as pairs the compiler vectorizes.
+template <typename T>
+inline T mul(T a, T b) {
+    return a * b;
+}
+
+template <typename T>
+inline std::complex<T> mul(std::complex<T> a, std::complex<T> b) {
+    return { a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real() };
+}
+
+template <typename T>
+inline std::complex<T> mul(T a, std::complex<T> b) {
+    return { a * b.real(), a * b.imag() };
+}
+
+template <typename T>
+inline T div(T a, T b) {
+    return a / b;
+}
+
+template <typename T>
+inline std::complex<T> div(std::complex<T> a, std::complex<T> b) {
+    const T norm = b.real() * b.real() + b.imag() * b.imag();
+    return { (a.real() * b.real() + a.imag() * b.imag()) / norm,
+             (a.imag() * b.real() - a.real() * b.imag()) / norm };
+}
+
+template <typename T>
+inline T conjugate(T a) {
+    return a;
+}
+
+template <typename T>
+inline std::complex<T> conjugate(std::complex<T> a) {
+    return { a.real(), -a.imag() };
+}
+
+// |re| + |im|, the magnitude used by asum
+template <typename T>
+inline T abs_sum(T a) {
+    return sycl::fabs(a);
+}
+
+template <typename T>
+inline T abs_sum(std::complex<T> a) {
+    return sycl::fabs(a.real()) + sycl::fabs(a.imag());
+}
+
+// Largest magnitude of the parts, NaN when either part is NaN
+template <typename T>
+inline T abs_max(T a) {
+    return sycl::fabs(a);
+}
+
+template <typename T>
+inline T abs_max(std::complex<T> a) {
+    const T re = sycl::fabs(a.real()), im = sycl::fabs(a.imag());
+    return re > im || sycl::isnan(re) ? re : im;
+}
+
+// |a / scale|^2
+template <typename T>
+inline T scaled_square(T a, T scale) {
+    T x = a / scale;
+    return x * x;
+}
+
+template <typename T>
+inline T scaled_square(std::complex<T> a, T scale) {
+    T x = a.real() / scale, y = a.imag() / scale;
+    return x * x + y * y;
+}
+
+template <typename T>
+inline T sub_group_sum(sycl::sub_group sg, T value) {
+    return sycl::reduce_over_group(sg, value, sycl::plus<T>());
+}
+
+template <typename T>
+inline std::complex<T> sub_group_sum(sycl::sub_group sg, std::complex<T> value) {
+    return { sycl::reduce_over_group(sg, value.real(), sycl::plus<T>()),
+             sycl::reduce_over_group(sg, value.imag(), sycl::plus<T>()) };
+}
+
+template <typename T>
+inline T sub_group_max(sycl::sub_group sg, T value) {
+    return sycl::reduce_over_group(sg, value, sycl::maximum<T>());
+}
+
+// Sum, or maximum, of value over the work-group, returned to every work-item: each sub-group
+// reduces with shuffles, then the partial results of the sub-groups are combined through local
+// memory holding one element per sub-group
+template <typename T>
+inline T group_sum(sycl::nd_item<1> item, const sycl::local_accessor<T, 1>& partials, T value) {
+    auto sg = item.get_sub_group();
+    value = sub_group_sum(sg, value);
+    if (sg.leader())
+        partials[sg.get_group_linear_id()] = value;
+    sycl::group_barrier(item.get_group());
+    value = partials[0];
+    for (std::size_t j = 1; j < sg.get_group_linear_range(); ++j) {
+        value += partials[j];
+    }
+    sycl::group_barrier(item.get_group());
+    return value;
+}
+
+template <typename T>
+inline T group_max(sycl::nd_item<1> item, const sycl::local_accessor<T, 1>& partials, T value) {
+    auto sg = item.get_sub_group();
+    value = sub_group_max(sg, value);
+    if (sg.leader())
+        partials[sg.get_group_linear_id()] = value;
+    sycl::group_barrier(item.get_group());
+    value = partials[0];
+    for (std::size_t j = 1; j < sg.get_group_linear_range(); ++j) {
+        value = sycl::fmax(value, partials[j]);
+    }
+    sycl::group_barrier(item.get_group());
+    return value;
+}
+
+// Vectors of the kernels. bind(cgh) returns the function giving a reference to the i-th element
+// within the command group cgh, for USM pointers and buffers alike.
+template <typename T>
+struct usm_vector {
+    T* data;
+    std::int64_t n;
+    std::int64_t inc;
+
+    auto bind(sycl::handler&) const {
+        return [data = data, n = n, inc = inc](std::int64_t i) -> T& {
+            return data[vector_offset(i, n, inc)];
+        };
+    }
+};
+
+template <typename T, sycl::access::mode Mode>
+struct buffer_vector {
+    sycl::buffer<T, 1>& buffer;
+    std::int64_t n;
+    std::int64_t inc;
+
+    auto bind(sycl::handler& cgh) const {
+        auto acc = buffer.template get_access<Mode>(cgh);
+        return [acc, n = n, inc = inc](std::int64_t i) -> decltype(auto) {
+            return acc[vector_offset(i, n, inc)];
+        };
+    }
+};
+
+template <typename T>
+inline usm_vector<T> in(T* data, std::int64_t n = 1, std::int64_t inc = 1) {
+    return { data, n, inc };
+}
+
+template <typename T>
+inline usm_vector<T> inout(T* data, std::int64_t n = 1, std::int64_t inc = 1) {
+    return { data, n, inc };
+}
+
+template <typename T>
+inline buffer_vector<T, sycl::access::mode::read> in(sycl::buffer<T, 1>& buffer,
+                                                     std::int64_t n = 1, std::int64_t inc = 1) {
+    return { buffer, n, inc };
+}
+
+template <typename T>
+inline buffer_vector<T, sycl::access::mode::read_write> inout(sycl::buffer<T, 1>& buffer,
+                                                              std::int64_t n = 1,
+                                                              std::int64_t inc = 1) {
+    return { buffer, n, inc };
+}
+
+// Scalar result of a reduction, written by a single work-item or through a sycl::reduction
+// initialized by the reduction kernel itself
+template <typename T>
+struct usm_result {
+    T* data;
+
+    auto writer(sycl::handler&) const {
+        return [data = data](T value) { data[0] = value; };
+    }
+
+    auto reduction(sycl::handler&) const {
+        return sycl::reduction(
+            data, T(0), sycl::plus<T>(),
+            sycl::property_list{ sycl::property::reduction::initialize_to_identity{} });
+    }
+};
+
+template <typename T>
+struct buffer_result {
+    sycl::buffer<T, 1>& buffer;
+
+    auto writer(sycl::handler& cgh) const {
+        auto acc = buffer.template get_access<sycl::access::mode::write>(cgh);
+        return [acc](T value) { acc[0] = value; };
+    }
+
+    auto reduction(sycl::handler& cgh) const {
+        return sycl::reduction(
+            buffer, cgh, T(0), sycl::plus<T>(),
+            sycl::property_list{ sycl::property::reduction::initialize_to_identity{} });
+    }
+};
+
+template <typename T>
+inline usm_result<T> out(T* data) {
+    return { data };
+}
+
+template <typename T>
+inline buffer_result<T> out(sycl::buffer<T, 1>& buffer) {
+    return { buffer };
+}
+
+// Largest vector reduced by a single work-group, above it the reductions use all the device
+constexpr std::int64_t single_group_max_size = 1 << 16;
+
+inline std::size_t single_group_size(sycl::queue& queue) {
+    return std::min<std::size_t>(
+        256, queue.get_device().get_info<sycl::info::device::max_work_group_size>());
+}
+
+// Writes init plus the sum of the n terms given by the function returned by bind_term(cgh) to
+// result, in a single launch: small vectors are reduced by one work-group, larger ones by a
+// sycl::reduction initialized by the kernel. Unlike onemath_sycl_blas, which accumulates into
+// the result, no kernel is needed to initialize it.
+template <typename T, typename Result, typename BindTerm>
+sycl::event reduce_sum(sycl::queue& queue, std::int64_t n, Result result, T init,
+                       BindTerm bind_term, const std::vector<sycl::event>& dependencies) {
+    if (n <= single_group_max_size) {
+        const std::size_t group_size = single_group_size(queue);
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto term = bind_term(cgh);
+            auto write = result.writer(cgh);
+            sycl::local_accessor<T, 1> partials(sycl::range<1>(group_size), cgh);
+            cgh.parallel_for(sycl::nd_range<1>(group_size, group_size), [=](sycl::nd_item<1> item) {
+                T sum = T(0);
+                for (std::int64_t i = item.get_local_linear_id(); i < n;
+                     i += static_cast<std::int64_t>(group_size)) {
+                    sum += term(i);
+                }
+                sum = group_sum(item, partials, sum);
+                if (item.get_local_linear_id() == 0)
+                    write(sum + init);
+            });
+        });
+    }
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto term = bind_term(cgh);
+        cgh.parallel_for(sycl::range<1>(n), result.reduction(cgh),
+                         [=](sycl::item<1> item, auto& sum) {
+                             const std::int64_t i = item.get_linear_id();
+                             sum.combine(i == 0 ? term(i) + init : term(i));
+                         });
+    });
+}
+
+// Sum of conj(x_i) * y_i when conj_x is set, of x_i * y_i otherwise, plus init
+template <bool conj_x, typename T, typename X, typename Y, typename Result>
+sycl::event dot(sycl::queue& queue, std::int64_t n, X x, Y y, Result result, T init,
+                const std::vector<sycl::event>& dependencies) {
+    return reduce_sum(
+        queue, n, result, init,
+        [&](sycl::handler& cgh) {
+            auto xi = x.bind(cgh);
+            auto yi = y.bind(cgh);
+            return [=](std::int64_t i) -> T {
+                if constexpr (conj_x)
+                    return mul(conjugate(T(xi(i))), T(yi(i)));
+                else
+                    return mul(T(xi(i)), T(yi(i)));
+            };
+        },
+        dependencies);
+}
+
+// Sum of x_i * y_i plus sb, accumulated in double as sdsdot requires and rounded to the type R of
+// the result. Above a single work-group, the sum is reduced into a temporary double first.
+template <typename R, typename X, typename Y, typename Result>
+sycl::event sdsdot(sycl::queue& queue, std::int64_t n, R sb, X x, Y y, Result result,
+                   const std::vector<sycl::event>& dependencies) {
+    auto bind_term = [&](sycl::handler& cgh) {
+        auto xi = x.bind(cgh);
+        auto yi = y.bind(cgh);
+        return [=](std::int64_t i) { return double(xi(i)) * double(yi(i)); };
+    };
+    if (n <= single_group_max_size || std::is_same_v<R, double>)
+        return reduce_sum(queue, n, result, double(sb), bind_term, dependencies);
+
+    double* scratch = scratch_alloc<double>(queue, 1, "sdsdot");
+    auto sum = reduce_sum(queue, n, out(scratch), double(sb), bind_term, dependencies);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(sum);
+        auto write = result.writer(cgh);
+        cgh.single_task([=]() { write(R(scratch[0])); });
+    });
+    free_after(queue, done, scratch);
+    return done;
+}
+
+template <typename R, typename X, typename Result>
+sycl::event asum(sycl::queue& queue, std::int64_t n, X x, Result result,
+                 const std::vector<sycl::event>& dependencies) {
+    return reduce_sum(
+        queue, n, result, R(0),
+        [&](sycl::handler& cgh) {
+            auto xi = x.bind(cgh);
+            return [=](std::int64_t i) { return abs_sum(xi(i)); };
+        },
+        dependencies);
+}
+
+// Euclidean norm of x, computed in two passes so that it neither overflows nor underflows: the
+// first finds the largest magnitude of the parts, the second sums the squares of the elements
+// scaled by it. The maximum leaves NaN out, so the first pass also records whether there is one,
+// the norm being NaN then.
+template <typename R, typename X, typename Result>
+sycl::event nrm2(sycl::queue& queue, std::int64_t n, X x, Result result,
+                 const std::vector<sycl::event>& dependencies) {
+    auto finalize = [](R scale, R sum, bool nan) {
+        if (nan)
+            return std::numeric_limits<R>::quiet_NaN();
+        return sycl::isinf(scale) || scale == R(0) ? scale : scale * sycl::sqrt(sum);
+    };
+
+    // Both passes in one work-group, in a single launch
+    if (n <= single_group_max_size) {
+        const std::size_t group_size = single_group_size(queue);
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto xi = x.bind(cgh);
+            auto write = result.writer(cgh);
+            sycl::local_accessor<R, 1> partials(sycl::range<1>(group_size), cgh);
+            cgh.parallel_for(sycl::nd_range<1>(group_size, group_size), [=](sycl::nd_item<1> item) {
+                const auto stride = static_cast<std::int64_t>(group_size);
+                R scale = R(0);
+                bool nan = false;
+                for (std::int64_t i = item.get_local_linear_id(); i < n; i += stride) {
+                    const R a = abs_max(xi(i));
+                    nan = nan || sycl::isnan(a);
+                    scale = sycl::fmax(scale, a);
+                }
+                nan = sycl::any_of_group(item.get_group(), nan);
+                scale = group_max(item, partials, scale);
+                R sum = R(0);
+                if (scale > R(0) && !sycl::isinf(scale)) {
+                    for (std::int64_t i = item.get_local_linear_id(); i < n; i += stride) {
+                        sum += scaled_square(xi(i), scale);
+                    }
+                }
+                sum = group_sum(item, partials, sum);
+                if (item.get_local_linear_id() == 0)
+                    write(finalize(scale, sum, nan));
+            });
+        });
+    }
+
+    // Reductions over the whole device, the scale, the sum and a NaN flag, 1 when x holds a NaN,
+    // being kept in a temporary allocation
+    R* scratch = scratch_alloc<R>(queue, 3, "nrm2");
+    auto max_pass = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto xi = x.bind(cgh);
+        const sycl::property_list initialize{
+            sycl::property::reduction::initialize_to_identity{}
+        };
+        auto scale_reduction = sycl::reduction(scratch, sycl::maximum<R>(), initialize);
+        auto nan_reduction = sycl::reduction(scratch + 2, sycl::maximum<R>(), initialize);
+        cgh.parallel_for(sycl::range<1>(n), scale_reduction, nan_reduction,
+                         [=](sycl::item<1> item, auto& scale, auto& nan) {
+                             const R a = abs_max(xi(item.get_linear_id()));
+                             scale.combine(sycl::isnan(a) ? R(0) : a);
+                             nan.combine(sycl::isnan(a) ? R(1) : R(0));
+                         });
+    });
+    auto sum_pass = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(max_pass);
+        auto xi = x.bind(cgh);
+        auto reduction = sycl::reduction(
+            scratch + 1, sycl::plus<R>(),
+            sycl::property_list{ sycl::property::reduction::initialize_to_identity{} });
+        cgh.parallel_for(sycl::range<1>(n), reduction, [=](sycl::item<1> item, auto& sum) {
+            const R scale = scratch[0];
+            if (scale > R(0) && !sycl::isinf(scale))
+                sum.combine(scaled_square(xi(item.get_linear_id()), scale));
+        });
+    });
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(sum_pass);
+        auto write = result.writer(cgh);
+        cgh.single_task([=]() { write(finalize(scratch[0], scratch[1], scratch[2] > R(0))); });
+    });
+    free_after(queue, done, scratch);
+    return done;
+}
+
+// Rank of an element of magnitude a for iamax when largest is set, for iamin otherwise: the
+// higher the better. NaN ranks above every magnitude, so that the index of the first NaN is
+// returned wherever it is, as oneMKL does; the reference BLAS only returns it when it is the
+// first element. Magnitudes are non-negative, so the bits of a compare as a.
+template <bool largest, typename R>
+inline std::uint64_t extremum_rank(R a) {
+    constexpr std::uint64_t nan_rank = ~std::uint64_t(0);
+    if (sycl::isnan(a))
+        return nan_rank;
+    std::uint64_t bits;
+    if constexpr (sizeof(R) == sizeof(std::uint32_t))
+        bits = sycl::bit_cast<std::uint32_t>(a);
+    else
+        bits = sycl::bit_cast<std::uint64_t>(a);
+    return largest ? bits : nan_rank - 1 - bits;
+}
+
+// Index given to work-items with no element, losing every tie
+constexpr std::int64_t no_index = std::numeric_limits<std::int64_t>::max();
+
+// Highest rank over the work-group and the smallest index having it, returned to every
+// work-item: each sub-group reduces the ranks then the indices of its best rank, then the pairs
+// of the sub-groups are combined through local memory
+inline void group_first_best(sycl::nd_item<1> item,
+                             const sycl::local_accessor<std::uint64_t, 1>& ranks,
+                             const sycl::local_accessor<std::int64_t, 1>& indices,
+                             std::uint64_t& rank, std::int64_t& index) {
+    auto sg = item.get_sub_group();
+    const std::uint64_t best = sycl::reduce_over_group(sg, rank, sycl::maximum<std::uint64_t>());
+    index = sycl::reduce_over_group(sg, rank == best ? index : no_index,
+                                    sycl::minimum<std::int64_t>());
+    rank = best;
+    if (sg.leader()) {
+        ranks[sg.get_group_linear_id()] = rank;
+        indices[sg.get_group_linear_id()] = index;
+    }
+    sycl::group_barrier(item.get_group());
+    rank = ranks[0];
+    index = indices[0];
+    for (std::size_t j = 1; j < sg.get_group_linear_range(); ++j) {
+        if (ranks[j] > rank || (ranks[j] == rank && indices[j] < index)) {
+            rank = ranks[j];
+            index = indices[j];
+        }
+    }
+    sycl::group_barrier(item.get_group());
+}
+
+// Index of the first element of x of largest |re| + |im| when largest is set, of smallest
+// otherwise, 0 when n < 1 or the increment of x is not positive as in the reference BLAS. Every
+// work-group reduces its (rank, index) pairs, small vectors in a single launch, larger ones
+// writing one pair per work-group to a temporary allocation reduced by a final work-group.
+template <bool largest, typename R, typename X, typename Result>
+sycl::event iamax_iamin(sycl::queue& queue, std::int64_t n, X x, Result result,
+                        const std::vector<sycl::event>& dependencies) {
+    if (n < 1 || x.inc <= 0) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto write = result.writer(cgh);
+            cgh.single_task([=]() { write(0); });
+        });
+    }
+
+    const std::size_t group_size = single_group_size(queue);
+    std::size_t num_groups = 1;
+    if (n > single_group_max_size) {
+        const auto compute_units =
+            queue.get_device().get_info<sycl::info::device::max_compute_units>();
+        num_groups = std::min<std::size_t>((n + group_size - 1) / group_size, 8 * compute_units);
+    }
+
+    // Ranks and indices reduced by each work-group over a grid-stride loop, so that the
+    // elements of a work-item come in increasing order and a strict comparison keeps the first
+    auto reduce_groups = [=](auto rank_of) {
+        return [=](sycl::nd_item<1> item, const sycl::local_accessor<std::uint64_t, 1>& ranks,
+                   const sycl::local_accessor<std::int64_t, 1>& indices, std::uint64_t& rank,
+                   std::int64_t& index) {
+            const auto stride = static_cast<std::int64_t>(item.get_global_range(0));
+            rank = 0;
+            index = no_index;
+            for (std::int64_t i = item.get_global_linear_id(); i < n; i += stride) {
+                const std::uint64_t r = rank_of(i);
+                if (r > rank || index == no_index) {
+                    rank = r;
+                    index = i;
+                }
+            }
+            group_first_best(item, ranks, indices, rank, index);
+        };
+    };
+
+    if (num_groups == 1) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto xi = x.bind(cgh);
+            auto write = result.writer(cgh);
+            auto reduce = reduce_groups(
+                [=](std::int64_t i) { return extremum_rank<largest, R>(abs_sum(xi(i))); });
+            sycl::local_accessor<std::uint64_t, 1> ranks(sycl::range<1>(group_size), cgh);
+            sycl::local_accessor<std::int64_t, 1> indices(sycl::range<1>(group_size), cgh);
+            cgh.parallel_for(sycl::nd_range<1>(group_size, group_size), [=](sycl::nd_item<1> item) {
+                std::uint64_t rank;
+                std::int64_t index;
+                reduce(item, ranks, indices, rank, index);
+                if (item.get_local_linear_id() == 0)
+                    write(index);
+            });
+        });
+    }
+
+    // One allocation holding the ranks then the indices of the work-groups
+    std::uint64_t* group_ranks =
+        scratch_alloc<std::uint64_t>(queue, 2 * num_groups, largest ? "iamax" : "iamin");
+    auto* group_indices = reinterpret_cast<std::int64_t*>(group_ranks + num_groups);
+    auto groups_pass = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto xi = x.bind(cgh);
+        auto reduce = reduce_groups(
+            [=](std::int64_t i) { return extremum_rank<largest, R>(abs_sum(xi(i))); });
+        sycl::local_accessor<std::uint64_t, 1> ranks(sycl::range<1>(group_size), cgh);
+        sycl::local_accessor<std::int64_t, 1> indices(sycl::range<1>(group_size), cgh);
+        cgh.parallel_for(sycl::nd_range<1>(num_groups * group_size, group_size),
+                         [=](sycl::nd_item<1> item) {
+                             std::uint64_t rank;
+                             std::int64_t index;
+                             reduce(item, ranks, indices, rank, index);
+                             if (item.get_local_linear_id() == 0) {
+                                 group_ranks[item.get_group_linear_id()] = rank;
+                                 group_indices[item.get_group_linear_id()] = index;
+                             }
+                         });
+    });
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(groups_pass);
+        auto write = result.writer(cgh);
+        sycl::local_accessor<std::uint64_t, 1> ranks(sycl::range<1>(group_size), cgh);
+        sycl::local_accessor<std::int64_t, 1> indices(sycl::range<1>(group_size), cgh);
+        const auto count = static_cast<std::int64_t>(num_groups);
+        cgh.parallel_for(sycl::nd_range<1>(group_size, group_size), [=](sycl::nd_item<1> item) {
+            std::uint64_t rank = 0;
+            std::int64_t index = no_index;
+            for (std::int64_t g = item.get_local_linear_id(); g < count;
+                 g += static_cast<std::int64_t>(group_size)) {
+                if (group_ranks[g] > rank || (group_ranks[g] == rank && group_indices[g] < index)) {
+                    rank = group_ranks[g];
+                    index = group_indices[g];
+                }
+            }
+            group_first_best(item, ranks, indices, rank, index);
+            if (item.get_local_linear_id() == 0)
+                write(index);
+        });
+    });
+    free_after(queue, done, group_ranks);
+    return done;
+}
+
+// Event of a call with nothing to compute, complete once its dependencies are
+inline sycl::event no_op(sycl::queue& queue, const std::vector<sycl::event>& dependencies) {
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.single_task([]() {});
+    });
+}
+
+// Runs f(i) for i in [0, n) with the elements of the vectors given by their bind(cgh)
+template <typename F, typename... Vectors>
+sycl::event for_each(sycl::queue& queue, std::int64_t n,
+                     const std::vector<sycl::event>& dependencies, F f, Vectors... vectors) {
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto kernel = [=](auto... elements) {
+            return [=](sycl::id<1> id) { f(elements(id[0])...); };
+        };
+        cgh.parallel_for(sycl::range<1>(std::max<std::int64_t>(n, 0)),
+                         kernel(vectors.bind(cgh)...));
+    });
+}
+
+// y = alpha * x + y
+template <typename T, typename X, typename Y>
+sycl::event axpy(sycl::queue& queue, std::int64_t n, T alpha, X x, Y y,
+                 const std::vector<sycl::event>& dependencies) {
+    return for_each(
+        queue, n, dependencies, [=](const auto& xi, auto& yi) { yi = mul(alpha, T(xi)) + yi; },
+        x, y);
+}
+
+// x = alpha * x, alpha being real or of the type of x
+template <typename A, typename X>
+sycl::event scal(sycl::queue& queue, std::int64_t n, A alpha, X x,
+                 const std::vector<sycl::event>& dependencies) {
+    return for_each(
+        queue, n, dependencies, [=](auto& xi) { xi = mul(alpha, xi); }, x);
+}
+
+template <typename X, typename Y>
+sycl::event copy(sycl::queue& queue, std::int64_t n, X x, Y y,
+                 const std::vector<sycl::event>& dependencies) {
+    return for_each(
+        queue, n, dependencies, [=](const auto& xi, auto& yi) { yi = xi; }, x, y);
+}
+
+template <typename X, typename Y>
+sycl::event swap(sycl::queue& queue, std::int64_t n, X x, Y y,
+                 const std::vector<sycl::event>& dependencies) {
+    return for_each(
+        queue, n, dependencies,
+        [=](auto& xi, auto& yi) {
+            auto tmp = xi;
+            xi = yi;
+            yi = tmp;
+        },
+        x, y);
+}
+
+// Applies the plane rotation of real cosine c and sine s to the pairs (x_i, y_i)
+template <typename R, typename X, typename Y>
+sycl::event rot(sycl::queue& queue, std::int64_t n, X x, Y y, R c, R s,
+                const std::vector<sycl::event>& dependencies) {
+    return for_each(
+        queue, n, dependencies,
+        [=](auto& xi, auto& yi) {
+            auto xv = xi, yv = yi;
+            xi = mul(c, xv) + mul(s, yv);
+            yi = mul(c, yv) - mul(s, xv);
+        },
+        x, y);
+}
+
+// Complex plane rotation zeroing b, as the reference crotg: on exit a holds r
+template <typename R, typename A, typename B, typename C, typename S>
+sycl::event rotg(sycl::queue& queue, A a, B b, C c, S s,
+                 const std::vector<sycl::event>& dependencies) {
+    return for_each(
+        queue, 1, dependencies,
+        [=](std::complex<R>& ai, const std::complex<R>& bi, R& ci, std::complex<R>& si) {
+            const std::complex<R> av = ai, bv = bi;
+            const R abs_a = sycl::hypot(av.real(), av.imag());
+            if (abs_a == R(0)) {
+                ci = R(0);
+                si = std::complex<R>(R(1), R(0));
+                ai = bv;
+                return;
+            }
+            const R abs_b = sycl::hypot(bv.real(), bv.imag());
+            const R scale = abs_a + abs_b;
+            const R norm =
+                scale * sycl::sqrt(scaled_square(av, scale) + scaled_square(bv, scale));
+            const std::complex<R> alpha(av.real() / abs_a, av.imag() / abs_a);
+            ci = abs_a / norm;
+            si = mul(R(1) / norm, mul(alpha, conjugate(bv)));
+            ai = mul(norm, alpha);
+        },
+        a, b, c, s);
+}
+
+} // namespace detail
+} // namespace generic
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif // _GENERIC_BLAS_KERNELS_HPP_
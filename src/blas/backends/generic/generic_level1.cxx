@@ -22,49 +22,53 @@
 void dotc(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
           std::int64_t incx, sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<real_t>, 1>& result) {
-    throw unimplemented("blas", "dotc", "");
+    detail::check_device_support<real_t>(queue, "dotc");
+    detail::dot<true>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                      detail::out(result), std::complex<real_t>(0), {});
 }
 
 void dotu(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
           std::int64_t incx, sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<real_t>, 1>& result) {
-    throw unimplemented("blas", "dotu", "");
+    detail::check_device_support<real_t>(queue, "dotu");
+    detail::dot<false>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                       detail::out(result), std::complex<real_t>(0), {});
 }
 
 void iamax(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    CALL_GENERIC_BLAS_FN(::blas::_iamax, queue, n, x, incx, result);
+    detail::check_device_support<real_t>(queue, "iamax");
+    detail::iamax_iamin<true, real_t>(queue, n, detail::in(x, n, incx), detail::out(result), {});
 }
 
 void iamax(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
            std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    throw unimplemented("blas", "iamax", "");
+    detail::check_device_support<real_t>(queue, "iamax");
+    detail::iamax_iamin<true, real_t>(queue, n, detail::in(x, n, incx), detail::out(result), {});
 }
 
 void iamin(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    CALL_GENERIC_BLAS_FN(::blas::_iamin, queue, n, x, incx, result);
+    detail::check_device_support<real_t>(queue, "iamin");
+    detail::iamax_iamin<false, real_t>(queue, n, detail::in(x, n, incx), detail::out(result), {});
 }
 
 void iamin(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
            std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    throw unimplemented("blas", "iamin", "");
+    detail::check_device_support<real_t>(queue, "iamin");
+    detail::iamax_iamin<false, real_t>(queue, n, detail::in(x, n, incx), detail::out(result), {});
 }
 
 void asum(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
           std::int64_t incx, sycl::buffer<real_t, 1>& result) {
-    throw unimplemented("blas", "asum", "");
+    detail::check_device_support<real_t>(queue, "asum");
+    detail::asum<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result), {});
 }
 
 void asum(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
           sycl::buffer<real_t, 1>& result) {
-    // Generic BLAS asum implementation requires that result is initialized to zero
-    // before performing the computation.
-    queue.submit([&](sycl::handler& cgh) {
-        auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
-    });
-    CALL_GENERIC_BLAS_FN(::blas::_asum, queue, n, x, incx, result);
+    detail::check_device_support<real_t>(queue, "asum");
+    detail::asum<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result), {});
 }
 
 void axpy(sycl::queue& queue, std::int64_t n, real_t alpha, sycl::buffer<real_t, 1>& x,
@@ -75,7 +79,8 @@ void axpy(sycl::queue& queue, std::int64_t n, real_t alpha, sycl::buffer<real_t,
 void axpy(sycl::queue& queue, std::int64_t n, std::complex<real_t> alpha,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "axpy", "for complex");
+    detail::check_device_support<real_t>(queue, "axpy");
+    detail::axpy(queue, n, alpha, detail::in(x, n, incx), detail::inout(y, n, incy), {});
 }
 
 void axpby(sycl::queue& queue, std::int64_t n, real_t alpha, sycl::buffer<real_t, 1>& x,
@@ -96,59 +101,51 @@ void copy(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::i
 
 void copy(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
           std::int64_t incx, sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "copy", " for complex.");
+    detail::check_device_support<real_t>(queue, "copy");
+    detail::copy(queue, n, detail::in(x, n, incx), detail::inout(y, n, incy), {});
 }
 
 void dot(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
          sycl::buffer<real_t, 1>& y, std::int64_t incy, sycl::buffer<real_t, 1>& result) {
-    // Generic BLAS dot implementation requires that result is initialized to zero
-    // before performing the computation.
-    queue.submit([&](sycl::handler& cgh) {
-        auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
-    });
-    CALL_GENERIC_BLAS_FN(::blas::_dot, queue, n, x, incx, y, incy, result);
+    detail::check_device_support<real_t>(queue, "dot");
+    detail::dot<false>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                       detail::out(result), real_t(0), {});
 }
 
 #ifdef ENABLE_MIXED_PRECISION_WITH_DOUBLE
 void dot(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x, std::int64_t incx,
          sycl::buffer<float, 1>& y, std::int64_t incy, sycl::buffer<double, 1>& result) {
-    throw unimplemented("blas", "dot", " for unmatched return type");
+    detail::check_device_support<double>(queue, "dot");
+    detail::dot<false>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                       detail::out(result), double(0), {});
 }
 #endif
 
 void sdsdot(sycl::queue& queue, std::int64_t n, real_t sb, sycl::buffer<real_t, 1>& x,
             std::int64_t incx, sycl::buffer<real_t, 1>& y, std::int64_t incy,
             sycl::buffer<real_t, 1>& result) {
-    // Generic BLAS sdsdot implementation requires that result is initialized to zero
-    // before performing the computation.
-    queue.submit([&](sycl::handler& cgh) {
-        auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
-    });
-    CALL_GENERIC_BLAS_FN(::blas::_sdsdot, queue, n, sb, x, incx, y, incy, result);
+    detail::check_device_support<double>(queue, "sdsdot");
+    detail::sdsdot(queue, n, sb, detail::in(x, n, incx), detail::in(y, n, incy),
+                   detail::out(result), {});
 }
 
 void nrm2(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
           std::int64_t incx, sycl::buffer<real_t, 1>& result) {
-    throw unimplemented("blas", "nrm2", " for complex");
+    detail::check_device_support<real_t>(queue, "nrm2");
+    detail::nrm2<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result), {});
 }
 
 void nrm2(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
           sycl::buffer<real_t, 1>& result) {
-    // Generic BLAS nrm2 implementation requires that result is initialized to zero
-    // before performing the computation.
-    queue.submit([&](sycl::handler& cgh) {
-        auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
-    });
-    CALL_GENERIC_BLAS_FN(::blas::_nrm2, queue, n, x, incx, result);
+    detail::check_device_support<real_t>(queue, "nrm2");
+    detail::nrm2<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result), {});
 }
 
 void rot(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
          std::int64_t incx, sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy, real_t c,
          real_t s) {
-    throw unimplemented("blas", "rot", " for complex");
+    detail::check_device_support<real_t>(queue, "rot");
+    detail::rot(queue, n, detail::inout(x, n, incx), detail::inout(y, n, incy), c, s, {});
 }
 
 void rot(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
@@ -164,7 +161,9 @@ void rotg(sycl::queue& queue, sycl::buffer<real_t, 1>& a, sycl::buffer<real_t, 1
 void rotg(sycl::queue& queue, sycl::buffer<std::complex<real_t>, 1>& a,
           sycl::buffer<std::complex<real_t>, 1>& b, sycl::buffer<real_t, 1>& c,
           sycl::buffer<std::complex<real_t>, 1>& s) {
-    throw unimplemented("blas", "rotg", " for complex");
+    detail::check_device_support<real_t>(queue, "rotg");
+    detail::rotg<real_t>(queue, detail::inout(a), detail::in(b), detail::inout(c), detail::inout(s),
+                         {});
 }
 
 void rotm(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
@@ -184,12 +183,14 @@ void scal(sycl::queue& queue, std::int64_t n, real_t alpha, sycl::buffer<real_t,
 
 void scal(sycl::queue& queue, std::int64_t n, std::complex<real_t> alpha,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx) {
-    throw unimplemented("blas", "scal", " for complex");
+    detail::check_device_support<real_t>(queue, "scal");
+    detail::scal(queue, n, alpha, detail::inout(x, n, std::abs(incx)), {});
 }
 
 void scal(sycl::queue& queue, std::int64_t n, real_t alpha,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx) {
-    throw unimplemented("blas", "scal", " for complex");
+    detail::check_device_support<real_t>(queue, "scal");
+    detail::scal(queue, n, alpha, detail::inout(x, n, std::abs(incx)), {});
 }
 
 void swap(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::int64_t incx,
@@ -199,7 +200,8 @@ void swap(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::i
 
 void swap(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>, 1>& x,
           std::int64_t incx, sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "swap", " for complex");
+    detail::check_device_support<real_t>(queue, "swap");
+    detail::swap(queue, n, detail::inout(x, n, incx), detail::inout(y, n, incy), {});
 }
 
 // USM APIs
@@ -207,51 +209,61 @@ void swap(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<real_t>,
 sycl::event dotc(sycl::queue& queue, std::int64_t n, const std::complex<real_t>* x,
                  std::int64_t incx, const std::complex<real_t>* y, std::int64_t incy,
                  std::complex<real_t>* result, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dotc", " for USM");
+    detail::check_device_support<real_t>(queue, "dotc");
+    return detail::dot<true>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                             detail::out(result), std::complex<real_t>(0), dependencies);
 }
 
 sycl::event dotu(sycl::queue& queue, std::int64_t n, const std::complex<real_t>* x,
                  std::int64_t incx, const std::complex<real_t>* y, std::int64_t incy,
                  std::complex<real_t>* result, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dotu", " for USM");
+    detail::check_device_support<real_t>(queue, "dotu");
+    return detail::dot<false>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                              detail::out(result), std::complex<real_t>(0), dependencies);
 }
 
 sycl::event iamax(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64_t incx,
                   std::int64_t* result, const std::vector<sycl::event>& dependencies) {
-    CALL_GENERIC_BLAS_USM_FN(::blas::_iamax, queue, n, x, incx, result, dependencies);
+    detail::check_device_support<real_t>(queue, "iamax");
+    return detail::iamax_iamin<true, real_t>(queue, n, detail::in(x, n, incx), detail::out(result),
+                                             dependencies);
 }
 
 sycl::event iamax(sycl::queue& queue, std::int64_t n, const std::complex<real_t>* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "iamax", " for USM");
+    detail::check_device_support<real_t>(queue, "iamax");
+    return detail::iamax_iamin<true, real_t>(queue, n, detail::in(x, n, incx), detail::out(result),
+                                             dependencies);
 }
 
 sycl::event iamin(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64_t incx,
                   std::int64_t* result, const std::vector<sycl::event>& dependencies) {
-    CALL_GENERIC_BLAS_USM_FN(::blas::_iamin, queue, n, x, incx, result, dependencies);
+    detail::check_device_support<real_t>(queue, "iamin");
+    return detail::iamax_iamin<false, real_t>(queue, n, detail::in(x, n, incx), detail::out(result),
+                                              dependencies);
 }
 
 sycl::event iamin(sycl::queue& queue, std::int64_t n, const std::complex<real_t>* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "iamin", " for USM");
+    detail::check_device_support<real_t>(queue, "iamin");
+    return detail::iamax_iamin<false, real_t>(queue, n, detail::in(x, n, incx), detail::out(result),
+                                              dependencies);
 }
 
 sycl::event asum(sycl::queue& queue, std::int64_t n, const std::complex<real_t>* x,
                  std::int64_t incx, real_t* result, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "asum", " for USM");
+    detail::check_device_support<real_t>(queue, "asum");
+    return detail::asum<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result),
+                                dependencies);
 }
 
 sycl::event asum(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64_t incx,
                  real_t* result, const std::vector<sycl::event>& dependencies) {
-    // Generic BLAS asum implementation requires result to be initializes to zero
-    // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
-    std::vector<sycl::event> new_dependencies = dependencies;
-    new_dependencies.push_back(init_res_val);
-    CALL_GENERIC_BLAS_USM_FN(::blas::_asum, queue, n, x, incx, result, new_dependencies);
+    detail::check_device_support<real_t>(queue, "asum");
+    return detail::asum<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result),
+                                dependencies);
 }
 
 sycl::event axpy(sycl::queue& queue, std::int64_t n, real_t alpha, const real_t* x,
@@ -263,7 +275,9 @@ sycl::event axpy(sycl::queue& queue, std::int64_t n, real_t alpha, const real_t*
 sycl::event axpy(sycl::queue& queue, std::int64_t n, std::complex<real_t> alpha,
                  const std::complex<real_t>* x, std::int64_t incx, std::complex<real_t>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "axpy", " for USM");
+    detail::check_device_support<real_t>(queue, "axpy");
+    return detail::axpy(queue, n, alpha, detail::in(x, n, incx), detail::inout(y, n, incy),
+                        dependencies);
 }
 
 sycl::event axpby(sycl::queue& queue, std::int64_t n, real_t alpha, const real_t* x,
@@ -287,62 +301,56 @@ sycl::event copy(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64
 sycl::event copy(sycl::queue& queue, std::int64_t n, const std::complex<real_t>* x,
                  std::int64_t incx, std::complex<real_t>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "copy", " for USM");
+    detail::check_device_support<real_t>(queue, "copy");
+    return detail::copy(queue, n, detail::in(x, n, incx), detail::inout(y, n, incy), dependencies);
 }
 
 sycl::event dot(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64_t incx,
                 const real_t* y, std::int64_t incy, real_t* result,
                 const std::vector<sycl::event>& dependencies) {
-    // Generic BLAS dot implementation requires result to be initializes to zero
-    // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
-    std::vector<sycl::event> new_dependencies = dependencies;
-    new_dependencies.emplace_back(init_res_val);
-    CALL_GENERIC_BLAS_USM_FN(::blas::_dot, queue, n, x, incx, y, incy, result, new_dependencies);
+    detail::check_device_support<real_t>(queue, "dot");
+    return detail::dot<false>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                              detail::out(result), real_t(0), dependencies);
 }
 
 #ifdef ENABLE_MIXED_PRECISION_WITH_DOUBLE
 sycl::event dot(sycl::queue& queue, std::int64_t n, const float* x, std::int64_t incx,
                 const float* y, std::int64_t incy, double* result,
                 const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "dot", " for USM");
+    detail::check_device_support<double>(queue, "dot");
+    return detail::dot<false>(queue, n, detail::in(x, n, incx), detail::in(y, n, incy),
+                              detail::out(result), double(0), dependencies);
 }
 #endif
 
 sycl::event sdsdot(sycl::queue& queue, std::int64_t n, real_t sb, const real_t* x,
                    std::int64_t incx, const real_t* y, std::int64_t incy, real_t* result,
                    const std::vector<sycl::event>& dependencies) {
-    // Generic BLAS sdsdot implementation requires result to be initializes to zero
-    // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
-    std::vector<sycl::event> new_dependencies = dependencies;
-    new_dependencies.emplace_back(init_res_val);
-    CALL_GENERIC_BLAS_USM_FN(::blas::_sdsdot, queue, n, sb, x, incx, y, incy, result,
-                             new_dependencies);
+    detail::check_device_support<double>(queue, "sdsdot");
+    return detail::sdsdot(queue, n, sb, detail::in(x, n, incx), detail::in(y, n, incy),
+                          detail::out(result), dependencies);
 }
 
 sycl::event nrm2(sycl::queue& queue, std::int64_t n, const std::complex<real_t>* x,
                  std::int64_t incx, real_t* result, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "nrm2", " for USM");
+    detail::check_device_support<real_t>(queue, "nrm2");
+    return detail::nrm2<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result),
+                                dependencies);
 }
 
 sycl::event nrm2(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64_t incx,
                  real_t* result, const std::vector<sycl::event>& dependencies) {
-    // Generic BLAS nrm2 implementation requires result to be initializes to zero
-    // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
-    std::vector<sycl::event> new_dependencies = dependencies;
-    new_dependencies.push_back(init_res_val);
-    CALL_GENERIC_BLAS_USM_FN(::blas::_nrm2, queue, n, x, incx, result, new_dependencies);
+    detail::check_device_support<real_t>(queue, "nrm2");
+    return detail::nrm2<real_t>(queue, n, detail::in(x, n, std::abs(incx)), detail::out(result),
+                                dependencies);
 }
 
 sycl::event rot(sycl::queue& queue, std::int64_t n, std::complex<real_t>* x, std::int64_t incx,
                 std::complex<real_t>* y, std::int64_t incy, real_t c, real_t s,
                 const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "rot", " for USM");
+    detail::check_device_support<real_t>(queue, "rot");
+    return detail::rot(queue, n, detail::inout(x, n, incx), detail::inout(y, n, incy), c, s,
+                       dependencies);
 }
 
 sycl::event rot(sycl::queue& queue, std::int64_t n, real_t* x, std::int64_t incx, real_t* y,
@@ -358,7 +366,9 @@ sycl::event rotg(sycl::queue& queue, real_t* a, real_t* b, real_t* c, real_t* s,
 
 sycl::event rotg(sycl::queue& queue, std::complex<real_t>* a, std::complex<real_t>* b, real_t* c,
                  std::complex<real_t>* s, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "rotg", " for USM");
+    detail::check_device_support<real_t>(queue, "rotg");
+    return detail::rotg<real_t>(queue, detail::inout(a), detail::in(b), detail::inout(c),
+                                detail::inout(s), dependencies);
 }
 
 sycl::event rotm(sycl::queue& queue, std::int64_t n, real_t* x, std::int64_t incx, real_t* y,
@@ -379,12 +389,14 @@ sycl::event scal(sycl::queue& queue, std::int64_t n, real_t alpha, real_t* x, st
 sycl::event scal(sycl::queue& queue, std::int64_t n, std::complex<real_t> alpha,
                  std::complex<real_t>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "scal", " for USM");
+    detail::check_device_support<real_t>(queue, "scal");
+    return detail::scal(queue, n, alpha, detail::inout(x, n, std::abs(incx)), dependencies);
 }
 
 sycl::event scal(sycl::queue& queue, std::int64_t n, real_t alpha, std::complex<real_t>* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "scal", " for USM");
+    detail::check_device_support<real_t>(queue, "scal");
+    return detail::scal(queue, n, alpha, detail::inout(x, n, std::abs(incx)), dependencies);
 }
 
 sycl::event swap(sycl::queue& queue, std::int64_t n, real_t* x, std::int64_t incx, real_t* y,
@@ -395,5 +407,7 @@ sycl::event swap(sycl::queue& queue, std::int64_t n, real_t* x, std::int64_t inc
 sycl::event swap(sycl::queue& queue, std::int64_t n, std::complex<real_t>* x, std::int64_t incx,
                  std::complex<real_t>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "swap", " for USM");
+    detail::check_device_support<real_t>(queue, "swap");
+    return detail::swap(queue, n, detail::inout(x, n, incx), detail::inout(y, n, incy),
+                        dependencies);
 }
@@ -29,7 +29,12 @@ void gemv(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m, std
           std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "gemv", " for complex");
+    detail::check_device_support<real_t>(queue, "gemv");
+    const std::int64_t x_size = trans == oneapi::math::transpose::nontrans ? n : m;
+    const std::int64_t y_size = trans == oneapi::math::transpose::nontrans ? m : n;
+    const detail::general_storage storage{ lda, is_column_major() };
+    detail::gemv(queue, trans, m, n, m - 1, n - 1, alpha, storage, detail::in(a),
+                 detail::in(x, x_size, incx), beta, detail::inout(y, y_size, incy), {});
 }
 
 void gbmv(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
@@ -45,7 +50,12 @@ void gbmv(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m, std
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "gbmv", " for complex");
+    detail::check_device_support<real_t>(queue, "gbmv");
+    const std::int64_t x_size = trans == oneapi::math::transpose::nontrans ? n : m;
+    const std::int64_t y_size = trans == oneapi::math::transpose::nontrans ? m : n;
+    const detail::band_storage storage{ lda, kl, ku, is_column_major() };
+    detail::gemv(queue, trans, m, n, kl, ku, alpha, storage, detail::in(a),
+                 detail::in(x, x_size, incx), beta, detail::inout(y, y_size, incy), {});
 }
 
 void ger(sycl::queue& queue, std::int64_t m, std::int64_t n, real_t alpha,
@@ -58,61 +68,94 @@ void gerc(sycl::queue& queue, std::int64_t m, std::int64_t n, std::complex<real_
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda) {
-    throw unimplemented("blas", "gerc", "");
+    detail::check_device_support<real_t>(queue, "gerc");
+    const detail::general_storage storage{ lda, is_column_major() };
+    detail::ger<true>(queue, m, n, alpha, detail::in(x, m, incx), detail::in(y, n, incy), storage,
+                      detail::inout(a), {});
 }
 
 void geru(sycl::queue& queue, std::int64_t m, std::int64_t n, std::complex<real_t> alpha,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda) {
-    throw unimplemented("blas", "geru", "");
+    detail::check_device_support<real_t>(queue, "geru");
+    const detail::general_storage storage{ lda, is_column_major() };
+    detail::ger<false>(queue, m, n, alpha, detail::in(x, m, incx), detail::in(y, n, incy), storage,
+                       detail::inout(a), {});
 }
 
 void hbmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, std::int64_t k,
           std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "hbmv", "");
+    detail::check_device_support<real_t>(queue, "hbmv");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const std::int64_t kl = upper ? 0 : k, ku = upper ? k : 0;
+    const detail::band_storage storage{ lda, kl, ku, is_column_major() };
+    detail::hemv(queue, n, kl, ku, alpha, storage, detail::in(a), detail::in(x, n, incx), beta,
+                 detail::inout(y, n, incy), {});
 }
 
 void hemv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
           std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "hemv", "");
+    detail::check_device_support<real_t>(queue, "hemv");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::triangular_storage storage{ lda, is_column_major(), upper };
+    detail::hemv(queue, n, upper ? 0 : n - 1, upper ? n - 1 : 0, alpha, storage, detail::in(a),
+                 detail::in(x, n, incx), beta, detail::inout(y, n, incy), {});
 }
 
 void her(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, real_t alpha,
          sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda) {
-    throw unimplemented("blas", "her", "");
+    detail::check_device_support<real_t>(queue, "her");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::triangular_storage storage{ lda, is_column_major(), upper };
+    detail::her(queue, n, alpha, detail::in(x, n, incx), storage, detail::inout(a), {});
 }
 
 void her2(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
           std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda) {
-    throw unimplemented("blas", "her2", "");
+    detail::check_device_support<real_t>(queue, "her2");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::triangular_storage storage{ lda, is_column_major(), upper };
+    detail::her2(queue, n, alpha, detail::in(x, n, incx), detail::in(y, n, incy), storage,
+                 detail::inout(a), {});
 }
 
 void hpmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
           std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& a,
           sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy) {
-    throw unimplemented("blas", "hpmv", "");
+    detail::check_device_support<real_t>(queue, "hpmv");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::packed_storage storage{ n, is_column_major(), upper };
+    detail::hemv(queue, n, upper ? 0 : n - 1, upper ? n - 1 : 0, alpha, storage, detail::in(a),
+                 detail::in(x, n, incx), beta, detail::inout(y, n, incy), {});
 }
 
 void hpr(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, real_t alpha,
          sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<real_t>, 1>& a) {
-    throw unimplemented("blas", "hpr", "");
+    detail::check_device_support<real_t>(queue, "hpr");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::packed_storage storage{ n, is_column_major(), upper };
+    detail::her(queue, n, alpha, detail::in(x, n, incx), storage, detail::inout(a), {});
 }
 
 void hpr2(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
           std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<real_t>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<real_t>, 1>& a) {
-    throw unimplemented("blas", "hpr2", "");
+    detail::check_device_support<real_t>(queue, "hpr2");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::packed_storage storage{ n, is_column_major(), upper };
+    detail::her2(queue, n, alpha, detail::in(x, n, incx), detail::in(y, n, incy), storage,
+                 detail::inout(a), {});
 }
 
 void sbmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, std::int64_t k,
@@ -249,7 +292,13 @@ sycl::event gemv(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t
                  const std::complex<real_t>* x, std::int64_t incx, std::complex<real_t> beta,
                  std::complex<real_t>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemv", " for USM");
+    detail::check_device_support<real_t>(queue, "gemv");
+    const std::int64_t x_size = trans == oneapi::math::transpose::nontrans ? n : m;
+    const std::int64_t y_size = trans == oneapi::math::transpose::nontrans ? m : n;
+    const detail::general_storage storage{ lda, is_column_major() };
+    return detail::gemv(queue, trans, m, n, m - 1, n - 1, alpha, storage, detail::in(a),
+                        detail::in(x, x_size, incx), beta, detail::inout(y, y_size, incy),
+                        dependencies);
 }
 
 sycl::event gbmv(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
@@ -265,7 +314,13 @@ sycl::event gbmv(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t
                  const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* x,
                  std::int64_t incx, std::complex<real_t> beta, std::complex<real_t>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gbmv", " for USM");
+    detail::check_device_support<real_t>(queue, "gbmv");
+    const std::int64_t x_size = trans == oneapi::math::transpose::nontrans ? n : m;
+    const std::int64_t y_size = trans == oneapi::math::transpose::nontrans ? m : n;
+    const detail::band_storage storage{ lda, kl, ku, is_column_major() };
+    return detail::gemv(queue, trans, m, n, kl, ku, alpha, storage, detail::in(a),
+                        detail::in(x, x_size, incx), beta, detail::inout(y, y_size, incy),
+                        dependencies);
 }
 
 sycl::event ger(sycl::queue& queue, std::int64_t m, std::int64_t n, real_t alpha, const real_t* x,
@@ -279,14 +334,20 @@ sycl::event gerc(sycl::queue& queue, std::int64_t m, std::int64_t n, std::comple
                  const std::complex<real_t>* x, std::int64_t incx, const std::complex<real_t>* y,
                  std::int64_t incy, std::complex<real_t>* a, std::int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gerc", " for USM");
+    detail::check_device_support<real_t>(queue, "gerc");
+    const detail::general_storage storage{ lda, is_column_major() };
+    return detail::ger<true>(queue, m, n, alpha, detail::in(x, m, incx), detail::in(y, n, incy),
+                             storage, detail::inout(a), dependencies);
 }
 
 sycl::event geru(sycl::queue& queue, std::int64_t m, std::int64_t n, std::complex<real_t> alpha,
                  const std::complex<real_t>* x, std::int64_t incx, const std::complex<real_t>* y,
                  std::int64_t incy, std::complex<real_t>* a, std::int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "geru", " for USM");
+    detail::check_device_support<real_t>(queue, "geru");
+    const detail::general_storage storage{ lda, is_column_major() };
+    return detail::ger<false>(queue, m, n, alpha, detail::in(x, m, incx), detail::in(y, n, incy),
+                              storage, detail::inout(a), dependencies);
 }
 
 sycl::event hbmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, std::int64_t k,
@@ -294,7 +355,12 @@ sycl::event hbmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_
                  const std::complex<real_t>* x, std::int64_t incx, std::complex<real_t> beta,
                  std::complex<real_t>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "hbmv", " for USM");
+    detail::check_device_support<real_t>(queue, "hbmv");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const std::int64_t kl = upper ? 0 : k, ku = upper ? k : 0;
+    const detail::band_storage storage{ lda, kl, ku, is_column_major() };
+    return detail::hemv(queue, n, kl, ku, alpha, storage, detail::in(a), detail::in(x, n, incx),
+                        beta, detail::inout(y, n, incy), dependencies);
 }
 
 sycl::event hemv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
@@ -302,20 +368,33 @@ sycl::event hemv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_
                  const std::complex<real_t>* x, std::int64_t incx, std::complex<real_t> beta,
                  std::complex<real_t>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "hemv", " for USM");
+    detail::check_device_support<real_t>(queue, "hemv");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::triangular_storage storage{ lda, is_column_major(), upper };
+    return detail::hemv(queue, n, upper ? 0 : n - 1, upper ? n - 1 : 0, alpha, storage,
+                        detail::in(a), detail::in(x, n, incx), beta, detail::inout(y, n, incy),
+                        dependencies);
 }
 
 sycl::event her(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, real_t alpha,
                 const std::complex<real_t>* x, std::int64_t incx, std::complex<real_t>* a,
                 std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "her", " for USM");
+    detail::check_device_support<real_t>(queue, "her");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::triangular_storage storage{ lda, is_column_major(), upper };
+    return detail::her(queue, n, alpha, detail::in(x, n, incx), storage, detail::inout(a),
+                       dependencies);
 }
 
 sycl::event her2(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
                  std::complex<real_t> alpha, const std::complex<real_t>* x, std::int64_t incx,
                  const std::complex<real_t>* y, std::int64_t incy, std::complex<real_t>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "her2", " for USM");
+    detail::check_device_support<real_t>(queue, "her2");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::triangular_storage storage{ lda, is_column_major(), upper };
+    return detail::her2(queue, n, alpha, detail::in(x, n, incx), detail::in(y, n, incy), storage,
+                        detail::inout(a), dependencies);
 }
 
 sycl::event hpmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
@@ -323,20 +402,33 @@ sycl::event hpmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_
                  const std::complex<real_t>* x, std::int64_t incx, std::complex<real_t> beta,
                  std::complex<real_t>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "hpmv", " for USM");
+    detail::check_device_support<real_t>(queue, "hpmv");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::packed_storage storage{ n, is_column_major(), upper };
+    return detail::hemv(queue, n, upper ? 0 : n - 1, upper ? n - 1 : 0, alpha, storage,
+                        detail::in(a), detail::in(x, n, incx), beta, detail::inout(y, n, incy),
+                        dependencies);
 }
 
 sycl::event hpr(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, real_t alpha,
                 const std::complex<real_t>* x, std::int64_t incx, std::complex<real_t>* a,
                 const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "hpr", " for USM");
+    detail::check_device_support<real_t>(queue, "hpr");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::packed_storage storage{ n, is_column_major(), upper };
+    return detail::her(queue, n, alpha, detail::in(x, n, incx), storage, detail::inout(a),
+                       dependencies);
 }
 
 sycl::event hpr2(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n,
                  std::complex<real_t> alpha, const std::complex<real_t>* x, std::int64_t incx,
                  const std::complex<real_t>* y, std::int64_t incy, std::complex<real_t>* a,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "hpr2", " for USM");
+    detail::check_device_support<real_t>(queue, "hpr2");
+    const bool upper = upper_lower == oneapi::math::uplo::upper;
+    const detail::packed_storage storage{ n, is_column_major(), upper };
+    return detail::her2(queue, n, alpha, detail::in(x, n, incx), detail::in(y, n, incy), storage,
+                        detail::inout(a), dependencies);
 }
 
 sycl::event sbmv(sycl::queue& queue, oneapi::math::uplo upper_lower, std::int64_t n, std::int64_t k,
@@ -24,6 +24,7 @@
 #endif
 
 #include "generic_common.hpp"
+#include "generic_level2_kernels.hpp"
 #include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/blas/detail/generic/onemath_blas_generic.hpp"
 
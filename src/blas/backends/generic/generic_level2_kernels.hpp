@@ -0,0 +1,362 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GENERIC_BLAS_LEVEL2_KERNELS_HPP_
+#define _GENERIC_BLAS_LEVEL2_KERNELS_HPP_
+
+#include <utility>
+
+#include "oneapi/math/types.hpp"
+#include "generic_kernels.hpp"
+
+// Matrix-vector products and rank updates of the generic backend. The matrices are accessed
+// through a storage describing where element (i, j) lives, so that the same kernels serve the
+// general, triangular, band and packed storages of both layouts.
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace generic {
+namespace detail {
+
+struct general_storage {
+    std::int64_t ld;
+    bool column_major;
+
+    std::int64_t offset(std::int64_t i, std::int64_t j) const {
+        return column_major ? i + j * ld : i * ld + j;
+    }
+    bool stored(std::int64_t, std::int64_t) const {
+        return true;
+    }
+};
+
+// Upper or lower triangle of a full matrix
+struct triangular_storage {
+    std::int64_t ld;
+    bool column_major;
+    bool upper;
+
+    std::int64_t offset(std::int64_t i, std::int64_t j) const {
+        return column_major ? i + j * ld : i * ld + j;
+    }
+    bool stored(std::int64_t i, std::int64_t j) const {
+        return upper ? i <= j : i >= j;
+    }
+};
+
+// kl sub-diagonals and ku super-diagonals. A row-major band matrix is stored as the column-major
+// band storage of its transpose.
+struct band_storage {
+    std::int64_t ld;
+    std::int64_t kl;
+    std::int64_t ku;
+    bool column_major;
+
+    std::int64_t offset(std::int64_t i, std::int64_t j) const {
+        return column_major ? ku + i - j + j * ld : kl + j - i + i * ld;
+    }
+    bool stored(std::int64_t i, std::int64_t j) const {
+        return i - j <= kl && j - i <= ku;
+    }
+};
+
+// Upper or lower triangle of an n x n matrix packed by columns, or by rows in row-major layout
+struct packed_storage {
+    std::int64_t n;
+    bool column_major;
+    bool upper;
+
+    std::int64_t offset(std::int64_t i, std::int64_t j) const {
+        if (!column_major)
+            std::swap(i, j);
+        // The row-major upper triangle is packed as the column-major lower one, and conversely
+        return upper == column_major ? i + j * (j + 1) / 2 : i + (2 * n - j - 1) * j / 2;
+    }
+    bool stored(std::int64_t i, std::int64_t j) const {
+        return upper ? i <= j : i >= j;
+    }
+};
+
+// Side of the m x n matrix product computed from its tiles
+enum class mv_part {
+    // y = A * x
+    rows,
+    // y = A^T * x
+    cols,
+    // y = A^H * x
+    cols_conj,
+    // y = A * x with A Hermitian and only one triangle stored: every stored element contributes
+    // to the product of its row, and the off-diagonal ones to the conjugate product of their
+    // column as well
+    hermitian
+};
+
+constexpr std::int64_t mv_tile_size = 32;
+
+// y = alpha * op(A) * x + beta * y for the m x n matrix A, with op given by Part.
+//
+// Each work-group loads one mv_tile_size x mv_tile_size tile of A into local memory, reading it
+// along the storage order, and multiplies it by the matching parts of x. A Hermitian tile is
+// used for both halves of the product, so the stored triangle is read once. Only the tiles
+// within kl sub-diagonals and ku super-diagonals of A are visited: tile (I, J) is visited by the
+// work-group (I, d) for J = I - ceil(kl / tile) + d, or for J = d when the band covers the whole
+// matrix. Every work-group writes its partial products to slot d of the rows of its tile, and to
+// slot d, or I for a whole matrix, of its columns, in a temporary allocation a second kernel sums
+// into y.
+template <mv_part Part, typename T, typename Storage, typename A, typename X, typename Y>
+sycl::event tiled_mv(sycl::queue& queue, std::int64_t m, std::int64_t n, std::int64_t kl,
+                     std::int64_t ku, T alpha, Storage storage, A a, X x, T beta, Y y,
+                     const std::vector<sycl::event>& dependencies) {
+    constexpr std::int64_t tile = mv_tile_size;
+    constexpr bool rows = Part == mv_part::rows || Part == mv_part::hermitian;
+    constexpr bool cols = Part != mv_part::rows;
+    constexpr bool conj_cols = Part == mv_part::cols_conj || Part == mv_part::hermitian;
+
+    const std::int64_t y_size = Part == mv_part::cols || Part == mv_part::cols_conj ? n : m;
+    if (m <= 0 || n <= 0 || (alpha == T(0) && beta == T(1)))
+        return no_op(queue, dependencies);
+
+    const std::int64_t row_tiles = (m + tile - 1) / tile;
+    const std::int64_t col_tiles = (n + tile - 1) / tile;
+    const std::int64_t lower_tiles = (std::min(kl, m - 1) + tile - 1) / tile;
+    const std::int64_t upper_tiles = (std::min(ku, n - 1) + tile - 1) / tile;
+    // Tiles of a whole matrix are indexed directly rather than by diagonal, which would leave
+    // half of the work-groups with no tile
+    const bool whole = lower_tiles >= row_tiles - 1 && upper_tiles >= col_tiles - 1;
+    const std::int64_t diagonals = whole ? col_tiles : lower_tiles + upper_tiles + 1;
+    const std::int64_t row_slots = diagonals;
+    const std::int64_t col_slots = whole ? row_tiles : diagonals;
+
+    T* partials = nullptr;
+    std::vector<sycl::event> products = dependencies;
+    if (alpha != T(0)) {
+        partials = scratch_alloc<T>(queue, (rows ? row_slots * m : 0) + (cols ? col_slots * n : 0),
+                                    Part == mv_part::hermitian ? "hemv" : "gemv");
+        T* row_partials = partials;
+        T* col_partials = partials + (rows ? row_slots * m : 0);
+        products = { queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto ai = a.bind(cgh);
+            auto xi = x.bind(cgh);
+            sycl::local_accessor<T, 2> a_tile(sycl::range<2>(tile, tile + 1), cgh);
+            sycl::local_accessor<T, 1> x_cols(sycl::range<1>(tile), cgh);
+            sycl::local_accessor<T, 1> x_rows(sycl::range<1>(tile), cgh);
+            cgh.parallel_for(
+                sycl::nd_range<2>(sycl::range<2>(row_tiles * tile, diagonals),
+                                  sycl::range<2>(tile, 1)),
+                [=](sycl::nd_item<2> item) {
+                    const std::int64_t I = item.get_group(0);
+                    const std::int64_t d = item.get_group(1);
+                    const std::int64_t J = whole ? d : I - lower_tiles + d;
+                    if (J < 0 || J >= col_tiles)
+                        return;
+                    const std::int64_t l = item.get_local_id(0);
+                    const std::int64_t i0 = I * tile, j0 = J * tile;
+
+                    // Consecutive work-items read consecutive elements
+                    for (std::int64_t k = 0; k < tile; ++k) {
+                        const std::int64_t r = storage.column_major ? l : k;
+                        const std::int64_t c = storage.column_major ? k : l;
+                        const std::int64_t i = i0 + r, j = j0 + c;
+                        T value = T(0);
+                        if (i < m && j < n && storage.stored(i, j)) {
+                            value = ai(storage.offset(i, j));
+                            if constexpr (Part == mv_part::hermitian) {
+                                if (i == j)
+                                    value = T(std::real(value));
+                            }
+                        }
+                        a_tile[r][c] = value;
+                    }
+                    if constexpr (rows)
+                        x_cols[l] = j0 + l < n ? T(xi(j0 + l)) : T(0);
+                    if constexpr (cols)
+                        x_rows[l] = i0 + l < m ? T(xi(i0 + l)) : T(0);
+                    sycl::group_barrier(item.get_group());
+
+                    if constexpr (rows) {
+                        T sum = T(0);
+                        for (std::int64_t c = 0; c < tile; ++c) {
+                            sum += mul(a_tile[l][c], x_cols[c]);
+                        }
+                        if (i0 + l < m)
+                            row_partials[d * m + i0 + l] = sum;
+                    }
+                    if constexpr (cols) {
+                        T sum = T(0);
+                        for (std::int64_t r = 0; r < tile; ++r) {
+                            // The diagonal of a Hermitian matrix is in the product of the rows
+                            if (Part == mv_part::hermitian && I == J && r == l)
+                                continue;
+                            T value = a_tile[r][l];
+                            if constexpr (conj_cols)
+                                value = conjugate(value);
+                            sum += mul(value, x_rows[r]);
+                        }
+                        if (j0 + l < n)
+                            col_partials[(whole ? I : d) * n + j0 + l] = sum;
+                    }
+                });
+        }) };
+    }
+
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(products);
+        auto yi = y.bind(cgh);
+        const T* row_partials = partials;
+        const T* col_partials = partials ? partials + (rows ? row_slots * m : 0) : nullptr;
+        cgh.parallel_for(sycl::range<1>(y_size), [=](sycl::id<1> id) {
+            const std::int64_t k = id[0];
+            T sum = T(0);
+            if (row_partials && rows) {
+                const std::int64_t I = k / tile;
+                for (std::int64_t d = 0; d < row_slots; ++d) {
+                    const std::int64_t J = whole ? d : I - lower_tiles + d;
+                    if (J >= 0 && J < col_tiles)
+                        sum += row_partials[d * m + k];
+                }
+            }
+            if (col_partials && cols) {
+                const std::int64_t J = k / tile;
+                for (std::int64_t d = 0; d < col_slots; ++d) {
+                    const std::int64_t I = whole ? d : J + lower_tiles - d;
+                    if (I >= 0 && I < row_tiles)
+                        sum += col_partials[d * n + k];
+                }
+            }
+            // y is not read when beta is zero
+            yi(k) = beta == T(0) ? mul(alpha, sum) : mul(alpha, sum) + mul(beta, T(yi(k)));
+        });
+    });
+    if (partials)
+        free_after(queue, done, partials);
+    return done;
+}
+
+// y = alpha * op(A) * x + beta * y for the m x n general or band matrix A
+template <typename T, typename Storage, typename A, typename X, typename Y>
+sycl::event gemv(sycl::queue& queue, oneapi::math::transpose trans, std::int64_t m,
+                 std::int64_t n, std::int64_t kl, std::int64_t ku, T alpha, Storage storage, A a,
+                 X x, T beta, Y y, const std::vector<sycl::event>& dependencies) {
+    switch (trans) {
+        case oneapi::math::transpose::nontrans:
+            return tiled_mv<mv_part::rows>(queue, m, n, kl, ku, alpha, storage, a, x, beta, y,
+                                           dependencies);
+        case oneapi::math::transpose::trans:
+            return tiled_mv<mv_part::cols>(queue, m, n, kl, ku, alpha, storage, a, x, beta, y,
+                                           dependencies);
+        default:
+            return tiled_mv<mv_part::cols_conj>(queue, m, n, kl, ku, alpha, storage, a, x, beta,
+                                                y, dependencies);
+    }
+}
+
+// y = alpha * A * x + beta * y for the n x n Hermitian matrix A
+template <typename T, typename Storage, typename A, typename X, typename Y>
+sycl::event hemv(sycl::queue& queue, std::int64_t n, std::int64_t kl, std::int64_t ku, T alpha,
+                 Storage storage, A a, X x, T beta, Y y,
+                 const std::vector<sycl::event>& dependencies) {
+    return tiled_mv<mv_part::hermitian>(queue, n, n, kl, ku, alpha, storage, a, x, beta, y,
+                                        dependencies);
+}
+
+// Runs f(i, j, a_ij, vectors...) for the stored elements (i, j) of the m x n matrix A, the
+// work-items following the storage order. The vectors are passed as the functions returned by
+// their bind(cgh).
+template <typename Storage, typename A, typename F, typename... Vectors>
+sycl::event for_each_stored(sycl::queue& queue, std::int64_t m, std::int64_t n, Storage storage,
+                            A a, const std::vector<sycl::event>& dependencies, F f,
+                            Vectors... vectors) {
+    if (m <= 0 || n <= 0)
+        return no_op(queue, dependencies);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto kernel = [=](auto ai, auto... elements) {
+            return [=](sycl::id<2> id) {
+                const std::int64_t i = storage.column_major ? id[1] : id[0];
+                const std::int64_t j = storage.column_major ? id[0] : id[1];
+                if (storage.stored(i, j))
+                    f(i, j, ai(storage.offset(i, j)), elements...);
+            };
+        };
+        auto range = storage.column_major ? sycl::range<2>(n, m) : sycl::range<2>(m, n);
+        cgh.parallel_for(range, kernel(a.bind(cgh), vectors.bind(cgh)...));
+    });
+}
+
+// A = alpha * x * y^H + A when conj_y is set, alpha * x * y^T + A otherwise
+template <bool conj_y, typename T, typename Storage, typename X, typename Y, typename A>
+sycl::event ger(sycl::queue& queue, std::int64_t m, std::int64_t n, T alpha, X x, Y y,
+                Storage storage, A a, const std::vector<sycl::event>& dependencies) {
+    if (alpha == T(0))
+        return no_op(queue, dependencies);
+    return for_each_stored(
+        queue, m, n, storage, a, dependencies,
+        [=](std::int64_t i, std::int64_t j, auto& aij, auto xi, auto yi) {
+            T yj = yi(j);
+            if constexpr (conj_y)
+                yj = conjugate(yj);
+            aij += mul(alpha, mul(T(xi(i)), yj));
+        },
+        x, y);
+}
+
+// A = alpha * x * x^H + A for the stored triangle of the Hermitian matrix A, whose diagonal is
+// left real
+template <typename R, typename Storage, typename X, typename A>
+sycl::event her(sycl::queue& queue, std::int64_t n, R alpha, X x, Storage storage, A a,
+                const std::vector<sycl::event>& dependencies) {
+    using T = std::complex<R>;
+    if (alpha == R(0))
+        return no_op(queue, dependencies);
+    return for_each_stored(
+        queue, n, n, storage, a, dependencies,
+        [=](std::int64_t i, std::int64_t j, auto& aij, auto xi) {
+            const T update = mul(alpha, mul(T(xi(i)), conjugate(T(xi(j)))));
+            aij = i == j ? T(aij.real() + update.real(), R(0)) : aij + update;
+        },
+        x);
+}
+
+// A = alpha * x * y^H + conj(alpha) * y * x^H + A for the stored triangle of the Hermitian
+// matrix A, whose diagonal is left real
+template <typename R, typename Storage, typename X, typename Y, typename A>
+sycl::event her2(sycl::queue& queue, std::int64_t n, std::complex<R> alpha, X x, Y y,
+                 Storage storage, A a, const std::vector<sycl::event>& dependencies) {
+    using T = std::complex<R>;
+    if (alpha == T(0))
+        return no_op(queue, dependencies);
+    return for_each_stored(
+        queue, n, n, storage, a, dependencies,
+        [=](std::int64_t i, std::int64_t j, auto& aij, auto xi, auto yi) {
+            const T update = mul(alpha, mul(T(xi(i)), conjugate(T(yi(j))))) +
+                             mul(conjugate(alpha), mul(T(yi(i)), conjugate(T(xi(j)))));
+            aij = i == j ? T(aij.real() + update.real(), R(0)) : aij + update;
+        },
+        x, y);
+}
+
+} // namespace detail
+} // namespace generic
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif // _GENERIC_BLAS_LEVEL2_KERNELS_HPP_
@@ -33,10 +33,16 @@ void gemm(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::tran
           sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
     using sycl_complex_real_t = sycl::ext::oneapi::experimental::complex<real_t>;
+    // onemath_sycl_blas has no conjugate transpose
     if (transa == oneapi::math::transpose::conjtrans ||
         transb == oneapi::math::transpose::conjtrans) {
-        throw unimplemented("blas", "gemm",
-                            "Conjugate Transpose unsupported yet on onemath_sycl_blas");
+        detail::check_device_support<real_t>(queue, "gemm");
+        const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+        const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+        const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+        detail::gemm(queue, transa, transb, m, n, k, alpha, a_matrix, b_matrix, beta, c_matrix,
+                     {});
+        return;
     }
     // Intermediate buffers for conversion purposes as onemath_sycl_blas expects sycl::complex instead of std::complex
     sycl::buffer<sycl_complex_real_t, 1> a_pb{ sycl::range<1>(a.size()) };
@@ -77,7 +83,12 @@ void symm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "symm", "");
+    detail::check_device_support<real_t>(queue, "symm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::symm(queue, left_right, upper_lower, false, m, n, alpha, a_matrix, b_matrix, beta,
+                 c_matrix, {});
 }
 
 void hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -85,34 +96,54 @@ void hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "hemm", "");
+    detail::check_device_support<real_t>(queue, "hemm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::symm(queue, left_right, upper_lower, true, m, n, alpha, a_matrix, b_matrix, beta,
+                 c_matrix, {});
 }
 
 void syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
           std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<real_t, 1>& a,
           std::int64_t lda, real_t beta, sycl::buffer<real_t, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "syrk", "");
+    detail::check_device_support<real_t>(queue, "syrk");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::syrk(queue, upper_lower, trans, false, n, k, alpha, a_matrix, beta, c_matrix, {});
 }
 
 void syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
           std::int64_t n, std::int64_t k, std::complex<real_t> alpha,
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "syrk", "");
+    detail::check_device_support<real_t>(queue, "syrk");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::syrk(queue, upper_lower, trans, false, n, k, alpha, a_matrix, beta, c_matrix, {});
 }
 
 void herk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
           std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<std::complex<real_t>, 1>& a,
           std::int64_t lda, real_t beta, sycl::buffer<std::complex<real_t>, 1>& c,
           std::int64_t ldc) {
-    throw unimplemented("blas", "herk", "");
+    detail::check_device_support<real_t>(queue, "herk");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::syrk(queue, upper_lower, trans, true, n, k, std::complex<real_t>(alpha), a_matrix,
+                 std::complex<real_t>(beta), c_matrix, {});
 }
 
 void syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
            std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<real_t, 1>& a,
            std::int64_t lda, sycl::buffer<real_t, 1>& b, std::int64_t ldb, real_t beta,
            sycl::buffer<real_t, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "syr2k", "");
+    detail::check_device_support<real_t>(queue, "syr2k");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::syr2k(queue, upper_lower, trans, false, n, k, alpha, a_matrix, b_matrix, beta, c_matrix,
+                  {});
 }
 
 void syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -120,7 +151,12 @@ void syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::tra
            sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
            sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "syr2k", "");
+    detail::check_device_support<real_t>(queue, "syr2k");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::syr2k(queue, upper_lower, trans, false, n, k, alpha, a_matrix, b_matrix, beta, c_matrix,
+                  {});
 }
 
 void her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -128,21 +164,34 @@ void her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::tra
            sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, real_t beta,
            sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "her2k", "");
+    detail::check_device_support<real_t>(queue, "her2k");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    detail::syr2k(queue, upper_lower, trans, true, n, k, alpha, a_matrix, b_matrix,
+                  std::complex<real_t>(beta), c_matrix, {});
 }
 
 void trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
           oneapi::math::transpose trans, oneapi::math::diag unit_diag, std::int64_t m,
           std::int64_t n, real_t alpha, sycl::buffer<real_t, 1>& a, std::int64_t lda,
           sycl::buffer<real_t, 1>& b, std::int64_t ldb) {
-    throw unimplemented("blas", "trmm", "");
+    detail::check_device_support<real_t>(queue, "trmm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::inout(b), ldb, is_column_major());
+    detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a_matrix, b_matrix,
+                 {});
 }
 
 void trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
           oneapi::math::transpose trans, oneapi::math::diag unit_diag, std::int64_t m,
           std::int64_t n, std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb) {
-    throw unimplemented("blas", "trmm", "");
+    detail::check_device_support<real_t>(queue, "trmm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::inout(b), ldb, is_column_major());
+    detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a_matrix, b_matrix,
+                 {});
 }
 
 void trsm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -157,7 +206,11 @@ void trsm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo
           oneapi::math::transpose trans, oneapi::math::diag unit_diag, std::int64_t m,
           std::int64_t n, std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb) {
-    throw unimplemented("blas", "trsm", " for complex");
+    detail::check_device_support<real_t>(queue, "trsm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::inout(b), ldb, is_column_major());
+    detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a_matrix, b_matrix,
+                 {});
 }
 
 void gemmt(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose transa,
@@ -242,10 +295,15 @@ sycl::event gemm(sycl::queue& queue, oneapi::math::transpose transa, oneapi::mat
                  const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                  std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
+    // onemath_sycl_blas has no conjugate transpose
     if (transa == oneapi::math::transpose::conjtrans ||
         transb == oneapi::math::transpose::conjtrans) {
-        throw unimplemented("blas", "gemm",
-                            "Conjugate Transpose unsupported yet on onemath_sycl_blas");
+        detail::check_device_support<real_t>(queue, "gemm");
+        const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+        const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+        const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+        return detail::gemm(queue, transa, transb, m, n, k, alpha, a_matrix, b_matrix, beta,
+                            c_matrix, dependencies);
     }
     CALL_GENERIC_BLAS_USM_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
                              beta, c, ldc, dependencies);
@@ -264,7 +322,12 @@ sycl::event symm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math
                  const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                  std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "symm", " for USM");
+    detail::check_device_support<real_t>(queue, "symm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::symm(queue, left_right, upper_lower, false, m, n, alpha, a_matrix, b_matrix,
+                        beta, c_matrix, dependencies);
 }
 
 sycl::event hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -272,14 +335,23 @@ sycl::event hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math
                  const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                  std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "hemm", " for USM");
+    detail::check_device_support<real_t>(queue, "hemm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::symm(queue, left_right, upper_lower, true, m, n, alpha, a_matrix, b_matrix, beta,
+                        c_matrix, dependencies);
 }
 
 sycl::event syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
                  std::int64_t n, std::int64_t k, real_t alpha, const real_t* a, std::int64_t lda,
                  real_t beta, real_t* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "syrk", " for USM");
+    detail::check_device_support<real_t>(queue, "syrk");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::syrk(queue, upper_lower, trans, false, n, k, alpha, a_matrix, beta, c_matrix,
+                        dependencies);
 }
 
 sycl::event syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -287,21 +359,34 @@ sycl::event syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::mat
                  const std::complex<real_t>* a, std::int64_t lda, std::complex<real_t> beta,
                  std::complex<real_t>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "syrk", " for USM");
+    detail::check_device_support<real_t>(queue, "syrk");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::syrk(queue, upper_lower, trans, false, n, k, alpha, a_matrix, beta, c_matrix,
+                        dependencies);
 }
 
 sycl::event herk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
                  std::int64_t n, std::int64_t k, real_t alpha, const std::complex<real_t>* a,
                  std::int64_t lda, real_t beta, std::complex<real_t>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "herk", " for USM");
+    detail::check_device_support<real_t>(queue, "herk");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::syrk(queue, upper_lower, trans, true, n, k, std::complex<real_t>(alpha),
+                        a_matrix, std::complex<real_t>(beta), c_matrix, dependencies);
 }
 
 sycl::event syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
                   std::int64_t n, std::int64_t k, real_t alpha, const real_t* a, std::int64_t lda,
                   const real_t* b, std::int64_t ldb, real_t beta, real_t* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "syr2k", " for USM");
+    detail::check_device_support<real_t>(queue, "syr2k");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::syr2k(queue, upper_lower, trans, false, n, k, alpha, a_matrix, b_matrix, beta,
+                         c_matrix, dependencies);
 }
 
 sycl::event syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -309,7 +394,12 @@ sycl::event syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::ma
                   const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                   std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "syr2k", " for USM");
+    detail::check_device_support<real_t>(queue, "syr2k");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::syr2k(queue, upper_lower, trans, false, n, k, alpha, a_matrix, b_matrix, beta,
+                         c_matrix, dependencies);
 }
 
 sycl::event her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -317,14 +407,23 @@ sycl::event her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::ma
                   const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                   std::int64_t ldb, real_t beta, std::complex<real_t>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "her2k", " for USM");
+    detail::check_device_support<real_t>(queue, "her2k");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::in(b), ldb, is_column_major());
+    const auto c_matrix = detail::make_matrix(detail::inout(c), ldc, is_column_major());
+    return detail::syr2k(queue, upper_lower, trans, true, n, k, alpha, a_matrix, b_matrix,
+                         std::complex<real_t>(beta), c_matrix, dependencies);
 }
 
 sycl::event trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
                  oneapi::math::transpose trans, oneapi::math::diag unit_diag, std::int64_t m,
                  std::int64_t n, real_t alpha, const real_t* a, std::int64_t lda, real_t* b,
                  std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "trmm", " for USM");
+    detail::check_device_support<real_t>(queue, "trmm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::inout(b), ldb, is_column_major());
+    return detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a_matrix,
+                        b_matrix, dependencies);
 }
 
 sycl::event trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -332,7 +431,11 @@ sycl::event trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math
                  std::int64_t n, std::complex<real_t> alpha, const std::complex<real_t>* a,
                  std::int64_t lda, std::complex<real_t>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "trmm", " for USM");
+    detail::check_device_support<real_t>(queue, "trmm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::inout(b), ldb, is_column_major());
+    return detail::trmm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a_matrix,
+                        b_matrix, dependencies);
 }
 
 sycl::event trsm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -348,7 +451,11 @@ sycl::event trsm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math
                  std::int64_t n, std::complex<real_t> alpha, const std::complex<real_t>* a,
                  std::int64_t lda, std::complex<real_t>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "trsm", " for USM");
+    detail::check_device_support<real_t>(queue, "trsm");
+    const auto a_matrix = detail::make_matrix(detail::in(a), lda, is_column_major());
+    const auto b_matrix = detail::make_matrix(detail::inout(b), ldb, is_column_major());
+    return detail::trsm(queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a_matrix,
+                        b_matrix, dependencies);
 }
 
 sycl::event gemmt(sycl::queue& queue, oneapi::math::uplo upper_lower,
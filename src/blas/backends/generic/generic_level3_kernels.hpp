@@ -0,0 +1,614 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GENERIC_BLAS_LEVEL3_KERNELS_HPP_
+#define _GENERIC_BLAS_LEVEL3_KERNELS_HPP_
+
+#include <utility>
+
+#include "oneapi/math/types.hpp"
+#include "generic_kernels.hpp"
+
+// Tiled matrix product of the generic backend and the level-3 routines built on it. The product
+// reads its operands through descriptors giving element (r, c) of op(X), so that symmetric,
+// Hermitian and triangular operands are used in place, without expanding them into full
+// matrices.
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace generic {
+namespace detail {
+
+// Matrix whose elements are those of the vector view data, starting at offset with leading
+// dimension ld
+template <typename V>
+struct matrix {
+    V data;
+    std::int64_t ld;
+    bool column_major;
+    std::int64_t offset = 0;
+
+    std::int64_t position(std::int64_t i, std::int64_t j) const {
+        return column_major ? i + j * ld : i * ld + j;
+    }
+
+    // Sub-matrix starting at element (i, j)
+    matrix sub(std::int64_t i, std::int64_t j) const {
+        return { data, ld, column_major, offset + position(i, j) };
+    }
+
+    auto bind(sycl::handler& cgh) const {
+        auto d = data.bind(cgh);
+        return [d, ld = ld, column_major = column_major, offset = offset](
+                   std::int64_t i, std::int64_t j) -> decltype(auto) {
+            return d(offset + (column_major ? i + j * ld : i * ld + j));
+        };
+    }
+};
+
+template <typename V>
+inline matrix<V> make_matrix(V data, std::int64_t ld, bool column_major) {
+    return { data, ld, column_major, 0 };
+}
+
+// Shape of op(X) for an operand X of gemm, bounding the range of k where it is not zero
+enum class operand_shape { general, upper, lower };
+
+// Columns of op(A) that are not zero in the rows [r0, r0 + rows)
+inline std::pair<std::int64_t, std::int64_t> k_range_as_a(operand_shape shape, std::int64_t r0,
+                                                          std::int64_t rows, std::int64_t k) {
+    switch (shape) {
+        case operand_shape::upper: return { std::min(r0, k), k };
+        case operand_shape::lower: return { 0, std::min(r0 + rows, k) };
+        default: return { 0, k };
+    }
+}
+
+// Rows of op(B) that are not zero in the columns [c0, c0 + cols)
+inline std::pair<std::int64_t, std::int64_t> k_range_as_b(operand_shape shape, std::int64_t c0,
+                                                          std::int64_t cols, std::int64_t k) {
+    switch (shape) {
+        case operand_shape::upper: return { 0, std::min(c0 + cols, k) };
+        case operand_shape::lower: return { std::min(c0, k), k };
+        default: return { 0, k };
+    }
+}
+
+// op(X) for a general matrix X
+template <typename T, typename V>
+struct general_operand {
+    matrix<V> x;
+    oneapi::math::transpose op;
+
+    auto bind(sycl::handler& cgh) const {
+        return [xe = x.bind(cgh), op = op](std::int64_t r, std::int64_t c) -> T {
+            if (op == oneapi::math::transpose::nontrans)
+                return xe(r, c);
+            T value = xe(c, r);
+            return op == oneapi::math::transpose::conjtrans ? conjugate(value) : value;
+        };
+    }
+    // Consecutive rows of op(X) are consecutive in memory
+    bool rows_contiguous() const {
+        return (op == oneapi::math::transpose::nontrans) == x.column_major;
+    }
+    operand_shape shape() const {
+        return operand_shape::general;
+    }
+};
+
+// Symmetric or Hermitian matrix X of which only one triangle is read
+template <typename T, typename V>
+struct symmetric_operand {
+    matrix<V> x;
+    bool upper;
+    bool hermitian;
+
+    auto bind(sycl::handler& cgh) const {
+        return [xe = x.bind(cgh), upper = upper, hermitian = hermitian](std::int64_t r,
+                                                                        std::int64_t c) -> T {
+            if (upper ? r <= c : r >= c) {
+                T value = xe(r, c);
+                return hermitian && r == c ? T(std::real(value)) : value;
+            }
+            T value = xe(c, r);
+            return hermitian ? conjugate(value) : value;
+        };
+    }
+    bool rows_contiguous() const {
+        return x.column_major;
+    }
+    operand_shape shape() const {
+        return operand_shape::general;
+    }
+};
+
+// op(X) for a triangular matrix X, whose other triangle is neither read nor multiplied
+template <typename T, typename V>
+struct triangular_operand {
+    matrix<V> x;
+    oneapi::math::transpose op;
+    bool upper;
+    bool unit;
+
+    auto bind(sycl::handler& cgh) const {
+        return [xe = x.bind(cgh), op = op, upper = upper, unit = unit](std::int64_t r,
+                                                                       std::int64_t c) -> T {
+            const bool nontrans = op == oneapi::math::transpose::nontrans;
+            const std::int64_t i = nontrans ? r : c, j = nontrans ? c : r;
+            if (!(upper ? i <= j : i >= j))
+                return T(0);
+            if (unit && i == j)
+                return T(1);
+            T value = xe(i, j);
+            return op == oneapi::math::transpose::conjtrans ? conjugate(value) : value;
+        };
+    }
+    bool rows_contiguous() const {
+        return (op == oneapi::math::transpose::nontrans) == x.column_major;
+    }
+    operand_shape shape() const {
+        return upper == (op == oneapi::math::transpose::nontrans) ? operand_shape::upper
+                                                                  : operand_shape::lower;
+    }
+};
+
+// Part of C written by gemm
+enum class matrix_part { full, upper, lower };
+
+constexpr std::int64_t gemm_tile = 32;
+constexpr std::int64_t gemm_tile_k = 16;
+// Work-items per dimension of a work-group, each computing gemm_tile / gemm_items elements per
+// dimension. Devices with smaller work-groups fall back to gemm_items / 2, then gemm_items / 4.
+constexpr std::int64_t gemm_items = 16;
+
+// Tiled product of gemm below, with work-groups of items x items work-items
+template <std::int64_t items, typename T, typename OpA, typename OpB, typename V>
+sycl::event gemm_tiles(sycl::queue& queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                       T alpha, OpA a, OpB b, T beta, matrix<V> c,
+                       const std::vector<sycl::event>& dependencies, matrix_part part,
+                       bool real_diagonal) {
+    constexpr std::int64_t tile = gemm_tile, tile_k = gemm_tile_k;
+    constexpr std::int64_t per_item = tile / items;
+    const std::int64_t row_tiles = (m + tile - 1) / tile;
+    const std::int64_t col_tiles = (n + tile - 1) / tile;
+    const bool a_rows_contiguous = a.rows_contiguous();
+    const bool b_rows_contiguous = b.rows_contiguous();
+    const operand_shape a_shape = a.shape(), b_shape = b.shape();
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto ae = a.bind(cgh);
+        auto be = b.bind(cgh);
+        auto ce = c.bind(cgh);
+        sycl::local_accessor<T, 2> a_tile(sycl::range<2>(tile, tile_k + 1), cgh);
+        sycl::local_accessor<T, 2> b_tile(sycl::range<2>(tile_k, tile + 1), cgh);
+        cgh.parallel_for(
+            sycl::nd_range<2>(sycl::range<2>(col_tiles * items, row_tiles * items),
+                              sycl::range<2>(items, items)),
+            [=](sycl::nd_item<2> item) {
+                const std::int64_t i0 = item.get_group(1) * tile;
+                const std::int64_t j0 = item.get_group(0) * tile;
+                if ((part == matrix_part::upper && i0 > j0 + tile - 1) ||
+                    (part == matrix_part::lower && j0 > i0 + tile - 1))
+                    return;
+                const std::int64_t li = item.get_local_id(1), lj = item.get_local_id(0);
+                const std::int64_t id = item.get_local_linear_id();
+
+                auto a_range = k_range_as_a(a_shape, i0, tile, k);
+                auto b_range = k_range_as_b(b_shape, j0, tile, k);
+                const std::int64_t k_begin = std::max(a_range.first, b_range.first);
+                const std::int64_t k_end = alpha == T(0) ? k_begin
+                                                         : std::min(a_range.second, b_range.second);
+
+                T sum[per_item][per_item];
+                for (std::int64_t p = 0; p < per_item; ++p) {
+                    for (std::int64_t q = 0; q < per_item; ++q) {
+                        sum[p][q] = T(0);
+                    }
+                }
+                for (std::int64_t k0 = k_begin; k0 < k_end; k0 += tile_k) {
+                    // Consecutive work-items load consecutive elements
+                    for (std::int64_t e = id; e < tile * tile_k; e += items * items) {
+                        const std::int64_t r = a_rows_contiguous ? e % tile : e / tile_k;
+                        const std::int64_t l = a_rows_contiguous ? e / tile : e % tile_k;
+                        a_tile[r][l] =
+                            i0 + r < m && k0 + l < k_end ? ae(i0 + r, k0 + l) : T(0);
+                    }
+                    for (std::int64_t e = id; e < tile * tile_k; e += items * items) {
+                        const std::int64_t l = b_rows_contiguous ? e % tile_k : e / tile;
+                        const std::int64_t s = b_rows_contiguous ? e / tile_k : e % tile;
+                        b_tile[l][s] =
+                            k0 + l < k_end && j0 + s < n ? be(k0 + l, j0 + s) : T(0);
+                    }
+                    sycl::group_barrier(item.get_group());
+                    for (std::int64_t l = 0; l < tile_k; ++l) {
+                        for (std::int64_t p = 0; p < per_item; ++p) {
+                            const T a_value = a_tile[li + p * items][l];
+                            for (std::int64_t q = 0; q < per_item; ++q) {
+                                sum[p][q] += mul(a_value, b_tile[l][lj + q * items]);
+                            }
+                        }
+                    }
+                    sycl::group_barrier(item.get_group());
+                }
+
+                for (std::int64_t p = 0; p < per_item; ++p) {
+                    for (std::int64_t q = 0; q < per_item; ++q) {
+                        const std::int64_t i = i0 + li + p * items, j = j0 + lj + q * items;
+                        if (i >= m || j >= n || (part == matrix_part::upper && i > j) ||
+                            (part == matrix_part::lower && i < j))
+                            continue;
+                        auto&& cij = ce(i, j);
+                        // C is not read when beta is zero
+                        T value = beta == T(0) ? mul(alpha, sum[p][q])
+                                               : mul(alpha, sum[p][q]) + mul(beta, T(cij));
+                        if (real_diagonal && i == j)
+                            value = T(std::real(value));
+                        cij = value;
+                    }
+                }
+            });
+    });
+}
+
+// C = alpha * op(A) * op(B) + beta * C for the m x n matrix C, with op(A) m x k and op(B) k x n.
+//
+// Each work-group computes a gemm_tile x gemm_tile tile of C, staging tiles of op(A) and op(B)
+// in local memory. With part set to upper or lower only that triangle of C is computed: the
+// tiles outside of it are skipped, which halves the work of the rank-k updates. The product
+// only runs over the range of k where triangular operands are not zero. real_diagonal drops the
+// imaginary part of the diagonal of C, as the Hermitian updates do.
+template <typename T, typename OpA, typename OpB, typename V>
+sycl::event gemm(sycl::queue& queue, std::int64_t m, std::int64_t n, std::int64_t k, T alpha,
+                 OpA a, OpB b, T beta, matrix<V> c, const std::vector<sycl::event>& dependencies,
+                 matrix_part part = matrix_part::full, bool real_diagonal = false) {
+    if (m <= 0 || n <= 0 || (alpha == T(0) && beta == T(1) && !real_diagonal))
+        return no_op(queue, dependencies);
+    const auto max_group = static_cast<std::int64_t>(
+        queue.get_device().get_info<sycl::info::device::max_work_group_size>());
+    if (max_group >= gemm_items * gemm_items)
+        return gemm_tiles<gemm_items>(queue, m, n, k, alpha, a, b, beta, c, dependencies, part,
+                                      real_diagonal);
+    if (max_group >= gemm_items * gemm_items / 4)
+        return gemm_tiles<gemm_items / 2>(queue, m, n, k, alpha, a, b, beta, c, dependencies,
+                                          part, real_diagonal);
+    return gemm_tiles<gemm_items / 4>(queue, m, n, k, alpha, a, b, beta, c, dependencies, part,
+                                      real_diagonal);
+}
+
+// X = alpha * X for the m x n matrix X, zeroed when alpha is zero
+template <typename T, typename V>
+sycl::event scale(sycl::queue& queue, std::int64_t m, std::int64_t n, T alpha, matrix<V> x,
+                  const std::vector<sycl::event>& dependencies) {
+    if (m <= 0 || n <= 0 || alpha == T(1))
+        return no_op(queue, dependencies);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto xe = x.bind(cgh);
+        auto range = x.column_major ? sycl::range<2>(n, m) : sycl::range<2>(m, n);
+        const bool column_major = x.column_major;
+        cgh.parallel_for(range, [=](sycl::id<2> id) {
+            const std::int64_t i = column_major ? id[1] : id[0];
+            const std::int64_t j = column_major ? id[0] : id[1];
+            auto&& xij = xe(i, j);
+            xij = alpha == T(0) ? T(0) : mul(alpha, T(xij));
+        });
+    });
+}
+
+// Block size of the triangular solves, the diagonal blocks being solved in local memory
+constexpr std::int64_t trsm_block = 32;
+
+// Solves M * v = b in place for count vectors v of size w <= trsm_block, M being the w x w
+// diagonal block op(A) on the left, or its transpose on the right, where the vectors are the
+// rows of B. M is lower triangular when lower is set.
+template <typename T, typename VA, typename VB>
+sycl::event trsm_diagonal(sycl::queue& queue, bool left, bool lower, bool unit, std::int64_t w,
+                          std::int64_t count, general_operand<T, VA> a, matrix<VB> b,
+                          const std::vector<sycl::event>& dependencies) {
+    constexpr std::int64_t block = trsm_block;
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto ae = a.bind(cgh);
+        auto be = b.bind(cgh);
+        sycl::local_accessor<T, 2> m_tile(sycl::range<2>(block, block + 1), cgh);
+        const std::int64_t groups = (count + block - 1) / block;
+        cgh.parallel_for(
+            sycl::nd_range<1>(sycl::range<1>(groups * block), sycl::range<1>(block)),
+            [=](sycl::nd_item<1> item) {
+                const std::int64_t l = item.get_local_id(0);
+                for (std::int64_t r = 0; r < w; ++r) {
+                    if (l < w)
+                        m_tile[r][l] = left ? ae(r, l) : ae(l, r);
+                }
+                sycl::group_barrier(item.get_group());
+                const std::int64_t v = item.get_global_id(0);
+                if (v >= count)
+                    return;
+                auto element = [&](std::int64_t t) -> decltype(auto) {
+                    return left ? be(t, v) : be(v, t);
+                };
+                T x[block];
+                for (std::int64_t t = 0; t < w; ++t) {
+                    x[t] = element(t);
+                }
+                for (std::int64_t s = 0; s < w; ++s) {
+                    const std::int64_t r = lower ? s : w - 1 - s;
+                    T value = x[r];
+                    for (std::int64_t c = lower ? 0 : r + 1; c < (lower ? r : w); ++c) {
+                        value -= mul(m_tile[r][c], x[c]);
+                    }
+                    x[r] = unit ? value : div(value, m_tile[r][r]);
+                }
+                for (std::int64_t t = 0; t < w; ++t) {
+                    element(t) = x[t];
+                }
+            });
+    });
+}
+
+// Solves op(A) * X = alpha * B on the left, or X * op(A) = alpha * B on the right, for the
+// triangular matrix A, overwriting B with X.
+//
+// The solve is blocked: each step solves one block of trsm_block rows, or columns, of X with the
+// diagonal block of op(A), then removes its contribution from the blocks still to solve with
+// one gemm.
+template <typename T, typename VA, typename VB>
+sycl::event trsm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
+                 oneapi::math::transpose trans, oneapi::math::diag unit_diag, std::int64_t m,
+                 std::int64_t n, T alpha, matrix<VA> a, matrix<VB> b,
+                 const std::vector<sycl::event>& dependencies) {
+    constexpr std::int64_t block = trsm_block;
+    if (m <= 0 || n <= 0)
+        return no_op(queue, dependencies);
+    auto done = scale(queue, m, n, alpha, b, dependencies);
+    if (alpha == T(0))
+        return done;
+
+    const bool left = left_right == oneapi::math::side::left;
+    const bool unit = unit_diag == oneapi::math::diag::unit;
+    const bool op_upper = (upper_lower == oneapi::math::uplo::upper) ==
+                          (trans == oneapi::math::transpose::nontrans);
+    // The system solved for each vector is lower triangular, and solved first to last
+    const bool forward = left != op_upper;
+    const std::int64_t size = left ? m : n;
+    const std::int64_t count = left ? n : m;
+    // Block (r0, c0) of op(A)
+    auto op_a = [&](std::int64_t r0, std::int64_t c0) {
+        const bool nontrans = trans == oneapi::math::transpose::nontrans;
+        return general_operand<T, VA>{ nontrans ? a.sub(r0, c0) : a.sub(c0, r0), trans };
+    };
+    auto rows_of_b = [&](std::int64_t first) { return left ? b.sub(first, 0) : b.sub(0, first); };
+
+    const std::int64_t blocks = (size + block - 1) / block;
+    for (std::int64_t s = 0; s < blocks; ++s) {
+        const std::int64_t p = (forward ? s : blocks - 1 - s) * block;
+        const std::int64_t w = std::min(block, size - p);
+        done = trsm_diagonal(queue, left, forward, unit, w, count, op_a(p, p), rows_of_b(p),
+                             { done });
+
+        // Blocks still to solve
+        const std::int64_t rest_begin = forward ? p + w : 0;
+        const std::int64_t rest = forward ? size - p - w : p;
+        if (rest == 0)
+            continue;
+        const general_operand<T, VB> x_block{ rows_of_b(p), oneapi::math::transpose::nontrans };
+        if (left) {
+            done = gemm(queue, rest, n, w, T(-1), op_a(rest_begin, p), x_block, T(1),
+                        rows_of_b(rest_begin), { done });
+        }
+        else {
+            done = gemm(queue, m, rest, w, T(-1), x_block, op_a(p, rest_begin), T(1),
+                        rows_of_b(rest_begin), { done });
+        }
+    }
+    return done;
+}
+
+// Size of the diagonal blocks of trmm, multiplied in local memory
+constexpr std::int64_t trmm_block = 32;
+
+// Computes v = alpha * M * v in place for count vectors v of size w <= trmm_block, M being the
+// w x w diagonal block op(A) on the left, or its transpose on the right, where the vectors are
+// the rows of B. M is lower triangular when lower is set.
+template <typename T, typename VA, typename VB>
+sycl::event trmm_diagonal(sycl::queue& queue, bool left, bool lower, bool unit, std::int64_t w,
+                          std::int64_t count, T alpha, general_operand<T, VA> a, matrix<VB> b,
+                          const std::vector<sycl::event>& dependencies) {
+    constexpr std::int64_t block = trmm_block;
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto ae = a.bind(cgh);
+        auto be = b.bind(cgh);
+        sycl::local_accessor<T, 2> m_tile(sycl::range<2>(block, block + 1), cgh);
+        const std::int64_t groups = (count + block - 1) / block;
+        cgh.parallel_for(
+            sycl::nd_range<1>(sycl::range<1>(groups * block), sycl::range<1>(block)),
+            [=](sycl::nd_item<1> item) {
+                const std::int64_t l = item.get_local_id(0);
+                for (std::int64_t r = 0; r < w; ++r) {
+                    if (l < w)
+                        m_tile[r][l] = left ? ae(r, l) : ae(l, r);
+                }
+                sycl::group_barrier(item.get_group());
+                const std::int64_t v = item.get_global_id(0);
+                if (v >= count)
+                    return;
+                auto element = [&](std::int64_t t) -> decltype(auto) {
+                    return left ? be(t, v) : be(v, t);
+                };
+                T x[block];
+                for (std::int64_t t = 0; t < w; ++t) {
+                    x[t] = element(t);
+                }
+                // Each element only reads those not overwritten yet
+                for (std::int64_t s = 0; s < w; ++s) {
+                    const std::int64_t r = lower ? w - 1 - s : s;
+                    T value = unit ? x[r] : mul(m_tile[r][r], x[r]);
+                    for (std::int64_t c = lower ? 0 : r + 1; c < (lower ? r : w); ++c) {
+                        value += mul(m_tile[r][c], x[c]);
+                    }
+                    x[r] = value;
+                }
+                for (std::int64_t t = 0; t < w; ++t) {
+                    element(t) = mul(alpha, x[t]);
+                }
+            });
+    });
+}
+
+// Multiplies the vectors [p, p + size) of trmm below by the diagonal block of M at p. Blocks
+// larger than trmm_block are split in two halves, M = [M11 0; M21 M22] when lower:
+// v2 = M22 * v2 + M21 * v1 is computed first, while v1 is still unchanged, with the recursion on
+// M22 and one gemm for M21, then v1 = M11 * v1. The upper case goes the other way round.
+template <typename T, typename VA, typename VB>
+sycl::event trmm_recursive(sycl::queue& queue, bool left, bool lower, bool unit,
+                           oneapi::math::transpose trans, std::int64_t p, std::int64_t size,
+                           std::int64_t count, T alpha, matrix<VA> a, matrix<VB> b,
+                           const std::vector<sycl::event>& dependencies) {
+    constexpr std::int64_t block = trmm_block;
+    // Block (r0, c0) of op(A)
+    auto op_a = [&](std::int64_t r0, std::int64_t c0) {
+        const bool nontrans = trans == oneapi::math::transpose::nontrans;
+        return general_operand<T, VA>{ nontrans ? a.sub(r0, c0) : a.sub(c0, r0), trans };
+    };
+    auto rows_of_b = [&](std::int64_t first) { return left ? b.sub(first, 0) : b.sub(0, first); };
+    if (size <= block)
+        return trmm_diagonal(queue, left, lower, unit, size, count, alpha, op_a(p, p),
+                             rows_of_b(p), dependencies);
+
+    // The first half is a whole number of blocks, so that the gemm tiles stay aligned
+    const std::int64_t half = (size / block + 1) / 2 * block;
+    const std::int64_t first = lower ? p + half : p;
+    const std::int64_t first_size = lower ? size - half : half;
+    const std::int64_t second = lower ? p : p + half;
+    const std::int64_t second_size = lower ? half : size - half;
+
+    // Vectors overwritten first, then updated from the others, which are still unchanged
+    auto done = trmm_recursive(queue, left, lower, unit, trans, first, first_size, count, alpha, a,
+                               b, dependencies);
+    const general_operand<T, VB> x_block{ rows_of_b(second), oneapi::math::transpose::nontrans };
+    if (left) {
+        done = gemm(queue, first_size, count, second_size, alpha, op_a(first, second), x_block,
+                    T(1), rows_of_b(first), { done });
+    }
+    else {
+        done = gemm(queue, count, first_size, second_size, alpha, x_block, op_a(second, first),
+                    T(1), rows_of_b(first), { done });
+    }
+    return trmm_recursive(queue, left, lower, unit, trans, second, second_size, count, alpha, a, b,
+                          { done });
+}
+
+// B = alpha * op(A) * B on the left, or alpha * B * op(A) on the right, for the triangular
+// matrix A, in place.
+//
+// The product is recursive: B is split in two halves, one multiplied by its diagonal block of
+// op(A) and updated with the other half by one gemm, which does most of the work on large
+// blocks, then the other half is multiplied by its own diagonal block. Diagonal blocks of
+// trmm_block are multiplied in local memory.
+template <typename T, typename VA, typename VB>
+sycl::event trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
+                 oneapi::math::transpose trans, oneapi::math::diag unit_diag, std::int64_t m,
+                 std::int64_t n, T alpha, matrix<VA> a, matrix<VB> b,
+                 const std::vector<sycl::event>& dependencies) {
+    if (m <= 0 || n <= 0 || alpha == T(0))
+        return scale(queue, m, n, alpha, b, dependencies);
+
+    const bool left = left_right == oneapi::math::side::left;
+    const bool op_upper = (upper_lower == oneapi::math::uplo::upper) ==
+                          (trans == oneapi::math::transpose::nontrans);
+    // The matrix applied to each vector is lower triangular
+    const bool lower = left != op_upper;
+    return trmm_recursive(queue, left, lower, unit_diag == oneapi::math::diag::unit, trans, 0,
+                          left ? m : n, left ? n : m, alpha, a, b, dependencies);
+}
+
+// C = alpha * op(A) * op(B) + beta * C for the general matrices A and B. The conjugation of a
+// conjtrans operand is applied as its tiles are loaded, so that it costs no extra pass.
+template <typename T, typename VA, typename VB, typename VC>
+sycl::event gemm(sycl::queue& queue, oneapi::math::transpose transa,
+                 oneapi::math::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                 T alpha, matrix<VA> a, matrix<VB> b, T beta, matrix<VC> c,
+                 const std::vector<sycl::event>& dependencies) {
+    return gemm(queue, m, n, k, alpha, general_operand<T, VA>{ a, transa },
+                general_operand<T, VB>{ b, transb }, beta, c, dependencies);
+}
+
+// C = alpha * A * B + beta * C on the left, or alpha * B * A + beta * C on the right, for the
+// symmetric or Hermitian matrix A
+template <typename T, typename VA, typename VB, typename VC>
+sycl::event symm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
+                 bool hermitian, std::int64_t m, std::int64_t n, T alpha, matrix<VA> a,
+                 matrix<VB> b, T beta, matrix<VC> c,
+                 const std::vector<sycl::event>& dependencies) {
+    const symmetric_operand<T, VA> sym_a{ a, upper_lower == oneapi::math::uplo::upper, hermitian };
+    const general_operand<T, VB> op_b{ b, oneapi::math::transpose::nontrans };
+    return left_right == oneapi::math::side::left
+               ? gemm(queue, m, n, m, alpha, sym_a, op_b, beta, c, dependencies)
+               : gemm(queue, m, n, n, alpha, op_b, sym_a, beta, c, dependencies);
+}
+
+// op(X) of the rank-k updates: X for nontrans, its transpose or conjugate transpose otherwise
+inline oneapi::math::transpose rank_k_op_b(oneapi::math::transpose trans, bool hermitian) {
+    if (trans != oneapi::math::transpose::nontrans)
+        return oneapi::math::transpose::nontrans;
+    return hermitian ? oneapi::math::transpose::conjtrans : oneapi::math::transpose::trans;
+}
+
+// C = alpha * op(A) * op(A)^T + beta * C, or op(A) * op(A)^H when hermitian is set, computing
+// only the triangle of C given by upper_lower
+template <typename T, typename VA, typename VC>
+sycl::event syrk(sycl::queue& queue, oneapi::math::uplo upper_lower,
+                 oneapi::math::transpose trans, bool hermitian, std::int64_t n, std::int64_t k,
+                 T alpha, matrix<VA> a, T beta, matrix<VC> c,
+                 const std::vector<sycl::event>& dependencies) {
+    const auto part = upper_lower == oneapi::math::uplo::upper ? matrix_part::upper
+                                                               : matrix_part::lower;
+    return gemm(queue, n, n, k, alpha, general_operand<T, VA>{ a, trans },
+                general_operand<T, VA>{ a, rank_k_op_b(trans, hermitian) }, beta, c,
+                dependencies, part, hermitian);
+}
+
+// C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C, or
+// alpha * op(A) * op(B)^H + conj(alpha) * op(B) * op(A)^H + beta * C when hermitian is set,
+// computing only the triangle of C given by upper_lower
+template <typename T, typename VA, typename VB, typename VC>
+sycl::event syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower,
+                  oneapi::math::transpose trans, bool hermitian, std::int64_t n, std::int64_t k,
+                  T alpha, matrix<VA> a, matrix<VB> b, T beta, matrix<VC> c,
+                  const std::vector<sycl::event>& dependencies) {
+    const auto part = upper_lower == oneapi::math::uplo::upper ? matrix_part::upper
+                                                               : matrix_part::lower;
+    const auto op_b = rank_k_op_b(trans, hermitian);
+    auto first = gemm(queue, n, n, k, alpha, general_operand<T, VA>{ a, trans },
+                      general_operand<T, VB>{ b, op_b }, beta, c, dependencies, part, hermitian);
+    return gemm(queue, n, n, k, hermitian ? conjugate(alpha) : alpha,
+                general_operand<T, VB>{ b, trans }, general_operand<T, VA>{ a, op_b }, T(1), c,
+                { first }, part, hermitian);
+}
+
+} // namespace detail
+} // namespace generic
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif // _GENERIC_BLAS_LEVEL3_KERNELS_HPP_
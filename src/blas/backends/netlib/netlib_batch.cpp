@@ -24,6 +24,7 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_small_gemm.hpp"
 #include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
 
@@ -33,15 +34,19 @@ namespace blas {
 namespace netlib {
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
@@ -214,24 +214,42 @@ void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t
                 int64_t k, float alpha, sycl::buffer<float, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<float, 1>& b, int64_t ldb, int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemm_batch>(cgh, [=]() {
+            const float* a_ptr = accessor_a.GET_MULTI_PTR;
+            const float* b_ptr = accessor_b.GET_MULTI_PTR;
+            float* c_ptr = accessor_c.GET_MULTI_PTR;
+            run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                           [=](int64_t i) {
+                               return std::make_tuple(a_ptr + i * stride_a, b_ptr + i * stride_b,
+                                                      c_ptr + i * stride_c);
+                           });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                 int64_t k, double alpha, sycl::buffer<double, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<double, 1>& b, int64_t ldb, int64_t stride_b, double beta,
                 sycl::buffer<double, 1>& c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemm_batch>(cgh, [=]() {
+            const double* a_ptr = accessor_a.GET_MULTI_PTR;
+            const double* b_ptr = accessor_b.GET_MULTI_PTR;
+            double* c_ptr = accessor_c.GET_MULTI_PTR;
+            run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                           [=](int64_t i) {
+                               return std::make_tuple(a_ptr + i * stride_a, b_ptr + i * stride_b,
+                                                      c_ptr + i * stride_c);
+                           });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -239,12 +257,21 @@ void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t
                 int64_t lda, int64_t stride_a, sycl::buffer<std::complex<float>, 1>& b, int64_t ldb,
                 int64_t stride_b, std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c,
                 int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemm_batch>(cgh, [=]() {
+            const std::complex<float>* a_ptr = accessor_a.GET_MULTI_PTR;
+            const std::complex<float>* b_ptr = accessor_b.GET_MULTI_PTR;
+            std::complex<float>* c_ptr = accessor_c.GET_MULTI_PTR;
+            run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                           [=](int64_t i) {
+                               return std::make_tuple(a_ptr + i * stride_a, b_ptr + i * stride_b,
+                                                      c_ptr + i * stride_c);
+                           });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -253,12 +280,21 @@ void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1>& c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemm_batch>(cgh, [=]() {
+            const std::complex<double>* a_ptr = accessor_a.GET_MULTI_PTR;
+            const std::complex<double>* b_ptr = accessor_b.GET_MULTI_PTR;
+            std::complex<double>* c_ptr = accessor_c.GET_MULTI_PTR;
+            run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                           [=](int64_t i) {
+                               return std::make_tuple(a_ptr + i * stride_a, b_ptr + i * stride_b,
+                                                      c_ptr + i * stride_c);
+                           });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -943,12 +979,16 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        const float** b, int64_t* ldb, float* beta, float** c, int64_t* ldc,
                        int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_sgemm_batch_group_usm>(queue, dependencies, [=]() {
+        int64_t first = 0;
+        for (int64_t g = 0; g < group_count; ++g) {
+            run_gemm_batch(MAJOR, transa[g], transb[g], m[g], n[g], k[g], alpha[g], lda[g],
+                           ldb[g], beta[g], ldc[g], group_size[g], [=](int64_t i) {
+                return std::make_tuple(a[first + i], b[first + i], c[first + i]);
+            });
+            first += group_size[g];
+        }
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -956,12 +996,16 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        const double** b, int64_t* ldb, double* beta, double** c, int64_t* ldc,
                        int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_dgemm_batch_group_usm>(queue, dependencies, [=]() {
+        int64_t first = 0;
+        for (int64_t g = 0; g < group_count; ++g) {
+            run_gemm_batch(MAJOR, transa[g], transb[g], m[g], n[g], k[g], alpha[g], lda[g],
+                           ldb[g], beta[g], ldc[g], group_size[g], [=](int64_t i) {
+                return std::make_tuple(a[first + i], b[first + i], c[first + i]);
+            });
+            first += group_size[g];
+        }
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -970,12 +1014,16 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        int64_t* ldb, std::complex<float>* beta, std::complex<float>** c,
                        int64_t* ldc, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_cgemm_batch_group_usm>(queue, dependencies, [=]() {
+        int64_t first = 0;
+        for (int64_t g = 0; g < group_count; ++g) {
+            run_gemm_batch(MAJOR, transa[g], transb[g], m[g], n[g], k[g], alpha[g], lda[g],
+                           ldb[g], beta[g], ldc[g], group_size[g], [=](int64_t i) {
+                return std::make_tuple(a[first + i], b[first + i], c[first + i]);
+            });
+            first += group_size[g];
+        }
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -984,12 +1032,16 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        int64_t* ldb, std::complex<double>* beta, std::complex<double>** c,
                        int64_t* ldc, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_zgemm_batch_group_usm>(queue, dependencies, [=]() {
+        int64_t first = 0;
+        for (int64_t g = 0; g < group_count; ++g) {
+            run_gemm_batch(MAJOR, transa[g], transb[g], m[g], n[g], k[g], alpha[g], lda[g],
+                           ldb[g], beta[g], ldc[g], group_size[g], [=](int64_t i) {
+                return std::make_tuple(a[first + i], b[first + i], c[first + i]);
+            });
+            first += group_size[g];
+        }
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -1049,12 +1101,13 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        const float* b, int64_t ldb, int64_t stride_b, float beta, float* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_sgemm_batch_usm>(queue, dependencies, [=]() {
+        run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                       [=](int64_t i) {
+                           return std::make_tuple(a + i * stride_a, b + i * stride_b,
+                                                  c + i * stride_c);
+                       });
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -1062,12 +1115,13 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        const double* b, int64_t ldb, int64_t stride_b, double beta, double* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_dgemm_batch_usm>(queue, dependencies, [=]() {
+        run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                       [=](int64_t i) {
+                           return std::make_tuple(a + i * stride_a, b + i * stride_b,
+                                                  c + i * stride_c);
+                       });
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -1076,12 +1130,13 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        int64_t stride_b, std::complex<float> beta, std::complex<float>* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_cgemm_batch_usm>(queue, dependencies, [=]() {
+        run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                       [=](int64_t i) {
+                           return std::make_tuple(a + i * stride_a, b + i * stride_b,
+                                                  c + i * stride_c);
+                       });
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -1090,12 +1145,13 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        int64_t stride_b, std::complex<double> beta, std::complex<double>* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    return host_submit<class netlib_zgemm_batch_usm>(queue, dependencies, [=]() {
+        run_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_size,
+                       [=](int64_t i) {
+                           return std::make_tuple(a + i * stride_a, b + i * stride_b,
+                                                  c + i * stride_c);
+                       });
+    });
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
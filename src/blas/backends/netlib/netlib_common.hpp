@@ -29,6 +29,7 @@
 
 #include "cblas.h"
 
+#include "netlib_executor.hpp"
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
 #include "oneapi/math/types.hpp"
 
@@ -95,6 +96,41 @@ static inline void host_task(H& cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// Runs f after the dependencies, on the executor when it is enabled and the queue is out of order,
+// in a host task otherwise
+template <typename K, typename F>
+static inline sycl::event host_submit(sycl::queue& queue,
+                                      const std::vector<sycl::event>& dependencies, F f) {
+    auto pool = executor::instance();
+    if (pool && !queue.is_in_order()) {
+        std::vector<executor::task_ptr> tasks;
+        bool foreign = false;
+        for (const auto& dependency : dependencies) {
+            if (auto t = pool->find(dependency))
+                tasks.push_back(std::move(t));
+            else if (dependency.get_info<sycl::info::event::command_execution_status>() !=
+                     sycl::info::event_command_status::complete)
+                foreign = true;
+        }
+        if (!foreign) {
+            auto t = pool->run(f, tasks);
+            auto done = queue.submit([&](sycl::handler& cgh) {
+                host_task<K>(cgh, [=]() { pool->wait(t); });
+            });
+            pool->track(done, t);
+            return done;
+        }
+    }
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<K>(cgh, f);
+    });
+    return done;
+}
+
 } // namespace netlib
 } // namespace blas
 } // namespace math
@@ -0,0 +1,280 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "netlib_executor.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+namespace {
+
+constexpr std::size_t no_worker = std::numeric_limits<std::size_t>::max();
+
+// Index of the current thread in the pool
+thread_local std::size_t current_worker = no_worker;
+
+// CPUs of every NUMA node, a single node with no CPU list when unknown
+std::vector<std::vector<int>> numa_nodes() {
+    std::vector<std::vector<int>> nodes;
+#ifdef __linux__
+    for (int node = 0;; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file)
+            break;
+        // e.g. 0-15,32-47
+        std::vector<int> cpus;
+        std::string range;
+        while (std::getline(file, range, ',')) {
+            int first = 0, last = 0;
+            char dash = 0;
+            std::istringstream in(range);
+            if (!(in >> first))
+                continue;
+            if (!(in >> dash >> last))
+                last = first;
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty())
+            nodes.push_back(std::move(cpus));
+    }
+#endif
+    if (nodes.empty())
+        nodes.emplace_back();
+    return nodes;
+}
+
+void pin_to(std::thread& thread, const std::vector<int>& cpus) {
+#ifdef __linux__
+    if (cpus.empty())
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    // Best effort, e.g. the CPUs may be outside of the affinity mask of the process
+    (void)pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+    (void)thread;
+    (void)cpus;
+#endif
+}
+
+} // namespace
+
+executor* executor::instance() {
+    static std::unique_ptr<executor> pool = []() -> std::unique_ptr<executor> {
+        const char* mode = std::getenv("ONEMATH_NETLIB_EXECUTOR");
+        if (!mode || std::string(mode) != "pool")
+            return nullptr;
+        std::size_t num_threads = std::thread::hardware_concurrency();
+        if (const char* threads = std::getenv("ONEMATH_NETLIB_THREADS"))
+            num_threads = std::strtoul(threads, nullptr, 10);
+        return std::unique_ptr<executor>(new executor(num_threads ? num_threads : 1));
+    }();
+    return pool.get();
+}
+
+executor::executor(std::size_t num_threads) {
+    auto nodes = numa_nodes();
+    std::vector<std::size_t> node_of(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        node_of[i] = i % nodes.size();
+        workers_.push_back(std::make_unique<worker>());
+    }
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        for (std::size_t j = 1; j < num_threads; ++j) {
+            std::size_t victim = (i + j) % num_threads;
+            if (node_of[victim] == node_of[i])
+                workers_[i]->victims.push_back(victim);
+        }
+        for (std::size_t j = 1; j < num_threads; ++j) {
+            std::size_t victim = (i + j) % num_threads;
+            if (node_of[victim] != node_of[i])
+                workers_[i]->victims.push_back(victim);
+        }
+    }
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        workers_[i]->thread = std::thread([this, i]() { work_loop(i); });
+        pin_to(workers_[i]->thread, nodes[node_of[i]]);
+    }
+}
+
+executor::~executor() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& w : workers_) {
+        w->thread.join();
+    }
+}
+
+executor::task_ptr executor::run(std::function<void()> work,
+                                 const std::vector<task_ptr>& dependencies) {
+    auto t = std::make_shared<task>();
+    t->work = std::move(work);
+    for (const auto& dependency : dependencies) {
+        std::lock_guard<std::mutex> lock(dependency->mutex);
+        if (dependency->done)
+            continue;
+        t->pending.fetch_add(1, std::memory_order_relaxed);
+        dependency->dependents.push_back(t);
+    }
+    if (t->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        schedule(t);
+    return t;
+}
+
+void executor::wait(const task_ptr& t) {
+    {
+        std::unique_lock<std::mutex> lock(t->mutex);
+        t->finished.wait(lock, [&]() { return t->done; });
+    }
+    untrack(t);
+    if (t->error)
+        std::rethrow_exception(t->error);
+}
+
+void executor::track(const sycl::event& event, const task_ptr& t) {
+    std::lock_guard<std::mutex> lock(events_mutex_);
+    if (t->untracked)
+        return;
+    t->event = event;
+    events_[event] = t;
+}
+
+void executor::untrack(const task_ptr& t) {
+    std::lock_guard<std::mutex> lock(events_mutex_);
+    t->untracked = true;
+    if (t->event) {
+        events_.erase(*t->event);
+        // The event holds the host task waiting for t
+        t->event.reset();
+    }
+}
+
+executor::task_ptr executor::find(const sycl::event& event) {
+    std::lock_guard<std::mutex> lock(events_mutex_);
+    auto found = events_.find(event);
+    return found == events_.end() ? nullptr : found->second;
+}
+
+void executor::schedule(task_ptr t) {
+    // Tasks made ready by a worker stay on it, the others are spread over the workers
+    std::size_t index = current_worker != no_worker
+                            ? current_worker
+                            : next_worker_.fetch_add(1, std::memory_order_relaxed) %
+                                  workers_.size();
+    queued_.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+        workers_[index]->ready.push_back(std::move(t));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_one();
+}
+
+void executor::execute(const task_ptr& t) {
+    // Like host tasks, the work runs even when a dependency failed
+    try {
+        t->work();
+    }
+    catch (...) {
+        t->error = std::current_exception();
+    }
+    t->work = nullptr;
+    finish(t);
+}
+
+void executor::finish(const task_ptr& t) {
+    std::vector<task_ptr> dependents;
+    {
+        std::lock_guard<std::mutex> lock(t->mutex);
+        t->done = true;
+        dependents.swap(t->dependents);
+    }
+    t->finished.notify_all();
+    for (auto& dependent : dependents) {
+        if (dependent->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            schedule(std::move(dependent));
+    }
+}
+
+executor::task_ptr executor::next(std::size_t index) {
+    task_ptr t;
+    {
+        // Own queue from the back, the most recently readied task is likely hot in the cache
+        auto& own = *workers_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.ready.empty()) {
+            t = std::move(own.ready.back());
+            own.ready.pop_back();
+        }
+    }
+    for (std::size_t v = 0; !t && v < workers_[index]->victims.size(); ++v) {
+        auto& victim = *workers_[workers_[index]->victims[v]];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.ready.empty()) {
+            t = std::move(victim.ready.front());
+            victim.ready.pop_front();
+        }
+    }
+    if (t)
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+    return t;
+}
+
+void executor::work_loop(std::size_t index) {
+    current_worker = index;
+    while (true) {
+        if (auto t = next(index)) {
+            execute(t);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [&]() { return stop_ || queued_.load(std::memory_order_acquire) > 0; });
+        if (stop_ && queued_.load(std::memory_order_acquire) == 0)
+            return;
+    }
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_EXECUTOR_HPP_
+#define _NETLIB_EXECUTOR_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+// Opt-in executor of the CBLAS calls of the USM API, enabled with ONEMATH_NETLIB_EXECUTOR=pool.
+//
+// The calls run on a persistent pool of host threads instead of SYCL host tasks, so independent
+// calls submitted to an out-of-order queue run concurrently as soon as they are submitted. The
+// pool tracks the dependencies between the calls it runs itself; a call depending on any other
+// unfinished event goes through a host task as usual. Each call still returns a SYCL event, from
+// a host task waiting for the completion of the call on the pool.
+//
+// Workers are spread over the NUMA nodes and pinned to the CPUs of their node on Linux. Every
+// worker has its own queue of ready calls and steals from the workers of its node first when its
+// queue is empty. ONEMATH_NETLIB_THREADS sets the number of workers, the number of hardware
+// threads by default.
+class executor {
+public:
+    struct task {
+        std::function<void()> work;
+        // Unfinished dependencies, plus one until the task is fully submitted
+        std::atomic<int> pending{ 1 };
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done = false;
+        std::exception_ptr error;
+        std::vector<std::shared_ptr<task>> dependents;
+        // Event of the host task waiting for the task, while it is tracked
+        std::optional<sycl::event> event;
+        bool untracked = false;
+    };
+    using task_ptr = std::shared_ptr<task>;
+
+    // The executor, nullptr unless enabled
+    static executor* instance();
+
+    ~executor();
+
+    executor(const executor&) = delete;
+    executor& operator=(const executor&) = delete;
+
+    // Runs work on the pool once all the dependencies are done
+    task_ptr run(std::function<void()> work, const std::vector<task_ptr>& dependencies);
+
+    // Waits for the task and untracks it, rethrowing the exception of its work
+    void wait(const task_ptr& t);
+
+    // Associates the event waiting for t with it until the wait
+    void track(const sycl::event& event, const task_ptr& t);
+
+    // Task of an event returned by the executor, nullptr for other events
+    task_ptr find(const sycl::event& event);
+
+private:
+    struct worker {
+        std::mutex mutex;
+        std::deque<task_ptr> ready;
+        // Workers to steal from, the ones of the same NUMA node first
+        std::vector<std::size_t> victims;
+        std::thread thread;
+    };
+
+    explicit executor(std::size_t num_threads);
+
+    void untrack(const task_ptr& t);
+    void schedule(task_ptr t);
+    void execute(const task_ptr& t);
+    void finish(const task_ptr& t);
+    task_ptr next(std::size_t index);
+    void work_loop(std::size_t index);
+
+    std::vector<std::unique_ptr<worker>> workers_;
+    std::atomic<std::size_t> queued_{ 0 };
+    std::atomic<std::size_t> next_worker_{ 0 };
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+    std::mutex events_mutex_;
+    std::unordered_map<sycl::event, task_ptr> events_;
+};
+
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif //_NETLIB_EXECUTOR_HPP_
@@ -24,6 +24,7 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_level1_kernels.hpp"
 #include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
 
@@ -25,8 +25,7 @@ void asum(sycl::queue& queue, int64_t n, sycl::buffer<float, 1>& x, int64_t incx
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
         host_task<class netlib_sasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_sasum((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
+            accessor_result[0] = level1::asum(n, accessor_x.GET_MULTI_PTR, std::abs(incx));
         });
     });
 }
@@ -37,8 +36,7 @@ void asum(sycl::queue& queue, int64_t n, sycl::buffer<double, 1>& x, int64_t inc
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
         host_task<class netlib_dasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dasum((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
+            accessor_result[0] = level1::asum(n, accessor_x.GET_MULTI_PTR, std::abs(incx));
         });
     });
 }
@@ -73,8 +71,7 @@ void axpy(sycl::queue& queue, int64_t n, float alpha, sycl::buffer<float, 1>& x,
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_saxpy>(cgh, [=]() {
-            ::cblas_saxpy((const int)n, (const float)alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, accessor_y.GET_MULTI_PTR, (const int)incy);
+            level1::axpy(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -85,8 +82,7 @@ void axpy(sycl::queue& queue, int64_t n, double alpha, sycl::buffer<double, 1>&
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_daxpy>(cgh, [=]() {
-            ::cblas_daxpy((const int)n, (const double)alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, accessor_y.GET_MULTI_PTR, (const int)incy);
+            level1::axpy(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -215,8 +211,7 @@ void dot(sycl::queue& queue, int64_t n, sycl::buffer<float, 1>& x, int64_t incx,
         auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
         host_task<class netlib_sdot>(cgh, [=]() {
             accessor_result[0] =
-                ::cblas_sdot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                             accessor_y.GET_MULTI_PTR, (const int)incy);
+                level1::dot(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -229,8 +224,7 @@ void dot(sycl::queue& queue, int64_t n, sycl::buffer<double, 1>& x, int64_t incx
         auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
         host_task<class netlib_ddot>(cgh, [=]() {
             accessor_result[0] =
-                ::cblas_ddot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                             accessor_y.GET_MULTI_PTR, (const int)incy);
+                level1::dot(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -403,8 +397,7 @@ void nrm2(sycl::queue& queue, int64_t n, sycl::buffer<float, 1>& x, int64_t incx
         auto accessor_x = x.template get_access<sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<sycl::access::mode::write>(cgh);
         host_task<class netlib_snrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_snrm2((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
+            accessor_result[0] = level1::nrm2(n, accessor_x.GET_MULTI_PTR, std::abs(incx));
         });
     });
 }
@@ -415,8 +408,7 @@ void nrm2(sycl::queue& queue, int64_t n, sycl::buffer<double, 1>& x, int64_t inc
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
         host_task<class netlib_dnrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dnrm2((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
+            accessor_result[0] = level1::nrm2(n, accessor_x.GET_MULTI_PTR, std::abs(incx));
         });
     });
 }
@@ -451,8 +443,7 @@ void rot(sycl::queue& queue, int64_t n, sycl::buffer<float, 1>& x, int64_t incx,
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_srot>(cgh, [=]() {
-            ::cblas_srot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                         accessor_y.GET_MULTI_PTR, (const int)incy, (const float)c, (const float)s);
+            level1::rot(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy, c, s);
         });
     });
 }
@@ -463,8 +454,7 @@ void rot(sycl::queue& queue, int64_t n, sycl::buffer<double, 1>& x, int64_t incx
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_drot>(cgh, [=]() {
-            ::cblas_drot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                         accessor_y.GET_MULTI_PTR, (const int)incy, (const float)c, (const float)s);
+            level1::rot(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy, c, s);
         });
     });
 }
@@ -611,8 +601,7 @@ void scal(sycl::queue& queue, int64_t n, float alpha, sycl::buffer<float, 1>& x,
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sscal>(cgh, [=]() {
-            ::cblas_sscal((const int)n, (const float)alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)std::abs(incx));
+            level1::scal(n, alpha, accessor_x.GET_MULTI_PTR, std::abs(incx));
         });
     });
 }
@@ -621,8 +610,7 @@ void scal(sycl::queue& queue, int64_t n, double alpha, sycl::buffer<double, 1>&
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dscal>(cgh, [=]() {
-            ::cblas_dscal((const int)n, (const double)alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)std::abs(incx));
+            level1::scal(n, alpha, accessor_x.GET_MULTI_PTR, std::abs(incx));
         });
     });
 }
@@ -737,115 +725,62 @@ void swap(sycl::queue& queue, int64_t n, sycl::buffer<std::complex<double>, 1>&
 
 sycl::event asum(sycl::queue& queue, int64_t n, const float* x, int64_t incx, float* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_sasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_sasum((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_sasum_usm>(queue, dependencies, [=]() {
+        result[0] = level1::asum(n, x, std::abs(incx));
     });
-    return done;
 }
 
 sycl::event asum(sycl::queue& queue, int64_t n, const double* x, int64_t incx, double* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_dasum((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_dasum_usm>(queue, dependencies, [=]() {
+        result[0] = level1::asum(n, x, std::abs(incx));
     });
-    return done;
 }
 
 sycl::event asum(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                  float* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_scasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_scasum((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_scasum_usm>(queue, dependencies, [=]() {
+        result[0] = ::cblas_scasum((const int)n, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event asum(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                  double* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dzasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_dzasum((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_dzasum_usm>(queue, dependencies, [=]() {
+        result[0] = ::cblas_dzasum((const int)n, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event axpy(sycl::queue& queue, int64_t n, float alpha, const float* x, int64_t incx, float* y,
                  int64_t incy, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_saxpy_usm>(cgh, [=]() {
-            ::cblas_saxpy((const int)n, (const float)alpha, x, (const int)incx, y, (const int)incy);
-        });
+    return host_submit<class netlib_saxpy_usm>(queue, dependencies, [=]() {
+        level1::axpy(n, alpha, x, incx, y, incy);
     });
-    return done;
 }
 
 sycl::event axpy(sycl::queue& queue, int64_t n, double alpha, const double* x, int64_t incx,
                  double* y, int64_t incy, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_daxpy_usm>(cgh, [=]() {
-            ::cblas_daxpy((const int)n, (const double)alpha, x, (const int)incx, y,
-                          (const int)incy);
-        });
+    return host_submit<class netlib_daxpy_usm>(queue, dependencies, [=]() {
+        level1::axpy(n, alpha, x, incx, y, incy);
     });
-    return done;
 }
 
 sycl::event axpy(sycl::queue& queue, int64_t n, std::complex<float> alpha,
                  const std::complex<float>* x, int64_t incx, std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_caxpy_usm>(cgh, [=]() {
-            ::cblas_caxpy((const int)n, (const void*)&alpha, x, (const int)incx, y,
-                          (const int)incy);
-        });
+    return host_submit<class netlib_caxpy_usm>(queue, dependencies, [=]() {
+        ::cblas_caxpy((const int)n, (const void*)&alpha, x, (const int)incx, y,
+                      (const int)incy);
     });
-    return done;
 }
 
 sycl::event axpy(sycl::queue& queue, int64_t n, std::complex<double> alpha,
                  const std::complex<double>* x, int64_t incx, std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zaxpy_usm>(cgh, [=]() {
-            ::cblas_zaxpy((const int)n, (const void*)&alpha, x, (const int)incx, y,
-                          (const int)incy);
-        });
+    return host_submit<class netlib_zaxpy_usm>(queue, dependencies, [=]() {
+        ::cblas_zaxpy((const int)n, (const void*)&alpha, x, (const int)incx, y,
+                      (const int)incy);
     });
-    return done;
 }
 
 sycl::event axpby(sycl::queue& queue, int64_t n, float alpha, const float* x, int64_t incx,
@@ -896,630 +831,323 @@ sycl::event axpby(sycl::queue& queue, int64_t n, std::complex<double> alpha,
 
 sycl::event copy(sycl::queue& queue, int64_t n, const float* x, int64_t incx, float* y,
                  int64_t incy, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_scopy_usm>(
-            cgh, [=]() { ::cblas_scopy((const int)n, x, (const int)incx, y, (const int)incy); });
+    return host_submit<class netlib_scopy_usm>(queue, dependencies, [=]() {
+        ::cblas_scopy((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event copy(sycl::queue& queue, int64_t n, const double* x, int64_t incx, double* y,
                  int64_t incy, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dcopy_usm>(
-            cgh, [=]() { ::cblas_dcopy((const int)n, x, (const int)incx, y, (const int)incy); });
+    return host_submit<class netlib_dcopy_usm>(queue, dependencies, [=]() {
+        ::cblas_dcopy((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event copy(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                  std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ccopy_usm>(
-            cgh, [=]() { ::cblas_ccopy((const int)n, x, (const int)incx, y, (const int)incy); });
+    return host_submit<class netlib_ccopy_usm>(queue, dependencies, [=]() {
+        ::cblas_ccopy((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event copy(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                  std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zcopy_usm>(
-            cgh, [=]() { ::cblas_zcopy((const int)n, x, (const int)incx, y, (const int)incy); });
+    return host_submit<class netlib_zcopy_usm>(queue, dependencies, [=]() {
+        ::cblas_zcopy((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event dot(sycl::queue& queue, int64_t n, const float* x, int64_t incx, const float* y,
                 int64_t incy, float* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_sdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_sdot((const int)n, x, (const int)incx, y, (const int)incy);
-        });
+    return host_submit<class netlib_sdot_usm>(queue, dependencies, [=]() {
+        result[0] = level1::dot(n, x, incx, y, incy);
     });
-    return done;
 }
 
 sycl::event dot(sycl::queue& queue, int64_t n, const double* x, int64_t incx, const double* y,
                 int64_t incy, double* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ddot_usm>(cgh, [=]() {
-            result[0] = ::cblas_ddot((const int)n, x, (const int)incx, y, (const int)incy);
-        });
+    return host_submit<class netlib_ddot_usm>(queue, dependencies, [=]() {
+        result[0] = level1::dot(n, x, incx, y, incy);
     });
-    return done;
 }
 
 sycl::event dot(sycl::queue& queue, int64_t n, const float* x, int64_t incx, const float* y,
                 int64_t incy, double* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dsdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_dsdot((const int)n, x, (const int)incx, y, (const int)incy);
-        });
+    return host_submit<class netlib_dsdot_usm>(queue, dependencies, [=]() {
+        result[0] = ::cblas_dsdot((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event dotc(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                  const std::complex<float>* y, int64_t incy, std::complex<float>* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_cdotc_usm>(cgh, [=]() {
-            ::cblas_cdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+    return host_submit<class netlib_cdotc_usm>(queue, dependencies, [=]() {
+        ::cblas_cdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
     });
-    return done;
 }
 
 sycl::event dotc(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                  const std::complex<double>* y, int64_t incy, std::complex<double>* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zdotc_usm>(cgh, [=]() {
-            ::cblas_zdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+    return host_submit<class netlib_zdotc_usm>(queue, dependencies, [=]() {
+        ::cblas_zdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
     });
-    return done;
 }
 
 sycl::event dotu(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                  const std::complex<float>* y, int64_t incy, std::complex<float>* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_cdotu_usm>(cgh, [=]() {
-            ::cblas_cdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+    return host_submit<class netlib_cdotu_usm>(queue, dependencies, [=]() {
+        ::cblas_cdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
     });
-    return done;
 }
 
 sycl::event dotu(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                  const std::complex<double>* y, int64_t incy, std::complex<double>* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zdotu_usm>(cgh, [=]() {
-            ::cblas_zdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+    return host_submit<class netlib_zdotu_usm>(queue, dependencies, [=]() {
+        ::cblas_zdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
     });
-    return done;
 }
 
 sycl::event iamin(sycl::queue& queue, int64_t n, const float* x, int64_t incx, int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_isamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamin((int)n, x, (int)incx); });
-    });
-    return done;
+    return host_submit<class netlib_isamin_usm>(
+        queue, dependencies, [=]() { result[0] = ::cblas_isamin((int)n, x, (int)incx); });
 }
 
 sycl::event iamin(sycl::queue& queue, int64_t n, const double* x, int64_t incx, int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_idamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamin((const int)n, x, (const int)incx); });
+    return host_submit<class netlib_idamin_usm>(queue, dependencies, [=]() {
+        result[0] = ::cblas_idamin((const int)n, x, (const int)incx);
     });
-    return done;
 }
 
 sycl::event iamin(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                   int64_t* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_icamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamin((int)n, x, (int)incx); });
-    });
-    return done;
+    return host_submit<class netlib_icamin_usm>(
+        queue, dependencies, [=]() { result[0] = ::cblas_icamin((int)n, x, (int)incx); });
 }
 
 sycl::event iamin(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                   int64_t* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_izamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamin((int)n, x, (int)incx); });
-    });
-    return done;
+    return host_submit<class netlib_izamin_usm>(
+        queue, dependencies, [=]() { result[0] = ::cblas_izamin((int)n, x, (int)incx); });
 }
 
 sycl::event iamax(sycl::queue& queue, int64_t n, const float* x, int64_t incx, int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_isamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamax((int)n, x, (int)incx); });
-    });
-    return done;
+    return host_submit<class netlib_isamax_usm>(
+        queue, dependencies, [=]() { result[0] = ::cblas_isamax((int)n, x, (int)incx); });
 }
 
 sycl::event iamax(sycl::queue& queue, int64_t n, const double* x, int64_t incx, int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_idamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamax((int)n, x, (int)incx); });
-    });
-    return done;
+    return host_submit<class netlib_idamax_usm>(
+        queue, dependencies, [=]() { result[0] = ::cblas_idamax((int)n, x, (int)incx); });
 }
 
 sycl::event iamax(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                   int64_t* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_icamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamax((int)n, x, (int)incx); });
-    });
-    return done;
+    return host_submit<class netlib_icamax_usm>(
+        queue, dependencies, [=]() { result[0] = ::cblas_icamax((int)n, x, (int)incx); });
 }
 
 sycl::event iamax(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                   int64_t* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_izamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamax((int)n, x, (int)incx); });
-    });
-    return done;
+    return host_submit<class netlib_izamax_usm>(
+        queue, dependencies, [=]() { result[0] = ::cblas_izamax((int)n, x, (int)incx); });
 }
 
 sycl::event nrm2(sycl::queue& queue, int64_t n, const float* x, int64_t incx, float* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_snrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_snrm2((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_snrm2_usm>(queue, dependencies, [=]() {
+        result[0] = level1::nrm2(n, x, std::abs(incx));
     });
-    return done;
 }
 
 sycl::event nrm2(sycl::queue& queue, int64_t n, const double* x, int64_t incx, double* result,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dnrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_dnrm2((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_dnrm2_usm>(queue, dependencies, [=]() {
+        result[0] = level1::nrm2(n, x, std::abs(incx));
     });
-    return done;
 }
 
 sycl::event nrm2(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                  float* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_scnrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_scnrm2((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_scnrm2_usm>(queue, dependencies, [=]() {
+        result[0] = ::cblas_scnrm2((const int)n, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event nrm2(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                  double* result, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dznrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_dznrm2((const int)n, x, (const int)std::abs(incx)); });
+    return host_submit<class netlib_dznrm2_usm>(queue, dependencies, [=]() {
+        result[0] = ::cblas_dznrm2((const int)n, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event rot(sycl::queue& queue, int64_t n, float* x, int64_t incx, float* y, int64_t incy,
                 float c, float s, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_srot_usm>(cgh, [=]() {
-            ::cblas_srot((const int)n, x, (const int)incx, y, (const int)incy, (const float)c,
-                         (const float)s);
-        });
+    return host_submit<class netlib_srot_usm>(queue, dependencies, [=]() {
+        level1::rot(n, x, incx, y, incy, c, s);
     });
-    return done;
 }
 
 sycl::event rot(sycl::queue& queue, int64_t n, double* x, int64_t incx, double* y, int64_t incy,
                 double c, double s, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_drot_usm>(cgh, [=]() {
-            ::cblas_drot((const int)n, x, (const int)incx, y, (const int)incy, (const float)c,
-                         (const float)s);
-        });
+    return host_submit<class netlib_drot_usm>(queue, dependencies, [=]() {
+        level1::rot(n, x, incx, y, incy, c, s);
     });
-    return done;
 }
 
 sycl::event rot(sycl::queue& queue, int64_t n, std::complex<float>* x, int64_t incx,
                 std::complex<float>* y, int64_t incy, float c, float s,
                 const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_csrot_usm>(cgh, [=]() {
-            ::cblas_csrot((const int)n, x, (const int)incx, y, (const int)incy, (const float)c,
-                          (const float)s);
-        });
+    return host_submit<class netlib_csrot_usm>(queue, dependencies, [=]() {
+        ::cblas_csrot((const int)n, x, (const int)incx, y, (const int)incy, (const float)c,
+                      (const float)s);
     });
-    return done;
 }
 
 sycl::event rot(sycl::queue& queue, int64_t n, std::complex<double>* x, int64_t incx,
                 std::complex<double>* y, int64_t incy, double c, double s,
                 const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zdrot_usm>(cgh, [=]() {
-            ::cblas_zdrot((const int)n, x, (const int)incx, y, (const int)incy, (const double)c,
-                          (const double)s);
-        });
+    return host_submit<class netlib_zdrot_usm>(queue, dependencies, [=]() {
+        ::cblas_zdrot((const int)n, x, (const int)incx, y, (const int)incy, (const double)c,
+                      (const double)s);
     });
-    return done;
 }
 
 sycl::event rotg(sycl::queue& queue, float* a, float* b, float* c, float* s,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_srotg_usm>(cgh, [=]() { ::cblas_srotg(a, b, c, s); });
-    });
-    return done;
+    return host_submit<class netlib_srotg_usm>(
+        queue, dependencies, [=]() { ::cblas_srotg(a, b, c, s); });
 }
 
 sycl::event rotg(sycl::queue& queue, double* a, double* b, double* c, double* s,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_drotg_usm>(cgh, [=]() { ::cblas_drotg(a, b, c, s); });
-    });
-    return done;
+    return host_submit<class netlib_drotg_usm>(
+        queue, dependencies, [=]() { ::cblas_drotg(a, b, c, s); });
 }
 
 sycl::event rotg(sycl::queue& queue, std::complex<float>* a, std::complex<float>* b, float* c,
                  std::complex<float>* s, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_crotg_usm>(cgh, [=]() { ::cblas_crotg(a, b, c, s); });
-    });
-    return done;
+    return host_submit<class netlib_crotg_usm>(
+        queue, dependencies, [=]() { ::cblas_crotg(a, b, c, s); });
 }
 
 sycl::event rotg(sycl::queue& queue, std::complex<double>* a, std::complex<double>* b, double* c,
                  std::complex<double>* s, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zrotg_usm>(cgh, [=]() { ::cblas_zrotg(a, b, c, s); });
-    });
-    return done;
+    return host_submit<class netlib_zrotg_usm>(
+        queue, dependencies, [=]() { ::cblas_zrotg(a, b, c, s); });
 }
 
 sycl::event rotm(sycl::queue& queue, int64_t n, float* x, int64_t incx, float* y, int64_t incy,
                  float* param, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_srotm_usm>(cgh, [=]() {
-            ::cblas_srotm((const int)n, x, (const int)incx, y, (const int)incy, param);
-        });
+    return host_submit<class netlib_srotm_usm>(queue, dependencies, [=]() {
+        ::cblas_srotm((const int)n, x, (const int)incx, y, (const int)incy, param);
     });
-    return done;
 }
 
 sycl::event rotm(sycl::queue& queue, int64_t n, double* x, int64_t incx, double* y, int64_t incy,
                  double* param, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_drotm_usm>(cgh, [=]() {
-            ::cblas_drotm((const int)n, x, (const int)incx, y, (const int)incy, param);
-        });
+    return host_submit<class netlib_drotm_usm>(queue, dependencies, [=]() {
+        ::cblas_drotm((const int)n, x, (const int)incx, y, (const int)incy, param);
     });
-    return done;
 }
 
 sycl::event rotmg(sycl::queue& queue, float* d1, float* d2, float* x1, float y1, float* param,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_srotmg_usm>(cgh,
-                                           [=]() { ::cblas_srotmg(d1, d2, x1, (float)y1, param); });
-    });
-    return done;
+    return host_submit<class netlib_srotmg_usm>(
+        queue, dependencies, [=]() { ::cblas_srotmg(d1, d2, x1, (float)y1, param); });
 }
 
 sycl::event rotmg(sycl::queue& queue, double* d1, double* d2, double* x1, double y1, double* param,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_drotmg_usm>(
-            cgh, [=]() { ::cblas_drotmg(d1, d2, x1, (double)y1, param); });
-    });
-    return done;
+    return host_submit<class netlib_drotmg_usm>(
+        queue, dependencies, [=]() { ::cblas_drotmg(d1, d2, x1, (double)y1, param); });
 }
 
 sycl::event scal(sycl::queue& queue, int64_t n, float alpha, float* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_sscal_usm>(cgh, [=]() {
-            ::cblas_sscal((const int)n, (const float)alpha, x, (const int)std::abs(incx));
-        });
+    return host_submit<class netlib_sscal_usm>(queue, dependencies, [=]() {
+        level1::scal(n, alpha, x, std::abs(incx));
     });
-    return done;
 }
 
 sycl::event scal(sycl::queue& queue, int64_t n, double alpha, double* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dscal_usm>(cgh, [=]() {
-            ::cblas_dscal((const int)n, (const double)alpha, x, (const int)std::abs(incx));
-        });
+    return host_submit<class netlib_dscal_usm>(queue, dependencies, [=]() {
+        level1::scal(n, alpha, x, std::abs(incx));
     });
-    return done;
 }
 
 sycl::event scal(sycl::queue& queue, int64_t n, std::complex<float> alpha, std::complex<float>* x,
                  int64_t incx, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_cscal_usm>(cgh, [=]() {
-            ::cblas_cscal((const int)n, (const void*)&alpha, x, (const int)std::abs(incx));
-        });
+    return host_submit<class netlib_cscal_usm>(queue, dependencies, [=]() {
+        ::cblas_cscal((const int)n, (const void*)&alpha, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event scal(sycl::queue& queue, int64_t n, float alpha, std::complex<float>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_csscal_usm>(cgh, [=]() {
-            ::cblas_csscal((const int)n, (const float)alpha, x, (const int)std::abs(incx));
-        });
+    return host_submit<class netlib_csscal_usm>(queue, dependencies, [=]() {
+        ::cblas_csscal((const int)n, (const float)alpha, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event scal(sycl::queue& queue, int64_t n, std::complex<double> alpha, std::complex<double>* x,
                  int64_t incx, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zscal_usm>(cgh, [=]() {
-            ::cblas_zscal((const int)n, (const void*)&alpha, x, (const int)std::abs(incx));
-        });
+    return host_submit<class netlib_zscal_usm>(queue, dependencies, [=]() {
+        ::cblas_zscal((const int)n, (const void*)&alpha, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event scal(sycl::queue& queue, int64_t n, double alpha, std::complex<double>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zdscal_usm>(cgh, [=]() {
-            ::cblas_zdscal((const int)n, (const double)alpha, x, (const int)std::abs(incx));
-        });
+    return host_submit<class netlib_zdscal_usm>(queue, dependencies, [=]() {
+        ::cblas_zdscal((const int)n, (const double)alpha, x, (const int)std::abs(incx));
     });
-    return done;
 }
 
 sycl::event sdsdot(sycl::queue& queue, int64_t n, float sb, const float* x, int64_t incx,
                    const float* y, int64_t incy, float* result,
                    const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_sdsdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_sdsdot((const int)n, (const float)sb, x, (const int)incx, y,
-                                       (const int)incy);
-        });
+    return host_submit<class netlib_sdsdot_usm>(queue, dependencies, [=]() {
+        result[0] = ::cblas_sdsdot((const int)n, (const float)sb, x, (const int)incx, y,
+                                   (const int)incy);
     });
-    return done;
 }
 
 sycl::event swap(sycl::queue& queue, int64_t n, float* x, int64_t incx, float* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_sswap_usm>(
-            cgh, [=]() { ::cblas_sswap((const int)n, x, (const int)incx, y, (const int)incy); });
+    return host_submit<class netlib_sswap_usm>(queue, dependencies, [=]() {
+        ::cblas_sswap((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event swap(sycl::queue& queue, int64_t n, double* x, int64_t incx, double* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dswap_usm>(
-            cgh, [=]() { ::cblas_dswap((const int)n, x, (const int)incx, y, (const int)incy); });
+    return host_submit<class netlib_dswap_usm>(queue, dependencies, [=]() {
+        ::cblas_dswap((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event swap(sycl::queue& queue, int64_t n, std::complex<float>* x, int64_t incx,
                  std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_cswap_usm>(
-            cgh, [=]() { ::cblas_cswap((const int)n, x, (const int)incx, y, (const int)incy); });
+    return host_submit<class netlib_cswap_usm>(queue, dependencies, [=]() {
+        ::cblas_cswap((const int)n, x, (const int)incx, y, (const int)incy);
     });
-    return done;
 }
 
 sycl::event swap(sycl::queue& queue, int64_t n, std::complex<double>* x, int64_t incx,
                  std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zswap_usm>(
-            cgh, [=]() { ::cblas_zswap((const int)n, x, (const int)incx, y, (const int)incy); });
-    });
-    return done;
+    return host_submit<class netlib_zswap_usm>(queue, dependencies, [=]() {
+        ::cblas_zswap((const int)n, x, (const int)incx, y, (const int)incy);
+    });
 }
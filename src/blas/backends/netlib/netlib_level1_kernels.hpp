@@ -0,0 +1,372 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LEVEL1_KERNELS_HPP_
+#define _NETLIB_LEVEL1_KERNELS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+// Real level-1 kernels replacing the scalar reference CBLAS routines.
+//
+// The vectors are split into blocks of a fixed number of elements, shared out between the calling
+// thread and a persistent pool of helper threads when the vector is large. Every block accumulates
+// its elements into a fixed number of lanes the compiler vectorizes, and the partial results of
+// the blocks are combined in order, so that the result of a reduction depends neither on the
+// number of threads nor on their scheduling. The unit-stride case of every routine is a separate
+// loop with contiguous accesses.
+namespace level1 {
+
+// Elements per block, a multiple of lanes
+constexpr int64_t block_size = 16384;
+
+// Vectors shorter than this run on the calling thread
+constexpr int64_t parallel_min = 262144;
+
+// Independent accumulators of a block
+constexpr int lanes = 16;
+
+// Threads of the kernels, ONEMATH_NETLIB_THREADS or the number of hardware threads. The variable
+// is read by every call large enough to be shared out, so that it can be changed at run time.
+inline int64_t max_threads() {
+    int64_t num_threads = std::thread::hardware_concurrency();
+    if (const char* env = std::getenv("ONEMATH_NETLIB_THREADS"))
+        num_threads = std::strtol(env, nullptr, 10);
+    return num_threads > 0 ? num_threads : 1;
+}
+
+// Persistent threads helping the calling thread of the kernels, created on first use
+class helper_pool {
+public:
+    static helper_pool& instance() {
+        static helper_pool pool;
+        return pool;
+    }
+
+    int64_t size() const {
+        return static_cast<int64_t>(threads_.size());
+    }
+
+    void post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        ready_.notify_one();
+    }
+
+    ~helper_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+private:
+    helper_pool() {
+        const int64_t num_threads =
+            std::max<int64_t>(std::thread::hardware_concurrency(), max_threads());
+        for (int64_t t = 1; t < num_threads; ++t) {
+            // The calling threads process the blocks alone if no thread can be created
+            try {
+                threads_.emplace_back([this]() { work_loop(); });
+            }
+            catch (const std::system_error&) {
+                break;
+            }
+        }
+    }
+
+    helper_pool(const helper_pool&) = delete;
+    helper_pool& operator=(const helper_pool&) = delete;
+
+    void work_loop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [&]() { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty())
+                    return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+// Runs f(first, last) over the blocks of [0, n)
+template <typename F>
+void for_each_block(int64_t n, F f) {
+    const int64_t num_blocks = (n + block_size - 1) / block_size;
+    const int64_t num_threads = n < parallel_min ? 1 : std::min(max_threads(), num_blocks);
+    if (num_threads == 1) {
+        for (int64_t b = 0; b < num_blocks; ++b)
+            f(b * block_size, std::min(n, (b + 1) * block_size));
+        return;
+    }
+
+    // The blocks are claimed one by one by the calling thread and the helpers. A helper starting
+    // after the calling thread ran out of blocks returns without touching them, so the call only
+    // waits for the helpers still processing a block, never for busy pool threads.
+    struct shared_state {
+        std::atomic<int64_t> next{ 0 };
+        std::mutex mutex;
+        std::condition_variable idle;
+        int64_t active = 0;
+        bool closed = false;
+        std::function<void()> work;
+    };
+    auto state = std::make_shared<shared_state>();
+    state->work = [&]() {
+        for (int64_t b; (b = state->next.fetch_add(1, std::memory_order_relaxed)) < num_blocks;)
+            f(b * block_size, std::min(n, (b + 1) * block_size));
+    };
+    auto& pool = helper_pool::instance();
+    for (int64_t t = 1; t < std::min(num_threads, pool.size() + 1); ++t) {
+        pool.post([state]() {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->closed)
+                    return;
+                ++state->active;
+            }
+            state->work();
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (--state->active == 0)
+                state->idle.notify_all();
+        });
+    }
+    state->work();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->closed = true;
+    state->idle.wait(lock, [&]() { return state->active == 0; });
+}
+
+// combine(term(first), ..., term(last - 1)) through the lanes, paired in a fixed order
+template <typename R, typename Term, typename Combine>
+R block_reduce(int64_t first, int64_t last, R init, Term term, Combine combine) {
+    R acc[lanes];
+    for (int l = 0; l < lanes; ++l) {
+        acc[l] = init;
+    }
+    int64_t i = first;
+    for (; i + lanes <= last; i += lanes) {
+        for (int l = 0; l < lanes; ++l) {
+            acc[l] = combine(acc[l], term(i + l));
+        }
+    }
+    for (int l = 0; i < last; ++i, ++l) {
+        acc[l] = combine(acc[l], term(i));
+    }
+    for (int width = lanes / 2; width > 0; width /= 2) {
+        for (int l = 0; l < width; ++l) {
+            acc[l] = combine(acc[l], acc[l + width]);
+        }
+    }
+    return acc[0];
+}
+
+// Reduction of term(i) over [0, n), combining the blocks in order
+template <typename R, typename Term, typename Combine>
+R reduce(int64_t n, R init, Term term, Combine combine) {
+    if (n <= block_size)
+        return block_reduce(0, n, init, term, combine);
+    std::vector<R> partial((n + block_size - 1) / block_size);
+    for_each_block(n, [&](int64_t first, int64_t last) {
+        partial[first / block_size] = block_reduce(first, last, init, term, combine);
+    });
+    R result = init;
+    for (R p : partial) {
+        result = combine(result, p);
+    }
+    return result;
+}
+
+template <typename R, typename Term>
+R sum(int64_t n, Term term) {
+    return reduce(n, R(0), term, [](R a, R b) { return a + b; });
+}
+
+// First element of a vector traversed with a negative increment, as in CBLAS
+template <typename T>
+T* first_element(T* x, int64_t n, int64_t inc) {
+    return inc < 0 ? x + (1 - n) * inc : x;
+}
+
+template <typename T>
+T asum(int64_t n, const T* x, int64_t incx) {
+    if (n < 1 || incx < 1)
+        return T(0);
+    if (incx == 1)
+        return sum<T>(n, [=](int64_t i) { return std::abs(x[i]); });
+    return sum<T>(n, [=](int64_t i) { return std::abs(x[i * incx]); });
+}
+
+template <typename T>
+void axpy(int64_t n, T alpha, const T* x, int64_t incx, T* y, int64_t incy) {
+    if (n < 1 || alpha == T(0))
+        return;
+    x = first_element(x, n, incx);
+    y = first_element(y, n, incy);
+    if (incx == 1 && incy == 1) {
+        for_each_block(n, [=](int64_t first, int64_t last) {
+            for (int64_t i = first; i < last; ++i) {
+                y[i] += alpha * x[i];
+            }
+        });
+        return;
+    }
+    auto strided = [=](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; ++i) {
+            y[i * incy] += alpha * x[i * incx];
+        }
+    };
+    // Every element updates the same y with a zero increment
+    if (incy == 0)
+        strided(0, n);
+    else
+        for_each_block(n, strided);
+}
+
+template <typename T>
+T dot(int64_t n, const T* x, int64_t incx, const T* y, int64_t incy) {
+    if (n < 1)
+        return T(0);
+    x = first_element(x, n, incx);
+    y = first_element(y, n, incy);
+    if (incx == 1 && incy == 1)
+        return sum<T>(n, [=](int64_t i) { return x[i] * y[i]; });
+    return sum<T>(n, [=](int64_t i) { return x[i * incx] * y[i * incy]; });
+}
+
+// Sum of squares in double precision for float, which can neither overflow nor underflow. For
+// double, the vector is scaled by its largest magnitude when the sum of squares overflows or is
+// too small to be accurate.
+template <typename T>
+T nrm2(int64_t n, const T* x, int64_t incx) {
+    if (n < 1 || incx < 1)
+        return T(0);
+    using Acc = std::conditional_t<std::is_same_v<T, float>, double, T>;
+    auto square = [=](int64_t i) {
+        Acc v = x[i * incx];
+        return v * v;
+    };
+    Acc ssq = incx == 1 ? sum<Acc>(n, [=](int64_t i) { return Acc(x[i]) * Acc(x[i]); })
+                        : sum<Acc>(n, square);
+    if (std::is_same_v<T, float> || std::isnan(ssq) ||
+        (std::isfinite(ssq) &&
+         ssq >= std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon()))
+        return T(std::sqrt(ssq));
+    T scale = reduce(n, T(0), [=](int64_t i) { return std::abs(x[i * incx]); },
+                     [](T a, T b) { return std::max(a, b); });
+    if (scale == T(0) || std::isinf(scale))
+        return scale;
+    T scaled = sum<T>(n, [=](int64_t i) {
+        T v = x[i * incx] / scale;
+        return v * v;
+    });
+    return scale * std::sqrt(scaled);
+}
+
+template <typename T>
+void rot(int64_t n, T* x, int64_t incx, T* y, int64_t incy, T c, T s) {
+    if (n < 1)
+        return;
+    x = first_element(x, n, incx);
+    y = first_element(y, n, incy);
+    if (incx == 1 && incy == 1) {
+        for_each_block(n, [=](int64_t first, int64_t last) {
+            for (int64_t i = first; i < last; ++i) {
+                T xi = x[i], yi = y[i];
+                x[i] = c * xi + s * yi;
+                y[i] = c * yi - s * xi;
+            }
+        });
+        return;
+    }
+    auto strided = [=](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; ++i) {
+            T xi = x[i * incx], yi = y[i * incy];
+            x[i * incx] = c * xi + s * yi;
+            y[i * incy] = c * yi - s * xi;
+        }
+    };
+    // Every element updates the same x or y with a zero increment
+    if (incx == 0 || incy == 0)
+        strided(0, n);
+    else
+        for_each_block(n, strided);
+}
+
+template <typename T>
+void scal(int64_t n, T alpha, T* x, int64_t incx) {
+    if (n < 1 || incx < 1)
+        return;
+    if (incx == 1) {
+        for_each_block(n, [=](int64_t first, int64_t last) {
+            for (int64_t i = first; i < last; ++i) {
+                x[i] *= alpha;
+            }
+        });
+        return;
+    }
+    for_each_block(n, [=](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; ++i) {
+            x[i * incx] *= alpha;
+        }
+    });
+}
+
+} // namespace level1
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif //_NETLIB_LEVEL1_KERNELS_HPP_
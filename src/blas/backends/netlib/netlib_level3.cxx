@@ -559,36 +559,22 @@ void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                  int64_t k, float alpha, const float* a, int64_t lda, const float* b, int64_t ldb,
                  float beta, float* c, int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_sgemm_usm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const float)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_sgemm_usm>(queue, dependencies, [=]() {
+        ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                      (const int)m, (const int)n, (const int)k, (const float)alpha, a,
+                      (const int)lda, b, (const int)ldb, (const float)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                  int64_t k, double alpha, const double* a, int64_t lda, const double* b,
                  int64_t ldb, double beta, double* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dgemm_usm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const double)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_dgemm_usm>(queue, dependencies, [=]() {
+        ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                      (const int)m, (const int)n, (const int)k, (const double)alpha, a,
+                      (const int)lda, b, (const int)ldb, (const double)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -596,18 +582,11 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t
                  const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                  std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_cgemm_usm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_cgemm_usm>(queue, dependencies, [=]() {
+        ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                      (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
+                      (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -615,18 +594,11 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t
                  const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
                  std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zgemm_usm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_zgemm_usm>(queue, dependencies, [=]() {
+        ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                      (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
+                      (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -670,19 +642,12 @@ sycl::event hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                  std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_chemm_usm>(cgh, [=]() {
-            ::cblas_chemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_chemm_usm>(queue, dependencies, [=]() {
+        ::cblas_chemm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
+                      (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
@@ -690,128 +655,79 @@ sycl::event hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
                  std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zhemm_usm>(cgh, [=]() {
-            ::cblas_zhemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_zhemm_usm>(queue, dependencies, [=]() {
+        ::cblas_zhemm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
+                      (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event herk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  float alpha, const std::complex<float>* a, int64_t lda, float beta,
                  std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_cherk_usm>(cgh, [=]() {
-            ::cblas_cherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_cherk_usm>(queue, dependencies, [=]() {
+        ::cblas_cherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                      (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
+                      (const float)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event herk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  double alpha, const std::complex<double>* a, int64_t lda, double beta,
                  std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zherk_usm>(cgh, [=]() {
-            ::cblas_zherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_zherk_usm>(queue, dependencies, [=]() {
+        ::cblas_zherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                      (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
+                      (const double)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                   std::complex<float> alpha, const std::complex<float>* a, int64_t lda,
                   const std::complex<float>* b, int64_t ldb, float beta, std::complex<float>* c,
                   int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_cher2k_usm>(cgh, [=]() {
-            ::cblas_cher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const float)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_cher2k_usm>(queue, dependencies, [=]() {
+        ::cblas_cher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                       (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
+                       (const int)ldb, (const float)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                   std::complex<double> alpha, const std::complex<double>* a, int64_t lda,
                   const std::complex<double>* b, int64_t ldb, double beta, std::complex<double>* c,
                   int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zher2k_usm>(cgh, [=]() {
-            ::cblas_zher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const double)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_zher2k_usm>(queue, dependencies, [=]() {
+        ::cblas_zher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                       (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
+                       (const int)ldb, (const double)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
                  float alpha, const float* a, int64_t lda, const float* b, int64_t ldb, float beta,
                  float* c, int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ssymm_usm>(cgh, [=]() {
-            ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const float)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_ssymm_usm>(queue, dependencies, [=]() {
+        ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
+                      (const float)alpha, a, (const int)lda, b, (const int)ldb,
+                      (const float)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
                  double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
                  double beta, double* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dsymm_usm>(cgh, [=]() {
-            ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const double)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_dsymm_usm>(queue, dependencies, [=]() {
+        ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
+                      (const double)alpha, a, (const int)lda, b, (const int)ldb,
+                      (const double)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
@@ -819,19 +735,12 @@ sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                  std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_csymm_usm>(cgh, [=]() {
-            ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_csymm_usm>(queue, dependencies, [=]() {
+        ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
+                      (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
@@ -839,124 +748,75 @@ sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
                  std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zsymm_usm>(cgh, [=]() {
-            ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_zsymm_usm>(queue, dependencies, [=]() {
+        ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
+                      (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  float alpha, const float* a, int64_t lda, float beta, float* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ssyrk_usm>(cgh, [=]() {
-            ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_ssyrk_usm>(queue, dependencies, [=]() {
+        ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                      (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
+                      (const float)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  double alpha, const double* a, int64_t lda, double beta, double* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dsyrk_usm>(cgh, [=]() {
-            ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_dsyrk_usm>(queue, dependencies, [=]() {
+        ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                      (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
+                      (const double)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  std::complex<float> alpha, const std::complex<float>* a, int64_t lda,
                  std::complex<float> beta, std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_csyrk_usm>(cgh, [=]() {
-            ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda,
-                          (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_csyrk_usm>(queue, dependencies, [=]() {
+        ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                      (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda,
+                      (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  std::complex<double> alpha, const std::complex<double>* a, int64_t lda,
                  std::complex<double> beta, std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zsyrk_usm>(cgh, [=]() {
-            ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda,
-                          (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_zsyrk_usm>(queue, dependencies, [=]() {
+        ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                      (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda,
+                      (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                   float alpha, const float* a, int64_t lda, const float* b, int64_t ldb, float beta,
                   float* c, int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ssyr2k_usm>(cgh, [=]() {
-            ::cblas_ssyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const float)alpha, a, (const int)lda, b,
-                           (const int)ldb, (const float)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_ssyr2k_usm>(queue, dependencies, [=]() {
+        ::cblas_ssyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                       (const int)n, (const int)k, (const float)alpha, a, (const int)lda, b,
+                       (const int)ldb, (const float)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                   double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
                   double beta, double* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dsyr2k_usm>(cgh, [=]() {
-            ::cblas_dsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const double)alpha, a, (const int)lda, b,
-                           (const int)ldb, (const double)beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_dsyr2k_usm>(queue, dependencies, [=]() {
+        ::cblas_dsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                       (const int)n, (const int)k, (const double)alpha, a, (const int)lda, b,
+                       (const int)ldb, (const double)beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -964,18 +824,11 @@ sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                   const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                   std::complex<float>* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_csyr2k_usm>(cgh, [=]() {
-            ::cblas_csyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_csyr2k_usm>(queue, dependencies, [=]() {
+        ::cblas_csyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                       (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
+                       (const int)ldb, (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -983,164 +836,101 @@ sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                   const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
                   std::complex<double>* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_zsyr2k_usm>(cgh, [=]() {
-            ::cblas_zsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const void*)&beta, c, (const int)ldc);
-        });
+    return host_submit<class netlib_zsyr2k_usm>(queue, dependencies, [=]() {
+        ::cblas_zsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                       (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
+                       (const int)ldb, (const void*)&beta, c, (const int)ldc);
     });
-    return done;
 }
 
 sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, float alpha, const float* a, int64_t lda,
                  float* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_strmm_usm>(cgh, [=]() {
-            ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_strmm_usm>(queue, dependencies, [=]() {
+        ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const float)alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
 
 sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, double alpha, const double* a, int64_t lda,
                  double* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dtrmm_usm>(cgh, [=]() {
-            ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_dtrmm_usm>(queue, dependencies, [=]() {
+        ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const double)alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
 
 sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                  const std::complex<float>* a, int64_t lda, std::complex<float>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ctrmm_usm>(cgh, [=]() {
-            ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_ctrmm_usm>(queue, dependencies, [=]() {
+        ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
 
 sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                  const std::complex<double>* a, int64_t lda, std::complex<double>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ztrmm_usm>(cgh, [=]() {
-            ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_ztrmm_usm>(queue, dependencies, [=]() {
+        ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
 
 sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, float alpha, const float* a, int64_t lda,
                  float* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_strsm_usm>(cgh, [=]() {
-            ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_strsm_usm>(queue, dependencies, [=]() {
+        ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const float)alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
 
 sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, double alpha, const double* a, int64_t lda,
                  double* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_dtrsm_usm>(cgh, [=]() {
-            ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_dtrsm_usm>(queue, dependencies, [=]() {
+        ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const double)alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
 
 sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                  const std::complex<float>* a, int64_t lda, std::complex<float>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ctrsm_usm>(cgh, [=]() {
-            ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_ctrsm_usm>(queue, dependencies, [=]() {
+        ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
 
 sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                  const std::complex<double>* a, int64_t lda, std::complex<double>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    auto done = queue.submit([&](sycl::handler& cgh) {
-        int64_t num_events = dependencies.size();
-        for (int64_t i = 0; i < num_events; i++) {
-            cgh.depends_on(dependencies[i]);
-        }
-        host_task<class netlib_ztrsm_usm>(cgh, [=]() {
-            ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
-        });
+    return host_submit<class netlib_ztrsm_usm>(queue, dependencies, [=]() {
+        ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
+                      convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+                      convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
+                      (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
     });
-    return done;
 }
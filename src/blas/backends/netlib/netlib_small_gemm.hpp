@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_SMALL_GEMM_HPP_
+#define _NETLIB_SMALL_GEMM_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+// Matrix products of gemm_batch. The items of a batch with m and k at most small_gemm_max run a
+// kernel specialized on bounds of m, which packs op(A) once and keeps a column of C in an array
+// of compile-time size the compiler unrolls and vectorizes. The other items call CBLAS.
+
+constexpr int64_t small_gemm_max = 32;
+
+template <typename T>
+inline T small_gemm_mul(T a, T b) {
+    return a * b;
+}
+
+// Without the NaN and infinity recovery of the std::complex operator, which is not vectorized
+template <typename T>
+inline std::complex<T> small_gemm_mul(std::complex<T> a, std::complex<T> b) {
+    return { a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real() };
+}
+
+template <typename T>
+inline T small_gemm_conj(T a) {
+    return a;
+}
+
+template <typename T>
+inline std::complex<T> small_gemm_conj(std::complex<T> a) {
+    return std::conj(a);
+}
+
+// Element (r, c) of op(X) for the column-major matrix X
+template <typename T>
+inline T op_element(const T* x, int64_t ldx, transpose op, int64_t r, int64_t c) {
+    if (op == transpose::nontrans)
+        return x[r + c * ldx];
+    return op == transpose::conjtrans ? small_gemm_conj(x[c + r * ldx]) : x[c + r * ldx];
+}
+
+// Signature of the column-major products, C = alpha * op(A) * op(B) + beta * C
+template <typename T>
+using gemm_kernel = void (*)(transpose, transpose, int64_t, int64_t, int64_t, T, const T*,
+                             int64_t, const T*, int64_t, T, T*, int64_t);
+
+// Product for m <= M and k <= small_gemm_max, C not being read when beta is zero
+template <int M, typename T>
+void small_gemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k, T alpha,
+                const T* a, int64_t lda, const T* b, int64_t ldb, T beta, T* c, int64_t ldc) {
+    // op(A) column by column, the rows past m being zero
+    T a_packed[small_gemm_max][M];
+    for (int64_t l = 0; l < k; ++l) {
+        for (int i = 0; i < M; ++i) {
+            a_packed[l][i] = i < m ? op_element(a, lda, transa, i, l) : T(0);
+        }
+    }
+    for (int64_t j = 0; j < n; ++j) {
+        T acc[M] = {};
+        for (int64_t l = 0; l < k; ++l) {
+            const T b_lj = op_element(b, ldb, transb, l, j);
+            for (int i = 0; i < M; ++i) {
+                acc[i] += small_gemm_mul(a_packed[l][i], b_lj);
+            }
+        }
+        T* c_j = c + j * ldc;
+        for (int64_t i = 0; i < m; ++i) {
+            c_j[i] = beta == T(0) ? small_gemm_mul(alpha, acc[i])
+                                  : small_gemm_mul(alpha, acc[i]) + small_gemm_mul(beta, c_j[i]);
+        }
+    }
+}
+
+inline void cblas_gemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                       float alpha, const float* a, int64_t lda, const float* b, int64_t ldb,
+                       float beta, float* c, int64_t ldc) {
+    ::cblas_sgemm(CblasColMajor, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                       double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
+                       double beta, double* c, int64_t ldc) {
+    ::cblas_dgemm(CblasColMajor, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                       std::complex<float> alpha, const std::complex<float>* a, int64_t lda,
+                       const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
+                       std::complex<float>* c, int64_t ldc) {
+    ::cblas_cgemm(CblasColMajor, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
+                  (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                       std::complex<double> alpha, const std::complex<double>* a, int64_t lda,
+                       const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
+                       std::complex<double>* c, int64_t ldc) {
+    ::cblas_zgemm(CblasColMajor, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
+                  (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
+}
+
+// Kernel of the column-major products of size m x n x k
+template <typename T>
+gemm_kernel<T> select_gemm_kernel(int64_t m, int64_t n, int64_t k) {
+    if (m > small_gemm_max || k > small_gemm_max || n <= 0 || k <= 0)
+        return static_cast<gemm_kernel<T>>(cblas_gemm);
+    if (m <= 4)
+        return small_gemm<4, T>;
+    if (m <= 8)
+        return small_gemm<8, T>;
+    if (m <= 16)
+        return small_gemm<16, T>;
+    return small_gemm<32, T>;
+}
+
+// Runs the products of the batch_size items whose matrices are given by item(i), returning
+// (a, b, c), with the kernel selected once for the whole batch. A row-major product is computed
+// as the column-major product of the transposes, C^T = op(B)^T * op(A)^T.
+template <typename T, typename Item>
+void run_gemm_batch(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                    int64_t k, T alpha, int64_t lda, int64_t ldb, T beta, int64_t ldc,
+                    int64_t batch_size, Item item) {
+    const bool row_major = layout == CblasRowMajor;
+    if (row_major) {
+        std::swap(transa, transb);
+        std::swap(m, n);
+        std::swap(lda, ldb);
+    }
+    const auto kernel = select_gemm_kernel<T>(m, n, k);
+    for (int64_t i = 0; i < batch_size; ++i) {
+        auto [a, b, c] = item(i);
+        if (row_major)
+            std::swap(a, b);
+        kernel(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif //_NETLIB_SMALL_GEMM_HPP_
@@ -35,421 +35,470 @@ static oneapi::math::detail::table_initializer<domain::blas, blas_function_table
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_scasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_scasum_sycl, queue, n, x, incx,
+                  result);
 }
 
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_dzasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dzasum_sycl, queue, n, x, incx,
+                  result);
 }
 
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_sasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sasum_sycl, queue, n, x, incx,
+                  result);
 }
 
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_dasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dasum_sycl, queue, n, x, incx,
+                  result);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_saxpy_sycl, queue, n, alpha, x, incx,
+                  y, incy);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_daxpy_sycl, queue, n, alpha, x, incx,
+                  y, incy);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_caxpy_sycl, queue, n, alpha, x, incx,
+                  y, incy);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zaxpy_sycl, queue, n, alpha, x, incx,
+                  y, incy);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_saxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_saxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_daxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_daxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<float>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_caxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_caxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<double>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zaxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zaxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
            sycl::buffer<float, 1>& x, std::int64_t incx, float beta, sycl::buffer<float, 1>& y,
            std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_saxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_saxpby_sycl, queue, n, alpha, x,
+                  incx, beta, y, incy);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
            sycl::buffer<double, 1>& x, std::int64_t incx, double beta, sycl::buffer<double, 1>& y,
            std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_daxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_daxpby_sycl, queue, n, alpha, x,
+                  incx, beta, y, incy);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
            std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_caxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_caxpby_sycl, queue, n, alpha, x,
+                  incx, beta, y, incy);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
            std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zaxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zaxpby_sycl, queue, n, alpha, x,
+                  incx, beta, y, incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_scopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_scopy_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_dcopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dcopy_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_ccopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ccopy_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zcopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zcopy_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_scopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_scopy_batch_strided_sycl, queue, n,
+                  x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_dcopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dcopy_batch_strided_sycl, queue, n,
+                  x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_ccopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ccopy_batch_strided_sycl, queue, n,
+                  x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zcopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zcopy_batch_strided_sycl, queue, n,
+                  x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x,
          std::int64_t incx, sycl::buffer<float, 1>& y, std::int64_t incy,
          sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_sdot_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sdot_sycl, queue, n, x, incx, y,
+                  incy, result);
 }
 
 void dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
          std::int64_t incy, sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_ddot_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ddot_sycl, queue, n, x, incx, y,
+                  incy, result);
 }
 
 void dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x,
          std::int64_t incx, sycl::buffer<float, 1>& y, std::int64_t incy,
          sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_dsdot_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsdot_sycl, queue, n, x, incx, y,
+                  incy, result);
 }
 
 void dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_cdotc_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cdotc_sycl, queue, n, x, incx, y,
+                  incy, result);
 }
 
 void dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_zdotc_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdotc_sycl, queue, n, x, incx, y,
+                  incy, result);
 }
 
 void dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_cdotu_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cdotu_sycl, queue, n, x, incx, y,
+                  incy, result);
 }
 
 void dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_zdotu_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdotu_sycl, queue, n, x, incx, y,
+                  incy, result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_isamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_isamin_sycl, queue, n, x, incx,
+                  result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_idamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_idamin_sycl, queue, n, x, incx,
+                  result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_icamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_icamin_sycl, queue, n, x, incx,
+                  result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_izamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_izamin_sycl, queue, n, x, incx,
+                  result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_isamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_isamax_sycl, queue, n, x, incx,
+                  result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_idamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_idamax_sycl, queue, n, x, incx,
+                  result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_icamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_icamax_sycl, queue, n, x, incx,
+                  result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_izamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_izamax_sycl, queue, n, x, incx,
+                  result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_scnrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_scnrm2_sycl, queue, n, x, incx,
+                  result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_dznrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dznrm2_sycl, queue, n, x, incx,
+                  result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_snrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_snrm2_sycl, queue, n, x, incx,
+                  result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_dnrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dnrm2_sycl, queue, n, x, incx,
+                  result);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, float c, float s) {
-    function_tables[{ libkey, queue }].column_major_srot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_srot_sycl, queue, n, x, incx, y,
+                  incy, c, s);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy, double c, double s) {
-    function_tables[{ libkey, queue }].column_major_drot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_drot_sycl, queue, n, x, incx, y,
+                  incy, c, s);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x,
          std::int64_t incx, sycl::buffer<float, 1>& y, std::int64_t incy, float c, float s) {
-    function_tables[{ libkey, queue }].column_major_csrot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_csrot_sycl, queue, n, x, incx, y,
+                  incy, c, s);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
          std::int64_t incy, double c, double s) {
-    function_tables[{ libkey, queue }].column_major_zdrot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdrot_sycl, queue, n, x, incx, y,
+                  incy, c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<float, 1>& a,
           sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& c, sycl::buffer<float, 1>& s) {
-    function_tables[{ libkey, queue }].column_major_srotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_srotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<double, 1>& a,
           sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& c, sycl::buffer<double, 1>& s) {
-    function_tables[{ libkey, queue }].column_major_drotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_drotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& b, sycl::buffer<float, 1>& c,
           sycl::buffer<std::complex<float>, 1>& s) {
-    function_tables[{ libkey, queue }].column_major_crotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_crotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& b, sycl::buffer<double, 1>& c,
           sycl::buffer<std::complex<double>, 1>& s) {
-    function_tables[{ libkey, queue }].column_major_zrotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zrotg_sycl, queue, a, b, c, s);
 }
 
 void rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy, sycl::buffer<float, 1>& param) {
-    function_tables[{ libkey, queue }].column_major_srotm_sycl(queue, n, x, incx, y, incy, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_srotm_sycl, queue, n, x, incx, y,
+                  incy, param);
 }
 
 void rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy, sycl::buffer<double, 1>& param) {
-    function_tables[{ libkey, queue }].column_major_drotm_sycl(queue, n, x, incx, y, incy, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_drotm_sycl, queue, n, x, incx, y,
+                  incy, param);
 }
 
 void rotmg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<float, 1>& d1,
            sycl::buffer<float, 1>& d2, sycl::buffer<float, 1>& x1, float y1,
            sycl::buffer<float, 1>& param) {
-    function_tables[{ libkey, queue }].column_major_srotmg_sycl(queue, d1, d2, x1, y1, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_srotmg_sycl, queue, d1, d2, x1, y1,
+                  param);
 }
 
 void rotmg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<double, 1>& d1,
            sycl::buffer<double, 1>& d2, sycl::buffer<double, 1>& x1, double y1,
            sycl::buffer<double, 1>& param) {
-    function_tables[{ libkey, queue }].column_major_drotmg_sycl(queue, d1, d2, x1, y1, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_drotmg_sycl, queue, d1, d2, x1, y1,
+                  param);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_sscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sscal_sycl, queue, n, alpha, x,
+                  incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_dscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dscal_sycl, queue, n, alpha, x,
+                  incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_cscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cscal_sycl, queue, n, alpha, x,
+                  incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_csscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_csscal_sycl, queue, n, alpha, x,
+                  incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_zscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zscal_sycl, queue, n, alpha, x,
+                  incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_zdscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdscal_sycl, queue, n, alpha, x,
+                  incx);
 }
 
 void sdsdot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float sb,
             sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
             std::int64_t incy, sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].column_major_sdsdot_sycl(queue, n, sb, x, incx, y, incy,
-                                                                result);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sdsdot_sycl, queue, n, sb, x, incx,
+                  y, incy, result);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_sswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sswap_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_dswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dswap_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_cswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cswap_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zswap_sycl, queue, n, x, incx, y,
+                  incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& x, std::int64_t incx, float beta,
           sycl::buffer<float, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_sgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgbmv_sycl, queue, trans, m, n, kl,
+                  ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
           sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& x,
           std::int64_t incx, double beta, sycl::buffer<double, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_dgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgbmv_sycl, queue, trans, m, n, kl,
+                  ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -457,8 +506,8 @@ void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std:
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_cgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgbmv_sycl, queue, trans, m, n, kl,
+                  ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -466,40 +515,40 @@ void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std:
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgbmv_sycl, queue, trans, m, n, kl,
+                  ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx, float beta, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_sgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemv_sycl, queue, trans, m, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx, double beta, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_dgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemv_sycl, queue, trans, m, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_cgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemv_sycl, queue, trans, m, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemv_sycl, queue, trans, m, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -507,9 +556,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 std::int64_t stridea, sycl::buffer<float, 1>& x, std::int64_t incx,
                 std::int64_t stridex, float beta, sycl::buffer<float, 1>& y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_sgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemv_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -517,9 +566,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 std::int64_t stridea, sycl::buffer<double, 1>& x, std::int64_t incx,
                 std::int64_t stridex, double beta, sycl::buffer<double, 1>& y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_dgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemv_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -528,9 +577,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 std::int64_t incx, std::int64_t stridex, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_cgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemv_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -539,9 +588,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemv_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -549,8 +598,8 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_sdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sdgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -558,8 +607,8 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_ddgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ddgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -567,8 +616,8 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::int64_t stridea, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_cdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cdgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -576,444 +625,444 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::int64_t stridea, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
          float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
          std::int64_t incy, sycl::buffer<float, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_sger_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                              a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sger_sycl, queue, m, n, alpha, x,
+                  incx, y, incy, a, lda);
 }
 
 void ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
          double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
          std::int64_t incy, sycl::buffer<double, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_dger_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                              a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dger_sycl, queue, m, n, alpha, x,
+                  incx, y, incy, a, lda);
 }
 
 void gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_cgerc_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgerc_sycl, queue, m, n, alpha, x,
+                  incx, y, incy, a, lda);
 }
 
 void gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_zgerc_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgerc_sycl, queue, m, n, alpha, x,
+                  incx, y, incy, a, lda);
 }
 
 void geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_cgeru_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgeru_sycl, queue, m, n, alpha, x,
+                  incx, y, incy, a, lda);
 }
 
 void geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_zgeru_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgeru_sycl, queue, m, n, alpha, x,
+                  incx, y, incy, a, lda);
 }
 
 void hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_chbmv_sycl(queue, upper_lower, n, k, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_chbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zhbmv_sycl(queue, upper_lower, n, k, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_chemv_sycl(queue, upper_lower, n, alpha, a, lda,
-                                                               x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_chemv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zhemv_sycl(queue, upper_lower, n, alpha, a, lda,
-                                                               x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhemv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_cher_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cher_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a, lda);
 }
 
 void her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_zher_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zher_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a, lda);
 }
 
 void her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_cher2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cher2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_zher2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zher2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_chpmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_chpmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_zhpmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhpmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_chpr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_chpr_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a);
 }
 
 void hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_zhpr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhpr_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a);
 }
 
 void hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_chpr2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_chpr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_zhpr2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhpr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx, float beta, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_ssbmv_sycl(queue, upper_lower, n, k, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx, double beta, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_dsbmv_sycl(queue, upper_lower, n, k, alpha, a,
-                                                               lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& x, std::int64_t incx,
           float beta, sycl::buffer<float, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_sspmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sspmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& x, std::int64_t incx,
           double beta, sycl::buffer<double, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_dspmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dspmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_sspr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sspr_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a);
 }
 
 void spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_dspr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dspr_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a);
 }
 
 void spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy, sycl::buffer<float, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_sspr2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sspr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy, sycl::buffer<double, 1>& a) {
-    function_tables[{ libkey, queue }].column_major_dspr2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dspr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& a, std::int64_t lda, sycl::buffer<float, 1>& x,
           std::int64_t incx, float beta, sycl::buffer<float, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_ssymv_sycl(queue, upper_lower, n, alpha, a, lda,
-                                                               x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssymv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& x,
           std::int64_t incx, double beta, sycl::buffer<double, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].column_major_dsymv_sycl(queue, upper_lower, n, alpha, a, lda,
-                                                               x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsymv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& a,
          std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_ssyr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyr_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a, lda);
 }
 
 void syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& a,
          std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_dsyr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyr_sycl, queue, upper_lower, n,
+                  alpha, x, incx, a, lda);
 }
 
 void syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy, sycl::buffer<float, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_ssyr2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy, sycl::buffer<double, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].column_major_dsyr2_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_stbmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_stbmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_dtbmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtbmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ctbmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctbmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ztbmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztbmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_stbsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_stbsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_dtbsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtbsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ctbsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctbsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ztbsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztbsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_stpmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_stpmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_dtpmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtpmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ctpmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctpmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ztpmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztpmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_stpsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_stpsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_dtpsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtpsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ctpsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctpsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ztpsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztpsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_strmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_strmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_dtrmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ctrmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ztrmv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrmv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_strsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_strsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_dtrsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ctrsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].column_major_ztrsv_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrsv_sycl, queue, upper_lower,
+                  trans, unit_diag, n, a, lda, x, incx);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_sgemm_sycl(queue, transa, transb, m, n, k,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemm_sycl, queue, transa, transb, m,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_dgemm_sycl(queue, transa, transb, m, n, k,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemm_sycl, queue, transa, transb, m,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1021,8 +1070,8 @@ void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, tra
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_cgemm_sycl(queue, transa, transb, m, n, k,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemm_sycl, queue, transa, transb, m,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1030,32 +1079,32 @@ void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, tra
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zgemm_sycl(queue, transa, transb, m, n, k,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemm_sycl, queue, transa, transb, m,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, sycl::half alpha,
           sycl::buffer<sycl::half, 1>& a, std::int64_t lda, sycl::buffer<sycl::half, 1>& b,
           std::int64_t ldb, sycl::half beta, sycl::buffer<sycl::half, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_hgemm_sycl(queue, transa, transb, m, n, k,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_hgemm_sycl, queue, transa, transb, m,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
           sycl::buffer<sycl::half, 1>& a, std::int64_t lda, sycl::buffer<sycl::half, 1>& b,
           std::int64_t ldb, float beta, sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_gemm_f16f16f32_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_f16f16f32_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<bfloat16, 1>& a,
           std::int64_t lda, sycl::buffer<bfloat16, 1>& b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_gemm_bf16bf16f32_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_bf16bf16f32_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1063,8 +1112,8 @@ void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_chemm_sycl(queue, left_right, upper_lower, m, n,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_chemm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1072,23 +1121,23 @@ void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zhemm_sycl(queue, left_right, upper_lower, m, n,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhemm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, float beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_cherk_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cherk_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, double beta, sycl::buffer<std::complex<double>, 1>& c,
           std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zherk_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zherk_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -1096,8 +1145,8 @@ void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, float beta,
            sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_cher2k_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cher2k_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -1105,24 +1154,24 @@ void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, double beta,
            sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zher2k_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zher2k_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& b, std::int64_t ldb, float beta, sycl::buffer<float, 1>& c,
           std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_ssymm_sycl(queue, left_right, upper_lower, m, n,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_dsymm_sycl(queue, left_right, upper_lower, m, n,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1130,8 +1179,8 @@ void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_csymm_sycl(queue, left_right, upper_lower, m, n,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_csymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1139,56 +1188,56 @@ void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zsymm_sycl(queue, left_right, upper_lower, m, n,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           float beta, sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_ssyrk_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyrk_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
           std::int64_t lda, double beta, sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_dsyrk_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyrk_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_csyrk_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_csyrk_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zsyrk_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsyrk_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, float beta, sycl::buffer<float, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_ssyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, double beta, sycl::buffer<double, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_dsyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -1196,9 +1245,9 @@ void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lowe
                 sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_csyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_csyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -1206,25 +1255,25 @@ void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lowe
                 sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zsyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
            sycl::buffer<float, 1>& b, std::int64_t ldb, float beta, sycl::buffer<float, 1>& c,
            std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_ssyr2k_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyr2k_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
            std::int64_t lda, sycl::buffer<double, 1>& b, std::int64_t ldb, double beta,
            sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_dsyr2k_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyr2k_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -1232,8 +1281,8 @@ void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_csyr2k_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_csyr2k_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -1241,72 +1290,72 @@ void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zsyr2k_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsyr2k_sycl, queue, upper_lower,
+                  trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& a, std::int64_t lda, sycl::buffer<float, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_strmm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_strmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_dtrmm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_ctrmm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_ztrmm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& a, std::int64_t lda, sycl::buffer<float, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_strsm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_strsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_dtrsm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_ctrsm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_ztrsm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1315,9 +1364,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<float, 1>& b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_sgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemm_batch_strided_sycl, queue,
+                  transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1326,9 +1375,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<double, 1>& b, std::int64_t ldb, std::int64_t stride_b, double beta,
                 sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_dgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemm_batch_strided_sycl, queue,
+                  transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1337,9 +1386,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_cgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemm_batch_strided_sycl, queue,
+                  transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1348,9 +1397,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemm_batch_strided_sycl, queue,
+                  transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1359,9 +1408,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<sycl::half, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 sycl::half beta, sycl::buffer<sycl::half, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_hgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_hgemm_batch_strided_sycl, queue,
+                  transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1370,9 +1419,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<sycl::half, 1>& b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_gemm_f16f16f32_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_f16f16f32_batch_strided_sycl,
+                  queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                  c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1381,9 +1430,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::int8_t, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 float beta, sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_gemm_s8s8f32_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_s8s8f32_batch_strided_sycl,
+                  queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                  c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1392,9 +1441,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::int8_t, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 float beta, sycl::buffer<std::int32_t, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_gemm_s8s8s32_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_s8s8s32_batch_strided_sycl,
+                  queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                  c, ldc, stride_c, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1402,9 +1451,9 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<float, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<float, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_strsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_strsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1412,9 +1461,9 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<double, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<double, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_dtrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1422,9 +1471,9 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<float>, 1>& b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_ctrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -1432,25 +1481,25 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<double>, 1>& b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_ztrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a,
            std::int64_t lda, sycl::buffer<float, 1>& b, std::int64_t ldb, float beta,
            sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_sgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemmt_sycl, queue, upper_lower,
+                  transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, double alpha,
            sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& b,
            std::int64_t ldb, double beta, sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_dgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemmt_sycl, queue, upper_lower,
+                  transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
@@ -1458,8 +1507,8 @@ void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_cgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemmt_sycl, queue, upper_lower,
+                  transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
@@ -1467,8 +1516,8 @@ void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemmt_sycl, queue, upper_lower,
+                  transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1476,8 +1525,9 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<int8_t, 1>& a, std::int64_t lda, int8_t ao, sycl::buffer<uint8_t, 1>& b,
                std::int64_t ldb, uint8_t bo, float beta, sycl::buffer<int32_t, 1>& c,
                std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].column_major_gemm_s8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_s8u8s32_bias_sycl, queue,
+                  transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc,
+                  co);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1485,8 +1535,9 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<int8_t, 1>& a, std::int64_t lda, int8_t ao, sycl::buffer<int8_t, 1>& b,
                std::int64_t ldb, int8_t bo, float beta, sycl::buffer<int32_t, 1>& c,
                std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].column_major_gemm_s8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_s8s8s32_bias_sycl, queue,
+                  transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc,
+                  co);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1494,8 +1545,9 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<uint8_t, 1>& a, std::int64_t lda, uint8_t ao,
                sycl::buffer<int8_t, 1>& b, std::int64_t ldb, int8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].column_major_gemm_u8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_u8s8s32_bias_sycl, queue,
+                  transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc,
+                  co);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1503,24 +1555,25 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<uint8_t, 1>& a, std::int64_t lda, uint8_t ao,
                sycl::buffer<uint8_t, 1>& b, std::int64_t ldb, uint8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].column_major_gemm_u8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_u8u8s32_bias_sycl, queue,
+                  transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc,
+                  co);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& a,
                     std::int64_t lda, std::int64_t stride_a, sycl::buffer<float, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_somatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& a,
                     std::int64_t lda, std::int64_t stride_a, sycl::buffer<double, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_domatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -1528,8 +1581,8 @@ void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<float>, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_comatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -1537,40 +1590,40 @@ void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<double>, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zomatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& ab,
                     std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                     std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_simatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_simatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& ab,
                     std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                     std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_dimatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dimatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, std::complex<float> alpha,
                     sycl::buffer<std::complex<float>, 1>& ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_cimatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cimatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, std::complex<double> alpha,
                     sycl::buffer<std::complex<double>, 1>& ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zimatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zimatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -1579,9 +1632,9 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    sycl::buffer<float, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_somatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -1590,9 +1643,9 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    sycl::buffer<double, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_domatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -1601,9 +1654,9 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& b,
                    std::int64_t ldb, std::int64_t stride_b, sycl::buffer<std::complex<float>, 1>& c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_comatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -1613,113 +1666,113 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb,
                    std::int64_t stride_b, sycl::buffer<std::complex<double>, 1>& c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].column_major_zomatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
               sycl::buffer<float, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_somatcopy_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
               sycl::buffer<double, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_domatcopy_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
               std::int64_t lda, sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_comatcopy_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
               std::int64_t lda, sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_zomatcopy_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
                std::int64_t stridea, sycl::buffer<float, 1>& b, std::int64_t ldb,
                std::int64_t strideb) {
-    function_tables[{ libkey, queue }].column_major_somatcopy2_sycl(queue, trans, m, n, alpha, a,
-                                                                    lda, stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
                std::int64_t stridea, sycl::buffer<double, 1>& b, std::int64_t ldb,
                std::int64_t strideb) {
-    function_tables[{ libkey, queue }].column_major_domatcopy2_sycl(queue, trans, m, n, alpha, a,
-                                                                    lda, stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
                std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<float>, 1>& b,
                std::int64_t ldb, std::int64_t strideb) {
-    function_tables[{ libkey, queue }].column_major_comatcopy2_sycl(queue, trans, m, n, alpha, a,
-                                                                    lda, stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
                std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<double>, 1>& b,
                std::int64_t ldb, std::int64_t strideb) {
-    function_tables[{ libkey, queue }].column_major_zomatcopy2_sycl(queue, trans, m, n, alpha, a,
-                                                                    lda, stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1>& ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_simatcopy_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_simatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1>& ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_dimatcopy_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_dimatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_cimatcopy_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_cimatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].column_major_zimatcopy_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zimatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& a,
              std::int64_t lda, float beta, sycl::buffer<float, 1>& b, std::int64_t ldb,
              sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_somatadd_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatadd_sycl, queue, transa, transb,
+                  m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& a,
              std::int64_t lda, double beta, sycl::buffer<double, 1>& b, std::int64_t ldb,
              sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_domatadd_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatadd_sycl, queue, transa, transb,
+                  m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1727,8 +1780,8 @@ void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
              sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda, std::complex<float> beta,
              sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb,
              sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_comatadd_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatadd_sycl, queue, transa, transb,
+                  m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -1736,8 +1789,8 @@ void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
              sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda, std::complex<double> beta,
              sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb,
              sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].column_major_zomatadd_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatadd_sycl, queue, transa, transb,
+                  m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 // USM APIs
@@ -1745,73 +1798,73 @@ void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, float* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_scasum_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_scasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, double* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dzasum_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dzasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                  std::int64_t incx, float* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sasum_usm_sycl(queue, n, x, incx, result,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                  std::int64_t incx, double* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dasum_usm_sycl(queue, n, x, incx, result,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                  const float* x, std::int64_t incx, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_saxpy_usm_sycl(queue, n, alpha, x, incx,
-                                                                          y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_saxpy_usm_sycl, queue, n,
+                         alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                  const double* x, std::int64_t incx, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_daxpy_usm_sycl(queue, n, alpha, x, incx,
-                                                                          y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_daxpy_usm_sycl, queue, n,
+                         alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_caxpy_usm_sycl(queue, n, alpha, x, incx,
-                                                                          y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_caxpy_usm_sycl, queue, n,
+                         alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zaxpy_usm_sycl(queue, n, alpha, x, incx,
-                                                                          y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zaxpy_usm_sycl, queue, n,
+                         alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        float* alpha, const float** x, std::int64_t* incx, float** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_saxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_saxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        double* alpha, const double** x, std::int64_t* incx, double** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_daxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_daxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
@@ -1819,8 +1872,8 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t* incx, std::complex<float>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_caxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_caxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
@@ -1828,24 +1881,26 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t* incx, std::complex<double>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zaxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zaxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                        const float* x, std::int64_t incx, std::int64_t stridex, float* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_saxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_saxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        double alpha, const double* x, std::int64_t incx, std::int64_t stridex,
                        double* y, std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_daxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_daxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
@@ -1853,8 +1908,9 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t stridex, std::complex<float>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_caxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_caxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
@@ -1862,438 +1918,439 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t stridex, std::complex<double>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zaxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zaxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                   const float* x, std::int64_t incx, const float beta, float* y, std::int64_t incy,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_saxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_saxpby_usm_sycl, queue, n,
+                         alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                   const double* x, std::int64_t incx, const double beta, double* y,
                   std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_daxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_daxpby_usm_sycl, queue, n,
+                         alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                   const std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_caxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_caxpby_usm_sycl, queue, n,
+                         alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                   const std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zaxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zaxpby_usm_sycl, queue, n,
+                         alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                  std::int64_t incx, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_scopy_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_scopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                  std::int64_t incx, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dcopy_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dcopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, std::complex<float>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ccopy_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ccopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, std::complex<double>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zcopy_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zcopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const float** x, std::int64_t* incx, float** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_scopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_scopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const double** x, std::int64_t* incx, double** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dcopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const std::complex<float>** x, std::int64_t* incx, std::complex<float>** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ccopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ccopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const std::complex<double>** x, std::int64_t* incx, std::complex<double>** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zcopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const float* x, std::int64_t incx, std::int64_t stridex, float* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_scopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_scopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const double* x, std::int64_t incx, std::int64_t stridex, double* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dcopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const std::complex<float>* x, std::int64_t incx, std::int64_t stridex,
                        std::complex<float>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ccopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ccopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const std::complex<double>* x, std::int64_t incx, std::int64_t stridex,
                        std::complex<double>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zcopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                 std::int64_t incx, const float* y, std::int64_t incy, float* result,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sdot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                         result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sdot_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                 std::int64_t incx, const double* y, std::int64_t incy, double* result,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ddot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                         result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ddot_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                 std::int64_t incx, const float* y, std::int64_t incy, double* result,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsdot_usm_sycl(
-        queue, n, x, incx, y, incy, result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsdot_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, const std::complex<float>* y,
                  std::int64_t incy, std::complex<float>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cdotc_usm_sycl(
-        queue, n, x, incx, y, incy, result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cdotc_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, const std::complex<double>* y,
                  std::int64_t incy, std::complex<double>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zdotc_usm_sycl(
-        queue, n, x, incx, y, incy, result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdotc_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, const std::complex<float>* y,
                  std::int64_t incy, std::complex<float>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cdotu_usm_sycl(
-        queue, n, x, incx, y, incy, result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cdotu_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, const std::complex<double>* y,
                  std::int64_t incy, std::complex<double>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zdotu_usm_sycl(
-        queue, n, x, incx, y, incy, result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdotu_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_isamin_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_isamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_idamin_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_idamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<float>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_icamin_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_icamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<double>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_izamin_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_izamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_isamax_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_isamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_idamax_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_idamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<float>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_icamax_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_icamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<double>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_izamax_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_izamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, float* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_scnrm2_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_scnrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, double* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dznrm2_usm_sycl(queue, n, x, incx,
-                                                                           result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dznrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                  std::int64_t incx, float* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_snrm2_usm_sycl(queue, n, x, incx, result,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_snrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                  std::int64_t incx, double* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dnrm2_usm_sycl(queue, n, x, incx, result,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dnrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<float>* x, std::int64_t incx, std::complex<float>* y,
                 std::int64_t incy, float c, float s, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_srot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                         c, s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_srot_usm_sycl, queue, n, x,
+                         incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<double>* x, std::int64_t incx, std::complex<double>* y,
                 std::int64_t incy, double c, double s,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_drot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                         c, s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_drot_usm_sycl, queue, n, x,
+                         incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float* x,
                 std::int64_t incx, float* y, std::int64_t incy, float c, float s,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_csrot_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, c, s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_csrot_usm_sycl, queue, n, x,
+                         incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double* x,
                 std::int64_t incx, double* y, std::int64_t incy, double c, double s,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zdrot_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, c, s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdrot_usm_sycl, queue, n, x,
+                         incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, float* a, float* b, float* c,
                  float* s, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_srotg_usm_sycl(queue, a, b, c, s,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_srotg_usm_sycl, queue, a, b,
+                         c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, double* a, double* b, double* c,
                  double* s, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_drotg_usm_sycl(queue, a, b, c, s,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_drotg_usm_sycl, queue, a, b,
+                         c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, std::complex<float>* a,
                  std::complex<float>* b, float* c, std::complex<float>* s,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_crotg_usm_sycl(queue, a, b, c, s,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_crotg_usm_sycl, queue, a, b,
+                         c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, std::complex<double>* a,
                  std::complex<double>* b, double* c, std::complex<double>* s,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zrotg_usm_sycl(queue, a, b, c, s,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zrotg_usm_sycl, queue, a, b,
+                         c, s, dependencies);
 }
 
 sycl::event rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float* x,
                  std::int64_t incx, float* y, std::int64_t incy, float* param,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_srotm_usm_sycl(
-        queue, n, x, incx, y, incy, param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_srotm_usm_sycl, queue, n, x,
+                         incx, y, incy, param, dependencies);
 }
 
 sycl::event rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double* x,
                  std::int64_t incx, double* y, std::int64_t incy, double* param,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_drotm_usm_sycl(
-        queue, n, x, incx, y, incy, param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_drotm_usm_sycl, queue, n, x,
+                         incx, y, incy, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::math::device libkey, sycl::queue& queue, float* d1, float* d2, float* x1,
                   float y1, float* param, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_srotmg_usm_sycl(queue, d1, d2, x1, y1,
-                                                                           param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_srotmg_usm_sycl, queue, d1,
+                         d2, x1, y1, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::math::device libkey, sycl::queue& queue, double* d1, double* d2,
                   double* x1, double y1, double* param,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_drotmg_usm_sycl(queue, d1, d2, x1, y1,
-                                                                           param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_drotmg_usm_sycl, queue, d1,
+                         d2, x1, y1, param, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                  float* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sscal_usm_sycl, queue, n,
+                         alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                  double* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dscal_usm_sycl, queue, n,
+                         alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<float> alpha, std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cscal_usm_sycl, queue, n,
+                         alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<double> alpha, std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_csscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                           dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_csscal_usm_sycl, queue, n,
+                         alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                          dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zscal_usm_sycl, queue, n,
+                         alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zdscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                           dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdscal_usm_sycl, queue, n,
+                         alpha, x, incx, dependencies);
 }
 
 sycl::event sdsdot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float sb,
                    const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                    float* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sdsdot_usm_sycl(
-        queue, n, sb, x, incx, y, incy, result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sdsdot_usm_sycl, queue, n, sb,
+                         x, incx, y, incy, result, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float* x,
                  std::int64_t incx, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sswap_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double* x,
                  std::int64_t incx, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dswap_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<float>* x, std::int64_t incx, std::complex<float>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cswap_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<double>* x, std::int64_t incx, std::complex<double>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zswap_usm_sycl(queue, n, x, incx, y,
-                                                                          incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, const float* a,
                  std::int64_t lda, const float* x, std::int64_t incx, float beta, float* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgbmv_usm_sycl, queue, trans,
+                         m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha, const double* a,
                  std::int64_t lda, const double* x, std::int64_t incx, double beta, double* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgbmv_usm_sycl, queue, trans,
+                         m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -2301,8 +2358,8 @@ sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<float>* a, std::int64_t lda, const std::complex<float>* x,
                  std::int64_t incx, std::complex<float> beta, std::complex<float>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgbmv_usm_sycl, queue, trans,
+                         m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -2310,24 +2367,24 @@ sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<double>* a, std::int64_t lda, const std::complex<double>* x,
                  std::int64_t incx, std::complex<double> beta, std::complex<double>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgbmv_usm_sycl, queue, trans,
+                         m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, float alpha, const float* a, std::int64_t lda, const float* x,
                  std::int64_t incx, float beta, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemv_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, double alpha, const double* a, std::int64_t lda, const double* x,
                  std::int64_t incx, double beta, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemv_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -2335,8 +2392,8 @@ sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  std::int64_t lda, const std::complex<float>* x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemv_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -2344,8 +2401,8 @@ sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  std::int64_t lda, const std::complex<double>* x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemv_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -2354,9 +2411,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stridex, float beta, float* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -2365,9 +2422,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stridex, double beta, double* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -2377,9 +2434,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -2389,9 +2446,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -2399,9 +2456,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* lda, const float** x, std::int64_t* incx, float* beta,
                        float** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -2409,9 +2466,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* lda, const double** x, std::int64_t* incx, double* beta,
                        double** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -2420,9 +2477,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::complex<float>** x, std::int64_t* incx, std::complex<float>* beta,
                        std::complex<float>** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -2432,9 +2489,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<double>* beta, std::complex<double>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -2442,9 +2499,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t stridea, const float* x, std::int64_t incx,
                        std::int64_t stridex, float* c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sdgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -2452,9 +2509,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t stridea, const double* x, std::int64_t incx,
                        std::int64_t stridex, double* c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ddgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ddgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -2463,9 +2520,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t incx, std::int64_t stridex, std::complex<float>* c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cdgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -2474,9 +2531,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t incx, std::int64_t stridex, std::complex<double>* c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -2484,8 +2541,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        const float** x, std::int64_t* incx, float** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sdgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -2493,8 +2551,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        const double** x, std::int64_t* incx, double** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ddgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ddgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -2502,8 +2561,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, const std::complex<float>** x, std::int64_t* incx,
                        std::complex<float>** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cdgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -2511,55 +2571,56 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, const std::complex<double>** x, std::int64_t* incx,
                        std::complex<double>** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zdgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                 float alpha, const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                 float* a, std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sger_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sger_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                 double alpha, const double* x, std::int64_t incx, const double* y,
                 std::int64_t incy, double* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dger_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dger_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgerc_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgerc_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgerc_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgerc_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgeru_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgeru_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgeru_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgeru_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -2567,8 +2628,8 @@ sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  std::int64_t lda, const std::complex<float>* x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_chbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_chbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -2576,8 +2637,8 @@ sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  std::int64_t lda, const std::complex<double>* x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zhbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -2585,8 +2646,8 @@ sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<float>* x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_chemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_chemv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -2594,40 +2655,40 @@ sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<double>* x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zhemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhemv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float>* x, std::int64_t incx,
                 std::complex<float>* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cher_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cher_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double>* x, std::int64_t incx,
                 std::complex<double>* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zher_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zher_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cher2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cher2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zher2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zher2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -2635,8 +2696,8 @@ sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<float>* x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_chpmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_chpmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -2644,337 +2705,337 @@ sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<double>* x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zhpmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhpmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float>* x, std::int64_t incx,
                 std::complex<float>* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_chpr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_chpr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double>* x, std::int64_t incx,
                 std::complex<double>* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zhpr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhpr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_chpr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_chpr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zhpr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhpr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, float alpha, const float* a, std::int64_t lda, const float* x,
                  std::int64_t incx, float beta, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, double alpha, const double* a, std::int64_t lda, const double* x,
                  std::int64_t incx, double beta, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* a, const float* x, std::int64_t incx, float beta,
                  float* y, std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sspmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sspmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* a, const double* x, std::int64_t incx, double beta,
                  double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dspmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dspmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float* x, std::int64_t incx, float* a,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sspr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sspr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double* x, std::int64_t incx, double* a,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dspr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dspr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                  float* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sspr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sspr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* x, std::int64_t incx, const double* y,
                  std::int64_t incy, double* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dspr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dspr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* a, std::int64_t lda, const float* x, std::int64_t incx,
                  float beta, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssymv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* a, std::int64_t lda, const double* x,
                  std::int64_t incx, double beta, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsymv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float* x, std::int64_t incx, float* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssyr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double* x, std::int64_t incx, double* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsyr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                  float* a, std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssyr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* x, std::int64_t incx, const double* y,
                  std::int64_t incy, double* a, std::int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsyr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float* a, std::int64_t lda,
                  float* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_stbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_stbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double* a, std::int64_t lda,
                  double* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float>* a,
                  std::int64_t lda, std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double>* a,
                  std::int64_t lda, std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float* a, std::int64_t lda,
                  float* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_stbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_stbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double* a, std::int64_t lda,
                  double* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float>* a,
                  std::int64_t lda, std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double>* a,
                  std::int64_t lda, std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, float* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_stpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_stpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, double* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, float* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_stpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_stpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, double* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, std::int64_t lda, float* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_strmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_strmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, std::int64_t lda, double* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtrmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctrmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztrmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, std::int64_t lda, float* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_strsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_strsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, std::int64_t lda, double* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtrsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctrsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztrsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                  transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
                  const float* a, std::int64_t lda, const float* b, std::int64_t ldb, float beta,
                  float* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                  transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
                  const double* a, std::int64_t lda, const double* b, std::int64_t ldb, double beta,
                  double* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -2983,8 +3044,8 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<float>* b, std::int64_t ldb, std::complex<float> beta,
                  std::complex<float>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -2993,8 +3054,8 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<double>* b, std::int64_t ldb, std::complex<double> beta,
                  std::complex<double>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3002,8 +3063,8 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const sycl::half* a, std::int64_t lda, const sycl::half* b, std::int64_t ldb,
                  sycl::half beta, sycl::half* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_hgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_hgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3011,8 +3072,9 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const sycl::half* a, std::int64_t lda, const sycl::half* b, std::int64_t ldb,
                  float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_f16f16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_f16f16f32_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3020,8 +3082,9 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const bfloat16* a, std::int64_t lda, const bfloat16* b, std::int64_t ldb,
                  float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_bf16bf16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_bf16bf16f32_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3029,8 +3092,9 @@ sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_chemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_chemm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3038,24 +3102,25 @@ sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zhemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zhemm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const std::complex<float>* a,
                  std::int64_t lda, float beta, std::complex<float>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cherk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const std::complex<double>* a,
                  std::int64_t lda, double beta, std::complex<double>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zherk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3063,8 +3128,9 @@ sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                   std::int64_t ldb, float beta, std::complex<float>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cher2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3072,24 +3138,27 @@ sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                   std::int64_t ldb, double beta, std::complex<double>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zher2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, float alpha, const float* a, std::int64_t lda,
                  const float* b, std::int64_t ldb, float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, double alpha, const double* a, std::int64_t lda,
                  const double* b, std::int64_t ldb, double beta, double* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3097,8 +3166,9 @@ sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_csymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_csymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3106,24 +3176,25 @@ sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const float* a, std::int64_t lda,
                  float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const double* a, std::int64_t lda,
                  double beta, double* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -3131,8 +3202,8 @@ sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<float>* a, std::int64_t lda, std::complex<float> beta,
                  std::complex<float>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_csyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_csyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -3140,8 +3211,8 @@ sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<double>* a, std::int64_t lda, std::complex<double> beta,
                  std::complex<double>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -3149,9 +3220,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        const float** a, std::int64_t* lda, float* beta, float** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -3159,9 +3230,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        const double** a, std::int64_t* lda, double* beta, double** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -3170,9 +3241,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        std::complex<float>* beta, std::complex<float>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_csyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_csyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -3181,9 +3252,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        std::int64_t* lda, std::complex<double>* beta, std::complex<double>** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3191,9 +3262,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        std::int64_t lda, std::int64_t stride_a, float beta, float* c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3201,9 +3272,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        const double* a, std::int64_t lda, std::int64_t stride_a, double beta,
                        double* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3212,9 +3283,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        std::complex<float> beta, std::complex<float>* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_csyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_csyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3223,25 +3294,27 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        std::complex<double> beta, std::complex<double>* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose trans, std::int64_t n, std::int64_t k, float alpha, const float* a,
                   std::int64_t lda, const float* b, std::int64_t ldb, float beta, float* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ssyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ssyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose trans, std::int64_t n, std::int64_t k, double alpha, const double* a,
                   std::int64_t lda, const double* b, std::int64_t ldb, double beta, double* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dsyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3249,8 +3322,9 @@ sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                   std::int64_t ldb, std::complex<float> beta, std::complex<float>* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_csyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_csyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3258,26 +3332,27 @@ sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                   std::int64_t ldb, std::complex<double> beta, std::complex<double>* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zsyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float* a, std::int64_t lda, float* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_strmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_strmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double* a, std::int64_t lda, double* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtrmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3285,9 +3360,9 @@ sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<float> alpha, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctrmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3295,27 +3370,27 @@ sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<double> alpha, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztrmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float* a, std::int64_t lda, float* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_strsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_strsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double* a, std::int64_t lda, double* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtrsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3323,9 +3398,9 @@ sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<float> alpha, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctrsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -3333,9 +3408,9 @@ sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<double> alpha, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztrsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -3343,9 +3418,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t n, float alpha, const float* a, std::int64_t lda,
                        std::int64_t stride_a, float* b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_strsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_strsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -3353,9 +3428,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t n, double alpha, const double* a, std::int64_t lda,
                        std::int64_t stride_a, double* b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -3364,9 +3439,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t lda, std::int64_t stride_a, std::complex<float>* b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -3375,9 +3450,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t lda, std::int64_t stride_a, std::complex<double>* b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -3385,9 +3460,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* n, float* alpha, const float** a, std::int64_t* lda, float** b,
                        std::int64_t* ldb, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_strsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_strsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -3395,9 +3470,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* n, double* alpha, const double** a, std::int64_t* lda,
                        double** b, std::int64_t* ldb, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dtrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dtrsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -3406,9 +3481,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, std::complex<float>** b, std::int64_t* ldb,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ctrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ctrsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -3417,9 +3492,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, std::complex<double>** b, std::int64_t* ldb,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_ztrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_ztrsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3428,9 +3503,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* ldb, float* beta, float** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3439,9 +3514,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* ldb, double* beta, double** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3450,9 +3525,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::complex<float>** b, std::int64_t* ldb, std::complex<float>* beta,
                        std::complex<float>** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3462,9 +3537,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<double>* beta, std::complex<double>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3473,9 +3548,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const sycl::half** b, std::int64_t* ldb, sycl::half* beta, sycl::half** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_hgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_hgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3484,9 +3559,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* ldb, float* beta, float** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_f16f16f32_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_gemm_f16f16f32_batch_group_usm_sycl, queue, transa, transb, m,
+                         n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3495,9 +3571,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t** b, std::int64_t* ldb, float* beta, float** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_s8s8f32_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_gemm_s8s8f32_batch_group_usm_sycl, queue, transa, transb, m,
+                         n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -3506,9 +3583,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t** b, std::int64_t* ldb, float* beta, std::int32_t** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_s8s8s32_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_gemm_s8s8s32_batch_group_usm_sycl, queue, transa, transb, m,
+                         n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3517,9 +3595,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const float* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3528,9 +3606,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const double* b, std::int64_t ldb, std::int64_t stride_b, double beta,
                        double* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3540,9 +3618,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stride_b, std::complex<float> beta, std::complex<float>* c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3552,9 +3630,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stride_b, std::complex<double> beta, std::complex<double>* c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3564,9 +3642,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stride_b, sycl::half beta, sycl::half* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_hgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_hgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3575,9 +3653,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const sycl::half* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_f16f16f32_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_gemm_f16f16f32_batch_strided_usm_sycl, queue, transa, transb,
+                         m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3586,9 +3665,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_s8s8f32_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_gemm_s8s8f32_batch_strided_usm_sycl, queue, transa, transb, m,
+                         n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3597,27 +3677,28 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        std::int32_t* c, std::int64_t ldc, std::int64_t stride_c,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_s8s8s32_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_gemm_s8s8s32_batch_strided_usm_sycl, queue, transa, transb, m,
+                         n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, float alpha,
                   const float* a, std::int64_t lda, const float* b, std::int64_t ldb, float beta,
                   float* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_sgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_sgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, double alpha,
                   const double* a, std::int64_t lda, const double* b, std::int64_t ldb, double beta,
                   double* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3626,9 +3707,9 @@ sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<float>* b, std::int64_t ldb, std::complex<float> beta,
                   std::complex<float>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -3637,9 +3718,9 @@ sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<double>* b, std::int64_t ldb, std::complex<double> beta,
                   std::complex<double>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3648,9 +3729,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::int8_t ao, const std::uint8_t* b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_s8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_s8u8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3659,9 +3740,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::int8_t ao, const std::int8_t* b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_s8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_s8s8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3670,9 +3751,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::uint8_t ao, const std::int8_t* b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_u8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_u8s8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3681,9 +3762,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::uint8_t ao, const std::uint8_t* b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_gemm_u8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_gemm_u8u8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3691,8 +3772,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t lda, std::int64_t stride_a, float* b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_somatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_somatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3700,8 +3782,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t lda, std::int64_t stride_a, double* b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_domatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_domatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3709,8 +3792,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<float>* a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<float>* b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_comatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_comatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3718,24 +3802,27 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<double>* a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<double>* b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zomatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_zomatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                            std::int64_t m, std::int64_t n, float alpha, float* ab, std::int64_t lda,
                            std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_simatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_simatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                            std::int64_t m, std::int64_t n, double alpha, double* ab,
                            std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                            std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_dimatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3743,8 +3830,9 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<float>* ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_cimatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3752,8 +3840,9 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<double>* ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_zimatcopy_batch_strided_usm_sycl, queue, trans, m, n, alpha,
+                         ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3762,9 +3851,10 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const float* b, std::int64_t ldb, std::int64_t stride_b, float* c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_somatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_somatadd_batch_strided_usm_sycl, queue, transa, transb, m, n,
+                         alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3773,9 +3863,10 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const double* b, std::int64_t ldb, std::int64_t stride_b, double* c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_domatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_domatadd_batch_strided_usm_sycl, queue, transa, transb, m, n,
+                         alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3785,9 +3876,10 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const std::complex<float>* b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<float>* c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_comatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_comatadd_batch_strided_usm_sycl, queue, transa, transb, m, n,
+                         alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3797,56 +3889,57 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const std::complex<double>* b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<double>* c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zomatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_zomatadd_batch_strided_usm_sycl, queue, transa, transb, m, n,
+                         alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, const float* a, std::int64_t lda,
                      float* b, std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_somatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, const double* a,
                      std::int64_t lda, double* b, std::int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_domatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      const std::complex<float>* a, std::int64_t lda, std::complex<float>* b,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_comatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      const std::complex<double>* a, std::int64_t lda, std::complex<double>* b,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zomatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                       std::int64_t m, std::int64_t n, float alpha, const float* a, std::int64_t lda,
                       std::int64_t stridea, float* b, std::int64_t ldb, std::int64_t strideb,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_somatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                       std::int64_t m, std::int64_t n, double alpha, const double* a,
                       std::int64_t lda, std::int64_t stridea, double* b, std::int64_t ldb,
                       std::int64_t strideb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_domatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3854,8 +3947,8 @@ sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose
                       const std::complex<float>* a, std::int64_t lda, std::int64_t stridea,
                       std::complex<float>* b, std::int64_t ldb, std::int64_t strideb,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_comatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -3863,54 +3956,54 @@ sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose
                       const std::complex<double>* a, std::int64_t lda, std::int64_t stridea,
                       std::complex<double>* b, std::int64_t ldb, std::int64_t strideb,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zomatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, float* ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_simatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_simatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, double* ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dimatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_dimatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      std::complex<float>* ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cimatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_cimatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      std::complex<double>* ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zimatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zimatcopy_usm_sycl, queue,
+                         trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, float alpha, const float* a,
                     std::int64_t lda, float beta, const float* b, std::int64_t ldb, float* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_somatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_somatadd_usm_sycl, queue,
+                         transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, double alpha, const double* a,
                     std::int64_t lda, double beta, const double* b, std::int64_t ldb, double* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_domatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_domatadd_usm_sycl, queue,
+                         transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3918,8 +4011,8 @@ sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     const std::complex<float>* a, std::int64_t lda, std::complex<float> beta,
                     const std::complex<float>* b, std::int64_t ldb, std::complex<float>* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_comatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_comatadd_usm_sycl, queue,
+                         transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -3927,8 +4020,8 @@ sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     const std::complex<double>* a, std::int64_t lda, std::complex<double> beta,
                     const std::complex<double>* b, std::int64_t ldb, std::complex<double>* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zomatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, column_major_zomatadd_usm_sycl, queue,
+                         transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -3936,8 +4029,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t* lda, float** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_somatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_somatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, a,
+                         lda, b, ldb, group_count, groupsize, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -3945,8 +4039,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t* lda, double** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_domatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_domatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, a,
+                         lda, b, ldb, group_count, groupsize, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -3954,8 +4049,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<float>** a, std::int64_t* lda,
                            std::complex<float>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_comatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_comatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, a,
+                         lda, b, ldb, group_count, groupsize, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -3963,24 +4059,27 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<double>** a, std::int64_t* lda,
                            std::complex<double>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zomatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_zomatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, a,
+                         lda, b, ldb, group_count, groupsize, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, float* alpha, float** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_simatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_simatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, ab,
+                         lda, ldb, group_count, groupsize, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, double* alpha, double** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_dimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_dimatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, ab,
+                         lda, ldb, group_count, groupsize, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -3988,8 +4087,9 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<float>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_cimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_cimatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, ab,
+                         lda, ldb, group_count, groupsize, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -3997,8 +4097,9 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<double>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].column_major_zimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         column_major_zimatcopy_batch_group_usm_sycl, queue, trans, m, n, alpha, ab,
+                         lda, ldb, group_count, groupsize, dependencies);
 }
 
 } //namespace detail
@@ -4013,421 +4114,440 @@ static oneapi::math::detail::table_initializer<domain::blas, blas_function_table
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_scasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_scasum_sycl, queue, n, x, incx, result);
 }
 
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_dzasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dzasum_sycl, queue, n, x, incx, result);
 }
 
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_sasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sasum_sycl, queue, n, x, incx, result);
 }
 
 void asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_dasum_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dasum_sycl, queue, n, x, incx, result);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_saxpy_sycl, queue, n, alpha, x, incx, y,
+                  incy);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_daxpy_sycl, queue, n, alpha, x, incx, y,
+                  incy);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_caxpy_sycl, queue, n, alpha, x, incx, y,
+                  incy);
 }
 
 void axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zaxpy_sycl, queue, n, alpha, x, incx, y,
+                  incy);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_saxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_saxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_daxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_daxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<float>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_caxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_caxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<double>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zaxpy_batch_strided_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zaxpy_batch_strided_sycl, queue, n,
+                  alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
            sycl::buffer<float, 1>& x, std::int64_t incx, float beta, sycl::buffer<float, 1>& y,
            std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_saxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_saxpby_sycl, queue, n, alpha, x, incx,
+                  beta, y, incy);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
            sycl::buffer<double, 1>& x, std::int64_t incx, double beta, sycl::buffer<double, 1>& y,
            std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_daxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_daxpby_sycl, queue, n, alpha, x, incx,
+                  beta, y, incy);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
            std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_caxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_caxpby_sycl, queue, n, alpha, x, incx,
+                  beta, y, incy);
 }
 
 void axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
            std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zaxpby_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zaxpby_sycl, queue, n, alpha, x, incx,
+                  beta, y, incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_scopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_scopy_sycl, queue, n, x, incx, y, incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_dcopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dcopy_sycl, queue, n, x, incx, y, incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_ccopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ccopy_sycl, queue, n, x, incx, y, incy);
 }
 
 void copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zcopy_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zcopy_sycl, queue, n, x, incx, y, incy);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_scopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_scopy_batch_strided_sycl, queue, n, x,
+                  incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_dcopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dcopy_batch_strided_sycl, queue, n, x,
+                  incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_ccopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ccopy_batch_strided_sycl, queue, n, x,
+                  incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zcopy_batch_strided_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zcopy_batch_strided_sycl, queue, n, x,
+                  incx, stridex, y, incy, stridey, batch_size);
 }
 
 void dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x,
          std::int64_t incx, sycl::buffer<float, 1>& y, std::int64_t incy,
          sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_sdot_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sdot_sycl, queue, n, x, incx, y, incy,
+                  result);
 }
 
 void dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
          std::int64_t incy, sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_ddot_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ddot_sycl, queue, n, x, incx, y, incy,
+                  result);
 }
 
 void dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x,
          std::int64_t incx, sycl::buffer<float, 1>& y, std::int64_t incy,
          sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_dsdot_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsdot_sycl, queue, n, x, incx, y, incy,
+                  result);
 }
 
 void dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_cdotc_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cdotc_sycl, queue, n, x, incx, y, incy,
+                  result);
 }
 
 void dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_zdotc_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdotc_sycl, queue, n, x, incx, y, incy,
+                  result);
 }
 
 void dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_cdotu_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cdotu_sycl, queue, n, x, incx, y, incy,
+                  result);
 }
 
 void dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_zdotu_sycl(queue, n, x, incx, y, incy, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdotu_sycl, queue, n, x, incx, y, incy,
+                  result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_isamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_isamin_sycl, queue, n, x, incx, result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_idamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_idamin_sycl, queue, n, x, incx, result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_icamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_icamin_sycl, queue, n, x, incx, result);
 }
 
 void iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_izamin_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_izamin_sycl, queue, n, x, incx, result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_isamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_isamax_sycl, queue, n, x, incx, result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_idamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_idamax_sycl, queue, n, x, incx, result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_icamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_icamax_sycl, queue, n, x, incx, result);
 }
 
 void iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_izamax_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_izamax_sycl, queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_scnrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_scnrm2_sycl, queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_dznrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dznrm2_sycl, queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_snrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_snrm2_sycl, queue, n, x, incx, result);
 }
 
 void nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_dnrm2_sycl(queue, n, x, incx, result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dnrm2_sycl, queue, n, x, incx, result);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, float c, float s) {
-    function_tables[{ libkey, queue }].row_major_srot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_srot_sycl, queue, n, x, incx, y, incy,
+                  c, s);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy, double c, double s) {
-    function_tables[{ libkey, queue }].row_major_drot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_drot_sycl, queue, n, x, incx, y, incy,
+                  c, s);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& x,
          std::int64_t incx, sycl::buffer<float, 1>& y, std::int64_t incy, float c, float s) {
-    function_tables[{ libkey, queue }].row_major_csrot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_csrot_sycl, queue, n, x, incx, y, incy,
+                  c, s);
 }
 
 void rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
          sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
          std::int64_t incy, double c, double s) {
-    function_tables[{ libkey, queue }].row_major_zdrot_sycl(queue, n, x, incx, y, incy, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdrot_sycl, queue, n, x, incx, y, incy,
+                  c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<float, 1>& a,
           sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& c, sycl::buffer<float, 1>& s) {
-    function_tables[{ libkey, queue }].row_major_srotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_srotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<double, 1>& a,
           sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& c, sycl::buffer<double, 1>& s) {
-    function_tables[{ libkey, queue }].row_major_drotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_drotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& b, sycl::buffer<float, 1>& c,
           sycl::buffer<std::complex<float>, 1>& s) {
-    function_tables[{ libkey, queue }].row_major_crotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_crotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& b, sycl::buffer<double, 1>& c,
           sycl::buffer<std::complex<double>, 1>& s) {
-    function_tables[{ libkey, queue }].row_major_zrotg_sycl(queue, a, b, c, s);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zrotg_sycl, queue, a, b, c, s);
 }
 
 void rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy, sycl::buffer<float, 1>& param) {
-    function_tables[{ libkey, queue }].row_major_srotm_sycl(queue, n, x, incx, y, incy, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_srotm_sycl, queue, n, x, incx, y, incy,
+                  param);
 }
 
 void rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy, sycl::buffer<double, 1>& param) {
-    function_tables[{ libkey, queue }].row_major_drotm_sycl(queue, n, x, incx, y, incy, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_drotm_sycl, queue, n, x, incx, y, incy,
+                  param);
 }
 
 void rotmg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<float, 1>& d1,
            sycl::buffer<float, 1>& d2, sycl::buffer<float, 1>& x1, float y1,
            sycl::buffer<float, 1>& param) {
-    function_tables[{ libkey, queue }].row_major_srotmg_sycl(queue, d1, d2, x1, y1, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_srotmg_sycl, queue, d1, d2, x1, y1,
+                  param);
 }
 
 void rotmg(oneapi::math::device libkey, sycl::queue& queue, sycl::buffer<double, 1>& d1,
            sycl::buffer<double, 1>& d2, sycl::buffer<double, 1>& x1, double y1,
            sycl::buffer<double, 1>& param) {
-    function_tables[{ libkey, queue }].row_major_drotmg_sycl(queue, d1, d2, x1, y1, param);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_drotmg_sycl, queue, d1, d2, x1, y1,
+                  param);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_sscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sscal_sycl, queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_dscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dscal_sycl, queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_cscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cscal_sycl, queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_csscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_csscal_sycl, queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_zscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zscal_sycl, queue, n, alpha, x, incx);
 }
 
 void scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_zdscal_sycl(queue, n, alpha, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdscal_sycl, queue, n, alpha, x, incx);
 }
 
 void sdsdot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float sb,
             sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
             std::int64_t incy, sycl::buffer<float, 1>& result) {
-    function_tables[{ libkey, queue }].row_major_sdsdot_sycl(queue, n, sb, x, incx, y, incy,
-                                                             result);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sdsdot_sycl, queue, n, sb, x, incx, y,
+                  incy, result);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_sswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sswap_sycl, queue, n, x, incx, y, incy);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_dswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dswap_sycl, queue, n, x, incx, y, incy);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_cswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cswap_sycl, queue, n, x, incx, y, incy);
 }
 
 void swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zswap_sycl(queue, n, x, incx, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zswap_sycl, queue, n, x, incx, y, incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& x, std::int64_t incx, float beta,
           sycl::buffer<float, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_sgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                            lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgbmv_sycl, queue, trans, m, n, kl, ku,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
           sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& x,
           std::int64_t incx, double beta, sycl::buffer<double, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_dgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                            lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgbmv_sycl, queue, trans, m, n, kl, ku,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -4435,8 +4555,8 @@ void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std:
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_cgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                            lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgbmv_sycl, queue, trans, m, n, kl, ku,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -4444,40 +4564,40 @@ void gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std:
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a,
-                                                            lda, x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgbmv_sycl, queue, trans, m, n, kl, ku,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx, float beta, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_sgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemv_sycl, queue, trans, m, n, alpha,
+                  a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx, double beta, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_dgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemv_sycl, queue, trans, m, n, alpha,
+                  a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_cgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemv_sycl, queue, trans, m, n, alpha,
+                  a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zgemv_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemv_sycl, queue, trans, m, n, alpha,
+                  a, lda, x, incx, beta, y, incy);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -4485,9 +4605,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 std::int64_t stridea, sycl::buffer<float, 1>& x, std::int64_t incx,
                 std::int64_t stridex, float beta, sycl::buffer<float, 1>& y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_sgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemv_batch_strided_sycl, queue, trans,
+                  m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -4495,9 +4615,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 std::int64_t stridea, sycl::buffer<double, 1>& x, std::int64_t incx,
                 std::int64_t stridex, double beta, sycl::buffer<double, 1>& y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_dgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemv_batch_strided_sycl, queue, trans,
+                  m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -4506,9 +4626,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 std::int64_t incx, std::int64_t stridex, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_cgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemv_batch_strided_sycl, queue, trans,
+                  m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -4517,9 +4637,9 @@ void gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::int64_t stridex,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zgemv_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemv_batch_strided_sycl, queue, trans,
+                  m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
+                  batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -4527,8 +4647,8 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<float, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_sdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sdgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -4536,8 +4656,8 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<double, 1>& x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_ddgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ddgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -4545,8 +4665,8 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::int64_t stridea, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_cdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cdgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, std::int64_t m,
@@ -4554,444 +4674,444 @@ void dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::int64_t stridea, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdgmm_batch_strided_sycl, queue,
+                  left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
 }
 
 void ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
          float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
          std::int64_t incy, sycl::buffer<float, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_sger_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                           lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sger_sycl, queue, m, n, alpha, x, incx,
+                  y, incy, a, lda);
 }
 
 void ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
          double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
          std::int64_t incy, sycl::buffer<double, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_dger_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                           lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dger_sycl, queue, m, n, alpha, x, incx,
+                  y, incy, a, lda);
 }
 
 void gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_cgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgerc_sycl, queue, m, n, alpha, x, incx,
+                  y, incy, a, lda);
 }
 
 void gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_zgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgerc_sycl, queue, m, n, alpha, x, incx,
+                  y, incy, a, lda);
 }
 
 void geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_cgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgeru_sycl, queue, m, n, alpha, x, incx,
+                  y, incy, a, lda);
 }
 
 void geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_zgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgeru_sycl, queue, m, n, alpha, x, incx,
+                  y, incy, a, lda);
 }
 
 void hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_chbmv_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_chbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zhbmv_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_chemv_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_chemv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zhemv_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhemv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_cher_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cher_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a, lda);
 }
 
 void her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_zher_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zher_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a, lda);
 }
 
 void her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_cher2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cher2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_zher2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zher2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_chpmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_chpmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_zhpmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhpmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_chpr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                           a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_chpr_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a);
 }
 
 void hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_zhpr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                           a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhpr_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a);
 }
 
 void hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_chpr2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_chpr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_zhpr2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhpr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx, float beta, sycl::buffer<float, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_ssbmv_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx, double beta, sycl::buffer<double, 1>& y,
           std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_dsbmv_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsbmv_sycl, queue, upper_lower, n, k,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& x, std::int64_t incx,
           float beta, sycl::buffer<float, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_sspmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sspmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& x, std::int64_t incx,
           double beta, sycl::buffer<double, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_dspmv_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dspmv_sycl, queue, upper_lower, n,
+                  alpha, a, x, incx, beta, y, incy);
 }
 
 void spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_sspr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                           a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sspr_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a);
 }
 
 void spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_dspr_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                           a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dspr_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a);
 }
 
 void spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy, sycl::buffer<float, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_sspr2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sspr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy, sycl::buffer<double, 1>& a) {
-    function_tables[{ libkey, queue }].row_major_dspr2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dspr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a);
 }
 
 void symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& a, std::int64_t lda, sycl::buffer<float, 1>& x,
           std::int64_t incx, float beta, sycl::buffer<float, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_ssymv_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssymv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& x,
           std::int64_t incx, double beta, sycl::buffer<double, 1>& y, std::int64_t incy) {
-    function_tables[{ libkey, queue }].row_major_dsymv_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsymv_sycl, queue, upper_lower, n,
+                  alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& a,
          std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_ssyr_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyr_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a, lda);
 }
 
 void syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& a,
          std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_dsyr_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyr_sycl, queue, upper_lower, n, alpha,
+                  x, incx, a, lda);
 }
 
 void syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1>& x, std::int64_t incx, sycl::buffer<float, 1>& y,
           std::int64_t incy, sycl::buffer<float, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_ssyr2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1>& x, std::int64_t incx, sycl::buffer<double, 1>& y,
           std::int64_t incy, sycl::buffer<double, 1>& a, std::int64_t lda) {
-    function_tables[{ libkey, queue }].row_major_dsyr2_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyr2_sycl, queue, upper_lower, n,
+                  alpha, x, incx, y, incy, a, lda);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_stbmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_stbmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_dtbmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtbmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ctbmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctbmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ztbmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztbmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_stbsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_stbsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_dtbsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtbsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ctbsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctbsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ztbsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztbsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, k, a, lda, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_stpmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_stpmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_dtpmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtpmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ctpmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctpmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ztpmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztpmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_stpsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_stpsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& x,
           std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_dtpsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtpsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ctpsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctpsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ztpsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztpsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_strmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_strmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_dtrmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ctrmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ztrmv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrmv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_strsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_strsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t lda,
           sycl::buffer<double, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_dtrsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ctrsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1>& x, std::int64_t incx) {
-    function_tables[{ libkey, queue }].row_major_ztrsv_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrsv_sycl, queue, upper_lower, trans,
+                  unit_diag, n, a, lda, x, incx);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a,
           std::int64_t lda, sycl::buffer<float, 1>& b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_sgemm_sycl(queue, transa, transb, m, n, k, alpha,
-                                                            a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemm_sycl, queue, transa, transb, m, n,
+                  k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_dgemm_sycl(queue, transa, transb, m, n, k, alpha,
-                                                            a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemm_sycl, queue, transa, transb, m, n,
+                  k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -4999,8 +5119,8 @@ void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, tra
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_cgemm_sycl(queue, transa, transb, m, n, k, alpha,
-                                                            a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemm_sycl, queue, transa, transb, m, n,
+                  k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5008,32 +5128,32 @@ void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, tra
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zgemm_sycl(queue, transa, transb, m, n, k, alpha,
-                                                            a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemm_sycl, queue, transa, transb, m, n,
+                  k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, sycl::half alpha,
           sycl::buffer<sycl::half, 1>& a, std::int64_t lda, sycl::buffer<sycl::half, 1>& b,
           std::int64_t ldb, sycl::half beta, sycl::buffer<sycl::half, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_hgemm_sycl(queue, transa, transb, m, n, k, alpha,
-                                                            a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_hgemm_sycl, queue, transa, transb, m, n,
+                  k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
           sycl::buffer<sycl::half, 1>& a, std::int64_t lda, sycl::buffer<sycl::half, 1>& b,
           std::int64_t ldb, float beta, sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_gemm_f16f16f32_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_f16f16f32_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<bfloat16, 1>& a,
           std::int64_t lda, sycl::buffer<bfloat16, 1>& b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_gemm_bf16bf16f32_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_bf16bf16f32_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5041,8 +5161,8 @@ void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_chemm_sycl(queue, left_right, upper_lower, m, n,
-                                                            alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_chemm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5050,23 +5170,23 @@ void hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zhemm_sycl(queue, left_right, upper_lower, m, n,
-                                                            alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhemm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<std::complex<float>, 1>& a,
           std::int64_t lda, float beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_cherk_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cherk_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<std::complex<double>, 1>& a,
           std::int64_t lda, double beta, sycl::buffer<std::complex<double>, 1>& c,
           std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zherk_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zherk_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -5074,8 +5194,8 @@ void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, float beta,
            sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_cher2k_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cher2k_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -5083,24 +5203,24 @@ void her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, double beta,
            sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zher2k_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zher2k_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           sycl::buffer<float, 1>& b, std::int64_t ldb, float beta, sycl::buffer<float, 1>& c,
           std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_ssymm_sycl(queue, left_right, upper_lower, m, n,
-                                                            alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& a,
           std::int64_t lda, sycl::buffer<double, 1>& b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_dsymm_sycl(queue, left_right, upper_lower, m, n,
-                                                            alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5108,8 +5228,8 @@ void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_csymm_sycl(queue, left_right, upper_lower, m, n,
-                                                            alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_csymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5117,56 +5237,56 @@ void symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zsymm_sycl(queue, left_right, upper_lower, m, n,
-                                                            alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsymm_sycl, queue, left_right,
+                  upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
           float beta, sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_ssyrk_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyrk_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
           std::int64_t lda, double beta, sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_dsyrk_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyrk_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_csyrk_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_csyrk_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zsyrk_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsyrk_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, float beta, sycl::buffer<float, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_ssyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, double beta, sycl::buffer<double, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_dsyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -5174,9 +5294,9 @@ void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lowe
                 sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_csyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_csyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -5184,25 +5304,25 @@ void syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lowe
                 sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zsyrk_batch_strided_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsyrk_batch_strided_sycl, queue,
+                  upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                  batch_size);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
            sycl::buffer<float, 1>& b, std::int64_t ldb, float beta, sycl::buffer<float, 1>& c,
            std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_ssyr2k_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyr2k_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1>& a,
            std::int64_t lda, sycl::buffer<double, 1>& b, std::int64_t ldb, double beta,
            sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_dsyr2k_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyr2k_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -5210,8 +5330,8 @@ void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_csyr2k_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_csyr2k_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -5219,72 +5339,72 @@ void syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zsyr2k_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsyr2k_sycl, queue, upper_lower, trans,
+                  n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& a, std::int64_t lda, sycl::buffer<float, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_strmm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_strmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_dtrmm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_ctrmm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_ztrmm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrmm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1>& a, std::int64_t lda, sycl::buffer<float, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_strsm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_strsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& b,
           std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_dtrsm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_ctrsm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_ztrsm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrsm_sycl, queue, left_right,
+                  upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5293,9 +5413,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<float, 1>& b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_sgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemm_batch_strided_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5304,9 +5424,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<double, 1>& b, std::int64_t ldb, std::int64_t stride_b, double beta,
                 sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_dgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemm_batch_strided_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5315,9 +5435,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_cgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemm_batch_strided_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5326,9 +5446,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemm_batch_strided_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5337,9 +5457,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<sycl::half, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 sycl::half beta, sycl::buffer<sycl::half, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_hgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_hgemm_batch_strided_sycl, queue, transa,
+                  transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5348,9 +5468,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<sycl::half, 1>& b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_gemm_f16f16f32_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_f16f16f32_batch_strided_sycl,
+                  queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                  c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5359,9 +5479,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::int8_t, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 float beta, sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_gemm_s8s8f32_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_s8s8f32_batch_strided_sycl, queue,
+                  transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5370,9 +5490,9 @@ void gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans
                 sycl::buffer<std::int8_t, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 float beta, sycl::buffer<std::int32_t, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_gemm_s8s8s32_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_s8s8s32_batch_strided_sycl, queue,
+                  transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                  stride_c, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5380,9 +5500,9 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<float, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<float, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_strsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_strsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5390,9 +5510,9 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 sycl::buffer<double, 1>& a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<double, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_dtrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5400,9 +5520,9 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<float>, 1>& b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_ctrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -5410,25 +5530,25 @@ void trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<double>, 1>& b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_ztrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrsm_batch_strided_sycl, queue,
+                  left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+                  stride_b, batch_size);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1>& a,
            std::int64_t lda, sycl::buffer<float, 1>& b, std::int64_t ldb, float beta,
            sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_sgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemmt_sycl, queue, upper_lower, transa,
+                  transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, double alpha,
            sycl::buffer<double, 1>& a, std::int64_t lda, sycl::buffer<double, 1>& b,
            std::int64_t ldb, double beta, sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_dgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemmt_sycl, queue, upper_lower, transa,
+                  transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
@@ -5436,8 +5556,8 @@ void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_cgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemmt_sycl, queue, upper_lower, transa,
+                  transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose transa,
@@ -5445,8 +5565,8 @@ void gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, tr
            sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zgemmt_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemmt_sycl, queue, upper_lower, transa,
+                  transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5454,8 +5574,8 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<int8_t, 1>& a, std::int64_t lda, int8_t ao, sycl::buffer<uint8_t, 1>& b,
                std::int64_t ldb, uint8_t bo, float beta, sycl::buffer<int32_t, 1>& c,
                std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].row_major_gemm_s8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_s8u8s32_bias_sycl, queue, transa,
+                  transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5463,8 +5583,8 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<int8_t, 1>& a, std::int64_t lda, int8_t ao, sycl::buffer<int8_t, 1>& b,
                std::int64_t ldb, int8_t bo, float beta, sycl::buffer<int32_t, 1>& c,
                std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].row_major_gemm_s8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_s8s8s32_bias_sycl, queue, transa,
+                  transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5472,8 +5592,8 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<uint8_t, 1>& a, std::int64_t lda, uint8_t ao,
                sycl::buffer<int8_t, 1>& b, std::int64_t ldb, int8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].row_major_gemm_u8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_u8s8s32_bias_sycl, queue, transa,
+                  transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
 }
 
 void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5481,24 +5601,24 @@ void gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa
                sycl::buffer<uint8_t, 1>& a, std::int64_t lda, uint8_t ao,
                sycl::buffer<uint8_t, 1>& b, std::int64_t ldb, uint8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, std::int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-    function_tables[{ libkey, queue }].row_major_gemm_u8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_u8u8s32_bias_sycl, queue, transa,
+                  transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& a,
                     std::int64_t lda, std::int64_t stride_a, sycl::buffer<float, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_somatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& a,
                     std::int64_t lda, std::int64_t stride_a, sycl::buffer<double, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_domatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -5506,8 +5626,8 @@ void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<float>, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_comatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -5515,40 +5635,40 @@ void omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<double>, 1>& b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zomatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& ab,
                     std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                     std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_simatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_simatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& ab,
                     std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                     std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_dimatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dimatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, std::complex<float> alpha,
                     sycl::buffer<std::complex<float>, 1>& ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_cimatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cimatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                     std::int64_t m, std::int64_t n, std::complex<double> alpha,
                     sycl::buffer<std::complex<double>, 1>& ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zimatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zimatcopy_batch_strided_sycl, queue,
+                  trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -5557,9 +5677,9 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    sycl::buffer<float, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_somatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -5568,9 +5688,9 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    sycl::buffer<double, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<double, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_domatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -5579,9 +5699,9 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& b,
                    std::int64_t ldb, std::int64_t stride_b, sycl::buffer<std::complex<float>, 1>& c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_comatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -5591,113 +5711,113 @@ void omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose tr
                    sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb,
                    std::int64_t stride_b, sycl::buffer<std::complex<double>, 1>& c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[{ libkey, queue }].row_major_zomatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatadd_batch_strided_sycl, queue,
+                  transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
+                  stride_c, batch_size);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
               sycl::buffer<float, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_somatcopy_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
               sycl::buffer<double, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_domatcopy_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
               std::int64_t lda, sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_comatcopy_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
               std::int64_t lda, sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_zomatcopy_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatcopy_sycl, queue, trans, m, n,
+                  alpha, a, lda, b, ldb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, float alpha, sycl::buffer<float, 1>& a, std::int64_t lda,
                std::int64_t stridea, sycl::buffer<float, 1>& b, std::int64_t ldb,
                std::int64_t strideb) {
-    function_tables[{ libkey, queue }].row_major_somatcopy2_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                 stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, double alpha, sycl::buffer<double, 1>& a, std::int64_t lda,
                std::int64_t stridea, sycl::buffer<double, 1>& b, std::int64_t ldb,
                std::int64_t strideb) {
-    function_tables[{ libkey, queue }].row_major_domatcopy2_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                 stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
                std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<float>, 1>& b,
                std::int64_t ldb, std::int64_t strideb) {
-    function_tables[{ libkey, queue }].row_major_comatcopy2_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                 stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
                std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<double>, 1>& b,
                std::int64_t ldb, std::int64_t strideb) {
-    function_tables[{ libkey, queue }].row_major_zomatcopy2_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                 stridea, b, ldb, strideb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatcopy2_sycl, queue, trans, m, n,
+                  alpha, a, lda, stridea, b, ldb, strideb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1>& ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_simatcopy_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_simatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1>& ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_dimatcopy_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_dimatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_cimatcopy_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_cimatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[{ libkey, queue }].row_major_zimatcopy_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zimatcopy_sycl, queue, trans, m, n,
+                  alpha, ab, lda, ldb);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1>& a,
              std::int64_t lda, float beta, sycl::buffer<float, 1>& b, std::int64_t ldb,
              sycl::buffer<float, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_somatadd_sycl(queue, transa, transb, m, n, alpha,
-                                                               a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatadd_sycl, queue, transa, transb, m,
+                  n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1>& a,
              std::int64_t lda, double beta, sycl::buffer<double, 1>& b, std::int64_t ldb,
              sycl::buffer<double, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_domatadd_sycl(queue, transa, transb, m, n, alpha,
-                                                               a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatadd_sycl, queue, transa, transb, m,
+                  n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5705,8 +5825,8 @@ void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
              sycl::buffer<std::complex<float>, 1>& a, std::int64_t lda, std::complex<float> beta,
              sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb,
              sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_comatadd_sycl(queue, transa, transb, m, n, alpha,
-                                                               a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatadd_sycl, queue, transa, transb, m,
+                  n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa, transpose transb,
@@ -5714,8 +5834,8 @@ void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
              sycl::buffer<std::complex<double>, 1>& a, std::int64_t lda, std::complex<double> beta,
              sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb,
              sycl::buffer<std::complex<double>, 1>& c, std::int64_t ldc) {
-    function_tables[{ libkey, queue }].row_major_zomatadd_sycl(queue, transa, transb, m, n, alpha,
-                                                               a, lda, beta, b, ldb, c, ldc);
+    CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatadd_sycl, queue, transa, transb, m,
+                  n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 // USM APIs
@@ -5723,73 +5843,73 @@ void omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, float* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_scasum_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_scasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, double* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dzasum_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dzasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                  std::int64_t incx, float* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sasum_usm_sycl(queue, n, x, incx, result,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                  std::int64_t incx, double* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dasum_usm_sycl(queue, n, x, incx, result,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dasum_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                  const float* x, std::int64_t incx, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_saxpy_usm_sycl(queue, n, alpha, x, incx, y,
-                                                                       incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_saxpy_usm_sycl, queue, n, alpha,
+                         x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                  const double* x, std::int64_t incx, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_daxpy_usm_sycl(queue, n, alpha, x, incx, y,
-                                                                       incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_daxpy_usm_sycl, queue, n, alpha,
+                         x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_caxpy_usm_sycl(queue, n, alpha, x, incx, y,
-                                                                       incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_caxpy_usm_sycl, queue, n, alpha,
+                         x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zaxpy_usm_sycl(queue, n, alpha, x, incx, y,
-                                                                       incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zaxpy_usm_sycl, queue, n, alpha,
+                         x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        float* alpha, const float** x, std::int64_t* incx, float** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_saxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_saxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        double* alpha, const double** x, std::int64_t* incx, double** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_daxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_daxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
@@ -5797,8 +5917,8 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t* incx, std::complex<float>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_caxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_caxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
@@ -5806,24 +5926,26 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t* incx, std::complex<double>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zaxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zaxpy_batch_group_usm_sycl,
+                         queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                        const float* x, std::int64_t incx, std::int64_t stridex, float* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_saxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_saxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        double alpha, const double* x, std::int64_t incx, std::int64_t stridex,
                        double* y, std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_daxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_daxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
@@ -5831,8 +5953,9 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t stridex, std::complex<float>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_caxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_caxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
@@ -5840,438 +5963,439 @@ sycl::event axpy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int
                        std::int64_t stridex, std::complex<double>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zaxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zaxpy_batch_strided_usm_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                         dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                   const float* x, std::int64_t incx, const float beta, float* y, std::int64_t incy,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_saxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_saxpby_usm_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                   const double* x, std::int64_t incx, const double beta, double* y,
                   std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_daxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_daxpby_usm_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                   const std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_caxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_caxpby_usm_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                   const std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zaxpby_usm_sycl(
-        queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zaxpby_usm_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                  std::int64_t incx, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_scopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_scopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                  std::int64_t incx, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dcopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, std::complex<float>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ccopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ccopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, std::complex<double>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zcopy_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const float** x, std::int64_t* incx, float** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_scopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_scopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const double** x, std::int64_t* incx, double** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dcopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const std::complex<float>** x, std::int64_t* incx, std::complex<float>** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ccopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ccopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t* n,
                        const std::complex<double>** x, std::int64_t* incx, std::complex<double>** y,
                        std::int64_t* incy, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zcopy_batch_group_usm_sycl,
+                         queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const float* x, std::int64_t incx, std::int64_t stridex, float* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_scopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_scopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const double* x, std::int64_t incx, std::int64_t stridex, double* y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dcopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const std::complex<float>* x, std::int64_t incx, std::int64_t stridex,
                        std::complex<float>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ccopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ccopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                        const std::complex<double>* x, std::int64_t incx, std::int64_t stridex,
                        std::complex<double>* y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zcopy_batch_strided_usm_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                 std::int64_t incx, const float* y, std::int64_t incy, float* result,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sdot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                      result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sdot_usm_sycl, queue, n, x, incx,
+                         y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                 std::int64_t incx, const double* y, std::int64_t incy, double* result,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ddot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                      result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ddot_usm_sycl, queue, n, x, incx,
+                         y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                 std::int64_t incx, const float* y, std::int64_t incy, double* result,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsdot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsdot_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, const std::complex<float>* y,
                  std::int64_t incy, std::complex<float>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cdotc_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cdotc_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, const std::complex<double>* y,
                  std::int64_t incy, std::complex<double>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zdotc_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdotc_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, const std::complex<float>* y,
                  std::int64_t incy, std::complex<float>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cdotu_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cdotu_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, const std::complex<double>* y,
                  std::int64_t incy, std::complex<double>* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zdotu_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdotu_usm_sycl, queue, n, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_isamin_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_isamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_idamin_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_idamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<float>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_icamin_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_icamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<double>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_izamin_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_izamin_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_isamax_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_isamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                   std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_idamax_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_idamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<float>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_icamax_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_icamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                   const std::complex<double>* x, std::int64_t incx, std::int64_t* result,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_izamax_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_izamax_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<float>* x, std::int64_t incx, float* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_scnrm2_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_scnrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  const std::complex<double>* x, std::int64_t incx, double* result,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dznrm2_usm_sycl(queue, n, x, incx, result,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dznrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* x,
                  std::int64_t incx, float* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_snrm2_usm_sycl(queue, n, x, incx, result,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_snrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* x,
                  std::int64_t incx, double* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dnrm2_usm_sycl(queue, n, x, incx, result,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dnrm2_usm_sycl, queue, n, x,
+                         incx, result, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<float>* x, std::int64_t incx, std::complex<float>* y,
                 std::int64_t incy, float c, float s, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_srot_usm_sycl(queue, n, x, incx, y, incy, c,
-                                                                      s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_srot_usm_sycl, queue, n, x, incx,
+                         y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                 std::complex<double>* x, std::int64_t incx, std::complex<double>* y,
                 std::int64_t incy, double c, double s,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_drot_usm_sycl(queue, n, x, incx, y, incy, c,
-                                                                      s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_drot_usm_sycl, queue, n, x, incx,
+                         y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float* x,
                 std::int64_t incx, float* y, std::int64_t incy, float c, float s,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_csrot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       c, s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_csrot_usm_sycl, queue, n, x,
+                         incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double* x,
                 std::int64_t incx, double* y, std::int64_t incy, double c, double s,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zdrot_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       c, s, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdrot_usm_sycl, queue, n, x,
+                         incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, float* a, float* b, float* c,
                  float* s, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_srotg_usm_sycl(queue, a, b, c, s,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_srotg_usm_sycl, queue, a, b, c,
+                         s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, double* a, double* b, double* c,
                  double* s, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_drotg_usm_sycl(queue, a, b, c, s,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_drotg_usm_sycl, queue, a, b, c,
+                         s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, std::complex<float>* a,
                  std::complex<float>* b, float* c, std::complex<float>* s,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_crotg_usm_sycl(queue, a, b, c, s,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_crotg_usm_sycl, queue, a, b, c,
+                         s, dependencies);
 }
 
 sycl::event rotg(oneapi::math::device libkey, sycl::queue& queue, std::complex<double>* a,
                  std::complex<double>* b, double* c, std::complex<double>* s,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zrotg_usm_sycl(queue, a, b, c, s,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zrotg_usm_sycl, queue, a, b, c,
+                         s, dependencies);
 }
 
 sycl::event rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float* x,
                  std::int64_t incx, float* y, std::int64_t incy, float* param,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_srotm_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_srotm_usm_sycl, queue, n, x,
+                         incx, y, incy, param, dependencies);
 }
 
 sycl::event rotm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double* x,
                  std::int64_t incx, double* y, std::int64_t incy, double* param,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_drotm_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_drotm_usm_sycl, queue, n, x,
+                         incx, y, incy, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::math::device libkey, sycl::queue& queue, float* d1, float* d2, float* x1,
                   float y1, float* param, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_srotmg_usm_sycl(queue, d1, d2, x1, y1,
-                                                                        param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_srotmg_usm_sycl, queue, d1, d2,
+                         x1, y1, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::math::device libkey, sycl::queue& queue, double* d1, double* d2,
                   double* x1, double y1, double* param,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_drotmg_usm_sycl(queue, d1, d2, x1, y1,
-                                                                        param, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_drotmg_usm_sycl, queue, d1, d2,
+                         x1, y1, param, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                  float* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sscal_usm_sycl, queue, n, alpha,
+                         x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                  double* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dscal_usm_sycl, queue, n, alpha,
+                         x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<float> alpha, std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cscal_usm_sycl, queue, n, alpha,
+                         x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<double> alpha, std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_csscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_csscal_usm_sycl, queue, n, alpha,
+                         x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float alpha,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zscal_usm_sycl, queue, n, alpha,
+                         x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double alpha,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zdscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdscal_usm_sycl, queue, n, alpha,
+                         x, incx, dependencies);
 }
 
 sycl::event sdsdot(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float sb,
                    const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                    float* result, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sdsdot_usm_sycl(queue, n, sb, x, incx, y,
-                                                                        incy, result, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sdsdot_usm_sycl, queue, n, sb, x,
+                         incx, y, incy, result, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, float* x,
                  std::int64_t incx, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, double* x,
                  std::int64_t incx, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<float>* x, std::int64_t incx, std::complex<float>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
                  std::complex<double>* x, std::int64_t incx, std::complex<double>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                                       dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zswap_usm_sycl, queue, n, x,
+                         incx, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, const float* a,
                  std::int64_t lda, const float* x, std::int64_t incx, float beta, float* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgbmv_usm_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha, const double* a,
                  std::int64_t lda, const double* x, std::int64_t incx, double beta, double* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgbmv_usm_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -6279,8 +6403,8 @@ sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<float>* a, std::int64_t lda, const std::complex<float>* x,
                  std::int64_t incx, std::complex<float> beta, std::complex<float>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgbmv_usm_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -6288,24 +6412,24 @@ sycl::event gbmv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<double>* a, std::int64_t lda, const std::complex<double>* x,
                  std::int64_t incx, std::complex<double> beta, std::complex<double>* y,
                  std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgbmv_usm_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, float alpha, const float* a, std::int64_t lda, const float* x,
                  std::int64_t incx, float beta, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemv_usm_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
                  std::int64_t n, double alpha, const double* a, std::int64_t lda, const double* x,
                  std::int64_t incx, double beta, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemv_usm_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -6313,8 +6437,8 @@ sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  std::int64_t lda, const std::complex<float>* x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemv_usm_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose trans, std::int64_t m,
@@ -6322,8 +6446,8 @@ sycl::event gemv(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  std::int64_t lda, const std::complex<double>* x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgemv_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemv_usm_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -6332,9 +6456,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stridex, float beta, float* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -6343,9 +6467,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stridex, double beta, double* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -6355,9 +6479,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -6367,9 +6491,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemv_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -6377,9 +6501,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* lda, const float** x, std::int64_t* incx, float* beta,
                        float** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -6387,9 +6511,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* lda, const double** x, std::int64_t* incx, double* beta,
                        double** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -6398,9 +6522,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::complex<float>** x, std::int64_t* incx, std::complex<float>* beta,
                        std::complex<float>** y, std::int64_t* incy, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -6410,9 +6534,9 @@ sycl::event gemv_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<double>* beta, std::complex<double>** y, std::int64_t* incy,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemv_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -6420,9 +6544,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t stridea, const float* x, std::int64_t incx,
                        std::int64_t stridex, float* c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sdgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -6430,9 +6554,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t stridea, const double* x, std::int64_t incx,
                        std::int64_t stridex, double* c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ddgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ddgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -6441,9 +6565,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t incx, std::int64_t stridex, std::complex<float>* c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cdgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -6452,9 +6576,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t incx, std::int64_t stridex, std::complex<double>* c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdgmm_batch_strided_usm_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -6462,8 +6586,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        const float** x, std::int64_t* incx, float** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sdgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -6471,8 +6596,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        const double** x, std::int64_t* incx, double** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ddgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ddgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -6480,8 +6606,9 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, const std::complex<float>** x, std::int64_t* incx,
                        std::complex<float>** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cdgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -6489,55 +6616,56 @@ sycl::event dgmm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, const std::complex<double>** x, std::int64_t* incx,
                        std::complex<double>** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zdgmm_batch_group_usm_sycl,
+                         queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                 float alpha, const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                 float* a, std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sger_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sger_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event ger(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                 double alpha, const double* x, std::int64_t incx, const double* y,
                 std::int64_t incy, double* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dger_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dger_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgerc_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgerc_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgerc_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgerc_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgeru_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgeru_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::math::device libkey, sycl::queue& queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgeru_usm_sycl(
-        queue, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgeru_usm_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -6545,8 +6673,8 @@ sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  std::int64_t lda, const std::complex<float>* x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_chbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_chbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -6554,8 +6682,8 @@ sycl::event hbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  std::int64_t lda, const std::complex<double>* x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zhbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -6563,8 +6691,8 @@ sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<float>* x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_chemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_chemv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -6572,40 +6700,40 @@ sycl::event hemv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<double>* x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zhemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhemv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float>* x, std::int64_t incx,
                 std::complex<float>* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cher_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cher_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double>* x, std::int64_t incx,
                 std::complex<double>* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zher_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zher_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cher2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cher2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zher2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zher2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -6613,8 +6741,8 @@ sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<float>* x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_chpmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_chpmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
@@ -6622,337 +6750,337 @@ sycl::event hpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<double>* x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double>* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zhpmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhpmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float>* x, std::int64_t incx,
                 std::complex<float>* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_chpr_usm_sycl(queue, upper_lower, n, alpha,
-                                                                      x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_chpr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double>* x, std::int64_t incx,
                 std::complex<double>* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zhpr_usm_sycl(queue, upper_lower, n, alpha,
-                                                                      x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhpr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float>* x, std::int64_t incx,
                  const std::complex<float>* y, std::int64_t incy, std::complex<float>* a,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_chpr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_chpr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double>* x, std::int64_t incx,
                  const std::complex<double>* y, std::int64_t incy, std::complex<double>* a,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zhpr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhpr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, float alpha, const float* a, std::int64_t lda, const float* x,
                  std::int64_t incx, float beta, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event sbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, double alpha, const double* a, std::int64_t lda, const double* x,
                  std::int64_t incx, double beta, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsbmv_usm_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* a, const float* x, std::int64_t incx, float beta,
                  float* y, std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sspmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sspmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* a, const double* x, std::int64_t incx, double beta,
                  double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dspmv_usm_sycl(
-        queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dspmv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float* x, std::int64_t incx, float* a,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sspr_usm_sycl(queue, upper_lower, n, alpha,
-                                                                      x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sspr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double* x, std::int64_t incx, double* a,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dspr_usm_sycl(queue, upper_lower, n, alpha,
-                                                                      x, incx, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dspr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                  float* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sspr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sspr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event spr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* x, std::int64_t incx, const double* y,
                  std::int64_t incy, double* a, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dspr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dspr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* a, std::int64_t lda, const float* x, std::int64_t incx,
                  float beta, float* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssymv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event symv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* a, std::int64_t lda, const double* x,
                  std::int64_t incx, double beta, double* y, std::int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsymv_usm_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float* x, std::int64_t incx, float* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssyr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double* x, std::int64_t incx, double* a, std::int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsyr_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyr_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float* x, std::int64_t incx, const float* y, std::int64_t incy,
                  float* a, std::int64_t lda, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssyr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double* x, std::int64_t incx, const double* y,
                  std::int64_t incy, double* a, std::int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsyr2_usm_sycl(
-        queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyr2_usm_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float* a, std::int64_t lda,
                  float* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_stbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_stbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double* a, std::int64_t lda,
                  double* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float>* a,
                  std::int64_t lda, std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double>* a,
                  std::int64_t lda, std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztbmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztbmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float* a, std::int64_t lda,
                  float* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_stbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_stbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double* a, std::int64_t lda,
                  double* x, std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float>* a,
                  std::int64_t lda, std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double>* a,
                  std::int64_t lda, std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztbsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztbsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, float* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_stpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_stpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, double* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztpmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztpmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, float* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_stpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_stpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, double* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztpsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztpsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, std::int64_t lda, float* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_strmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_strmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, std::int64_t lda, double* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtrmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctrmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztrmv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrmv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float* a, std::int64_t lda, float* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_strsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_strsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double* a, std::int64_t lda, double* x,
                  std::int64_t incx, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtrsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctrsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* x, std::int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztrsv_usm_sycl(
-        queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrsv_usm_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                  transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
                  const float* a, std::int64_t lda, const float* b, std::int64_t ldb, float beta,
                  float* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                  transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
                  const double* a, std::int64_t lda, const double* b, std::int64_t ldb, double beta,
                  double* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -6961,8 +7089,8 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<float>* b, std::int64_t ldb, std::complex<float> beta,
                  std::complex<float>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -6971,8 +7099,8 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const std::complex<double>* b, std::int64_t ldb, std::complex<double> beta,
                  std::complex<double>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -6980,8 +7108,8 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const sycl::half* a, std::int64_t lda, const sycl::half* b, std::int64_t ldb,
                  sycl::half beta, sycl::half* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_hgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_hgemm_usm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -6989,8 +7117,9 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const sycl::half* a, std::int64_t lda, const sycl::half* b, std::int64_t ldb,
                  float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_f16f16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_f16f16f32_usm_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -6998,8 +7127,9 @@ sycl::event gemm(oneapi::math::device libkey, sycl::queue& queue, transpose tran
                  const bfloat16* a, std::int64_t lda, const bfloat16* b, std::int64_t ldb,
                  float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_bf16bf16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_bf16bf16f32_usm_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7007,8 +7137,9 @@ sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_chemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_chemm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7016,24 +7147,25 @@ sycl::event hemm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zhemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zhemm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const std::complex<float>* a,
                  std::int64_t lda, float beta, std::complex<float>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cherk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event herk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const std::complex<double>* a,
                  std::int64_t lda, double beta, std::complex<double>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zherk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7041,8 +7173,9 @@ sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                   std::int64_t ldb, float beta, std::complex<float>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cher2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7050,24 +7183,27 @@ sycl::event her2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                   std::int64_t ldb, double beta, std::complex<double>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zher2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, float alpha, const float* a, std::int64_t lda,
                  const float* b, std::int64_t ldb, float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, double alpha, const double* a, std::int64_t lda,
                  const double* b, std::int64_t ldb, double beta, double* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7075,8 +7211,9 @@ sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_csymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_csymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7084,24 +7221,25 @@ sycl::event symm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsymm_usm_sycl, queue,
+                         left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const float* a, std::int64_t lda,
                  float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const double* a, std::int64_t lda,
                  double beta, double* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -7109,8 +7247,8 @@ sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<float>* a, std::int64_t lda, std::complex<float> beta,
                  std::complex<float>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_csyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_csyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower, transpose trans,
@@ -7118,8 +7256,8 @@ sycl::event syrk(oneapi::math::device libkey, sycl::queue& queue, uplo upper_low
                  const std::complex<double>* a, std::int64_t lda, std::complex<double> beta,
                  std::complex<double>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsyrk_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -7127,9 +7265,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        const float** a, std::int64_t* lda, float* beta, float** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -7137,9 +7275,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        const double** a, std::int64_t* lda, double* beta, double** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -7148,9 +7286,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        std::complex<float>* beta, std::complex<float>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_csyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_csyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* upper_lower,
@@ -7159,9 +7297,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo* up
                        std::int64_t* lda, std::complex<double>* beta, std::complex<double>** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsyrk_batch_group_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                         group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7169,9 +7307,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        std::int64_t lda, std::int64_t stride_a, float beta, float* c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7179,9 +7317,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        const double* a, std::int64_t lda, std::int64_t stride_a, double beta,
                        double* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7190,9 +7328,9 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        std::complex<float> beta, std::complex<float>* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_csyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_csyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7201,25 +7339,27 @@ sycl::event syrk_batch(oneapi::math::device libkey, sycl::queue& queue, uplo upp
                        std::complex<double> beta, std::complex<double>* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsyrk_batch_strided_usm_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size, dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose trans, std::int64_t n, std::int64_t k, float alpha, const float* a,
                   std::int64_t lda, const float* b, std::int64_t ldb, float beta, float* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ssyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ssyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose trans, std::int64_t n, std::int64_t k, double alpha, const double* a,
                   std::int64_t lda, const double* b, std::int64_t ldb, double beta, double* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dsyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7227,8 +7367,9 @@ sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                   std::int64_t ldb, std::complex<float> beta, std::complex<float>* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_csyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_csyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7236,26 +7377,27 @@ sycl::event syr2k(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                   std::int64_t ldb, std::complex<double> beta, std::complex<double>* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zsyr2k_usm_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float* a, std::int64_t lda, float* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_strmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_strmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double* a, std::int64_t lda, double* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtrmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7263,9 +7405,9 @@ sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<float> alpha, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctrmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7273,27 +7415,27 @@ sycl::event trmm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<double> alpha, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztrmm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrmm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float* a, std::int64_t lda, float* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_strsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_strsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double* a, std::int64_t lda, double* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtrsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7301,9 +7443,9 @@ sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<float> alpha, const std::complex<float>* a, std::int64_t lda,
                  std::complex<float>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctrsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_right, uplo upper_lower,
@@ -7311,9 +7453,9 @@ sycl::event trsm(oneapi::math::device libkey, sycl::queue& queue, side left_righ
                  std::complex<double> alpha, const std::complex<double>* a, std::int64_t lda,
                  std::complex<double>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztrsm_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrsm_usm_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb,
+                         dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -7321,9 +7463,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t n, float alpha, const float* a, std::int64_t lda,
                        std::int64_t stride_a, float* b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_strsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_strsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -7331,9 +7473,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t n, double alpha, const double* a, std::int64_t lda,
                        std::int64_t stride_a, double* b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -7342,9 +7484,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t lda, std::int64_t stride_a, std::complex<float>* b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side left_right,
@@ -7353,9 +7495,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side lef
                        std::int64_t lda, std::int64_t stride_a, std::complex<double>* b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrsm_batch_strided_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -7363,9 +7505,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* n, float* alpha, const float** a, std::int64_t* lda, float** b,
                        std::int64_t* ldb, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_strsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_strsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -7373,9 +7515,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* n, double* alpha, const double** a, std::int64_t* lda,
                        double** b, std::int64_t* ldb, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dtrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dtrsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -7384,9 +7526,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, std::complex<float>** b, std::int64_t* ldb,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ctrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ctrsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* left_right,
@@ -7395,9 +7537,9 @@ sycl::event trsm_batch(oneapi::math::device libkey, sycl::queue& queue, side* le
                        std::int64_t* lda, std::complex<double>** b, std::int64_t* ldb,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_ztrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_ztrsm_batch_group_usm_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                         ldb, group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7406,9 +7548,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* ldb, float* beta, float** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7417,9 +7559,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* ldb, double* beta, double** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7428,9 +7570,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::complex<float>** b, std::int64_t* ldb, std::complex<float>* beta,
                        std::complex<float>** c, std::int64_t* ldc, std::int64_t group_count,
                        std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7440,9 +7582,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::complex<double>* beta, std::complex<double>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7451,9 +7593,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const sycl::half** b, std::int64_t* ldb, sycl::half* beta, sycl::half** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_hgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_hgemm_batch_group_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7462,9 +7604,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t* ldb, float* beta, float** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_f16f16f32_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         row_major_gemm_f16f16f32_batch_group_usm_sycl, queue, transa, transb, m, n,
+                         k, alpha, a, lda, b, ldb, beta, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7473,9 +7616,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t** b, std::int64_t* ldb, float* beta, float** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_s8s8f32_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         row_major_gemm_s8s8f32_batch_group_usm_sycl, queue, transa, transb, m, n,
+                         k, alpha, a, lda, b, ldb, beta, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* transa,
@@ -7484,9 +7628,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t** b, std::int64_t* ldb, float* beta, std::int32_t** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_s8s8s32_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         row_major_gemm_s8s8s32_batch_group_usm_sycl, queue, transa, transb, m, n,
+                         k, alpha, a, lda, b, ldb, beta, c, ldc, group_count, group_size,
+                         dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7495,9 +7640,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const float* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7506,9 +7651,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const double* b, std::int64_t ldb, std::int64_t stride_b, double beta,
                        double* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7518,9 +7663,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stride_b, std::complex<float> beta, std::complex<float>* c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7530,9 +7675,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stride_b, std::complex<double> beta, std::complex<double>* c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7542,9 +7687,9 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        std::int64_t stride_b, sycl::half beta, sycl::half* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_hgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_hgemm_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7553,9 +7698,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const sycl::half* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_f16f16f32_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         row_major_gemm_f16f16f32_batch_strided_usm_sycl, queue, transa, transb, m,
+                         n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7564,9 +7710,10 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float* c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_s8s8f32_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         row_major_gemm_s8s8f32_batch_strided_usm_sycl, queue, transa, transb, m, n,
+                         k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7575,27 +7722,28 @@ sycl::event gemm_batch(oneapi::math::device libkey, sycl::queue& queue, transpos
                        const std::int8_t* b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        std::int32_t* c, std::int64_t ldc, std::int64_t stride_c,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_s8s8s32_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue,
+                         row_major_gemm_s8s8s32_batch_strided_usm_sycl, queue, transa, transb, m, n,
+                         k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                         batch_size, dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, float alpha,
                   const float* a, std::int64_t lda, const float* b, std::int64_t ldb, float beta,
                   float* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_sgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_sgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, double alpha,
                   const double* a, std::int64_t lda, const double* b, std::int64_t ldb, double beta,
                   double* c, std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7604,9 +7752,9 @@ sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<float>* b, std::int64_t ldb, std::complex<float> beta,
                   std::complex<float>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lower,
@@ -7615,9 +7763,9 @@ sycl::event gemmt(oneapi::math::device libkey, sycl::queue& queue, uplo upper_lo
                   const std::complex<double>* b, std::int64_t ldb, std::complex<double> beta,
                   std::complex<double>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zgemmt_usm_sycl(
-        queue, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zgemmt_usm_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                         dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7626,9 +7774,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::int8_t ao, const std::uint8_t* b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_s8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_s8u8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7637,9 +7785,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::int8_t ao, const std::int8_t* b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_s8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_s8s8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7648,9 +7796,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::uint8_t ao, const std::int8_t* b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_u8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_u8s8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7659,9 +7807,9 @@ sycl::event gemm_bias(oneapi::math::device libkey, sycl::queue& queue, transpose
                       std::uint8_t ao, const std::uint8_t* b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t* c, std::int64_t ldc, const std::int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_gemm_u8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_gemm_u8u8s32_bias_usm_sycl,
+                         queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                         beta, c, ldc, co, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7669,8 +7817,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t lda, std::int64_t stride_a, float* b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_somatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                         dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7678,8 +7827,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t lda, std::int64_t stride_a, double* b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_domatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                         dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7687,8 +7837,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<float>* a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<float>* b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_comatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                         dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7696,24 +7847,25 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<double>* a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<double>* b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zomatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                         dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                            std::int64_t m, std::int64_t n, float alpha, float* ab, std::int64_t lda,
                            std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_simatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_simatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                            std::int64_t m, std::int64_t n, double alpha, double* ab,
                            std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                            std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dimatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7721,8 +7873,8 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<float>* ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cimatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7730,8 +7882,8 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<double>* ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zimatcopy_batch_strided_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7740,9 +7892,9 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const float* b, std::int64_t ldb, std::int64_t stride_b, float* c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_somatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatadd_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7751,9 +7903,9 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const double* b, std::int64_t ldb, std::int64_t stride_b, double* c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_domatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatadd_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7763,9 +7915,9 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const std::complex<float>* b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<float>* c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_comatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatadd_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7775,56 +7927,56 @@ sycl::event omatadd_batch(oneapi::math::device libkey, sycl::queue& queue, trans
                           const std::complex<double>* b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<double>* c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zomatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatadd_batch_strided_usm_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, const float* a, std::int64_t lda,
                      float* b, std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_somatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, const double* a,
                      std::int64_t lda, double* b, std::int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_domatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      const std::complex<float>* a, std::int64_t lda, std::complex<float>* b,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_comatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      const std::complex<double>* a, std::int64_t lda, std::complex<double>* b,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zomatcopy_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                       std::int64_t m, std::int64_t n, float alpha, const float* a, std::int64_t lda,
                       std::int64_t stridea, float* b, std::int64_t ldb, std::int64_t strideb,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_somatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                       std::int64_t m, std::int64_t n, double alpha, const double* a,
                       std::int64_t lda, std::int64_t stridea, double* b, std::int64_t ldb,
                       std::int64_t strideb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_domatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7832,8 +7984,8 @@ sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose
                       const std::complex<float>* a, std::int64_t lda, std::int64_t stridea,
                       std::complex<float>* b, std::int64_t ldb, std::int64_t strideb,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_comatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
@@ -7841,54 +7993,54 @@ sycl::event omatcopy2(oneapi::math::device libkey, sycl::queue& queue, transpose
                       const std::complex<double>* a, std::int64_t lda, std::int64_t stridea,
                       std::complex<double>* b, std::int64_t ldb, std::int64_t strideb,
                       const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zomatcopy2_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatcopy2_usm_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, b, ldb, strideb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, float* ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_simatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_simatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, double* ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dimatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dimatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      std::complex<float>* ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cimatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cimatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::math::device libkey, sycl::queue& queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      std::complex<double>* ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zimatcopy_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zimatcopy_usm_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, float alpha, const float* a,
                     std::int64_t lda, float beta, const float* b, std::int64_t ldb, float* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_somatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatadd_usm_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, double alpha, const double* a,
                     std::int64_t lda, double beta, const double* b, std::int64_t ldb, double* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_domatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatadd_usm_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7896,8 +8048,8 @@ sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     const std::complex<float>* a, std::int64_t lda, std::complex<float> beta,
                     const std::complex<float>* b, std::int64_t ldb, std::complex<float>* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_comatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatadd_usm_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose transa,
@@ -7905,8 +8057,8 @@ sycl::event omatadd(oneapi::math::device libkey, sycl::queue& queue, transpose t
                     const std::complex<double>* a, std::int64_t lda, std::complex<double> beta,
                     const std::complex<double>* b, std::int64_t ldb, std::complex<double>* c,
                     std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zomatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatadd_usm_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -7914,8 +8066,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t* lda, float** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_somatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_somatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -7923,8 +8076,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::int64_t* lda, double** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_domatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_domatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -7932,8 +8086,9 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<float>** a, std::int64_t* lda,
                            std::complex<float>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_comatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_comatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -7941,24 +8096,27 @@ sycl::event omatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            const std::complex<double>** a, std::int64_t* lda,
                            std::complex<double>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zomatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zomatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, float* alpha, float** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_simatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_simatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, double* alpha, double** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_dimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_dimatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -7966,8 +8124,9 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<float>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_cimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_cimatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, transpose* trans,
@@ -7975,8 +8134,9 @@ sycl::event imatcopy_batch(oneapi::math::device libkey, sycl::queue& queue, tran
                            std::complex<double>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[{ libkey, queue }].row_major_zimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return CALL_TABLE_FN(function_tables, libkey, queue, row_major_zimatcopy_batch_group_usm_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                         dependencies);
 }
 
 } //namespace detail
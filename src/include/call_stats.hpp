@@ -0,0 +1,463 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_CALL_STATS_HPP_
+#define _ONEMATH_CALL_STATS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/math/detail/backends_table.hpp"
+#include "call_tracer.hpp"
+
+// Call, flop and byte counters of the functions called through the loaders, read with
+// oneapi::math::stats::snapshot().
+//
+// Every thread counts in its own table of slots, one per backend function it called. Only the
+// owning thread writes a slot, so counting is a few relaxed atomic stores; snapshot() reads the
+// tables of the live threads and the totals left by the threads that exited.
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+// Operation counts, in the style of the LAPACK Working Note 41 flop counts
+enum class stats_formula : std::uint8_t {
+    none,
+    level1, // ops * n flops, vectors * n elements
+    gemv,
+    ger,
+    symv,
+    syr,
+    syr2,
+    trmv,
+    gemm,
+    symm,
+    syrk,
+    syr2k,
+    trmm,
+    getrf,
+    potrf,
+    geqrf,
+    getrs,
+    vm // vectors * n elements
+};
+
+// Arguments of the formulas, found by name in the argument list of the call
+enum stats_arg { stats_m, stats_n, stats_k, stats_nrhs, stats_side, stats_batch, stats_arg_count };
+
+struct stats_shape {
+    stats_formula formula = stats_formula::none;
+    double ops = 0.0;
+    double vectors = 0.0;
+    double complex_factor = 1.0;
+    double element_size = 0.0;
+    std::array<int, stats_arg_count> arg;
+};
+
+struct stats_routine {
+    const char* name;
+    stats_formula formula;
+    double ops;
+    double vectors;
+    // Real operations per complex operation
+    double complex_factor;
+};
+
+// clang-format off
+inline constexpr stats_routine stats_routines[] = {
+    { "axpy", stats_formula::level1, 2, 3, 4 },  { "axpby", stats_formula::level1, 3, 3, 4 },
+    { "dot", stats_formula::level1, 2, 2, 4 },   { "dotc", stats_formula::level1, 2, 2, 4 },
+    { "dotu", stats_formula::level1, 2, 2, 4 },  { "dsdot", stats_formula::level1, 2, 2, 4 },
+    { "nrm2", stats_formula::level1, 2, 1, 2 },  { "asum", stats_formula::level1, 1, 1, 2 },
+    { "scal", stats_formula::level1, 1, 2, 4 },  { "copy", stats_formula::level1, 0, 2, 1 },
+    { "swap", stats_formula::level1, 0, 4, 1 },  { "rot", stats_formula::level1, 6, 4, 2 },
+    { "iamax", stats_formula::level1, 1, 1, 2 }, { "iamin", stats_formula::level1, 1, 1, 2 },
+    { "gemv", stats_formula::gemv, 0, 0, 4 },    { "ger", stats_formula::ger, 0, 0, 4 },
+    { "gerc", stats_formula::ger, 0, 0, 4 },     { "geru", stats_formula::ger, 0, 0, 4 },
+    { "symv", stats_formula::symv, 0, 0, 4 },    { "hemv", stats_formula::symv, 0, 0, 4 },
+    { "spmv", stats_formula::symv, 0, 0, 4 },    { "hpmv", stats_formula::symv, 0, 0, 4 },
+    { "syr", stats_formula::syr, 0, 0, 4 },      { "her", stats_formula::syr, 0, 0, 4 },
+    { "spr", stats_formula::syr, 0, 0, 4 },      { "hpr", stats_formula::syr, 0, 0, 4 },
+    { "syr2", stats_formula::syr2, 0, 0, 4 },    { "her2", stats_formula::syr2, 0, 0, 4 },
+    { "spr2", stats_formula::syr2, 0, 0, 4 },    { "hpr2", stats_formula::syr2, 0, 0, 4 },
+    { "trmv", stats_formula::trmv, 0, 0, 4 },    { "trsv", stats_formula::trmv, 0, 0, 4 },
+    { "tpmv", stats_formula::trmv, 0, 0, 4 },    { "tpsv", stats_formula::trmv, 0, 0, 4 },
+    { "gemm", stats_formula::gemm, 0, 0, 4 },    { "symm", stats_formula::symm, 0, 0, 4 },
+    { "hemm", stats_formula::symm, 0, 0, 4 },    { "syrk", stats_formula::syrk, 0, 0, 4 },
+    { "herk", stats_formula::syrk, 0, 0, 4 },    { "syr2k", stats_formula::syr2k, 0, 0, 4 },
+    { "her2k", stats_formula::syr2k, 0, 0, 4 },  { "trmm", stats_formula::trmm, 0, 0, 4 },
+    { "trsm", stats_formula::trmm, 0, 0, 4 },
+    { "getrf", stats_formula::getrf, 0, 0, 4 },  { "potrf", stats_formula::potrf, 0, 0, 4 },
+    { "geqrf", stats_formula::geqrf, 0, 0, 4 },  { "getrs", stats_formula::getrs, 0, 0, 4 },
+    { "potrs", stats_formula::getrs, 0, 0, 4 },
+};
+// clang-format on
+
+inline bool stats_strip_prefix(std::string& s, const char* prefix) {
+    std::size_t length = std::strlen(prefix);
+    if (s.compare(0, length, prefix) != 0)
+        return false;
+    s.erase(0, length);
+    return true;
+}
+
+inline bool stats_strip_suffix(std::string& s, const char* suffix) {
+    std::size_t length = std::strlen(suffix);
+    if (s.size() < length || s.compare(s.size() - length, length, suffix) != 0)
+        return false;
+    s.erase(s.size() - length);
+    return true;
+}
+
+// Resolves the formula of a backend function from its name, e.g. column_major_zgemm_usm_sycl,
+// and the names of its arguments
+inline stats_shape stats_resolve(oneapi::math::domain domain_id, const char* name,
+                                 const char* arg_names, std::size_t element_size,
+                                 bool is_complex, std::size_t data_args) {
+    stats_shape shape;
+    shape.arg.fill(-1);
+    shape.element_size = static_cast<double>(element_size);
+
+    static constexpr const char* arg_spellings[stats_arg_count] = {
+        "m", "n", "k", "nrhs", "left_right", "batch_size"
+    };
+    std::string names(arg_names);
+    std::size_t begin = 0;
+    for (int index = 0; begin <= names.size(); ++index) {
+        std::size_t end = std::min(names.find(',', begin), names.size());
+        std::size_t first = names.find_first_not_of(" \t\n\\", begin);
+        std::size_t last = names.find_last_not_of(" \t\n\\", end - 1);
+        if (first < end && last != std::string::npos && last >= first) {
+            std::string arg = names.substr(first, last - first + 1);
+            for (int a = 0; a < stats_arg_count; ++a) {
+                if (arg == arg_spellings[a])
+                    shape.arg[a] = index;
+            }
+        }
+        begin = end + 1;
+    }
+
+    if (domain_id == oneapi::math::domain::vm) {
+        shape.formula = stats_formula::vm;
+        shape.vectors = static_cast<double>(data_args);
+        return shape;
+    }
+    if (domain_id != oneapi::math::domain::blas && domain_id != oneapi::math::domain::lapack)
+        return shape;
+
+    std::string routine(name);
+    stats_strip_prefix(routine, "column_major_") || stats_strip_prefix(routine, "row_major_");
+    stats_strip_suffix(routine, "_sycl");
+    stats_strip_suffix(routine, "_usm");
+    if (stats_strip_suffix(routine, "_batch_group"))
+        return shape; // sizes are held in arrays
+    if (stats_strip_suffix(routine, "_batch_strided") || stats_strip_suffix(routine, "_batch")) {
+        if (shape.arg[stats_batch] < 0)
+            return shape;
+    }
+    // Mixed precision gemm, e.g. gemm_f16f16f32
+    if (routine.compare(0, 5, "gemm_") == 0)
+        routine = "gemm";
+
+    // The routine follows one or two precision letters, e.g. sgemm, scasum
+    for (std::size_t skip = 0; skip <= 2 && skip < routine.size(); ++skip) {
+        for (const auto& r : stats_routines) {
+            if (routine.compare(skip, std::string::npos, r.name) == 0) {
+                shape.formula = r.formula;
+                shape.ops = r.ops;
+                shape.vectors = r.vectors;
+                shape.complex_factor = is_complex ? r.complex_factor : 1.0;
+                return shape;
+            }
+        }
+    }
+    return shape;
+}
+
+// Flops and bytes of one call with the given integer arguments
+inline std::pair<double, double> stats_evaluate(const stats_shape& shape,
+                                                const std::int64_t* values) {
+    auto get = [&](stats_arg a, double fallback) {
+        return shape.arg[a] < 0 ? fallback : static_cast<double>(values[shape.arg[a]]);
+    };
+    const double m = get(stats_m, 0.0), n = get(stats_n, 0.0), k = get(stats_k, 0.0);
+    const double nrhs = get(stats_nrhs, 0.0), batch = get(stats_batch, 1.0);
+    // side::left is 0
+    const double ka = get(stats_side, 0.0) == 0.0 ? m : n;
+    const double p = std::min(m, n);
+
+    double flops = 0.0, elements = 0.0;
+    switch (shape.formula) {
+        case stats_formula::level1:
+            flops = shape.ops * n;
+            elements = shape.vectors * n;
+            break;
+        case stats_formula::gemv:
+            flops = 2 * m * n;
+            elements = m * n + 2 * m + n;
+            break;
+        case stats_formula::ger:
+            flops = 2 * m * n;
+            elements = 2 * m * n + m + n;
+            break;
+        case stats_formula::symv:
+            flops = 2 * n * n;
+            elements = n * n / 2 + 3 * n;
+            break;
+        case stats_formula::syr:
+            flops = n * n;
+            elements = n * n + n;
+            break;
+        case stats_formula::syr2:
+            flops = 2 * n * n;
+            elements = n * n + 2 * n;
+            break;
+        case stats_formula::trmv:
+            flops = n * n;
+            elements = n * n / 2 + 2 * n;
+            break;
+        case stats_formula::gemm:
+            flops = 2 * m * n * k;
+            elements = m * k + k * n + 2 * m * n;
+            break;
+        case stats_formula::symm:
+            flops = 2 * ka * m * n;
+            elements = ka * ka / 2 + 3 * m * n;
+            break;
+        case stats_formula::syrk:
+            flops = n * n * k;
+            elements = n * k + n * n;
+            break;
+        case stats_formula::syr2k:
+            flops = 2 * n * n * k;
+            elements = 2 * n * k + n * n;
+            break;
+        case stats_formula::trmm:
+            flops = ka * m * n;
+            elements = ka * ka / 2 + 2 * m * n;
+            break;
+        case stats_formula::getrf:
+            flops = 2 * (m * n * p - (m + n) * p * p / 2 + p * p * p / 3);
+            elements = 2 * m * n;
+            break;
+        case stats_formula::potrf:
+            flops = n * n * n / 3;
+            elements = n * n;
+            break;
+        case stats_formula::geqrf:
+            flops = m >= n ? 2 * m * n * n - 2 * n * n * n / 3 : 2 * n * m * m - 2 * m * m * m / 3;
+            elements = 2 * m * n;
+            break;
+        case stats_formula::getrs:
+            flops = 2 * n * n * nrhs;
+            elements = n * n + 2 * n * nrhs;
+            break;
+        case stats_formula::vm: elements = shape.vectors * n; break;
+        default: break;
+    }
+    return { std::max(flops, 0.0) * shape.complex_factor * batch,
+             std::max(elements, 0.0) * shape.element_size * batch };
+}
+
+struct stats_totals {
+    std::uint64_t calls = 0;
+    std::uint64_t flops = 0;
+    std::uint64_t bytes = 0;
+};
+
+using stats_key = std::tuple<oneapi::math::domain, std::string, std::string>;
+
+class thread_stats;
+
+// Tables of the live threads and totals of the threads that exited
+class stats_registry {
+public:
+    static stats_registry& instance() {
+        static stats_registry registry;
+        return registry;
+    }
+
+    void add(thread_stats* table) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        live_.push_back(table);
+    }
+
+    inline void remove(thread_stats* table);
+    inline std::map<stats_key, stats_totals> totals();
+
+    void reset() {
+        auto current = totals();
+        std::lock_guard<std::mutex> lock(mutex_);
+        baseline_ = std::move(current);
+    }
+
+    std::map<stats_key, stats_totals> baseline() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return baseline_;
+    }
+
+private:
+    stats_registry() = default;
+
+    std::mutex mutex_;
+    std::vector<thread_stats*> live_;
+    std::map<stats_key, stats_totals> retired_;
+    std::map<stats_key, stats_totals> baseline_;
+};
+
+class thread_stats {
+public:
+    // Backend functions a thread can count, calls to more are not counted
+    static constexpr std::size_t capacity = 256;
+
+    struct slot {
+        // Published last, the other fields are set when it is not null
+        std::atomic<const char*> name{ nullptr };
+        const std::string* backend = nullptr;
+        oneapi::math::domain domain_id;
+        stats_shape shape;
+        std::atomic<std::uint64_t> calls{ 0 };
+        std::atomic<std::uint64_t> flops{ 0 };
+        std::atomic<std::uint64_t> bytes{ 0 };
+    };
+
+    thread_stats() {
+        stats_registry::instance().add(this);
+    }
+
+    ~thread_stats() {
+        stats_registry::instance().remove(this);
+    }
+
+    thread_stats(const thread_stats&) = delete;
+    thread_stats& operator=(const thread_stats&) = delete;
+
+    // Slot of the function, resolving its formula the first time it is called by this thread
+    template <typename Resolve>
+    slot* find(oneapi::math::domain domain_id, const char* name, const std::string* backend,
+               Resolve&& resolve) {
+        std::size_t hash = (reinterpret_cast<std::uintptr_t>(name) >> 3) ^
+                           (reinterpret_cast<std::uintptr_t>(backend) >> 5);
+        for (std::size_t probe = 0; probe < capacity; ++probe) {
+            slot& s = slots_[(hash + probe) % capacity];
+            const char* slot_name = s.name.load(std::memory_order_relaxed);
+            if (slot_name == name && s.backend == backend)
+                return &s;
+            if (!slot_name) {
+                s.backend = backend;
+                s.domain_id = domain_id;
+                s.shape = resolve();
+                s.name.store(name, std::memory_order_release);
+                return &s;
+            }
+        }
+        return nullptr;
+    }
+
+    static void add(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+        // Only the owning thread writes the counter
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    void accumulate(std::map<stats_key, stats_totals>& totals) const {
+        for (const slot& s : slots_) {
+            const char* name = s.name.load(std::memory_order_acquire);
+            if (!name)
+                continue;
+            auto& t = totals[stats_key{ s.domain_id, name, *s.backend }];
+            t.calls += s.calls.load(std::memory_order_relaxed);
+            t.flops += s.flops.load(std::memory_order_relaxed);
+            t.bytes += s.bytes.load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::array<slot, capacity> slots_;
+};
+
+inline void stats_registry::remove(thread_stats* table) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    table->accumulate(retired_);
+    live_.erase(std::remove(live_.begin(), live_.end(), table), live_.end());
+}
+
+inline std::map<stats_key, stats_totals> stats_registry::totals() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto totals = retired_;
+    for (auto table : live_) {
+        table->accumulate(totals);
+    }
+    return totals;
+}
+
+inline thread_stats& this_thread_stats() {
+    thread_local thread_stats stats;
+    return stats;
+}
+
+template <typename Arg>
+std::int64_t stats_value(const Arg& arg) {
+    if constexpr (std::is_integral_v<Arg> || std::is_enum_v<Arg>)
+        return static_cast<std::int64_t>(arg);
+    else
+        return 0;
+}
+
+// Counts one call of the backend function name with the given arguments
+template <typename... Args>
+void record_call_stats(oneapi::math::domain domain_id, const char* name, const char* arg_names,
+                       const std::string& backend, const Args&... args) {
+    auto* s = this_thread_stats().find(domain_id, name, &backend, [&]() {
+        // The data type is the one of the first buffer or pointer argument
+        std::size_t element_size = 0;
+        bool is_complex = false;
+        auto first_data = [&](std::size_t size, bool complex) {
+            if (!element_size && size) {
+                element_size = size;
+                is_complex = complex;
+            }
+        };
+        (first_data(trace_data_dtype<Args>::size, trace_data_dtype<Args>::is_complex), ...);
+        std::size_t data_args = (std::size_t{ 0 } + ... + (trace_data_dtype<Args>::size != 0));
+        return stats_resolve(domain_id, name, arg_names, element_size, is_complex, data_args);
+    });
+    if (!s)
+        return;
+    std::array<std::int64_t, sizeof...(Args)> values{ stats_value(args)... };
+    auto [flops, bytes] = stats_evaluate(s->shape, values.data());
+    thread_stats::add(s->calls, 1);
+    thread_stats::add(s->flops, static_cast<std::uint64_t>(flops));
+    thread_stats::add(s->bytes, static_cast<std::uint64_t>(bytes));
+}
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_CALL_STATS_HPP_
@@ -0,0 +1,376 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_CALL_TRACER_HPP_
+#define _ONEMATH_CALL_TRACER_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#ifdef ONEMATH_ENABLE_ITT
+#include <ittnotify.h>
+#endif
+
+#include "oneapi/math/types.hpp"
+#include "oneapi/math/detail/backends_table.hpp"
+
+// Tracing of the calls made through the run-time dispatcher.
+//
+// ONEMATH_TRACE=<file> records every call going through the loaders and writes them to <file> at
+// exit as a Chrome trace (chrome://tracing, https://ui.perfetto.dev). A call records its name,
+// data type, integer arguments, backend library and host submission time. When the call returns
+// an event of a queue created with sycl::property::queue::enable_profiling, the device execution
+// of the event is recorded as well.
+// ONEMATH_TRACE_ITT=1 wraps every call in an ITT task, for builds with ENABLE_ITT_TRACING.
+//
+// When neither variable is set, the loaders only test a flag before calling the backend.
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+inline const char* domain_name(oneapi::math::domain domain_id) {
+    switch (domain_id) {
+        case oneapi::math::domain::blas: return "blas";
+        case oneapi::math::domain::dft: return "dft";
+        case oneapi::math::domain::lapack: return "lapack";
+        case oneapi::math::domain::rng: return "rng";
+        case oneapi::math::domain::sparse_blas: return "sparse_blas";
+        case oneapi::math::domain::vm: return "vm";
+        default: return "unknown";
+    }
+}
+
+// Name, size and kind of the data type of a oneMath argument, nullptr for arguments that are not
+// data
+template <typename T>
+struct trace_dtype {
+    static constexpr const char* value = nullptr;
+    static constexpr std::size_t size = 0;
+    static constexpr bool is_complex = false;
+};
+template <typename T>
+struct trace_dtype<const T> : trace_dtype<T> {};
+template <typename T>
+struct trace_dtype<T*> : trace_dtype<T> {};
+template <typename T, int dimensions>
+struct trace_dtype<sycl::buffer<T, dimensions>> : trace_dtype<T> {};
+
+#define DEF_TRACE_DTYPE(type, name, complex)               \
+    template <>                                           \
+    struct trace_dtype<type> {                            \
+        static constexpr const char* value = name;        \
+        static constexpr std::size_t size = sizeof(type); \
+        static constexpr bool is_complex = complex;       \
+    };
+
+DEF_TRACE_DTYPE(float, "float", false)
+DEF_TRACE_DTYPE(double, "double", false)
+DEF_TRACE_DTYPE(sycl::half, "half", false)
+#ifndef __HIPSYCL__
+DEF_TRACE_DTYPE(oneapi::math::bfloat16, "bfloat16", false)
+#endif
+DEF_TRACE_DTYPE(std::complex<float>, "complex<float>", true)
+DEF_TRACE_DTYPE(std::complex<double>, "complex<double>", true)
+
+#undef DEF_TRACE_DTYPE
+
+// Data type of the buffers and pointers of a call, nullptr for scalars: complex routines such as
+// herk, her or zdscal take real scalars before their data
+template <typename T>
+struct trace_data_dtype : trace_dtype<void> {};
+template <typename T>
+struct trace_data_dtype<const T> : trace_data_dtype<T> {};
+template <typename T>
+struct trace_data_dtype<T*> : trace_dtype<T*> {};
+template <typename T, int dimensions>
+struct trace_data_dtype<sycl::buffer<T, dimensions>> : trace_dtype<T> {};
+
+class call_tracer {
+public:
+    struct record {
+        const char* domain;
+        const char* name;
+        std::string backend;
+        const char* dtype;
+        std::vector<std::pair<std::string, std::int64_t>> sizes;
+        std::size_t thread;
+        double submit_begin_us;
+        double submit_end_us;
+        // Event returned by the call until its execution is known
+        std::optional<sycl::event> event;
+        bool on_device = false;
+        double device_begin_us = 0.0;
+        double device_end_us = 0.0;
+    };
+
+    static call_tracer& instance() {
+        static call_tracer tracer;
+        return tracer;
+    }
+
+    bool enabled() const {
+        return !trace_file_.empty() || itt_;
+    }
+
+    bool itt() const {
+        return itt_;
+    }
+
+    double now_us() const {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() -
+                                                         origin_)
+            .count();
+    }
+
+    void add(record&& r) {
+        if (trace_file_.empty())
+            return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        records_.push_back(std::move(r));
+        if (records_.back().event)
+            pending_.push_back(records_.size() - 1);
+        // Completed events are released in sweeps rather than kept until exit. A sweep runs once
+        // the pending events have doubled since the previous one, so that a call costs amortized
+        // constant time however many events are still running.
+        if (pending_.size() < next_sweep_)
+            return;
+        std::size_t still_pending = 0;
+        for (auto index : pending_) {
+            if (!resolve(records_[index], false))
+                pending_[still_pending++] = index;
+        }
+        pending_.resize(still_pending);
+        next_sweep_ = std::max(min_sweep, 2 * still_pending);
+    }
+
+#ifdef ONEMATH_ENABLE_ITT
+    __itt_domain* itt_domain(oneapi::math::domain domain_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& itt_domain = itt_domains_[domain_id];
+        if (!itt_domain)
+            itt_domain = __itt_domain_create(
+                (std::string("oneMath.") + domain_name(domain_id)).c_str());
+        return itt_domain;
+    }
+
+    __itt_string_handle* itt_name(const char* name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& handle = itt_names_[name];
+        if (!handle)
+            handle = __itt_string_handle_create(name);
+        return handle;
+    }
+#endif
+
+    ~call_tracer() {
+        if (trace_file_.empty())
+            return;
+        try {
+            write();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "oneMath: could not write the trace to " << trace_file_ << ": "
+                      << e.what() << '\n';
+        }
+    }
+
+private:
+    call_tracer() : origin_(std::chrono::steady_clock::now()) {
+        if (const char* file = std::getenv("ONEMATH_TRACE"))
+            trace_file_ = file;
+#ifdef ONEMATH_ENABLE_ITT
+        if (const char* itt = std::getenv("ONEMATH_TRACE_ITT"))
+            itt_ = std::string(itt) != "0";
+#endif
+    }
+
+    call_tracer(const call_tracer&) = delete;
+    call_tracer& operator=(const call_tracer&) = delete;
+
+    // Reads the execution of the event of r, returns false while it is running unless wait is set.
+    // Device timestamps do not share the host clock: the execution is placed relative to the end
+    // of the submission, using the delay between submission and start measured on the device.
+    static bool resolve(record& r, bool wait) {
+        try {
+            if (wait)
+                r.event->wait();
+            else if (r.event->get_info<sycl::info::event::command_execution_status>() !=
+                     sycl::info::event_command_status::complete)
+                return false;
+            auto submit =
+                r.event->get_profiling_info<sycl::info::event_profiling::command_submit>();
+            auto start = r.event->get_profiling_info<sycl::info::event_profiling::command_start>();
+            auto end = r.event->get_profiling_info<sycl::info::event_profiling::command_end>();
+            r.device_begin_us = r.submit_end_us + (static_cast<double>(start) - submit) * 1e-3;
+            r.device_end_us = r.device_begin_us + (static_cast<double>(end) - start) * 1e-3;
+            r.on_device = true;
+        }
+        catch (const sycl::exception&) {
+            // Queue created without enable_profiling
+        }
+        r.event.reset();
+        return true;
+    }
+
+    static void write_event(std::ofstream& out, bool& first, const record& r, const char* thread,
+                            double begin_us, double end_us) {
+        out << (first ? "" : ",\n") << "{\"name\":\"" << r.name << "\",\"cat\":\"" << r.domain
+            << "\",\"ph\":\"X\",\"pid\":0,\"tid\":\"" << thread << "\",\"ts\":" << begin_us
+            << ",\"dur\":" << end_us - begin_us << ",\"args\":{\"backend\":\"" << r.backend
+            << "\"";
+        if (r.dtype)
+            out << ",\"dtype\":\"" << r.dtype << "\"";
+        for (auto& size : r.sizes) {
+            out << ",\"" << size.first << "\":" << size.second;
+        }
+        out << "}}";
+        first = false;
+    }
+
+    void write() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::ofstream out(trace_file_);
+        out.precision(15);
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        bool first = true;
+        for (auto index : pending_) {
+            resolve(records_[index], true);
+        }
+        pending_.clear();
+        for (auto& r : records_) {
+            std::string thread = "host " + std::to_string(r.thread);
+            write_event(out, first, r, thread.c_str(), r.submit_begin_us, r.submit_end_us);
+            if (r.on_device)
+                write_event(out, first, r, "device", r.device_begin_us, r.device_end_us);
+        }
+        out << "\n]}\n";
+    }
+
+    std::chrono::steady_clock::time_point origin_;
+    std::string trace_file_;
+    bool itt_ = false;
+    std::mutex mutex_;
+    std::vector<record> records_;
+    std::vector<std::size_t> pending_;
+    static constexpr std::size_t min_sweep = 64;
+    std::size_t next_sweep_ = min_sweep;
+#ifdef ONEMATH_ENABLE_ITT
+    std::map<oneapi::math::domain, __itt_domain*> itt_domains_;
+    std::map<const char*, __itt_string_handle*> itt_names_;
+#endif
+};
+
+inline bool call_tracing_enabled() {
+    static const bool enabled = call_tracer::instance().enabled();
+    return enabled;
+}
+
+// Records one call from the start of its submission to the destruction of the trace
+class call_trace {
+public:
+    template <typename... Args>
+    call_trace(oneapi::math::domain domain_id, const char* name, const char* arg_names,
+               const std::string& backend, const Args&... args) {
+        auto& tracer = call_tracer::instance();
+        record_.domain = domain_name(domain_id);
+        record_.name = name;
+        record_.backend = backend;
+        record_.dtype = nullptr;
+        ((record_.dtype = record_.dtype ? record_.dtype : trace_data_dtype<Args>::value), ...);
+        std::string names(arg_names);
+        std::size_t begin = 0;
+        (add_size(names, begin, args), ...);
+        record_.thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+#ifdef ONEMATH_ENABLE_ITT
+        itt_domain_ = tracer.itt() ? tracer.itt_domain(domain_id) : nullptr;
+        if (itt_domain_)
+            __itt_task_begin(itt_domain_, __itt_null, __itt_null, tracer.itt_name(name));
+#endif
+        record_.submit_begin_us = tracer.now_us();
+    }
+
+    call_trace(const call_trace&) = delete;
+    call_trace& operator=(const call_trace&) = delete;
+
+    // Closes the record when the call returns or throws, so that ITT tasks stay balanced
+    ~call_trace() {
+        auto& tracer = call_tracer::instance();
+        record_.submit_end_us = tracer.now_us();
+#ifdef ONEMATH_ENABLE_ITT
+        if (itt_domain_)
+            __itt_task_end(itt_domain_);
+#endif
+        tracer.add(std::move(record_));
+    }
+
+    // Attaches the result of the call, whose event gives the execution on the device
+    template <typename Result>
+    void end(const Result& result) {
+        if constexpr (std::is_same_v<Result, sycl::event>)
+            record_.event = result;
+    }
+
+private:
+    // Pairs the integer arguments with their names, taken from the stringized argument list
+    template <typename Arg>
+    void add_size(const std::string& names, std::size_t& begin, const Arg& arg) {
+        std::size_t end = names.find(',', begin);
+        if (end == std::string::npos)
+            end = names.size();
+        if constexpr (std::is_integral_v<Arg> && !std::is_same_v<Arg, bool>) {
+            std::size_t first = names.find_first_not_of(" \t\n\\", begin);
+            std::size_t last = names.find_last_not_of(" \t\n\\", end - 1);
+            record_.sizes.emplace_back(names.substr(first, last - first + 1),
+                                       static_cast<std::int64_t>(arg));
+        }
+        begin = end + 1;
+    }
+
+    call_tracer::record record_;
+#ifdef ONEMATH_ENABLE_ITT
+    __itt_domain* itt_domain_;
+#endif
+};
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_CALL_TRACER_HPP_
@@ -22,12 +22,24 @@
 
 #include <cstdint>
 #include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 #include "oneapi/math/detail/backends_table.hpp"
+#include "oneapi/math/detail/dispatch_profiler.hpp"
+#include "call_stats.hpp"
+#include "call_tracer.hpp"
 #include "oneapi/math/detail/exceptions.hpp"
 
 #define SPEC_VERSION 1
 
+// Calls fn of the function table of the queue's device with the remaining arguments, counted in
+// oneapi::math::stats and traced when tracing is enabled
+#define CALL_TABLE_FN(tables, libkey, queue, fn, ...) \
+    (tables).call(libkey, queue, #fn, #__VA_ARGS__,    \
+                  &std::remove_reference_t<decltype(tables)>::table_type::fn, __VA_ARGS__)
+
 #ifdef __linux__
 #include <dlfcn.h>
 #define LIB_TYPE                 void*
@@ -59,15 +71,39 @@ class table_initializer {
     using dlhandle = std::unique_ptr<LIB_TYPE, handle_deleter>;
 
 public:
+    using table_type = function_table_t;
+
     function_table_t& operator[](std::pair<oneapi::math::device, sycl::queue> device_queue_pair) {
+        dispatch_timer timer(dispatch_stage::table_lookup);
         auto lib = tables.find(device_queue_pair.first);
         if (lib != tables.end())
             return lib->second;
         return add_table(device_queue_pair.first, device_queue_pair.second);
     }
 
+    template <typename Fn, typename... Args>
+    auto call(oneapi::math::device key, sycl::queue& queue, const char* name,
+              const char* arg_names, Fn function_table_t::*fn, Args&&... args) {
+        auto& table = (*this)[{ key, queue }];
+        const std::string& backend = library_names[key];
+        record_call_stats(domain_id, name, arg_names, backend, args...);
+        if (!call_tracing_enabled())
+            return (table.*fn)(std::forward<Args>(args)...);
+
+        call_trace trace(domain_id, name, arg_names, backend, args...);
+        if constexpr (std::is_void_v<decltype((table.*fn)(std::forward<Args>(args)...))>) {
+            (table.*fn)(std::forward<Args>(args)...);
+        }
+        else {
+            auto result = (table.*fn)(std::forward<Args>(args)...);
+            trace.end(result);
+            return result;
+        }
+    }
+
 private:
-#if defined(ENABLE_GENERIC_BLAS_BACKEND) || defined(ENABLE_PORTFFT_BACKEND)
+#if defined(ENABLE_GENERIC_BLAS_BACKEND) || defined(ENABLE_PORTFFT_BACKEND) || \
+    defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
     static constexpr bool is_generic_device_supported = true;
 #else
     static constexpr bool is_generic_device_supported = false;
@@ -98,11 +134,14 @@ private:
 
     function_table_t& add_table(oneapi::math::device key, sycl::queue& q) {
         dlhandle handle;
+        const char* loaded_libname = nullptr;
         // check all available libraries for the key(device)
         for (const char* libname : libraries[domain_id][key]) {
             handle = dlhandle{ ::GET_LIB_HANDLE(libname) };
-            if (handle)
+            if (handle) {
+                loaded_libname = libname;
                 break;
+            }
         }
         if (!handle) {
             if (!is_generic_device_supported && key == oneapi::math::device::generic_device) {
@@ -124,12 +163,14 @@ private:
             throw math::specification_mismatch();
 
         handles[key] = std::move(handle);
+        library_names[key] = loaded_libname;
         tables[key] = *t;
         return *t;
     }
 
     std::map<oneapi::math::device, function_table_t> tables;
     std::map<oneapi::math::device, dlhandle> handles;
+    std::map<oneapi::math::device, std::string> library_names;
 };
 
 } //namespace detail
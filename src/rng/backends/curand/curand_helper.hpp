@@ -65,7 +65,10 @@
 #include <cuda.h>
 #include <curand.h>
 
+#include <cmath>
 #include <complex>
+#include <type_traits>
+#include <vector>
 
 #include "oneapi/math/types.hpp"
 
@@ -318,6 +321,183 @@ static inline sycl::event sample_bernoulli_from_uniform(sycl::queue& queue, floa
     return queue.parallel_for(n, [=](sycl::id<1> id) { out[id] = in[id] < p; });
 }
 
+// Static template functions oneapi::math::rng::curand::sample_exponential_from_uniform
+// for Buffer and USM APIs
+//
+// cuRAND has no built-in exponential distribution. `curandGenerateUniform' generates uniform
+// random numbers on (0, 1], so the inverse CDF a - beta * log(u) is always finite.
+// The transformation is applied in place, by a kernel following the host task that fills the
+// output: the library kernel writing the uniforms cannot be extended to apply it.
+//
+// Supported types:
+//      float
+//      double
+//
+// Input arguments:
+//      queue - the queue to submit the kernel to
+//      a     - displacement
+//      beta  - scalefactor
+//      r     - buffer of uniform random numbers, overwritten with the result
+template <typename T>
+static inline void sample_exponential_from_uniform(sycl::queue& queue, T a, T beta, std::int64_t n,
+                                                   sycl::buffer<T, 1>& r) {
+    queue.submit([&](sycl::handler& cgh) {
+        auto acc = r.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.parallel_for(n, [=](sycl::id<1> id) { acc[id] = a - beta * sycl::log(acc[id]); });
+    });
+}
+
+template <typename T>
+static inline sycl::event sample_exponential_from_uniform(sycl::queue& queue, T a, T beta,
+                                                          std::int64_t n, T* r,
+                                                          sycl::event dependency) {
+    return queue.parallel_for(n, dependency,
+                              [=](sycl::id<1> id) { r[id] = a - beta * sycl::log(r[id]); });
+}
+
+// Static template functions oneapi::math::rng::curand::sample_geometric_from_uniform
+// for Buffer and USM APIs
+//
+// cuRAND has no built-in geometric distribution. The implementation inverts the CDF
+// of uniformly-generated random numbers on (0, 1]: floor(log(u) / log(1 - p)).
+//
+// Supported types:
+//      std::int32_t
+//      std::uint32_t
+//
+// Input arguments:
+//      queue - the queue to submit the kernel to
+//      p     - success probablity of a trial
+//      in    - buffer containing uniformly-generated random numbers
+//      out   - buffer to store geometric random numbers
+template <typename T>
+static inline void sample_geometric_from_uniform(sycl::queue& queue, float p, std::int64_t n,
+                                                 sycl::buffer<float, 1> in,
+                                                 sycl::buffer<T, 1>& out) {
+    const float log_q = std::log1p(-p);
+    queue.submit([&](sycl::handler& cgh) {
+        auto acc_in = in.template get_access<sycl::access::mode::read>(cgh);
+        auto acc_out = out.template get_access<sycl::access::mode::write>(cgh);
+        cgh.parallel_for(n, [=](sycl::id<1> id) {
+            acc_out[id] = static_cast<T>(sycl::floor(sycl::log(acc_in[id]) / log_q));
+        });
+    });
+}
+
+template <typename T>
+static inline sycl::event sample_geometric_from_uniform(sycl::queue& queue, float p, std::int64_t n,
+                                                        float* in, T* out, sycl::event dependency) {
+    const float log_q = std::log1p(-p);
+    return queue.parallel_for(n, dependency, [=](sycl::id<1> id) {
+        out[id] = static_cast<T>(sycl::floor(sycl::log(in[id]) / log_q));
+    });
+}
+
+// Static template functions oneapi::math::rng::curand::multivariate_normal_transform for
+// Buffer and USM APIs
+//
+// cuRAND has no multivariate normal generator. `curandGenerateNormal' fills the output with
+// n * dimen standard normal numbers, and this kernel turns each group of dimen numbers z into
+// mean + T * z in place, one work-item per vector. The kernel is instantiated for every
+// dimen up to max_multivariate_normal_dimen so that the triangular product is fully unrolled and
+// z stays in registers.
+//
+// Supported types:
+//      float
+//      double
+//
+// Input arguments:
+//      queue - the queue to submit the kernel to
+//      dimen - dimension of the vectors
+//      mean  - mean vector
+//      t     - lower triangular Cholesky factor, row-major dimen * dimen
+//      n     - number of vectors
+//      r     - buffer of standard normal numbers, overwritten with the result
+constexpr std::int32_t max_multivariate_normal_dimen = 16;
+
+template <typename T, std::int32_t Dimen>
+struct multivariate_normal_params {
+    T mean[Dimen];
+    T t[Dimen * (Dimen + 1) / 2]; // lower triangle, packed by rows
+};
+
+template <typename T, std::int32_t Dimen>
+static inline multivariate_normal_params<T, Dimen> pack_multivariate_normal_params(
+    const std::vector<T>& mean, const std::vector<T>& t) {
+    multivariate_normal_params<T, Dimen> params;
+    for (std::int32_t i = 0; i < Dimen; i++) {
+        params.mean[i] = mean[i];
+        for (std::int32_t j = 0; j <= i; j++) {
+            params.t[i * (i + 1) / 2 + j] = t[i * Dimen + j];
+        }
+    }
+    return params;
+}
+
+template <typename T, std::int32_t Dimen, typename Output>
+static inline void multivariate_normal_transform_vector(
+    const multivariate_normal_params<T, Dimen>& params, Output v, std::int64_t offset) {
+    T z[Dimen];
+#pragma unroll
+    for (std::int32_t i = 0; i < Dimen; i++) {
+        z[i] = v[offset + i];
+    }
+#pragma unroll
+    for (std::int32_t i = 0; i < Dimen; i++) {
+        T res = params.mean[i];
+#pragma unroll
+        for (std::int32_t j = 0; j <= i; j++) {
+            res += params.t[i * (i + 1) / 2 + j] * z[j];
+        }
+        v[offset + i] = res;
+    }
+}
+
+// Calls launch(std::integral_constant<std::int32_t, dimen>) for the runtime dimen
+template <std::int32_t Dimen = 1, typename Launch>
+static inline auto dispatch_multivariate_normal_dimen(std::int32_t dimen, Launch&& launch) {
+    if constexpr (Dimen == max_multivariate_normal_dimen) {
+        return launch(std::integral_constant<std::int32_t, Dimen>{});
+    }
+    else {
+        if (dimen == Dimen) {
+            return launch(std::integral_constant<std::int32_t, Dimen>{});
+        }
+        return dispatch_multivariate_normal_dimen<Dimen + 1>(dimen, launch);
+    }
+}
+
+template <typename T>
+static inline void multivariate_normal_transform(sycl::queue& queue, std::int32_t dimen,
+                                                 const std::vector<T>& mean,
+                                                 const std::vector<T>& t, std::int64_t n,
+                                                 sycl::buffer<T, 1>& r) {
+    dispatch_multivariate_normal_dimen(dimen, [&](auto dimen_constant) {
+        constexpr std::int32_t Dimen = decltype(dimen_constant)::value;
+        auto params = pack_multivariate_normal_params<T, Dimen>(mean, t);
+        queue.submit([&](sycl::handler& cgh) {
+            auto acc = r.template get_access<sycl::access::mode::read_write>(cgh);
+            cgh.parallel_for(n, [=](sycl::id<1> id) {
+                multivariate_normal_transform_vector(params, acc, id[0] * Dimen);
+            });
+        });
+    });
+}
+
+template <typename T>
+static inline sycl::event multivariate_normal_transform(sycl::queue& queue, std::int32_t dimen,
+                                                        const std::vector<T>& mean,
+                                                        const std::vector<T>& t, std::int64_t n,
+                                                        T* r, sycl::event dependency) {
+    return dispatch_multivariate_normal_dimen(dimen, [&](auto dimen_constant) {
+        constexpr std::int32_t Dimen = decltype(dimen_constant)::value;
+        auto params = pack_multivariate_normal_params<T, Dimen>(mean, t);
+        return queue.parallel_for(n, dependency, [=](sycl::id<1> id) {
+            multivariate_normal_transform_vector(params, r, id[0] * Dimen);
+        });
+    });
+}
+
 } // namespace curand
 } // namespace rng
 } // namespace math
@@ -88,7 +88,9 @@ namespace curand {
 class mrg32k3a_impl : public oneapi::math::rng::detail::engine_impl {
 public:
     mrg32k3a_impl(sycl::queue queue, std::uint32_t seed)
-            : oneapi::math::rng::detail::engine_impl(queue) {
+            : oneapi::math::rng::detail::engine_impl(queue),
+              seed_(seed),
+              offset_(0) {
         curandStatus_t status;
         CURAND_CALL(curandCreateGenerator, status, &engine_, CURAND_RNG_PSEUDO_MRG32K3A);
         CURAND_CALL(curandSetPseudoRandomGeneratorSeed, status, engine_, (unsigned long long)seed);
@@ -110,6 +112,7 @@ public:
     virtual void generate(
         const oneapi::math::rng::uniform<float, oneapi::math::rng::uniform_method::standard>& distr,
         std::int64_t n, sycl::buffer<float, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
@@ -123,6 +126,7 @@ public:
     virtual void generate(const oneapi::math::rng::uniform<
                               double, oneapi::math::rng::uniform_method::standard>& distr,
                           std::int64_t n, sycl::buffer<double, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
@@ -137,6 +141,7 @@ public:
                               std::int32_t, oneapi::math::rng::uniform_method::standard>& distr,
                           std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
         sycl::buffer<std::uint32_t, 1> ib(n);
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = ib.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](std::uint32_t* r_ptr) {
@@ -150,6 +155,7 @@ public:
     virtual void generate(
         const oneapi::math::rng::uniform<float, oneapi::math::rng::uniform_method::accurate>& distr,
         std::int64_t n, sycl::buffer<float, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
@@ -163,6 +169,7 @@ public:
     virtual void generate(const oneapi::math::rng::uniform<
                               double, oneapi::math::rng::uniform_method::accurate>& distr,
                           std::int64_t n, sycl::buffer<double, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
@@ -176,6 +183,7 @@ public:
     virtual void generate(const oneapi::math::rng::gaussian<
                               float, oneapi::math::rng::gaussian_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<float, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
@@ -189,6 +197,7 @@ public:
     virtual void generate(const oneapi::math::rng::gaussian<
                               double, oneapi::math::rng::gaussian_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<double, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
@@ -218,6 +227,7 @@ public:
     virtual void generate(const oneapi::math::rng::lognormal<
                               float, oneapi::math::rng::lognormal_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<float, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
@@ -231,6 +241,7 @@ public:
     virtual void generate(const oneapi::math::rng::lognormal<
                               double, oneapi::math::rng::lognormal_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<double, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
@@ -285,8 +296,129 @@ public:
             "ICDF method not used for pseudorandom generators in cuRAND backend");
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        increment_internal_offset(n);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r_ptr, n);
+            });
+        });
+        sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        increment_internal_offset(n);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniformDouble, status, engine_, r_ptr, n);
+            });
+        });
+        sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        sycl::buffer<float, 1> fb(n);
+        increment_internal_offset(n);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = fb.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r_ptr, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r);
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        sycl::buffer<float, 1> fb(n);
+        increment_internal_offset(n);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = fb.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r_ptr, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r);
+    }
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        increment_internal_offset(n_gen);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormal, status, engine_, r_ptr, n_gen, 0.0, 1.0);
+            });
+        });
+        multivariate_normal_transform(queue_, distr.dimen(), distr.mean(), distr.cholesky_factor(),
+                                      n, r);
+    }
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        increment_internal_offset(n_gen);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormalDouble, status, engine_, r_ptr, n_gen, 0.0, 1.0);
+            });
+        });
+        multivariate_normal_transform(queue_, distr.dimen(), distr.mean(), distr.cholesky_factor(),
+                                      n, r);
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
+        increment_internal_offset(n);
         queue_.submit([&](sycl::handler& cgh) {
             auto acc = r.template get_access<sycl::access::mode::read_write>(cgh);
             onemath_curand_host_task(cgh, acc, engine_, [=](std::uint32_t* r_ptr) {
@@ -302,6 +434,7 @@ public:
         const oneapi::math::rng::uniform<float, oneapi::math::rng::uniform_method::standard>& distr,
         std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -316,6 +449,7 @@ public:
             distr,
         std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -337,6 +471,7 @@ public:
         std::uint32_t* ib = usm_ib.get();
         sycl::event::wait_and_throw(dependencies);
 
+        increment_internal_offset(n);
         sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -352,6 +487,7 @@ public:
         const oneapi::math::rng::uniform<float, oneapi::math::rng::uniform_method::accurate>& distr,
         std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -367,6 +503,7 @@ public:
             distr,
         std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -381,6 +518,7 @@ public:
             distr,
         std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         return queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -395,6 +533,7 @@ public:
             distr,
         std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         return queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -427,6 +566,7 @@ public:
             distr,
         std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         return queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -440,6 +580,7 @@ public:
                                            oneapi::math::rng::lognormal_method::box_muller2>& distr,
         std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         return queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -504,9 +645,157 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r, n);
+            });
+        });
+        return sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r,
+                                               generate_event);
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniformDouble, status, engine_, r, n);
+            });
+        });
+        return sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r,
+                                               generate_event);
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        auto usm_deleter = [this](float* ptr) {
+            sycl::free(ptr, this->queue_);
+        };
+        std::unique_ptr<float, decltype(usm_deleter)> usm_fb(sycl::malloc_device<float>(n, queue_),
+                                                             usm_deleter);
+        float* fb = usm_fb.get();
+        sycl::event::wait_and_throw(dependencies);
+
+        increment_internal_offset(n);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, fb, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r, generate_event)
+            .wait_and_throw();
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        auto usm_deleter = [this](float* ptr) {
+            sycl::free(ptr, this->queue_);
+        };
+        std::unique_ptr<float, decltype(usm_deleter)> usm_fb(sycl::malloc_device<float>(n, queue_),
+                                                             usm_deleter);
+        float* fb = usm_fb.get();
+        sycl::event::wait_and_throw(dependencies);
+
+        increment_internal_offset(n);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, fb, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r, generate_event)
+            .wait_and_throw();
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n_gen);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormal, status, engine_, r, n_gen, 0.0, 1.0);
+            });
+        });
+        return multivariate_normal_transform(queue_, distr.dimen(), distr.mean(),
+                                             distr.cholesky_factor(), n, r, generate_event);
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n_gen);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormalDouble, status, engine_, r, n_gen, 0.0, 1.0);
+            });
+        });
+        return multivariate_normal_transform(queue_, distr.dimen(), distr.mean(),
+                                             distr.cholesky_factor(), n, r, generate_event);
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
+        increment_internal_offset(n);
         return queue_.submit([&](sycl::handler& cgh) {
             onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
                 curandStatus_t status;
@@ -520,13 +809,29 @@ public:
     }
 
     virtual void skip_ahead(std::uint64_t num_to_skip) override {
-        curandStatus_t status;
-        CURAND_CALL(curandSetGeneratorOffset, status, engine_, num_to_skip);
+        // curandSetGeneratorOffset sets an absolute offset, so accumulate it on top of the
+        // numbers already generated by this engine
+        increment_internal_offset(num_to_skip);
+        set_internal_offset();
     }
 
     virtual void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
-        throw oneapi::math::unimplemented("rng", "skip_ahead",
-                                          "initializer list unsupported by cuRAND backend");
+        // cuRAND offsets are 64-bit, so only the lowest word of the partitioned number of
+        // skipped elements may be non-zero. The generator state is opaque, so the precomputed
+        // jump matrices cannot be applied here; device API mrg32k3a engines use them instead,
+        // including when they are constructed with an offset on the host
+        auto it = num_to_skip.begin();
+        if (it == num_to_skip.end()) {
+            return;
+        }
+        std::uint64_t low = *it;
+        for (++it; it != num_to_skip.end(); ++it) {
+            if (*it != 0) {
+                throw oneapi::math::unimplemented(
+                    "rng", "skip_ahead", "skip on 2^64 or more unsupported by cuRAND backend");
+            }
+        }
+        skip_ahead(low);
     }
 
     virtual void leapfrog(std::uint64_t idx, std::uint64_t stride) override {
@@ -540,6 +845,18 @@ public:
 private:
     curandGenerator_t engine_;
     std::uint32_t seed_;
+    std::uint64_t offset_;
+
+    void increment_internal_offset(std::uint64_t n) {
+        offset_ += n;
+    }
+
+    void set_internal_offset() {
+        // The generations already submitted must run from the current offset
+        queue_.wait_and_throw();
+        curandStatus_t status;
+        CURAND_CALL(curandSetGeneratorOffset, status, engine_, offset_);
+    }
 };
 #else // cuRAND backend is currently not supported on Windows
 class mrg32k3a_impl : public oneapi::math::rng::detail::engine_impl {
@@ -658,6 +975,58 @@ public:
         throw oneapi::math::unimplemented("rng", "mrg32ka engine");
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         throw oneapi::math::unimplemented("rng", "mrg32ka engine");
@@ -792,6 +1161,73 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         throw oneapi::math::unimplemented("rng", "mrg32ka engine");
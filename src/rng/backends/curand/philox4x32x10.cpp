@@ -308,6 +308,120 @@ public:
             "ICDF method not used for pseudorandom generators in cuRAND backend");
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r_ptr, n);
+            });
+        });
+        sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniformDouble, status, engine_, r_ptr, n);
+            });
+        });
+        sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "beta distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "beta distribution unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        sycl::buffer<float, 1> fb(n);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = fb.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r_ptr, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r);
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        sycl::buffer<float, 1> fb(n);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = fb.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r_ptr, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r);
+    }
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "philox4x32x10 engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormal, status, engine_, r_ptr, n_gen, 0.0, 1.0);
+            });
+        });
+        multivariate_normal_transform(queue_, distr.dimen(), distr.mean(), distr.cholesky_factor(),
+                                      n, r);
+    }
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "philox4x32x10 engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+            onemath_curand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormalDouble, status, engine_, r_ptr, n_gen, 0.0, 1.0);
+            });
+        });
+        multivariate_normal_transform(queue_, distr.dimen(), distr.mean(), distr.cholesky_factor(),
+                                      n, r);
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         queue_.submit([&](sycl::handler& cgh) {
@@ -526,6 +640,147 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, r, n);
+            });
+        });
+        return sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r,
+                                               generate_event);
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniformDouble, status, engine_, r, n);
+            });
+        });
+        return sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r,
+                                               generate_event);
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "gamma distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "beta distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine",
+                                          "beta distribution unsupported by cuRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        auto usm_deleter = [this](float* ptr) {
+            sycl::free(ptr, this->queue_);
+        };
+        std::unique_ptr<float, decltype(usm_deleter)> usm_fb(sycl::malloc_device<float>(n, queue_),
+                                                             usm_deleter);
+        float* fb = usm_fb.get();
+        sycl::event::wait_and_throw(dependencies);
+
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, fb, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r, generate_event)
+            .wait_and_throw();
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        auto usm_deleter = [this](float* ptr) {
+            sycl::free(ptr, this->queue_);
+        };
+        std::unique_ptr<float, decltype(usm_deleter)> usm_fb(sycl::malloc_device<float>(n, queue_),
+                                                             usm_deleter);
+        float* fb = usm_fb.get();
+        sycl::event::wait_and_throw(dependencies);
+
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateUniform, status, engine_, fb, n);
+            });
+        });
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r, generate_event)
+            .wait_and_throw();
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "philox4x32x10 engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        sycl::event::wait_and_throw(dependencies);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormal, status, engine_, r, n_gen, 0.0, 1.0);
+            });
+        });
+        return multivariate_normal_transform(queue_, distr.dimen(), distr.mean(),
+                                             distr.cholesky_factor(), n, r, generate_event);
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "philox4x32x10 engine",
+                "multivariate_normal dimen above 16 unsupported by cuRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        sycl::event::wait_and_throw(dependencies);
+        sycl::event generate_event = queue_.submit([&](sycl::handler& cgh) {
+            onemath_curand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                curandStatus_t status;
+                CURAND_CALL(curandGenerateNormalDouble, status, engine_, r, n_gen, 0.0, 1.0);
+            });
+        });
+        return multivariate_normal_transform(queue_, distr.dimen(), distr.mean(),
+                                             distr.cholesky_factor(), n, r, generate_event);
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
@@ -680,6 +935,58 @@ public:
         throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
@@ -814,6 +1121,73 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
+        return sycl::event{};
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         throw oneapi::math::unimplemented("rng", "philox4x32x10 engine");
@@ -304,6 +304,151 @@ public:
         });
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngExponential(VSL_RNG_METHOD_EXPONENTIAL_ICDF,
+                                 static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                 get_raw_ptr(acc_r), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngExponential(VSL_RNG_METHOD_EXPONENTIAL_ICDF,
+                                 static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                 get_raw_ptr(acc_r), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGamma(VSL_RNG_METHOD_GAMMA_GNORM,
+                           static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                           get_raw_ptr(acc_r), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGamma(VSL_RNG_METHOD_GAMMA_GNORM,
+                           static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                           get_raw_ptr(acc_r), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngBeta(VSL_RNG_METHOD_BETA_CJA,
+                          static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                          get_raw_ptr(acc_r), distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngBeta(VSL_RNG_METHOD_BETA_CJA,
+                          static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                          get_raw_ptr(acc_r), distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                viRngGeometric(VSL_RNG_METHOD_GEOMETRIC_ICDF,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               get_raw_ptr(acc_r), distr.p());
+            });
+        });
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                std::uint32_t* r_ptr = get_raw_ptr(acc_r);
+                viRngGeometric(VSL_RNG_METHOD_GEOMETRIC_ICDF,
+                               static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                               reinterpret_cast<std::int32_t*>(r_ptr), distr.p());
+            });
+        });
+    }
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2,
+                                static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                get_raw_ptr(acc_r), distr.dimen(), VSL_MATRIX_STORAGE_FULL,
+                                distr.mean().data(), distr.cholesky_factor().data());
+            });
+        });
+    }
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) override {
+        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2,
+                                static_cast<VSLStreamStatePtr>(get_raw_ptr(acc_stream)), n,
+                                get_raw_ptr(acc_r), distr.dimen(), VSL_MATRIX_STORAGE_FULL,
+                                distr.mean().data(), distr.cholesky_factor().data());
+            });
+        });
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
@@ -536,6 +681,134 @@ public:
         });
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngExponential(VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n, r, distr.a(),
+                                 distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngExponential(VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n, r, distr.a(),
+                                 distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGamma(VSL_RNG_METHOD_GAMMA_GNORM, stream, n, r, distr.alpha(), distr.a(),
+                           distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGamma(VSL_RNG_METHOD_GAMMA_GNORM, stream, n, r, distr.alpha(), distr.a(),
+                           distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngBeta(VSL_RNG_METHOD_BETA_CJA, stream, n, r, distr.p(), distr.q(), distr.a(),
+                          distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngBeta(VSL_RNG_METHOD_BETA_CJA, stream, n, r, distr.p(), distr.q(), distr.a(),
+                          distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                viRngGeometric(VSL_RNG_METHOD_GEOMETRIC_ICDF, stream, n, r, distr.p());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                viRngGeometric(VSL_RNG_METHOD_GEOMETRIC_ICDF, stream, n,
+                               reinterpret_cast<std::int32_t*>(r), distr.p());
+            });
+        });
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vsRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2, stream, n, r, distr.dimen(),
+                                VSL_MATRIX_STORAGE_FULL, distr.mean().data(),
+                                distr.cholesky_factor().data());
+            });
+        });
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                vdRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_BOXMULLER2, stream, n, r, distr.dimen(),
+                                VSL_MATRIX_STORAGE_FULL, distr.mean().data(),
+                                distr.cholesky_factor().data());
+            });
+        });
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
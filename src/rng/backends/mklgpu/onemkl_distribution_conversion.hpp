@@ -75,6 +75,31 @@ struct convert_method_t<poisson_method::gaussian_icdf_based> {
     using type = oneapi::mkl::rng::poisson_method::gaussian_icdf_based;
 };
 
+template <>
+struct convert_method_t<exponential_method::icdf> {
+    using type = oneapi::mkl::rng::exponential_method::icdf;
+};
+
+template <>
+struct convert_method_t<gamma_method::marsaglia> {
+    using type = oneapi::mkl::rng::gamma_method::marsaglia;
+};
+
+template <>
+struct convert_method_t<beta_method::cja> {
+    using type = oneapi::mkl::rng::beta_method::cja;
+};
+
+template <>
+struct convert_method_t<geometric_method::icdf> {
+    using type = oneapi::mkl::rng::geometric_method::icdf;
+};
+
+template <>
+struct convert_method_t<multivariate_normal_method::box_muller2> {
+    using type = oneapi::mkl::rng::gaussian_mv_method::box_muller2;
+};
+
 template <class DistributionT>
 struct convert_distrib_t;
 
@@ -120,6 +145,50 @@ struct convert_distrib_t<poisson<T, Method>> {
     }
 };
 
+template <class T, class Method>
+struct convert_distrib_t<exponential<T, Method>> {
+    auto operator()(exponential<T, Method> distribution) {
+        using onemkl_method_t = typename convert_method_t<Method>::type;
+        return oneapi::mkl::rng::exponential<T, onemkl_method_t>(distribution.a(),
+                                                                 distribution.beta());
+    }
+};
+
+template <class T, class Method>
+struct convert_distrib_t<gamma<T, Method>> {
+    auto operator()(gamma<T, Method> distribution) {
+        using onemkl_method_t = typename convert_method_t<Method>::type;
+        return oneapi::mkl::rng::gamma<T, onemkl_method_t>(
+            distribution.alpha(), distribution.a(), distribution.beta());
+    }
+};
+
+template <class T, class Method>
+struct convert_distrib_t<beta<T, Method>> {
+    auto operator()(beta<T, Method> distribution) {
+        using onemkl_method_t = typename convert_method_t<Method>::type;
+        return oneapi::mkl::rng::beta<T, onemkl_method_t>(distribution.p(), distribution.q(),
+                                                          distribution.a(), distribution.b());
+    }
+};
+
+template <class T, class Method>
+struct convert_distrib_t<geometric<T, Method>> {
+    auto operator()(geometric<T, Method> distribution) {
+        using onemkl_method_t = typename convert_method_t<Method>::type;
+        return oneapi::mkl::rng::geometric<T, onemkl_method_t>(distribution.p());
+    }
+};
+
+template <class T, class Method>
+struct convert_distrib_t<multivariate_normal<T, Method>> {
+    auto operator()(multivariate_normal<T, Method> distribution) {
+        using onemkl_method_t = typename convert_method_t<Method>::type;
+        return oneapi::mkl::rng::gaussian_mv<T, oneapi::mkl::rng::layout::full, onemkl_method_t>(
+            distribution.dimen(), distribution.mean(), distribution.cholesky_factor());
+    }
+};
+
 template <class DistributionT>
 inline auto get_onemkl_distribution(DistributionT distribution) {
     return convert_distrib_t<DistributionT>()(distribution);
@@ -111,7 +111,7 @@ public:
         ROCRAND_CALL(rocrand_set_seed, status, engine_, (unsigned long long)seed_);
 
         // Allign this->engine_'s offset state with other->engine_'s offset
-        skip_ahead(offset_);
+        set_internal_offset();
     }
 
     // Buffers API
@@ -389,6 +389,151 @@ public:
         increment_internal_offset(n);
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+                onemath_rocrand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform, status, engine_, r_ptr, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+                onemath_rocrand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform_double, status, engine_, r_ptr, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by rocRAND backend");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by rocRAND backend");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by rocRAND backend");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by rocRAND backend");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        sycl::buffer<float, 1> fb(n);
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                auto acc = fb.get_access<sycl::access::mode::read_write>(cgh);
+                onemath_rocrand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform, status, engine_, r_ptr, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r);
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        sycl::buffer<float, 1> fb(n);
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                auto acc = fb.get_access<sycl::access::mode::read_write>(cgh);
+                onemath_rocrand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform, status, engine_, r_ptr, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r);
+    }
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by rocRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+                onemath_rocrand_host_task(cgh, acc, engine_, [=](float* r_ptr) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_normal, status, engine_, r_ptr, n_gen, 0.0, 1.0);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n_gen);
+
+        multivariate_normal_transform(queue_, distr.dimen(), distr.mean(), distr.cholesky_factor(),
+                                      n, r);
+    }
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by rocRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                auto acc = r.get_access<sycl::access::mode::read_write>(cgh);
+                onemath_rocrand_host_task(cgh, acc, engine_, [=](double* r_ptr) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_normal_double, status, engine_, r_ptr, n_gen,
+                                 0.0, 1.0);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n_gen);
+
+        multivariate_normal_transform(queue_, distr.dimen(), distr.mean(), distr.cholesky_factor(),
+                                      n, r);
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         queue_
@@ -693,6 +838,174 @@ public:
         return event;
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                onemath_rocrand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform, status, engine_, r, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        return sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                onemath_rocrand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform_double, status, engine_, r, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        return sample_exponential_from_uniform(queue_, distr.a(), distr.beta(), n, r);
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by rocRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "gamma distribution unsupported by rocRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by rocRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine",
+                                          "beta distribution unsupported by rocRAND backend");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        auto usm_deleter = [this](float* ptr) {
+            sycl::free(ptr, this->queue_);
+        };
+        std::unique_ptr<float, decltype(usm_deleter)> usm_fb(sycl::malloc_device<float>(n, queue_),
+                                                             usm_deleter);
+        float* fb = usm_fb.get();
+        sycl::event::wait_and_throw(dependencies);
+
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                onemath_rocrand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform, status, engine_, fb, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r).wait_and_throw();
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        auto usm_deleter = [this](float* ptr) {
+            sycl::free(ptr, this->queue_);
+        };
+        std::unique_ptr<float, decltype(usm_deleter)> usm_fb(sycl::malloc_device<float>(n, queue_),
+                                                             usm_deleter);
+        float* fb = usm_fb.get();
+        sycl::event::wait_and_throw(dependencies);
+
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                onemath_rocrand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_uniform, status, engine_, fb, n);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n);
+
+        sample_geometric_from_uniform(queue_, distr.p(), n, fb, r).wait_and_throw();
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by rocRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        sycl::event::wait_and_throw(dependencies);
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                onemath_rocrand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_normal, status, engine_, r, n_gen, 0.0, 1.0);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n_gen);
+
+        return multivariate_normal_transform(queue_, distr.dimen(), distr.mean(),
+                                             distr.cholesky_factor(), n, r);
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
+        if (distr.dimen() > max_multivariate_normal_dimen) {
+            throw oneapi::math::unimplemented(
+                "rng", "mrg32k3a engine",
+                "multivariate_normal dimen above 16 unsupported by rocRAND backend");
+        }
+        std::int64_t n_gen = n * distr.dimen();
+        sycl::event::wait_and_throw(dependencies);
+        queue_
+            .submit([&](sycl::handler& cgh) {
+                onemath_rocrand_host_task(cgh, engine_, [=](sycl::interop_handle ih) {
+                    rocrand_status status;
+                    ROCRAND_CALL(rocrand_generate_normal_double, status, engine_, r, n_gen, 0.0,
+                                 1.0);
+                });
+            })
+            .wait_and_throw();
+
+        increment_internal_offset(n_gen);
+
+        return multivariate_normal_transform(queue_, distr.dimen(), distr.mean(),
+                                             distr.cholesky_factor(), n, r);
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
@@ -713,13 +1026,29 @@ public:
     }
 
     virtual void skip_ahead(std::uint64_t num_to_skip) override {
-        rocrand_status status;
-        ROCRAND_CALL(rocrand_set_offset, status, engine_, num_to_skip);
+        // rocrand_set_offset sets an absolute offset, so accumulate it on top of the
+        // numbers already generated by this engine
+        increment_internal_offset(num_to_skip);
+        set_internal_offset();
     }
 
     virtual void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
-        throw oneapi::math::unimplemented("rng", "skip_ahead",
-                                          "initializer list unsupported by rocRAND backend");
+        // rocRAND offsets are 64-bit, so only the lowest word of the partitioned number of
+        // skipped elements may be non-zero. The generator state is opaque, so the precomputed
+        // jump matrices cannot be applied here; device API mrg32k3a engines use them instead,
+        // including when they are constructed with an offset on the host
+        auto it = num_to_skip.begin();
+        if (it == num_to_skip.end()) {
+            return;
+        }
+        std::uint64_t low = *it;
+        for (++it; it != num_to_skip.end(); ++it) {
+            if (*it != 0) {
+                throw oneapi::math::unimplemented(
+                    "rng", "skip_ahead", "skip on 2^64 or more unsupported by rocRAND backend");
+            }
+        }
+        skip_ahead(low);
     }
 
     virtual void leapfrog(std::uint64_t idx, std::uint64_t stride) override {
@@ -738,6 +1067,11 @@ private:
     void increment_internal_offset(std::uint64_t n) {
         offset_ += n;
     }
+
+    void set_internal_offset() {
+        rocrand_status status;
+        ROCRAND_CALL(rocrand_set_offset, status, engine_, offset_);
+    }
 };
 #else // rocRAND backend is currently not supported on Windows
 class mrg32k3a_impl : public oneapi::math::rng::detail::engine_impl {
@@ -856,6 +1190,58 @@ public:
         throw oneapi::math::unimplemented("rng", "mrg32ka engine");
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+    }
+
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
         throw oneapi::math::unimplemented("rng", "mrg32ka engine");
@@ -990,6 +1376,73 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<float, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multivariate_normal<double, multivariate_normal_method::box_muller2>& distr,
+        std::int64_t n, double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::math::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         throw oneapi::math::unimplemented("rng", "mrg32ka engine");
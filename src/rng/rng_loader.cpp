@@ -31,21 +31,21 @@ static oneapi::math::detail::table_initializer<domain::rng, rng_function_table_t
 
 engine_impl* create_philox4x32x10(oneapi::math::device libkey, sycl::queue queue,
                                   std::uint64_t seed) {
-    return function_tables[{ libkey, queue }].create_philox4x32x10_sycl(queue, seed);
+    return CALL_TABLE_FN(function_tables, libkey, queue, create_philox4x32x10_sycl, queue, seed);
 }
 
 engine_impl* create_philox4x32x10(oneapi::math::device libkey, sycl::queue queue,
                                   std::initializer_list<std::uint64_t> seed) {
-    return function_tables[{ libkey, queue }].create_philox4x32x10_ex_sycl(queue, seed);
+    return CALL_TABLE_FN(function_tables, libkey, queue, create_philox4x32x10_ex_sycl, queue, seed);
 }
 
 engine_impl* create_mrg32k3a(oneapi::math::device libkey, sycl::queue queue, std::uint32_t seed) {
-    return function_tables[{ libkey, queue }].create_mrg32k3a_sycl(queue, seed);
+    return CALL_TABLE_FN(function_tables, libkey, queue, create_mrg32k3a_sycl, queue, seed);
 }
 
 engine_impl* create_mrg32k3a(oneapi::math::device libkey, sycl::queue queue,
                              std::initializer_list<std::uint32_t> seed) {
-    return function_tables[{ libkey, queue }].create_mrg32k3a_ex_sycl(queue, seed);
+    return CALL_TABLE_FN(function_tables, libkey, queue, create_mrg32k3a_ex_sycl, queue, seed);
 }
 
 } // namespace detail
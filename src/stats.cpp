@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "oneapi/math/stats.hpp"
+
+#include "call_stats.hpp"
+
+namespace oneapi {
+namespace math {
+namespace stats {
+
+std::vector<routine_stats> snapshot() {
+    auto& registry = detail::stats_registry::instance();
+    auto baseline = registry.baseline();
+    std::vector<routine_stats> result;
+    for (auto& [key, totals] : registry.totals()) {
+        routine_stats stats;
+        stats.domain = detail::domain_name(std::get<0>(key));
+        stats.routine = std::get<1>(key);
+        stats.backend = std::get<2>(key);
+        stats.calls = totals.calls;
+        stats.flops = totals.flops;
+        stats.bytes = totals.bytes;
+        auto base = baseline.find(key);
+        if (base != baseline.end()) {
+            stats.calls -= base->second.calls;
+            stats.flops -= base->second.flops;
+            stats.bytes -= base->second.bytes;
+        }
+        if (stats.calls != 0)
+            result.push_back(std::move(stats));
+    }
+    return result;
+}
+
+void reset() {
+    detail::stats_registry::instance().reset();
+}
+
+} // namespace stats
+} // namespace math
+} // namespace oneapi
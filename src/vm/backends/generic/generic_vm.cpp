@@ -0,0 +1,1283 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "generic_vm_common.hpp"
+#include "oneapi/math/vm/detail/generic/onemath_vm_generic.hpp"
+
+namespace oneapi {
+namespace math {
+namespace vm {
+namespace generic {
+
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::add_op>(queue, "add", n, a, b, y, mode);
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::add_op>(queue, "add", n, a, b, y, mode);
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::add_op>(queue, "add", n, a, b, y, dependencies, mode);
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::add_op>(queue, "add", n, a, b, y, dependencies, mode);
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::add_op>(queue, "add", n, a, inca, b, incb, y, incy, mode);
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::add_op>(queue, "add", n, a, inca, b, incb, y, incy, mode);
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::add_op>(queue, "add", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::add_op>(queue, "add", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::add_op>(queue, "add", n, a, b, y, index, mode);
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::add_op>(queue, "add", n, a, b, y, index, mode);
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::add_op>(queue, "add", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::add_op>(queue, "add", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+             sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, mode);
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+             sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, mode);
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, dependencies, mode);
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, dependencies, mode);
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+             sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::cdfnorm_op>(queue, "cdfnorm", n, a, inca, y, incy, mode);
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+             sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::cdfnorm_op>(queue, "cdfnorm", n, a, inca, y, incy, mode);
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                    std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::cdfnorm_op>(queue, "cdfnorm", n, a, inca, y, incy,
+                                                     dependencies, mode);
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                    double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::cdfnorm_op>(queue, "cdfnorm", n, a, inca, y, incy,
+                                                     dependencies, mode);
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+             sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+             oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, index, mode);
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+             sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+             oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, index, mode);
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                    const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, index, dependencies,
+                                                     mode);
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                    const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::cdfnorm_op>(queue, "cdfnorm", n, a, y, index, dependencies,
+                                                     mode);
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, mode);
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, mode);
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, dependencies, mode);
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, dependencies, mode);
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+                sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, inca, y, incy, mode);
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+                sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, inca, y, incy, mode);
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                       float* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, inca, y, incy,
+                                                        dependencies, mode);
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                       double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, inca, y, incy,
+                                                        dependencies, mode);
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, index, mode);
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, index, mode);
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                       const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, index,
+                                                        dependencies, mode);
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                       const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::cdfnorminv_op>(queue, "cdfnorminv", n, a, y, index,
+                                                        dependencies, mode);
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::div_op>(queue, "div", n, a, b, y, mode);
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::div_op>(queue, "div", n, a, b, y, mode);
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::div_op>(queue, "div", n, a, b, y, dependencies, mode);
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::div_op>(queue, "div", n, a, b, y, dependencies, mode);
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::div_op>(queue, "div", n, a, inca, b, incb, y, incy, mode);
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::div_op>(queue, "div", n, a, inca, b, incb, y, incy, mode);
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::div_op>(queue, "div", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::div_op>(queue, "div", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::div_op>(queue, "div", n, a, b, y, index, mode);
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::div_op>(queue, "div", n, a, b, y, index, mode);
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::div_op>(queue, "div", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::div_op>(queue, "div", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::erf_op>(queue, "erf", n, a, y, mode);
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::erf_op>(queue, "erf", n, a, y, mode);
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::erf_op>(queue, "erf", n, a, y, dependencies, mode);
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::erf_op>(queue, "erf", n, a, y, dependencies, mode);
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::erf_op>(queue, "erf", n, a, inca, y, incy, mode);
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::erf_op>(queue, "erf", n, a, inca, y, incy, mode);
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::erf_op>(queue, "erf", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::erf_op>(queue, "erf", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::erf_op>(queue, "erf", n, a, y, index, mode);
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::erf_op>(queue, "erf", n, a, y, index, mode);
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::erf_op>(queue, "erf", n, a, y, index, dependencies, mode);
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::erf_op>(queue, "erf", n, a, y, index, dependencies, mode);
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          oneapi::math::vm::mode mode) {
+    detail::unary<detail::erfc_op>(queue, "erfc", n, a, y, mode);
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::erfc_op>(queue, "erfc", n, a, y, mode);
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::erfc_op>(queue, "erfc", n, a, y, dependencies, mode);
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::erfc_op>(queue, "erfc", n, a, y, dependencies, mode);
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+          sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::erfc_op>(queue, "erfc", n, a, inca, y, incy, mode);
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+          sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::erfc_op>(queue, "erfc", n, a, inca, y, incy, mode);
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::erfc_op>(queue, "erfc", n, a, inca, y, incy, dependencies,
+                                                  mode);
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::erfc_op>(queue, "erfc", n, a, inca, y, incy, dependencies,
+                                                  mode);
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::erfc_op>(queue, "erfc", n, a, y, index, mode);
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+          oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::erfc_op>(queue, "erfc", n, a, y, index, mode);
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::erfc_op>(queue, "erfc", n, a, y, index, dependencies,
+                                                  mode);
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::erfc_op>(queue, "erfc", n, a, y, index, dependencies,
+                                                  mode);
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::erfinv_op>(queue, "erfinv", n, a, y, mode);
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::erfinv_op>(queue, "erfinv", n, a, y, mode);
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::erfinv_op>(queue, "erfinv", n, a, y, dependencies, mode);
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::erfinv_op>(queue, "erfinv", n, a, y, dependencies, mode);
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+            sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::erfinv_op>(queue, "erfinv", n, a, inca, y, incy, mode);
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+            sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::erfinv_op>(queue, "erfinv", n, a, inca, y, incy, mode);
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                   std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::erfinv_op>(queue, "erfinv", n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                   double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::erfinv_op>(queue, "erfinv", n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::erfinv_op>(queue, "erfinv", n, a, y, index, mode);
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::erfinv_op>(queue, "erfinv", n, a, y, index, mode);
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::erfinv_op>(queue, "erfinv", n, a, y, index, dependencies,
+                                                    mode);
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::erfinv_op>(queue, "erfinv", n, a, y, index, dependencies,
+                                                    mode);
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::exp_op>(queue, "exp", n, a, y, mode);
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::exp_op>(queue, "exp", n, a, y, mode);
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::exp_op>(queue, "exp", n, a, y, dependencies, mode);
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::exp_op>(queue, "exp", n, a, y, dependencies, mode);
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::exp_op>(queue, "exp", n, a, inca, y, incy, mode);
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::exp_op>(queue, "exp", n, a, inca, y, incy, mode);
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::exp_op>(queue, "exp", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::exp_op>(queue, "exp", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::exp_op>(queue, "exp", n, a, y, index, mode);
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::exp_op>(queue, "exp", n, a, y, index, mode);
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::exp_op>(queue, "exp", n, a, y, index, dependencies, mode);
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::exp_op>(queue, "exp", n, a, y, index, dependencies, mode);
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::inv_op>(queue, "inv", n, a, y, mode);
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::inv_op>(queue, "inv", n, a, y, mode);
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::inv_op>(queue, "inv", n, a, y, dependencies, mode);
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::inv_op>(queue, "inv", n, a, y, dependencies, mode);
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::inv_op>(queue, "inv", n, a, inca, y, incy, mode);
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::inv_op>(queue, "inv", n, a, inca, y, incy, mode);
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::inv_op>(queue, "inv", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::inv_op>(queue, "inv", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::inv_op>(queue, "inv", n, a, y, index, mode);
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::inv_op>(queue, "inv", n, a, y, index, mode);
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::inv_op>(queue, "inv", n, a, y, index, dependencies, mode);
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::inv_op>(queue, "inv", n, a, y, index, dependencies, mode);
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::lgamma_op>(queue, "lgamma", n, a, y, mode);
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::lgamma_op>(queue, "lgamma", n, a, y, mode);
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::lgamma_op>(queue, "lgamma", n, a, y, dependencies, mode);
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::lgamma_op>(queue, "lgamma", n, a, y, dependencies, mode);
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+            sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::lgamma_op>(queue, "lgamma", n, a, inca, y, incy, mode);
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+            sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::lgamma_op>(queue, "lgamma", n, a, inca, y, incy, mode);
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                   std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::lgamma_op>(queue, "lgamma", n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                   double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::lgamma_op>(queue, "lgamma", n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::lgamma_op>(queue, "lgamma", n, a, y, index, mode);
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::lgamma_op>(queue, "lgamma", n, a, y, index, mode);
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::lgamma_op>(queue, "lgamma", n, a, y, index, dependencies,
+                                                    mode);
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::lgamma_op>(queue, "lgamma", n, a, y, index, dependencies,
+                                                    mode);
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::log_op>(queue, "log", n, a, y, mode);
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::unary<detail::log_op>(queue, "log", n, a, y, mode);
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::log_op>(queue, "log", n, a, y, dependencies, mode);
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::log_op>(queue, "log", n, a, y, dependencies, mode);
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::log_op>(queue, "log", n, a, inca, y, incy, mode);
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::log_op>(queue, "log", n, a, inca, y, incy, mode);
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::log_op>(queue, "log", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::log_op>(queue, "log", n, a, inca, y, incy, dependencies,
+                                                 mode);
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::log_op>(queue, "log", n, a, y, index, mode);
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::log_op>(queue, "log", n, a, y, index, mode);
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::log_op>(queue, "log", n, a, y, index, dependencies, mode);
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::log_op>(queue, "log", n, a, y, index, dependencies, mode);
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::mul_op>(queue, "mul", n, a, b, y, mode);
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::mul_op>(queue, "mul", n, a, b, y, mode);
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::mul_op>(queue, "mul", n, a, b, y, dependencies, mode);
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::mul_op>(queue, "mul", n, a, b, y, dependencies, mode);
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::mul_op>(queue, "mul", n, a, inca, b, incb, y, incy, mode);
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::mul_op>(queue, "mul", n, a, inca, b, incb, y, incy, mode);
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::mul_op>(queue, "mul", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::mul_op>(queue, "mul", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::mul_op>(queue, "mul", n, a, b, y, index, mode);
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::mul_op>(queue, "mul", n, a, b, y, index, mode);
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::mul_op>(queue, "mul", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::mul_op>(queue, "mul", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::pow_op>(queue, "pow", n, a, b, y, mode);
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::binary<detail::pow_op>(queue, "pow", n, a, b, y, mode);
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::pow_op>(queue, "pow", n, a, b, y, dependencies, mode);
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary<detail::pow_op>(queue, "pow", n, a, b, y, dependencies, mode);
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::pow_op>(queue, "pow", n, a, inca, b, incb, y, incy, mode);
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::binary_strided<detail::pow_op>(queue, "pow", n, a, inca, b, incb, y, incy, mode);
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::pow_op>(queue, "pow", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::binary_strided<detail::pow_op>(queue, "pow", n, a, inca, b, incb, y, incy,
+                                                  dependencies, mode);
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::pow_op>(queue, "pow", n, a, b, y, index, mode);
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    detail::binary_indexed<detail::pow_op>(queue, "pow", n, a, b, y, index, mode);
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::pow_op>(queue, "pow", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::binary_indexed<detail::pow_op>(queue, "pow", n, a, b, y, index, dependencies,
+                                                  mode);
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          oneapi::math::vm::mode mode) {
+    detail::unary<detail::sqrt_op>(queue, "sqrt", n, a, y, mode);
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::sqrt_op>(queue, "sqrt", n, a, y, mode);
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::sqrt_op>(queue, "sqrt", n, a, y, dependencies, mode);
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::sqrt_op>(queue, "sqrt", n, a, y, dependencies, mode);
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+          sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::sqrt_op>(queue, "sqrt", n, a, inca, y, incy, mode);
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+          sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::sqrt_op>(queue, "sqrt", n, a, inca, y, incy, mode);
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::sqrt_op>(queue, "sqrt", n, a, inca, y, incy, dependencies,
+                                                  mode);
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::sqrt_op>(queue, "sqrt", n, a, inca, y, incy, dependencies,
+                                                  mode);
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::sqrt_op>(queue, "sqrt", n, a, y, index, mode);
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+          oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::sqrt_op>(queue, "sqrt", n, a, y, index, mode);
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::sqrt_op>(queue, "sqrt", n, a, y, index, dependencies,
+                                                  mode);
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::sqrt_op>(queue, "sqrt", n, a, y, index, dependencies,
+                                                  mode);
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::tgamma_op>(queue, "tgamma", n, a, y, mode);
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::unary<detail::tgamma_op>(queue, "tgamma", n, a, y, mode);
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::tgamma_op>(queue, "tgamma", n, a, y, dependencies, mode);
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::unary<detail::tgamma_op>(queue, "tgamma", n, a, y, dependencies, mode);
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+            sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::tgamma_op>(queue, "tgamma", n, a, inca, y, incy, mode);
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+            sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    detail::unary_strided<detail::tgamma_op>(queue, "tgamma", n, a, inca, y, incy, mode);
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                   std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::tgamma_op>(queue, "tgamma", n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                   double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_strided<detail::tgamma_op>(queue, "tgamma", n, a, inca, y, incy,
+                                                    dependencies, mode);
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::tgamma_op>(queue, "tgamma", n, a, y, index, mode);
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    detail::unary_indexed<detail::tgamma_op>(queue, "tgamma", n, a, y, index, mode);
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::tgamma_op>(queue, "tgamma", n, a, y, index, dependencies,
+                                                    mode);
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return detail::unary_indexed<detail::tgamma_op>(queue, "tgamma", n, a, y, index, dependencies,
+                                                    mode);
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cabs_op, float>(queue, "abs", n, {}, mode,
+                                                detail::bind_out("abs", n, y),
+                                                detail::bind_in("abs", n, a));
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cabs_op, double>(queue, "abs", n, {}, mode,
+                                                 detail::bind_out("abs", n, y),
+                                                 detail::bind_in("abs", n, a));
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<float>* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cabs_op, float>(queue, "abs", n, dependencies, mode,
+                                                       detail::bind_out("abs", n, y),
+                                                       detail::bind_in("abs", n, a));
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<double>* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cabs_op, double>(queue, "abs", n, dependencies, mode,
+                                                        detail::bind_out("abs", n, y),
+                                                        detail::bind_in("abs", n, a));
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cabs_op, float>(queue, "abs", n, {}, mode,
+                                                detail::bind_out("abs", n, y),
+                                                detail::bind_in("abs", n, a_re, a_im));
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cabs_op, double>(queue, "abs", n, {}, mode,
+                                                 detail::bind_out("abs", n, y),
+                                                 detail::bind_in("abs", n, a_re, a_im));
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cabs_op, float>(queue, "abs", n, dependencies, mode,
+                                                       detail::bind_out("abs", n, y),
+                                                       detail::bind_in("abs", n, a_re, a_im));
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cabs_op, double>(queue, "abs", n, dependencies, mode,
+                                                        detail::bind_out("abs", n, y),
+                                                        detail::bind_in("abs", n, a_re, a_im));
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::carg_op, float>(queue, "arg", n, {}, mode,
+                                                detail::bind_out("arg", n, y),
+                                                detail::bind_in("arg", n, a));
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::carg_op, double>(queue, "arg", n, {}, mode,
+                                                 detail::bind_out("arg", n, y),
+                                                 detail::bind_in("arg", n, a));
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<float>* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::carg_op, float>(queue, "arg", n, dependencies, mode,
+                                                       detail::bind_out("arg", n, y),
+                                                       detail::bind_in("arg", n, a));
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<double>* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::carg_op, double>(queue, "arg", n, dependencies, mode,
+                                                        detail::bind_out("arg", n, y),
+                                                        detail::bind_in("arg", n, a));
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::carg_op, float>(queue, "arg", n, {}, mode,
+                                                detail::bind_out("arg", n, y),
+                                                detail::bind_in("arg", n, a_re, a_im));
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::carg_op, double>(queue, "arg", n, {}, mode,
+                                                 detail::bind_out("arg", n, y),
+                                                 detail::bind_in("arg", n, a_re, a_im));
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::carg_op, float>(queue, "arg", n, dependencies, mode,
+                                                       detail::bind_out("arg", n, y),
+                                                       detail::bind_in("arg", n, a_re, a_im));
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::carg_op, double>(queue, "arg", n, dependencies, mode,
+                                                        detail::bind_out("arg", n, y),
+                                                        detail::bind_in("arg", n, a_re, a_im));
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cis_op, float>(queue, "cis", n, {}, mode,
+                                               detail::bind_out("cis", n, y),
+                                               detail::bind_in("cis", n, a));
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cis_op, double>(queue, "cis", n, {}, mode,
+                                                detail::bind_out("cis", n, y),
+                                                detail::bind_in("cis", n, a));
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cis_op, float>(queue, "cis", n, dependencies, mode,
+                                                      detail::bind_out("cis", n, y),
+                                                      detail::bind_in("cis", n, a));
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cis_op, double>(queue, "cis", n, dependencies, mode,
+                                                       detail::bind_out("cis", n, y),
+                                                       detail::bind_in("cis", n, a));
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cis_op, float>(queue, "cis", n, {}, mode,
+                                               detail::bind_out("cis", n, y_re, y_im),
+                                               detail::bind_in("cis", n, a));
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+         sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cis_op, double>(queue, "cis", n, {}, mode,
+                                                detail::bind_out("cis", n, y_re, y_im),
+                                                detail::bind_in("cis", n, a));
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cis_op, float>(queue, "cis", n, dependencies, mode,
+                                                      detail::bind_out("cis", n, y_re, y_im),
+                                                      detail::bind_in("cis", n, a));
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cis_op, double>(queue, "cis", n, dependencies, mode,
+                                                       detail::bind_out("cis", n, y_re, y_im),
+                                                       detail::bind_in("cis", n, a));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& b, sycl::buffer<std::complex<float>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cdiv_op, float>(queue, "div", n, {}, mode,
+                                                detail::bind_out("div", n, y),
+                                                detail::bind_in("div", n, a),
+                                                detail::bind_in("div", n, b));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& b, sycl::buffer<std::complex<double>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cdiv_op, double>(queue, "div", n, {}, mode,
+                                                 detail::bind_out("div", n, y),
+                                                 detail::bind_in("div", n, a),
+                                                 detail::bind_in("div", n, b));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                const std::complex<float>* b, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cdiv_op, float>(queue, "div", n, dependencies, mode,
+                                                       detail::bind_out("div", n, y),
+                                                       detail::bind_in("div", n, a),
+                                                       detail::bind_in("div", n, b));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                const std::complex<double>* b, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cdiv_op, double>(queue, "div", n, dependencies, mode,
+                                                        detail::bind_out("div", n, y),
+                                                        detail::bind_in("div", n, a),
+                                                        detail::bind_in("div", n, b));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re, sycl::buffer<float, 1>& b_im,
+         sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cdiv_op, float>(queue, "div", n, {}, mode,
+                                                detail::bind_out("div", n, y_re, y_im),
+                                                detail::bind_in("div", n, a_re, a_im),
+                                                detail::bind_in("div", n, b_re, b_im));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+         sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cdiv_op, double>(queue, "div", n, {}, mode,
+                                                 detail::bind_out("div", n, y_re, y_im),
+                                                 detail::bind_in("div", n, a_re, a_im),
+                                                 detail::bind_in("div", n, b_re, b_im));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                const float* b_re, const float* b_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cdiv_op, float>(queue, "div", n, dependencies, mode,
+                                                       detail::bind_out("div", n, y_re, y_im),
+                                                       detail::bind_in("div", n, a_re, a_im),
+                                                       detail::bind_in("div", n, b_re, b_im));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                const double* b_re, const double* b_im, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cdiv_op, double>(queue, "div", n, dependencies, mode,
+                                                        detail::bind_out("div", n, y_re, y_im),
+                                                        detail::bind_in("div", n, a_re, a_im),
+                                                        detail::bind_in("div", n, b_re, b_im));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cexp_op, float>(queue, "exp", n, {}, mode,
+                                                detail::bind_out("exp", n, y),
+                                                detail::bind_in("exp", n, a));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cexp_op, double>(queue, "exp", n, {}, mode,
+                                                 detail::bind_out("exp", n, y),
+                                                 detail::bind_in("exp", n, a));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                std::complex<float>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cexp_op, float>(queue, "exp", n, dependencies, mode,
+                                                       detail::bind_out("exp", n, y),
+                                                       detail::bind_in("exp", n, a));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                std::complex<double>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cexp_op, double>(queue, "exp", n, dependencies, mode,
+                                                        detail::bind_out("exp", n, y),
+                                                        detail::bind_in("exp", n, a));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cexp_op, float>(queue, "exp", n, {}, mode,
+                                                detail::bind_out("exp", n, y_re, y_im),
+                                                detail::bind_in("exp", n, a_re, a_im));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cexp_op, double>(queue, "exp", n, {}, mode,
+                                                 detail::bind_out("exp", n, y_re, y_im),
+                                                 detail::bind_in("exp", n, a_re, a_im));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                float* y_re, float* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cexp_op, float>(queue, "exp", n, dependencies, mode,
+                                                       detail::bind_out("exp", n, y_re, y_im),
+                                                       detail::bind_in("exp", n, a_re, a_im));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y_re, double* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cexp_op, double>(queue, "exp", n, dependencies, mode,
+                                                        detail::bind_out("exp", n, y_re, y_im),
+                                                        detail::bind_in("exp", n, a_re, a_im));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::clog_op, float>(queue, "log", n, {}, mode,
+                                                detail::bind_out("log", n, y),
+                                                detail::bind_in("log", n, a));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::clog_op, double>(queue, "log", n, {}, mode,
+                                                 detail::bind_out("log", n, y),
+                                                 detail::bind_in("log", n, a));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                std::complex<float>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::clog_op, float>(queue, "log", n, dependencies, mode,
+                                                       detail::bind_out("log", n, y),
+                                                       detail::bind_in("log", n, a));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                std::complex<double>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::clog_op, double>(queue, "log", n, dependencies, mode,
+                                                        detail::bind_out("log", n, y),
+                                                        detail::bind_in("log", n, a));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::clog_op, float>(queue, "log", n, {}, mode,
+                                                detail::bind_out("log", n, y_re, y_im),
+                                                detail::bind_in("log", n, a_re, a_im));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::clog_op, double>(queue, "log", n, {}, mode,
+                                                 detail::bind_out("log", n, y_re, y_im),
+                                                 detail::bind_in("log", n, a_re, a_im));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                float* y_re, float* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::clog_op, float>(queue, "log", n, dependencies, mode,
+                                                       detail::bind_out("log", n, y_re, y_im),
+                                                       detail::bind_in("log", n, a_re, a_im));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y_re, double* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::clog_op, double>(queue, "log", n, dependencies, mode,
+                                                        detail::bind_out("log", n, y_re, y_im),
+                                                        detail::bind_in("log", n, a_re, a_im));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& b, sycl::buffer<std::complex<float>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cmul_op, float>(queue, "mul", n, {}, mode,
+                                                detail::bind_out("mul", n, y),
+                                                detail::bind_in("mul", n, a),
+                                                detail::bind_in("mul", n, b));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& b, sycl::buffer<std::complex<double>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cmul_op, double>(queue, "mul", n, {}, mode,
+                                                 detail::bind_out("mul", n, y),
+                                                 detail::bind_in("mul", n, a),
+                                                 detail::bind_in("mul", n, b));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                const std::complex<float>* b, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cmul_op, float>(queue, "mul", n, dependencies, mode,
+                                                       detail::bind_out("mul", n, y),
+                                                       detail::bind_in("mul", n, a),
+                                                       detail::bind_in("mul", n, b));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                const std::complex<double>* b, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cmul_op, double>(queue, "mul", n, dependencies, mode,
+                                                        detail::bind_out("mul", n, y),
+                                                        detail::bind_in("mul", n, a),
+                                                        detail::bind_in("mul", n, b));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re, sycl::buffer<float, 1>& b_im,
+         sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cmul_op, float>(queue, "mul", n, {}, mode,
+                                                detail::bind_out("mul", n, y_re, y_im),
+                                                detail::bind_in("mul", n, a_re, a_im),
+                                                detail::bind_in("mul", n, b_re, b_im));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+         sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    detail::complex_map<detail::cmul_op, double>(queue, "mul", n, {}, mode,
+                                                 detail::bind_out("mul", n, y_re, y_im),
+                                                 detail::bind_in("mul", n, a_re, a_im),
+                                                 detail::bind_in("mul", n, b_re, b_im));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                const float* b_re, const float* b_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cmul_op, float>(queue, "mul", n, dependencies, mode,
+                                                       detail::bind_out("mul", n, y_re, y_im),
+                                                       detail::bind_in("mul", n, a_re, a_im),
+                                                       detail::bind_in("mul", n, b_re, b_im));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                const double* b_re, const double* b_im, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return detail::complex_map<detail::cmul_op, double>(queue, "mul", n, dependencies, mode,
+                                                        detail::bind_out("mul", n, y_re, y_im),
+                                                        detail::bind_in("mul", n, a_re, a_im),
+                                                        detail::bind_in("mul", n, b_re, b_im));
+}
+
+} // namespace generic
+} // namespace vm
+} // namespace math
+} // namespace oneapi
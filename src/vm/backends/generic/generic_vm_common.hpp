@@ -0,0 +1,817 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GENERIC_VM_COMMON_HPP_
+#define _GENERIC_VM_COMMON_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/exceptions.hpp"
+#include "oneapi/math/vm/detail/math_impl.hpp"
+#include "oneapi/math/vm/detail/special_impl.hpp"
+#include "oneapi/math/vm/types.hpp"
+
+namespace oneapi {
+namespace math {
+namespace vm {
+namespace generic {
+namespace detail {
+
+// Each work-item owns a contiguous block of vec_width elements and evaluates it with the
+// sycl::vec overloads of the math built-ins. On a CPU device a block fills one AVX-512 register
+// (or two AVX2 registers) while the SYCL runtime spreads the blocks over all cores; GPU devices
+// simply see a work-item with more instruction-level parallelism.
+template <typename T>
+constexpr int vec_width = 64 / sizeof(T);
+
+template <typename T>
+using vec_t = sycl::vec<T, vec_width<T>>;
+
+template <typename T>
+inline std::int64_t num_blocks(std::int64_t n) {
+    return (n + vec_width<T> - 1) / vec_width<T>;
+}
+
+// The operators are templated on the accuracy mode, resolved once per call, and on the argument
+// type so the same functor evaluates both the packed body of a block and the scalar tail of the
+// last one. Only exp, log, pow and the special functions built on them depend on the mode, see
+// math_impl.hpp and special_impl.hpp.
+template <oneapi::math::vm::mode Mode>
+struct add_op {
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return a + b;
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct cdfnorm_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return oneapi::math::vm::detail::cdfnorm_impl<Mode>(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct cdfnorminv_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return oneapi::math::vm::detail::cdfnorminv_impl<Mode>(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct div_op {
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return a / b;
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct mul_op {
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return a * b;
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct pow_op {
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return oneapi::math::vm::detail::pow_impl<Mode>(a, b);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct erf_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return sycl::erf(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct erfc_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return sycl::erfc(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct erfinv_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return oneapi::math::vm::detail::erfinv_impl<Mode>(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct exp_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return oneapi::math::vm::detail::exp_impl<Mode>(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct inv_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return T(1) / a;
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct lgamma_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return sycl::lgamma(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct log_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return oneapi::math::vm::detail::log_impl<Mode>(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct sqrt_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return sycl::sqrt(a);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct tgamma_op {
+    template <typename T>
+    T operator()(const T& a) const {
+        return sycl::tgamma(a);
+    }
+};
+
+// Complex operators take and return the real and imaginary parts as separate values, so that a
+// block of complex numbers is evaluated as two sycl::vec whatever the storage
+template <typename V>
+struct complex_value {
+    V re;
+    V im;
+};
+
+template <oneapi::math::vm::mode Mode>
+struct cabs_op {
+    template <typename V>
+    V operator()(const complex_value<V>& a) const {
+        return sycl::hypot(a.re, a.im);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct carg_op {
+    template <typename V>
+    V operator()(const complex_value<V>& a) const {
+        return sycl::atan2(a.im, a.re);
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct cis_op {
+    template <typename V>
+    complex_value<V> operator()(const V& a) const {
+        return { sycl::cos(a), sycl::sin(a) };
+    }
+};
+
+// a / b with both parts of b scaled by max(|b.re|, |b.im|), so that |b|^2 neither overflows nor
+// underflows
+template <oneapi::math::vm::mode Mode>
+struct cdiv_op {
+    template <typename V>
+    complex_value<V> operator()(const complex_value<V>& a, const complex_value<V>& b) const {
+        const V scale = sycl::fmax(sycl::fabs(b.re), sycl::fabs(b.im));
+        const V b_re = b.re / scale;
+        const V b_im = b.im / scale;
+        const V denom = (b_re * b_re + b_im * b_im) * scale;
+        return { (a.re * b_re + a.im * b_im) / denom, (a.im * b_re - a.re * b_im) / denom };
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct cexp_op {
+    template <typename V>
+    complex_value<V> operator()(const complex_value<V>& a) const {
+        const V r = oneapi::math::vm::detail::exp_impl<Mode>(a.re);
+        return { r * sycl::cos(a.im), r * sycl::sin(a.im) };
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct clog_op {
+    template <typename V>
+    complex_value<V> operator()(const complex_value<V>& a) const {
+        return { oneapi::math::vm::detail::log_impl<Mode>(sycl::hypot(a.re, a.im)),
+                 sycl::atan2(a.im, a.re) };
+    }
+};
+
+template <oneapi::math::vm::mode Mode>
+struct cmul_op {
+    template <typename V>
+    complex_value<V> operator()(const complex_value<V>& a, const complex_value<V>& b) const {
+        return { a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re };
+    }
+};
+
+// Calls f with the operator instantiated for the requested mode; not_defined is ha
+template <template <oneapi::math::vm::mode> class Op, typename F>
+inline auto dispatch_mode(oneapi::math::vm::mode mode, F f) {
+    switch (mode) {
+        case oneapi::math::vm::mode::la: return f(Op<oneapi::math::vm::mode::la>{});
+        case oneapi::math::vm::mode::ep: return f(Op<oneapi::math::vm::mode::ep>{});
+        default: return f(Op<oneapi::math::vm::mode::ha>{});
+    }
+}
+
+template <typename T, typename Op, typename InA, typename Out>
+inline void unary_block(std::int64_t block, std::int64_t n, InA a, Out y, Op op) {
+    constexpr int width = vec_width<T>;
+    const std::int64_t first = block * width;
+    if (first + width <= n) {
+        vec_t<T> va;
+#pragma unroll
+        for (int i = 0; i < width; i++) {
+            va[i] = a[first + i];
+        }
+        vec_t<T> vy = op(va);
+#pragma unroll
+        for (int i = 0; i < width; i++) {
+            y[first + i] = vy[i];
+        }
+    }
+    else {
+        for (std::int64_t i = first; i < n; i++) {
+            y[i] = op(T(a[i]));
+        }
+    }
+}
+
+template <typename T, typename Op, typename InA, typename InB, typename Out>
+inline void binary_block(std::int64_t block, std::int64_t n, InA a, InB b, Out y, Op op) {
+    constexpr int width = vec_width<T>;
+    const std::int64_t first = block * width;
+    if (first + width <= n) {
+        vec_t<T> va, vb;
+#pragma unroll
+        for (int i = 0; i < width; i++) {
+            va[i] = a[first + i];
+            vb[i] = b[first + i];
+        }
+        vec_t<T> vy = op(va, vb);
+#pragma unroll
+        for (int i = 0; i < width; i++) {
+            y[first + i] = vy[i];
+        }
+    }
+    else {
+        for (std::int64_t i = first; i < n; i++) {
+            y[i] = op(T(a[i]), T(b[i]));
+        }
+    }
+}
+
+// Strided and indexed arguments are read and written through views, so that the block kernels
+// above serve every layout. As in BLAS, a negative increment walks the vector backwards from its
+// last element.
+template <typename Data>
+struct strided_view {
+    Data data;
+    std::int64_t offset;
+    std::int64_t inc;
+
+    decltype(auto) operator[](std::int64_t i) const {
+        return data[offset + i * inc];
+    }
+};
+
+template <typename Data>
+inline strided_view<Data> make_strided(Data data, std::int64_t n, std::int64_t inc) {
+    return { data, inc < 0 ? (1 - n) * inc : 0, inc };
+}
+
+template <typename Data, typename Index>
+struct indexed_view {
+    Data data;
+    Index index;
+
+    decltype(auto) operator[](std::int64_t i) const {
+        return data[index[i]];
+    }
+};
+
+template <typename Data, typename Index>
+inline indexed_view<Data, Index> make_indexed(Data data, Index index) {
+    return { data, index };
+}
+
+template <typename T>
+struct is_complex : std::false_type {};
+
+template <typename T>
+struct is_complex<std::complex<T>> : std::true_type {};
+
+template <typename V>
+constexpr int lanes() {
+    if constexpr (oneapi::math::vm::detail::is_vec<V>::value) {
+        return static_cast<int>(V::size());
+    }
+    else {
+        return 1;
+    }
+}
+
+template <typename V>
+inline auto& lane(V& v, int i) {
+    if constexpr (oneapi::math::vm::detail::is_vec<V>::value) {
+        return v[i];
+    }
+    else {
+        return v;
+    }
+}
+
+// Real or interleaved complex elements; a load at i returns lanes<V>() consecutive elements
+template <typename Data>
+struct element_view {
+    using element_type = std::remove_cv_t<
+        std::remove_reference_t<decltype(std::declval<Data>()[std::size_t(0)])>>;
+
+    template <typename V>
+    auto load(std::int64_t i) const {
+        if constexpr (is_complex<element_type>::value) {
+            complex_value<V> v;
+            for (int k = 0; k < lanes<V>(); k++) {
+                const element_type c = data[i + k];
+                lane(v.re, k) = c.real();
+                lane(v.im, k) = c.imag();
+            }
+            return v;
+        }
+        else {
+            V v;
+            for (int k = 0; k < lanes<V>(); k++) {
+                lane(v, k) = data[i + k];
+            }
+            return v;
+        }
+    }
+
+    template <typename V>
+    void store(std::int64_t i, V v) const {
+        for (int k = 0; k < lanes<V>(); k++) {
+            data[i + k] = lane(v, k);
+        }
+    }
+
+    template <typename V>
+    void store(std::int64_t i, complex_value<V> v) const {
+        for (int k = 0; k < lanes<V>(); k++) {
+            data[i + k] = element_type(lane(v.re, k), lane(v.im, k));
+        }
+    }
+
+    Data data;
+};
+
+// Complex elements split into separate arrays of real and imaginary parts
+template <typename Data>
+struct split_view {
+    template <typename V>
+    complex_value<V> load(std::int64_t i) const {
+        complex_value<V> v;
+        for (int k = 0; k < lanes<V>(); k++) {
+            lane(v.re, k) = re[i + k];
+            lane(v.im, k) = im[i + k];
+        }
+        return v;
+    }
+
+    template <typename V>
+    void store(std::int64_t i, complex_value<V> v) const {
+        for (int k = 0; k < lanes<V>(); k++) {
+            re[i + k] = lane(v.re, k);
+            im[i + k] = lane(v.im, k);
+        }
+    }
+
+    Data re;
+    Data im;
+};
+
+template <typename T, typename Op, typename Out, typename... In>
+inline void map_block(std::int64_t block, std::int64_t n, Op op, const Out& y, const In&... in) {
+    constexpr int width = vec_width<T>;
+    const std::int64_t first = block * width;
+    if (first + width <= n) {
+        y.store(first, op(in.template load<vec_t<T>>(first)...));
+    }
+    else {
+        for (std::int64_t i = first; i < n; i++) {
+            y.store(i, op(in.template load<T>(i)...));
+        }
+    }
+}
+
+inline void check_n(const char* function_name, std::int64_t n) {
+    if (n < 0) {
+        throw oneapi::math::invalid_argument("vm", function_name, "n < 0");
+    }
+}
+
+template <typename T>
+inline void check_size(const char* function_name, std::int64_t n, sycl::buffer<T, 1>& buf) {
+    if (static_cast<std::int64_t>(buf.size()) < n) {
+        throw oneapi::math::invalid_argument("vm", function_name, "buffer size < n");
+    }
+}
+
+inline void check_inc(const char* function_name, const char* inc_name, std::int64_t inc) {
+    if (inc == 0) {
+        throw oneapi::math::invalid_argument("vm", function_name, std::string(inc_name) + " == 0");
+    }
+}
+
+template <typename T>
+inline void check_size(const char* function_name, std::int64_t n, std::int64_t inc,
+                       sycl::buffer<T, 1>& buf) {
+    if (n > 0 && static_cast<std::int64_t>(buf.size()) < 1 + (n - 1) * std::abs(inc)) {
+        throw oneapi::math::invalid_argument("vm", function_name,
+                                             "buffer size < 1 + (n - 1) * |inc|");
+    }
+}
+
+// Buffer APIs
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+void unary(sycl::queue& queue, const char* function_name, std::int64_t n, sycl::buffer<T, 1>& a,
+           sycl::buffer<T, 1>& y, oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    check_size(function_name, n, a);
+    check_size(function_name, n, y);
+    dispatch_mode<Op>(mode, [&](auto op) {
+        queue.submit([&](sycl::handler& cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+            auto y_acc = y.template get_access<sycl::access::mode::write>(cgh);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                unary_block<T>(id[0], n, a_acc, y_acc, op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+void binary(sycl::queue& queue, const char* function_name, std::int64_t n, sycl::buffer<T, 1>& a,
+            sycl::buffer<T, 1>& b, sycl::buffer<T, 1>& y, oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    check_size(function_name, n, a);
+    check_size(function_name, n, b);
+    check_size(function_name, n, y);
+    dispatch_mode<Op>(mode, [&](auto op) {
+        queue.submit([&](sycl::handler& cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+            auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+            auto y_acc = y.template get_access<sycl::access::mode::write>(cgh);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                binary_block<T>(id[0], n, a_acc, b_acc, y_acc, op);
+            });
+        });
+    });
+}
+
+// The strided and indexed variants fall back to the dense kernels when every increment is one;
+// indexed variants read index[i] and update y[index[i]] for i < n, indices are not range checked.
+template <template <oneapi::math::vm::mode> class Op, typename T>
+void unary_strided(sycl::queue& queue, const char* function_name, std::int64_t n,
+                   sycl::buffer<T, 1>& a, std::int64_t inca, sycl::buffer<T, 1>& y,
+                   std::int64_t incy, oneapi::math::vm::mode mode) {
+    if (inca == 1 && incy == 1) {
+        unary<Op>(queue, function_name, n, a, y, mode);
+        return;
+    }
+    check_n(function_name, n);
+    check_inc(function_name, "inca", inca);
+    check_inc(function_name, "incy", incy);
+    check_size(function_name, n, inca, a);
+    check_size(function_name, n, incy, y);
+    dispatch_mode<Op>(mode, [&](auto op) {
+        queue.submit([&](sycl::handler& cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+            auto y_acc = y.template get_access<sycl::access::mode::read_write>(cgh);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                unary_block<T>(id[0], n, make_strided(a_acc, n, inca),
+                               make_strided(y_acc, n, incy), op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+void binary_strided(sycl::queue& queue, const char* function_name, std::int64_t n,
+                    sycl::buffer<T, 1>& a, std::int64_t inca, sycl::buffer<T, 1>& b,
+                    std::int64_t incb, sycl::buffer<T, 1>& y, std::int64_t incy,
+                    oneapi::math::vm::mode mode) {
+    if (inca == 1 && incb == 1 && incy == 1) {
+        binary<Op>(queue, function_name, n, a, b, y, mode);
+        return;
+    }
+    check_n(function_name, n);
+    check_inc(function_name, "inca", inca);
+    check_inc(function_name, "incb", incb);
+    check_inc(function_name, "incy", incy);
+    check_size(function_name, n, inca, a);
+    check_size(function_name, n, incb, b);
+    check_size(function_name, n, incy, y);
+    dispatch_mode<Op>(mode, [&](auto op) {
+        queue.submit([&](sycl::handler& cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+            auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+            auto y_acc = y.template get_access<sycl::access::mode::read_write>(cgh);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                binary_block<T>(id[0], n, make_strided(a_acc, n, inca),
+                                make_strided(b_acc, n, incb), make_strided(y_acc, n, incy), op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+void unary_indexed(sycl::queue& queue, const char* function_name, std::int64_t n,
+                   sycl::buffer<T, 1>& a, sycl::buffer<T, 1>& y,
+                   sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    check_size(function_name, n, index);
+    dispatch_mode<Op>(mode, [&](auto op) {
+        queue.submit([&](sycl::handler& cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+            auto y_acc = y.template get_access<sycl::access::mode::read_write>(cgh);
+            auto index_acc = index.template get_access<sycl::access::mode::read>(cgh);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                unary_block<T>(id[0], n, make_indexed(a_acc, index_acc),
+                               make_indexed(y_acc, index_acc), op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+void binary_indexed(sycl::queue& queue, const char* function_name, std::int64_t n,
+                    sycl::buffer<T, 1>& a, sycl::buffer<T, 1>& b, sycl::buffer<T, 1>& y,
+                    sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    check_size(function_name, n, index);
+    dispatch_mode<Op>(mode, [&](auto op) {
+        queue.submit([&](sycl::handler& cgh) {
+            auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+            auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+            auto y_acc = y.template get_access<sycl::access::mode::read_write>(cgh);
+            auto index_acc = index.template get_access<sycl::access::mode::read>(cgh);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                binary_block<T>(id[0], n, make_indexed(a_acc, index_acc),
+                                make_indexed(b_acc, index_acc), make_indexed(y_acc, index_acc),
+                                op);
+            });
+        });
+    });
+}
+
+// Binders of the arguments of complex_map: each returns a callable creating, inside the command
+// group, the view the kernel accesses the argument through. Buffers get their accessors there,
+// USM pointers are used as they are.
+template <typename E>
+inline auto bind_in(const char* function_name, std::int64_t n, sycl::buffer<E, 1>& a) {
+    check_size(function_name, n, a);
+    return [&a](sycl::handler& cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        return element_view<decltype(a_acc)>{ a_acc };
+    };
+}
+
+template <typename T>
+inline auto bind_in(const char* function_name, std::int64_t n, sycl::buffer<T, 1>& a_re,
+                    sycl::buffer<T, 1>& a_im) {
+    check_size(function_name, n, a_re);
+    check_size(function_name, n, a_im);
+    return [&a_re, &a_im](sycl::handler& cgh) {
+        auto re_acc = a_re.template get_access<sycl::access::mode::read>(cgh);
+        auto im_acc = a_im.template get_access<sycl::access::mode::read>(cgh);
+        return split_view<decltype(re_acc)>{ re_acc, im_acc };
+    };
+}
+
+template <typename E>
+inline auto bind_out(const char* function_name, std::int64_t n, sycl::buffer<E, 1>& y) {
+    check_size(function_name, n, y);
+    return [&y](sycl::handler& cgh) {
+        auto y_acc = y.template get_access<sycl::access::mode::write>(cgh);
+        return element_view<decltype(y_acc)>{ y_acc };
+    };
+}
+
+template <typename T>
+inline auto bind_out(const char* function_name, std::int64_t n, sycl::buffer<T, 1>& y_re,
+                     sycl::buffer<T, 1>& y_im) {
+    check_size(function_name, n, y_re);
+    check_size(function_name, n, y_im);
+    return [&y_re, &y_im](sycl::handler& cgh) {
+        auto re_acc = y_re.template get_access<sycl::access::mode::write>(cgh);
+        auto im_acc = y_im.template get_access<sycl::access::mode::write>(cgh);
+        return split_view<decltype(re_acc)>{ re_acc, im_acc };
+    };
+}
+
+template <typename E>
+inline auto bind_in(const char* function_name, std::int64_t n, const E* a) {
+    return [=](sycl::handler& cgh) { return element_view<const E*>{ a }; };
+}
+
+template <typename T>
+inline auto bind_in(const char* function_name, std::int64_t n, const T* a_re, const T* a_im) {
+    return [=](sycl::handler& cgh) { return split_view<const T*>{ a_re, a_im }; };
+}
+
+template <typename E>
+inline auto bind_out(const char* function_name, std::int64_t n, E* y) {
+    return [=](sycl::handler& cgh) { return element_view<E*>{ y }; };
+}
+
+template <typename T>
+inline auto bind_out(const char* function_name, std::int64_t n, T* y_re, T* y_im) {
+    return [=](sycl::handler& cgh) { return split_view<T*>{ y_re, y_im }; };
+}
+
+// Evaluates y = op(in...) for the complex functions, T being the real type of the parts
+template <template <oneapi::math::vm::mode> class Op, typename T, typename Out, typename... In>
+sycl::event complex_map(sycl::queue& queue, const char* function_name, std::int64_t n,
+                        const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode,
+                        Out bind_y, In... bind_in) {
+    check_n(function_name, n);
+    return dispatch_mode<Op>(mode, [&](auto op) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto y = bind_y(cgh);
+            auto kernel = [=](auto... in) {
+                return [=](sycl::id<1> id) { map_block<T>(id[0], n, op, y, in...); };
+            };
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), kernel(bind_in(cgh)...));
+        });
+    });
+}
+
+// USM APIs
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+sycl::event unary(sycl::queue& queue, const char* function_name, std::int64_t n, const T* a, T* y,
+                  const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    return dispatch_mode<Op>(mode, [&](auto op) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                unary_block<T>(id[0], n, a, y, op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+sycl::event binary(sycl::queue& queue, const char* function_name, std::int64_t n, const T* a,
+                   const T* b, T* y, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    return dispatch_mode<Op>(mode, [&](auto op) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                binary_block<T>(id[0], n, a, b, y, op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+sycl::event unary_strided(sycl::queue& queue, const char* function_name, std::int64_t n,
+                          const T* a, std::int64_t inca, T* y, std::int64_t incy,
+                          const std::vector<sycl::event>& dependencies,
+                          oneapi::math::vm::mode mode) {
+    if (inca == 1 && incy == 1) {
+        return unary<Op>(queue, function_name, n, a, y, dependencies, mode);
+    }
+    check_n(function_name, n);
+    check_inc(function_name, "inca", inca);
+    check_inc(function_name, "incy", incy);
+    return dispatch_mode<Op>(mode, [&](auto op) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                unary_block<T>(id[0], n, make_strided(a, n, inca), make_strided(y, n, incy), op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+sycl::event binary_strided(sycl::queue& queue, const char* function_name, std::int64_t n,
+                           const T* a, std::int64_t inca, const T* b, std::int64_t incb, T* y,
+                           std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                           oneapi::math::vm::mode mode) {
+    if (inca == 1 && incb == 1 && incy == 1) {
+        return binary<Op>(queue, function_name, n, a, b, y, dependencies, mode);
+    }
+    check_n(function_name, n);
+    check_inc(function_name, "inca", inca);
+    check_inc(function_name, "incb", incb);
+    check_inc(function_name, "incy", incy);
+    return dispatch_mode<Op>(mode, [&](auto op) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                binary_block<T>(id[0], n, make_strided(a, n, inca), make_strided(b, n, incb),
+                                make_strided(y, n, incy), op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+sycl::event unary_indexed(sycl::queue& queue, const char* function_name, std::int64_t n,
+                          const T* a, T* y, const std::int64_t* index,
+                          const std::vector<sycl::event>& dependencies,
+                          oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    return dispatch_mode<Op>(mode, [&](auto op) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                unary_block<T>(id[0], n, make_indexed(a, index), make_indexed(y, index), op);
+            });
+        });
+    });
+}
+
+template <template <oneapi::math::vm::mode> class Op, typename T>
+sycl::event binary_indexed(sycl::queue& queue, const char* function_name, std::int64_t n,
+                           const T* a, const T* b, T* y, const std::int64_t* index,
+                           const std::vector<sycl::event>& dependencies,
+                           oneapi::math::vm::mode mode) {
+    check_n(function_name, n);
+    return dispatch_mode<Op>(mode, [&](auto op) {
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            cgh.parallel_for(sycl::range<1>(num_blocks<T>(n)), [=](sycl::id<1> id) {
+                binary_block<T>(id[0], n, make_indexed(a, index), make_indexed(b, index),
+                                make_indexed(y, index), op);
+            });
+        });
+    });
+}
+
+} // namespace detail
+} // namespace generic
+} // namespace vm
+} // namespace math
+} // namespace oneapi
+
+#endif //_GENERIC_VM_COMMON_HPP_
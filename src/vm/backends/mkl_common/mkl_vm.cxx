@@ -0,0 +1,1426 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+static inline ::oneapi::mkl::vm::mode get_onemkl_vm_mode(oneapi::math::vm::mode mode) {
+    switch (mode) {
+        case oneapi::math::vm::mode::ha: return ::oneapi::mkl::vm::mode::ha;
+        case oneapi::math::vm::mode::la: return ::oneapi::mkl::vm::mode::la;
+        case oneapi::math::vm::mode::ep: return ::oneapi::mkl::vm::mode::ep;
+        default: return ::oneapi::mkl::vm::mode::not_defined;
+    }
+}
+
+static inline void check_inc(const char* function_name, const char* inc_name, std::int64_t inc) {
+    if (inc == 0) {
+        throw oneapi::math::invalid_argument("vm", function_name, std::string(inc_name) + " == 0");
+    }
+}
+
+// A negative increment walks the vector backwards from its last element, as in BLAS
+static inline ::oneapi::mkl::slice get_onemkl_slice(std::int64_t n, std::int64_t inc) {
+    return ::oneapi::mkl::slice(inc < 0 ? (1 - n) * inc : 0, n, inc);
+}
+
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::add(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::add(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::add(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::add(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    check_inc("add", "inca", inca);
+    check_inc("add", "incb", incb);
+    check_inc("add", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::add(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("add", "inca", inca);
+    check_inc("add", "incb", incb);
+    check_inc("add", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::add(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("add", "inca", inca);
+    check_inc("add", "incb", incb);
+    check_inc("add", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::add(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("add", "inca", inca);
+    check_inc("add", "incb", incb);
+    check_inc("add", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::add(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "add", "indexed access");
+}
+void add(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "add", "indexed access");
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "add", "indexed access");
+}
+sycl::event add(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "add", "indexed access");
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+             sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorm(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+             sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorm(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorm(queue, n, a, y, dependencies,
+                                                             get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorm(queue, n, a, y, dependencies,
+                                                             get_onemkl_vm_mode(mode)));
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+             sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("cdfnorm", "inca", inca);
+    check_inc("cdfnorm", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorm(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy),
+                                                         get_onemkl_vm_mode(mode)));
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+             sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("cdfnorm", "inca", inca);
+    check_inc("cdfnorm", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorm(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy),
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                    std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    check_inc("cdfnorm", "inca", inca);
+    check_inc("cdfnorm", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorm(queue, a, get_onemkl_slice(n, inca), y,
+                                                             get_onemkl_slice(n, incy),
+                                                             dependencies,
+                                                             get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                    double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    check_inc("cdfnorm", "inca", inca);
+    check_inc("cdfnorm", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorm(queue, a, get_onemkl_slice(n, inca), y,
+                                                             get_onemkl_slice(n, incy),
+                                                             dependencies,
+                                                             get_onemkl_vm_mode(mode)));
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+             sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+             oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorm", "indexed access");
+}
+void cdfnorm(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+             sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+             oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorm", "indexed access");
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                    const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorm", "indexed access");
+}
+sycl::event cdfnorm(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                    const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorm", "indexed access");
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorminv(queue, n, a, y,
+                                                            get_onemkl_vm_mode(mode)));
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorminv(queue, n, a, y,
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorminv(queue, n, a, y, dependencies,
+                                                                get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorminv(queue, n, a, y, dependencies,
+                                                                get_onemkl_vm_mode(mode)));
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+                sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("cdfnorminv", "inca", inca);
+    check_inc("cdfnorminv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorminv(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy),
+                                                            get_onemkl_vm_mode(mode)));
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+                sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("cdfnorminv", "inca", inca);
+    check_inc("cdfnorminv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cdfnorminv(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy),
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                       float* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    check_inc("cdfnorminv", "inca", inca);
+    check_inc("cdfnorminv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorminv(queue, a, get_onemkl_slice(n, inca),
+                                                                y, get_onemkl_slice(n, incy),
+                                                                dependencies,
+                                                                get_onemkl_vm_mode(mode)));
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                       double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    check_inc("cdfnorminv", "inca", inca);
+    check_inc("cdfnorminv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cdfnorminv(queue, a, get_onemkl_slice(n, inca),
+                                                                y, get_onemkl_slice(n, incy),
+                                                                dependencies,
+                                                                get_onemkl_vm_mode(mode)));
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorminv", "indexed access");
+}
+void cdfnorminv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorminv", "indexed access");
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                       const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorminv", "indexed access");
+}
+sycl::event cdfnorminv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                       const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cdfnorminv", "indexed access");
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::div(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::div(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::div(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::div(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    check_inc("div", "inca", inca);
+    check_inc("div", "incb", incb);
+    check_inc("div", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::div(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("div", "inca", inca);
+    check_inc("div", "incb", incb);
+    check_inc("div", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::div(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("div", "inca", inca);
+    check_inc("div", "incb", incb);
+    check_inc("div", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::div(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("div", "inca", inca);
+    check_inc("div", "incb", incb);
+    check_inc("div", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::div(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "indexed access");
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "indexed access");
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "indexed access");
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "indexed access");
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erf(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erf(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erf(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erf(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("erf", "inca", inca);
+    check_inc("erf", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erf(queue, a, get_onemkl_slice(n, inca), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("erf", "inca", inca);
+    check_inc("erf", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erf(queue, a, get_onemkl_slice(n, inca), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("erf", "inca", inca);
+    check_inc("erf", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erf(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("erf", "inca", inca);
+    check_inc("erf", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erf(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erf", "indexed access");
+}
+void erf(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erf", "indexed access");
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erf", "indexed access");
+}
+sycl::event erf(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erf", "indexed access");
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfc(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfc(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfc(queue, n, a, y, dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfc(queue, n, a, y, dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+          sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("erfc", "inca", inca);
+    check_inc("erfc", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfc(queue, a, get_onemkl_slice(n, inca), y,
+                                                      get_onemkl_slice(n, incy),
+                                                      get_onemkl_vm_mode(mode)));
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+          sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("erfc", "inca", inca);
+    check_inc("erfc", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfc(queue, a, get_onemkl_slice(n, inca), y,
+                                                      get_onemkl_slice(n, incy),
+                                                      get_onemkl_vm_mode(mode)));
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    check_inc("erfc", "inca", inca);
+    check_inc("erfc", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfc(queue, a, get_onemkl_slice(n, inca), y,
+                                                          get_onemkl_slice(n, incy), dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    check_inc("erfc", "inca", inca);
+    check_inc("erfc", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfc(queue, a, get_onemkl_slice(n, inca), y,
+                                                          get_onemkl_slice(n, incy), dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfc", "indexed access");
+}
+void erfc(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+          oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfc", "indexed access");
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfc", "indexed access");
+}
+sycl::event erfc(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfc", "indexed access");
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfinv(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfinv(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfinv(queue, n, a, y, dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfinv(queue, n, a, y, dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+            sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("erfinv", "inca", inca);
+    check_inc("erfinv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfinv(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy),
+                                                        get_onemkl_vm_mode(mode)));
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+            sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("erfinv", "inca", inca);
+    check_inc("erfinv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::erfinv(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy),
+                                                        get_onemkl_vm_mode(mode)));
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                   std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    check_inc("erfinv", "inca", inca);
+    check_inc("erfinv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfinv(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy), dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                   double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    check_inc("erfinv", "inca", inca);
+    check_inc("erfinv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::erfinv(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy), dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfinv", "indexed access");
+}
+void erfinv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfinv", "indexed access");
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfinv", "indexed access");
+}
+sycl::event erfinv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "erfinv", "indexed access");
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::exp(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::exp(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::exp(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::exp(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("exp", "inca", inca);
+    check_inc("exp", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::exp(queue, a, get_onemkl_slice(n, inca), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("exp", "inca", inca);
+    check_inc("exp", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::exp(queue, a, get_onemkl_slice(n, inca), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("exp", "inca", inca);
+    check_inc("exp", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::exp(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("exp", "inca", inca);
+    check_inc("exp", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::exp(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "indexed access");
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "indexed access");
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "indexed access");
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "indexed access");
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::inv(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::inv(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::inv(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::inv(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("inv", "inca", inca);
+    check_inc("inv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::inv(queue, a, get_onemkl_slice(n, inca), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("inv", "inca", inca);
+    check_inc("inv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::inv(queue, a, get_onemkl_slice(n, inca), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("inv", "inca", inca);
+    check_inc("inv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::inv(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("inv", "inca", inca);
+    check_inc("inv", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::inv(queue, a, get_onemkl_slice(n, inca), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "inv", "indexed access");
+}
+void inv(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "inv", "indexed access");
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "inv", "indexed access");
+}
+sycl::event inv(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "inv", "indexed access");
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::lgamma(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::lgamma(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::lgamma(queue, n, a, y, dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::lgamma(queue, n, a, y, dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+            sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("lgamma", "inca", inca);
+    check_inc("lgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::lgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy),
+                                                        get_onemkl_vm_mode(mode)));
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+            sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("lgamma", "inca", inca);
+    check_inc("lgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::lgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy),
+                                                        get_onemkl_vm_mode(mode)));
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                   std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    check_inc("lgamma", "inca", inca);
+    check_inc("lgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::lgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy), dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                   double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    check_inc("lgamma", "inca", inca);
+    check_inc("lgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::lgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy), dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "lgamma", "indexed access");
+}
+void lgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "lgamma", "indexed access");
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "lgamma", "indexed access");
+}
+sycl::event lgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "lgamma", "indexed access");
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::ln(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::ln(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::ln(queue, n, a, y, dependencies,
+                                                        get_onemkl_vm_mode(mode)));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::ln(queue, n, a, y, dependencies,
+                                                        get_onemkl_vm_mode(mode)));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("ln", "inca", inca);
+    check_inc("ln", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::ln(queue, a, get_onemkl_slice(n, inca), y,
+                                                    get_onemkl_slice(n, incy),
+                                                    get_onemkl_vm_mode(mode)));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("ln", "inca", inca);
+    check_inc("ln", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::ln(queue, a, get_onemkl_slice(n, inca), y,
+                                                    get_onemkl_slice(n, incy),
+                                                    get_onemkl_vm_mode(mode)));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("ln", "inca", inca);
+    check_inc("ln", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::ln(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy), dependencies,
+                                                        get_onemkl_vm_mode(mode)));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    check_inc("ln", "inca", inca);
+    check_inc("ln", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::ln(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy), dependencies,
+                                                        get_onemkl_vm_mode(mode)));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "indexed access");
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "indexed access");
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "indexed access");
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "indexed access");
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::mul(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::mul(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::mul(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::mul(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    check_inc("mul", "inca", inca);
+    check_inc("mul", "incb", incb);
+    check_inc("mul", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::mul(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("mul", "inca", inca);
+    check_inc("mul", "incb", incb);
+    check_inc("mul", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::mul(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("mul", "inca", inca);
+    check_inc("mul", "incb", incb);
+    check_inc("mul", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::mul(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("mul", "inca", inca);
+    check_inc("mul", "incb", incb);
+    check_inc("mul", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::mul(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "indexed access");
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "indexed access");
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "indexed access");
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "indexed access");
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::pow(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::pow(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::pow(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::pow(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+         sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    check_inc("pow", "inca", inca);
+    check_inc("pow", "incb", incb);
+    check_inc("pow", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::pow(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+         sycl::buffer<double, 1>& b, std::int64_t incb, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("pow", "inca", inca);
+    check_inc("pow", "incb", incb);
+    check_inc("pow", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::pow(queue, a, get_onemkl_slice(n, inca), b,
+                                                     get_onemkl_slice(n, incb), y,
+                                                     get_onemkl_slice(n, incy),
+                                                     get_onemkl_vm_mode(mode)));
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca,
+                const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("pow", "inca", inca);
+    check_inc("pow", "incb", incb);
+    check_inc("pow", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::pow(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    check_inc("pow", "inca", inca);
+    check_inc("pow", "incb", incb);
+    check_inc("pow", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::pow(queue, a, get_onemkl_slice(n, inca), b,
+                                                         get_onemkl_slice(n, incb), y,
+                                                         get_onemkl_slice(n, incy), dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& b,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "pow", "indexed access");
+}
+void pow(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b,
+         sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "pow", "indexed access");
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const float* a, const float* b, float* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "pow", "indexed access");
+}
+sycl::event pow(sycl::queue& queue, std::int64_t n, const double* a, const double* b, double* y,
+                const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "pow", "indexed access");
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::sqrt(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::sqrt(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::sqrt(queue, n, a, y, dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::sqrt(queue, n, a, y, dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+          sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("sqrt", "inca", inca);
+    check_inc("sqrt", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::sqrt(queue, a, get_onemkl_slice(n, inca), y,
+                                                      get_onemkl_slice(n, incy),
+                                                      get_onemkl_vm_mode(mode)));
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+          sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("sqrt", "inca", inca);
+    check_inc("sqrt", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::sqrt(queue, a, get_onemkl_slice(n, inca), y,
+                                                      get_onemkl_slice(n, incy),
+                                                      get_onemkl_vm_mode(mode)));
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    check_inc("sqrt", "inca", inca);
+    check_inc("sqrt", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::sqrt(queue, a, get_onemkl_slice(n, inca), y,
+                                                          get_onemkl_slice(n, incy), dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca, double* y,
+                 std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    check_inc("sqrt", "inca", inca);
+    check_inc("sqrt", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::sqrt(queue, a, get_onemkl_slice(n, inca), y,
+                                                          get_onemkl_slice(n, incy), dependencies,
+                                                          get_onemkl_vm_mode(mode)));
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "sqrt", "indexed access");
+}
+void sqrt(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+          sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+          oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "sqrt", "indexed access");
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "sqrt", "indexed access");
+}
+sycl::event sqrt(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                 const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "sqrt", "indexed access");
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::tgamma(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::tgamma(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::tgamma(queue, n, a, y, dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::tgamma(queue, n, a, y, dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a, std::int64_t inca,
+            sycl::buffer<float, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("tgamma", "inca", inca);
+    check_inc("tgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::tgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy),
+                                                        get_onemkl_vm_mode(mode)));
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a, std::int64_t inca,
+            sycl::buffer<double, 1>& y, std::int64_t incy, oneapi::math::vm::mode mode) {
+    check_inc("tgamma", "inca", inca);
+    check_inc("tgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::tgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                        get_onemkl_slice(n, incy),
+                                                        get_onemkl_vm_mode(mode)));
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const float* a, std::int64_t inca, float* y,
+                   std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    check_inc("tgamma", "inca", inca);
+    check_inc("tgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::tgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy), dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const double* a, std::int64_t inca,
+                   double* y, std::int64_t incy, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    check_inc("tgamma", "inca", inca);
+    check_inc("tgamma", "incy", incy);
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::tgamma(queue, a, get_onemkl_slice(n, inca), y,
+                                                            get_onemkl_slice(n, incy), dependencies,
+                                                            get_onemkl_vm_mode(mode)));
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+            sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "tgamma", "indexed access");
+}
+void tgamma(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+            sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+            oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "tgamma", "indexed access");
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "tgamma", "indexed access");
+}
+sycl::event tgamma(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                   const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "tgamma", "indexed access");
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::abs(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::abs(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<float>* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::abs(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const std::complex<double>* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::abs(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "abs", "split complex storage");
+}
+void abs(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "abs", "split complex storage");
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "abs", "split complex storage");
+}
+sycl::event abs(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "abs", "split complex storage");
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::arg(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::arg(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<float>* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::arg(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const std::complex<double>* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::arg(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "arg", "split complex storage");
+}
+void arg(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "arg", "split complex storage");
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "arg", "split complex storage");
+}
+sycl::event arg(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "arg", "split complex storage");
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cis(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::cis(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cis(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::cis(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cis", "split complex storage");
+}
+void cis(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+         sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cis", "split complex storage");
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const float* a, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cis", "split complex storage");
+}
+sycl::event cis(sycl::queue& queue, std::int64_t n, const double* a, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "cis", "split complex storage");
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& b, sycl::buffer<std::complex<float>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::div(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& b, sycl::buffer<std::complex<double>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::div(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                const std::complex<float>* b, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::div(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                const std::complex<double>* b, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::div(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re, sycl::buffer<float, 1>& b_im,
+         sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "split complex storage");
+}
+void div(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+         sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "split complex storage");
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                const float* b_re, const float* b_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "split complex storage");
+}
+sycl::event div(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                const double* b_re, const double* b_im, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "div", "split complex storage");
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::exp(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::exp(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                std::complex<float>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::exp(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                std::complex<double>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::exp(queue, n, a, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "split complex storage");
+}
+void exp(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "split complex storage");
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                float* y_re, float* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "split complex storage");
+}
+sycl::event exp(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y_re, double* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "exp", "split complex storage");
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::ln(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::ln(queue, n, a, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                std::complex<float>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::ln(queue, n, a, y, dependencies,
+                                                        get_onemkl_vm_mode(mode)));
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                std::complex<double>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::ln(queue, n, a, y, dependencies,
+                                                        get_onemkl_vm_mode(mode)));
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "split complex storage");
+}
+void log(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "split complex storage");
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                float* y_re, float* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "split complex storage");
+}
+sycl::event log(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                double* y_re, double* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "log", "split complex storage");
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& b, sycl::buffer<std::complex<float>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::mul(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+         sycl::buffer<std::complex<double>, 1>& b, sycl::buffer<std::complex<double>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS(::oneapi::mkl::vm::mul(queue, n, a, b, y, get_onemkl_vm_mode(mode)));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                const std::complex<float>* b, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::mul(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                const std::complex<double>* b, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    RETHROW_ONEMKL_EXCEPTIONS_RET(::oneapi::mkl::vm::mul(queue, n, a, b, y, dependencies,
+                                                         get_onemkl_vm_mode(mode)));
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+         sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re, sycl::buffer<float, 1>& b_im,
+         sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "split complex storage");
+}
+void mul(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+         sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+         sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+         sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "split complex storage");
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const float* a_re, const float* a_im,
+                const float* b_re, const float* b_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "split complex storage");
+}
+sycl::event mul(sycl::queue& queue, std::int64_t n, const double* a_re, const double* a_im,
+                const double* b_re, const double* b_im, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    throw unimplemented("vm", "mul", "split complex storage");
+}
@@ -0,0 +1,257 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// clang-format off
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::add,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorm,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::cdfnorminv,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erf,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfc,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::erfinv,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::inv,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::lgamma,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::pow,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::sqrt,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::tgamma,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::abs,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::arg,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::cis,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::div,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::exp,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::log,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+oneapi::math::vm::VM_BACKEND::mul,
+// clang-format on
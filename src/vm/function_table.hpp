@@ -0,0 +1,829 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _VM_FUNCTION_TABLE_HPP_
+#define _VM_FUNCTION_TABLE_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/vm/types.hpp"
+
+typedef struct {
+    int version;
+    void (*sadd_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                      oneapi::math::vm::mode mode);
+    void (*dadd_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                      oneapi::math::vm::mode mode);
+    sycl::event (*sadd_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                                 float* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*dadd_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                 const double* b, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*sadd_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                              sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*dadd_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                              sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*sadd_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, const float* b, std::int64_t incb,
+                                         float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dadd_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, const double* b, std::int64_t incb,
+                                         double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*sadd_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    void (*dadd_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    sycl::event (*sadd_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         const float* b, float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dadd_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         const double* b, double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*scdfnorm_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                          sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dcdfnorm_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                          sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*scdfnorm_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                     const std::vector<sycl::event>& dependencies,
+                                     oneapi::math::vm::mode mode);
+    sycl::event (*dcdfnorm_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                     const std::vector<sycl::event>& dependencies,
+                                     oneapi::math::vm::mode mode);
+    void (*scdfnorm_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                  std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                                  oneapi::math::vm::mode mode);
+    void (*dcdfnorm_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                  std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                                  oneapi::math::vm::mode mode);
+    sycl::event (*scdfnorm_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                             std::int64_t inca, float* y, std::int64_t incy,
+                                             const std::vector<sycl::event>& dependencies,
+                                             oneapi::math::vm::mode mode);
+    sycl::event (*dcdfnorm_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                             std::int64_t inca, double* y, std::int64_t incy,
+                                             const std::vector<sycl::event>& dependencies,
+                                             oneapi::math::vm::mode mode);
+    void (*scdfnorm_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                  sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                  oneapi::math::vm::mode mode);
+    void (*dcdfnorm_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                  sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                  oneapi::math::vm::mode mode);
+    sycl::event (*scdfnorm_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                             float* y, const std::int64_t* index,
+                                             const std::vector<sycl::event>& dependencies,
+                                             oneapi::math::vm::mode mode);
+    sycl::event (*dcdfnorm_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                             double* y, const std::int64_t* index,
+                                             const std::vector<sycl::event>& dependencies,
+                                             oneapi::math::vm::mode mode);
+    void (*scdfnorminv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                             sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dcdfnorminv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                             sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*scdfnorminv_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                        float* y, const std::vector<sycl::event>& dependencies,
+                                        oneapi::math::vm::mode mode);
+    sycl::event (*dcdfnorminv_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                        double* y, const std::vector<sycl::event>& dependencies,
+                                        oneapi::math::vm::mode mode);
+    void (*scdfnorminv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                     std::int64_t inca, sycl::buffer<float, 1>& y,
+                                     std::int64_t incy, oneapi::math::vm::mode mode);
+    void (*dcdfnorminv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                     std::int64_t inca, sycl::buffer<double, 1>& y,
+                                     std::int64_t incy, oneapi::math::vm::mode mode);
+    sycl::event (*scdfnorminv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                                std::int64_t inca, float* y, std::int64_t incy,
+                                                const std::vector<sycl::event>& dependencies,
+                                                oneapi::math::vm::mode mode);
+    sycl::event (*dcdfnorminv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                                std::int64_t inca, double* y, std::int64_t incy,
+                                                const std::vector<sycl::event>& dependencies,
+                                                oneapi::math::vm::mode mode);
+    void (*scdfnorminv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                     sycl::buffer<float, 1>& y,
+                                     sycl::buffer<std::int64_t, 1>& index,
+                                     oneapi::math::vm::mode mode);
+    void (*dcdfnorminv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                     sycl::buffer<double, 1>& y,
+                                     sycl::buffer<std::int64_t, 1>& index,
+                                     oneapi::math::vm::mode mode);
+    sycl::event (*scdfnorminv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                                float* y, const std::int64_t* index,
+                                                const std::vector<sycl::event>& dependencies,
+                                                oneapi::math::vm::mode mode);
+    sycl::event (*dcdfnorminv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                                double* y, const std::int64_t* index,
+                                                const std::vector<sycl::event>& dependencies,
+                                                oneapi::math::vm::mode mode);
+    void (*sdiv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                      oneapi::math::vm::mode mode);
+    void (*ddiv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                      oneapi::math::vm::mode mode);
+    sycl::event (*sdiv_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                                 float* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*ddiv_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                 const double* b, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*sdiv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                              sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*ddiv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                              sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*sdiv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, const float* b, std::int64_t incb,
+                                         float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*ddiv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, const double* b, std::int64_t incb,
+                                         double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*sdiv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    void (*ddiv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    sycl::event (*sdiv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         const float* b, float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*ddiv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         const double* b, double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*serf_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*derf_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*serf_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*derf_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*serf_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*derf_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*serf_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*derf_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*serf_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    void (*derf_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*serf_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*derf_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*serfc_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*derfc_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*serfc_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                  const std::vector<sycl::event>& dependencies,
+                                  oneapi::math::vm::mode mode);
+    sycl::event (*derfc_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                  const std::vector<sycl::event>& dependencies,
+                                  oneapi::math::vm::mode mode);
+    void (*serfc_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                               std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                               oneapi::math::vm::mode mode);
+    void (*derfc_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                               std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                               oneapi::math::vm::mode mode);
+    sycl::event (*serfc_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                          std::int64_t inca, float* y, std::int64_t incy,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    sycl::event (*derfc_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                          std::int64_t inca, double* y, std::int64_t incy,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    void (*serfc_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                               sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                               oneapi::math::vm::mode mode);
+    void (*derfc_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                               sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                               oneapi::math::vm::mode mode);
+    sycl::event (*serfc_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                          float* y, const std::int64_t* index,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    sycl::event (*derfc_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                          double* y, const std::int64_t* index,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    void (*serfinv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*derfinv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*serfinv_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                    const std::vector<sycl::event>& dependencies,
+                                    oneapi::math::vm::mode mode);
+    sycl::event (*derfinv_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                    const std::vector<sycl::event>& dependencies,
+                                    oneapi::math::vm::mode mode);
+    void (*serfinv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                 std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                                 oneapi::math::vm::mode mode);
+    void (*derfinv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                 std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*serfinv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                            std::int64_t inca, float* y, std::int64_t incy,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    sycl::event (*derfinv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                            std::int64_t inca, double* y, std::int64_t incy,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    void (*serfinv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                 sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                 oneapi::math::vm::mode mode);
+    void (*derfinv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                 sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*serfinv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                            float* y, const std::int64_t* index,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    sycl::event (*derfinv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                            double* y, const std::int64_t* index,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    void (*sexp_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dexp_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*sexp_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*dexp_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*sexp_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*dexp_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*sexp_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dexp_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*sexp_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    void (*dexp_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*sexp_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dexp_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*sinv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dinv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*sinv_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*dinv_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*sinv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*dinv_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*sinv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dinv_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*sinv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    void (*dinv_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*sinv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dinv_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*slgamma_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dlgamma_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*slgamma_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                    const std::vector<sycl::event>& dependencies,
+                                    oneapi::math::vm::mode mode);
+    sycl::event (*dlgamma_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                    const std::vector<sycl::event>& dependencies,
+                                    oneapi::math::vm::mode mode);
+    void (*slgamma_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                 std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                                 oneapi::math::vm::mode mode);
+    void (*dlgamma_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                 std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*slgamma_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                            std::int64_t inca, float* y, std::int64_t incy,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    sycl::event (*dlgamma_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                            std::int64_t inca, double* y, std::int64_t incy,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    void (*slgamma_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                 sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                 oneapi::math::vm::mode mode);
+    void (*dlgamma_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                 sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*slgamma_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                            float* y, const std::int64_t* index,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    sycl::event (*dlgamma_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                            double* y, const std::int64_t* index,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    void (*slog_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dlog_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*slog_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*dlog_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*slog_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*dlog_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*slog_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dlog_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*slog_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    void (*dlog_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*slog_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dlog_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*smul_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                      oneapi::math::vm::mode mode);
+    void (*dmul_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                      oneapi::math::vm::mode mode);
+    sycl::event (*smul_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                                 float* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*dmul_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                 const double* b, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*smul_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                              sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*dmul_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                              sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*smul_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, const float* b, std::int64_t incb,
+                                         float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dmul_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, const double* b, std::int64_t incb,
+                                         double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*smul_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    void (*dmul_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    sycl::event (*smul_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         const float* b, float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dmul_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         const double* b, double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*spow_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                      oneapi::math::vm::mode mode);
+    void (*dpow_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                      oneapi::math::vm::mode mode);
+    sycl::event (*spow_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, const float* b,
+                                 float* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*dpow_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                 const double* b, double* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*spow_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb,
+                              sycl::buffer<float, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    void (*dpow_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              std::int64_t inca, sycl::buffer<double, 1>& b, std::int64_t incb,
+                              sycl::buffer<double, 1>& y, std::int64_t incy,
+                              oneapi::math::vm::mode mode);
+    sycl::event (*spow_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         std::int64_t inca, const float* b, std::int64_t incb,
+                                         float* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dpow_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         std::int64_t inca, const double* b, std::int64_t incb,
+                                         double* y, std::int64_t incy,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*spow_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                              sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    void (*dpow_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                              sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+                              sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode);
+    sycl::event (*spow_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                         const float* b, float* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    sycl::event (*dpow_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                         const double* b, double* y, const std::int64_t* index,
+                                         const std::vector<sycl::event>& dependencies,
+                                         oneapi::math::vm::mode mode);
+    void (*ssqrt_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                       sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dsqrt_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                       sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*ssqrt_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                  const std::vector<sycl::event>& dependencies,
+                                  oneapi::math::vm::mode mode);
+    sycl::event (*dsqrt_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                  const std::vector<sycl::event>& dependencies,
+                                  oneapi::math::vm::mode mode);
+    void (*ssqrt_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                               std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                               oneapi::math::vm::mode mode);
+    void (*dsqrt_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                               std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                               oneapi::math::vm::mode mode);
+    sycl::event (*ssqrt_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                          std::int64_t inca, float* y, std::int64_t incy,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    sycl::event (*dsqrt_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                          std::int64_t inca, double* y, std::int64_t incy,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    void (*ssqrt_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                               sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                               oneapi::math::vm::mode mode);
+    void (*dsqrt_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                               sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                               oneapi::math::vm::mode mode);
+    sycl::event (*ssqrt_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                          float* y, const std::int64_t* index,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    sycl::event (*dsqrt_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                          double* y, const std::int64_t* index,
+                                          const std::vector<sycl::event>& dependencies,
+                                          oneapi::math::vm::mode mode);
+    void (*stgamma_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*dtgamma_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                         sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*stgamma_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a, float* y,
+                                    const std::vector<sycl::event>& dependencies,
+                                    oneapi::math::vm::mode mode);
+    sycl::event (*dtgamma_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a, double* y,
+                                    const std::vector<sycl::event>& dependencies,
+                                    oneapi::math::vm::mode mode);
+    void (*stgamma_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                 std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+                                 oneapi::math::vm::mode mode);
+    void (*dtgamma_strided_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                 std::int64_t inca, sycl::buffer<double, 1>& y, std::int64_t incy,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*stgamma_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                            std::int64_t inca, float* y, std::int64_t incy,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    sycl::event (*dtgamma_strided_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                            std::int64_t inca, double* y, std::int64_t incy,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    void (*stgamma_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                                 sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                 oneapi::math::vm::mode mode);
+    void (*dtgamma_indexed_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                                 sycl::buffer<double, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*stgamma_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                            float* y, const std::int64_t* index,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    sycl::event (*dtgamma_indexed_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                            double* y, const std::int64_t* index,
+                                            const std::vector<sycl::event>& dependencies,
+                                            oneapi::math::vm::mode mode);
+    void (*cabs_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                      sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*zabs_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                      sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*cabs_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                                 float* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*zabs_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                                 double* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*cabs_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                            sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+                            oneapi::math::vm::mode mode);
+    void (*zabs_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                            sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+                            oneapi::math::vm::mode mode);
+    sycl::event (*cabs_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a_re,
+                                       const float* a_im, float* y,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    sycl::event (*zabs_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a_re,
+                                       const double* a_im, double* y,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    void (*carg_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                      sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode);
+    void (*zarg_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                      sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*carg_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                                 float* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*zarg_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                                 double* y, const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*carg_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                            sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+                            oneapi::math::vm::mode mode);
+    void (*zarg_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                            sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+                            oneapi::math::vm::mode mode);
+    sycl::event (*carg_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a_re,
+                                       const float* a_im, float* y,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    sycl::event (*zarg_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a_re,
+                                       const double* a_im, double* y,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    void (*ccis_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                      sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode);
+    void (*zcis_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                      sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*ccis_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                 std::complex<float>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*zcis_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                 std::complex<double>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*ccis_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+                            sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+                            oneapi::math::vm::mode mode);
+    void (*zcis_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a,
+                            sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+                            oneapi::math::vm::mode mode);
+    sycl::event (*ccis_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a,
+                                       float* y_re, float* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    sycl::event (*zcis_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a,
+                                       double* y_re, double* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    void (*cdiv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                      sycl::buffer<std::complex<float>, 1>& b,
+                      sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode);
+    void (*zdiv_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                      sycl::buffer<std::complex<double>, 1>& b,
+                      sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*cdiv_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                                 const std::complex<float>* b, std::complex<float>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*zdiv_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                                 const std::complex<double>* b, std::complex<double>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*cdiv_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                            sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+                            sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re,
+                            sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode);
+    void (*zdiv_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                            sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+                            sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+                            sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode);
+    sycl::event (*cdiv_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a_re,
+                                       const float* a_im, const float* b_re, const float* b_im,
+                                       float* y_re, float* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    sycl::event (*zdiv_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a_re,
+                                       const double* a_im, const double* b_re, const double* b_im,
+                                       double* y_re, double* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    void (*cexp_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                      sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode);
+    void (*zexp_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                      sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*cexp_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                                 std::complex<float>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*zexp_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                                 std::complex<double>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*cexp_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                            sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+                            sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode);
+    void (*zexp_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                            sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+                            sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode);
+    sycl::event (*cexp_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a_re,
+                                       const float* a_im, float* y_re, float* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    sycl::event (*zexp_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a_re,
+                                       const double* a_im, double* y_re, double* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    void (*clog_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                      sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode);
+    void (*zlog_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                      sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*clog_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                                 std::complex<float>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*zlog_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                                 std::complex<double>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*clog_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                            sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+                            sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode);
+    void (*zlog_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                            sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y_re,
+                            sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode);
+    sycl::event (*clog_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a_re,
+                                       const float* a_im, float* y_re, float* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    sycl::event (*zlog_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a_re,
+                                       const double* a_im, double* y_re, double* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    void (*cmul_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<float>, 1>& a,
+                      sycl::buffer<std::complex<float>, 1>& b,
+                      sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode);
+    void (*zmul_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<std::complex<double>, 1>& a,
+                      sycl::buffer<std::complex<double>, 1>& b,
+                      sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode);
+    sycl::event (*cmul_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<float>* a,
+                                 const std::complex<float>* b, std::complex<float>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    sycl::event (*zmul_usm_sycl)(sycl::queue& queue, std::int64_t n, const std::complex<double>* a,
+                                 const std::complex<double>* b, std::complex<double>* y,
+                                 const std::vector<sycl::event>& dependencies,
+                                 oneapi::math::vm::mode mode);
+    void (*cmul_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a_re,
+                            sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+                            sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re,
+                            sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode);
+    void (*zmul_split_sycl)(sycl::queue& queue, std::int64_t n, sycl::buffer<double, 1>& a_re,
+                            sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& b_re,
+                            sycl::buffer<double, 1>& b_im, sycl::buffer<double, 1>& y_re,
+                            sycl::buffer<double, 1>& y_im, oneapi::math::vm::mode mode);
+    sycl::event (*cmul_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const float* a_re,
+                                       const float* a_im, const float* b_re, const float* b_im,
+                                       float* y_re, float* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+    sycl::event (*zmul_split_usm_sycl)(sycl::queue& queue, std::int64_t n, const double* a_re,
+                                       const double* a_im, const double* b_re, const double* b_im,
+                                       double* y_re, double* y_im,
+                                       const std::vector<sycl::event>& dependencies,
+                                       oneapi::math::vm::mode mode);
+} vm_function_table_t;
+
+#endif //_VM_FUNCTION_TABLE_HPP_
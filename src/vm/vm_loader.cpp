@@ -0,0 +1,1379 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "oneapi/math/vm/detail/vm_loader.hpp"
+
+#include "function_table_initializer.hpp"
+#include "vm/function_table.hpp"
+
+namespace oneapi {
+namespace math {
+namespace vm {
+namespace detail {
+
+static oneapi::math::detail::table_initializer<domain::vm, vm_function_table_t> function_tables;
+
+void add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sadd_sycl, queue, n, a, b, y, mode);
+}
+void add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dadd_sycl, queue, n, a, b, y, mode);
+}
+sycl::event add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sadd_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+sycl::event add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dadd_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+void add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sadd_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+void add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+         std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dadd_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+sycl::event add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sadd_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+sycl::event add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dadd_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+void add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sadd_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+void add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dadd_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+sycl::event add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sadd_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+sycl::event add(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dadd_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+void cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+             sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, scdfnorm_sycl, queue, n, a, y, mode);
+}
+void cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+             sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorm_sycl, queue, n, a, y, mode);
+}
+sycl::event cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                    float* y, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, scdfnorm_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                    const double* a, double* y, const std::vector<sycl::event>& dependencies,
+                    oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorm_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+             sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+             std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, scdfnorm_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+             sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+             std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorm_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                    std::int64_t inca, float* y, std::int64_t incy,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, scdfnorm_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+sycl::event cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                    const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorm_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+void cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+             sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+             sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, scdfnorm_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+void cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+             sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+             sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorm_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+sycl::event cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                    float* y, const std::int64_t* index,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, scdfnorm_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event cdfnorm(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                    const double* a, double* y, const std::int64_t* index,
+                    const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorm_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, scdfnorminv_sycl, queue, n, a, y, mode);
+}
+void cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorminv_sycl, queue, n, a, y, mode);
+}
+sycl::event cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                       const float* a, float* y, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, scdfnorminv_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                       const double* a, double* y, const std::vector<sycl::event>& dependencies,
+                       oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorminv_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+                std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, scdfnorminv_strided_sycl, queue, n, a, inca, y,
+                  incy, mode);
+}
+void cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+                std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorminv_strided_sycl, queue, n, a, inca, y,
+                  incy, mode);
+}
+sycl::event cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                       const float* a, std::int64_t inca, float* y, std::int64_t incy,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, scdfnorminv_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+sycl::event cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                       const double* a, std::int64_t inca, double* y, std::int64_t incy,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorminv_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+void cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+                sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, scdfnorminv_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+void cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+                sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorminv_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+sycl::event cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                       const float* a, float* y, const std::int64_t* index,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, scdfnorminv_indexed_usm_sycl, queue, n, a,
+                         y, index, dependencies, mode);
+}
+sycl::event cdfnorminv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                       const double* a, double* y, const std::int64_t* index,
+                       const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dcdfnorminv_indexed_usm_sycl, queue, n, a,
+                         y, index, dependencies, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sdiv_sycl, queue, n, a, b, y, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ddiv_sycl, queue, n, a, b, y, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sdiv_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ddiv_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sdiv_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+         std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ddiv_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sdiv_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ddiv_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sdiv_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ddiv_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sdiv_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ddiv_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+void erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serf_sycl, queue, n, a, y, mode);
+}
+void erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derf_sycl, queue, n, a, y, mode);
+}
+sycl::event erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serf_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derf_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serf_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derf_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serf_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+sycl::event erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derf_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+void erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serf_indexed_sycl, queue, n, a, y, index, mode);
+}
+void erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derf_indexed_sycl, queue, n, a, y, index, mode);
+}
+sycl::event erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serf_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event erf(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derf_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serfc_sycl, queue, n, a, y, mode);
+}
+void erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derfc_sycl, queue, n, a, y, mode);
+}
+sycl::event erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                 float* y, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serfc_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                 double* y, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derfc_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+          std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serfc_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+          std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derfc_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                 std::int64_t inca, float* y, std::int64_t incy,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serfc_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+sycl::event erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                 std::int64_t inca, double* y, std::int64_t incy,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derfc_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+void erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serfc_indexed_sycl, queue, n, a, y, index, mode);
+}
+void erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derfc_indexed_sycl, queue, n, a, y, index, mode);
+}
+sycl::event erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                 float* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serfc_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event erfc(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                 double* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derfc_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serfinv_sycl, queue, n, a, y, mode);
+}
+void erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derfinv_sycl, queue, n, a, y, mode);
+}
+sycl::event erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   float* y, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serfinv_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   double* y, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derfinv_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+            std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serfinv_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+            std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derfinv_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   std::int64_t inca, float* y, std::int64_t incy,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serfinv_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+sycl::event erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   std::int64_t inca, double* y, std::int64_t incy,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derfinv_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+void erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+            sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, serfinv_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+void erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+            sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, derfinv_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+sycl::event erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   float* y, const std::int64_t* index,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, serfinv_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event erfinv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   double* y, const std::int64_t* index,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, derfinv_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sexp_sycl, queue, n, a, y, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dexp_sycl, queue, n, a, y, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sexp_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dexp_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sexp_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dexp_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sexp_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dexp_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sexp_indexed_sycl, queue, n, a, y, index, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dexp_indexed_sycl, queue, n, a, y, index, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sexp_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dexp_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sinv_sycl, queue, n, a, y, mode);
+}
+void inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dinv_sycl, queue, n, a, y, mode);
+}
+sycl::event inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sinv_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dinv_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sinv_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dinv_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sinv_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+sycl::event inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dinv_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+void inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, sinv_indexed_sycl, queue, n, a, y, index, mode);
+}
+void inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dinv_indexed_sycl, queue, n, a, y, index, mode);
+}
+sycl::event inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, sinv_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event inv(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dinv_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, slgamma_sycl, queue, n, a, y, mode);
+}
+void lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dlgamma_sycl, queue, n, a, y, mode);
+}
+sycl::event lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   float* y, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, slgamma_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   double* y, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dlgamma_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+            std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, slgamma_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+            std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dlgamma_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   std::int64_t inca, float* y, std::int64_t incy,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, slgamma_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+sycl::event lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   std::int64_t inca, double* y, std::int64_t incy,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dlgamma_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+void lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+            sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, slgamma_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+void lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+            sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dlgamma_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+sycl::event lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   float* y, const std::int64_t* index,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, slgamma_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event lgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   double* y, const std::int64_t* index,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dlgamma_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, slog_sycl, queue, n, a, y, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dlog_sycl, queue, n, a, y, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, slog_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dlog_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, slog_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dlog_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, slog_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dlog_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, slog_indexed_sycl, queue, n, a, y, index, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dlog_indexed_sycl, queue, n, a, y, index, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, slog_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dlog_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, smul_sycl, queue, n, a, b, y, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dmul_sycl, queue, n, a, b, y, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, smul_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dmul_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, smul_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+         std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dmul_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, smul_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dmul_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, smul_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dmul_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, smul_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dmul_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+void pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, spow_sycl, queue, n, a, b, y, mode);
+}
+void pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dpow_sycl, queue, n, a, b, y, mode);
+}
+sycl::event pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, spow_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+sycl::event pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dpow_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+void pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         std::int64_t inca, sycl::buffer<float, 1>& b, std::int64_t incb, sycl::buffer<float, 1>& y,
+         std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, spow_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+void pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& b,
+         std::int64_t incb, sycl::buffer<double, 1>& y, std::int64_t incy,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dpow_strided_sycl, queue, n, a, inca, b, incb, y,
+                  incy, mode);
+}
+sycl::event pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::int64_t inca, const float* b, std::int64_t incb, float* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, spow_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+sycl::event pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::int64_t inca, const double* b, std::int64_t incb, double* y, std::int64_t incy,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dpow_strided_usm_sycl, queue, n, a, inca,
+                         b, incb, y, incy, dependencies, mode);
+}
+void pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& b, sycl::buffer<float, 1>& y, sycl::buffer<std::int64_t, 1>& index,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, spow_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+void pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& b, sycl::buffer<double, 1>& y,
+         sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dpow_indexed_sycl, queue, n, a, b, y, index,
+                  mode);
+}
+sycl::event pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                const float* b, float* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, spow_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+sycl::event pow(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                const double* b, double* y, const std::int64_t* index,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dpow_indexed_usm_sycl, queue, n, a, b, y,
+                         index, dependencies, mode);
+}
+void sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ssqrt_sycl, queue, n, a, y, mode);
+}
+void sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dsqrt_sycl, queue, n, a, y, mode);
+}
+sycl::event sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                 float* y, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ssqrt_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                 double* y, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dsqrt_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+          std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ssqrt_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+          std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dsqrt_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                 std::int64_t inca, float* y, std::int64_t incy,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ssqrt_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+sycl::event sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                 std::int64_t inca, double* y, std::int64_t incy,
+                 const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dsqrt_strided_usm_sycl, queue, n, a, inca,
+                         y, incy, dependencies, mode);
+}
+void sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ssqrt_indexed_sycl, queue, n, a, y, index, mode);
+}
+void sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+          sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+          sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dsqrt_indexed_sycl, queue, n, a, y, index, mode);
+}
+sycl::event sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                 float* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ssqrt_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event sqrt(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                 double* y, const std::int64_t* index, const std::vector<sycl::event>& dependencies,
+                 oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dsqrt_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, stgamma_sycl, queue, n, a, y, mode);
+}
+void tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dtgamma_sycl, queue, n, a, y, mode);
+}
+sycl::event tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   float* y, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, stgamma_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   double* y, const std::vector<sycl::event>& dependencies,
+                   oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dtgamma_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, std::int64_t inca, sycl::buffer<float, 1>& y,
+            std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, stgamma_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+void tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, std::int64_t inca, sycl::buffer<double, 1>& y,
+            std::int64_t incy, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dtgamma_strided_sycl, queue, n, a, inca, y, incy,
+                  mode);
+}
+sycl::event tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   std::int64_t inca, float* y, std::int64_t incy,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, stgamma_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+sycl::event tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   std::int64_t inca, double* y, std::int64_t incy,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dtgamma_strided_usm_sycl, queue, n, a,
+                         inca, y, incy, dependencies, mode);
+}
+void tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<float, 1>& a, sycl::buffer<float, 1>& y,
+            sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, stgamma_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+void tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+            sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y,
+            sycl::buffer<std::int64_t, 1>& index, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, dtgamma_indexed_sycl, queue, n, a, y, index,
+                  mode);
+}
+sycl::event tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                   float* y, const std::int64_t* index,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, stgamma_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+sycl::event tgamma(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                   double* y, const std::int64_t* index,
+                   const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, dtgamma_indexed_usm_sycl, queue, n, a, y,
+                         index, dependencies, mode);
+}
+void abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cabs_sycl, queue, n, a, y, mode);
+}
+void abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zabs_sycl, queue, n, a, y, mode);
+}
+sycl::event abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<float>* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cabs_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<double>* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zabs_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cabs_split_sycl, queue, n, a_re, a_im, y, mode);
+}
+void abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zabs_split_sycl, queue, n, a_re, a_im, y, mode);
+}
+sycl::event abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a_re,
+                const float* a_im, float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cabs_split_usm_sycl, queue, n, a_re, a_im,
+                         y, dependencies, mode);
+}
+sycl::event abs(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a_re,
+                const double* a_im, double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zabs_split_usm_sycl, queue, n, a_re, a_im,
+                         y, dependencies, mode);
+}
+void arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, carg_sycl, queue, n, a, y, mode);
+}
+void arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zarg_sycl, queue, n, a, y, mode);
+}
+sycl::event arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<float>* a, float* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, carg_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<double>* a, double* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zarg_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, carg_split_sycl, queue, n, a_re, a_im, y, mode);
+}
+void arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im, sycl::buffer<double, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zarg_split_sycl, queue, n, a_re, a_im, y, mode);
+}
+sycl::event arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a_re,
+                const float* a_im, float* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, carg_split_usm_sycl, queue, n, a_re, a_im,
+                         y, dependencies, mode);
+}
+sycl::event arg(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a_re,
+                const double* a_im, double* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zarg_split_usm_sycl, queue, n, a_re, a_im,
+                         y, dependencies, mode);
+}
+void cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ccis_sycl, queue, n, a, y, mode);
+}
+void cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<std::complex<double>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zcis_sycl, queue, n, a, y, mode);
+}
+sycl::event cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                std::complex<float>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ccis_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                std::complex<double>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zcis_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, sycl::buffer<float, 1>& a,
+         sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, ccis_split_sycl, queue, n, a, y_re, y_im, mode);
+}
+void cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a, sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zcis_split_sycl, queue, n, a, y_re, y_im, mode);
+}
+sycl::event cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a,
+                float* y_re, float* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, ccis_split_usm_sycl, queue, n, a, y_re,
+                         y_im, dependencies, mode);
+}
+sycl::event cis(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a,
+                double* y_re, double* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zcis_split_usm_sycl, queue, n, a, y_re,
+                         y_im, dependencies, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<std::complex<float>, 1>& b,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cdiv_sycl, queue, n, a, b, y, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<std::complex<double>, 1>& b,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zdiv_sycl, queue, n, a, b, y, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<float>* a, const std::complex<float>* b, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cdiv_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<double>* a, const std::complex<double>* b,
+                std::complex<double>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zdiv_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+         sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cdiv_split_sycl, queue, n, a_re, a_im, b_re, b_im,
+                  y_re, y_im, mode);
+}
+void div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+         sycl::buffer<double, 1>& b_re, sycl::buffer<double, 1>& b_im,
+         sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zdiv_split_sycl, queue, n, a_re, a_im, b_re, b_im,
+                  y_re, y_im, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a_re,
+                const float* a_im, const float* b_re, const float* b_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cdiv_split_usm_sycl, queue, n, a_re, a_im,
+                         b_re, b_im, y_re, y_im, dependencies, mode);
+}
+sycl::event div(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a_re,
+                const double* a_im, const double* b_re, const double* b_im, double* y_re,
+                double* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zdiv_split_usm_sycl, queue, n, a_re, a_im,
+                         b_re, b_im, y_re, y_im, dependencies, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<std::complex<float>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cexp_sycl, queue, n, a, y, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<std::complex<double>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zexp_sycl, queue, n, a, y, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<float>* a, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cexp_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<double>* a, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zexp_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+         sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cexp_split_sycl, queue, n, a_re, a_im, y_re, y_im,
+                  mode);
+}
+void exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+         sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zexp_split_sycl, queue, n, a_re, a_im, y_re, y_im,
+                  mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a_re,
+                const float* a_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cexp_split_usm_sycl, queue, n, a_re, a_im,
+                         y_re, y_im, dependencies, mode);
+}
+sycl::event exp(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a_re,
+                const double* a_im, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zexp_split_usm_sycl, queue, n, a_re, a_im,
+                         y_re, y_im, dependencies, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<std::complex<float>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, clog_sycl, queue, n, a, y, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<std::complex<double>, 1>& y,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zlog_sycl, queue, n, a, y, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<float>* a, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, clog_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<double>* a, std::complex<double>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zlog_usm_sycl, queue, n, a, y,
+                         dependencies, mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& y_re,
+         sycl::buffer<float, 1>& y_im, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, clog_split_sycl, queue, n, a_re, a_im, y_re, y_im,
+                  mode);
+}
+void log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+         sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zlog_split_sycl, queue, n, a_re, a_im, y_re, y_im,
+                  mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a_re,
+                const float* a_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, clog_split_usm_sycl, queue, n, a_re, a_im,
+                         y_re, y_im, dependencies, mode);
+}
+sycl::event log(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a_re,
+                const double* a_im, double* y_re, double* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zlog_split_usm_sycl, queue, n, a_re, a_im,
+                         y_re, y_im, dependencies, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<float>, 1>& a, sycl::buffer<std::complex<float>, 1>& b,
+         sycl::buffer<std::complex<float>, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cmul_sycl, queue, n, a, b, y, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<std::complex<double>, 1>& a, sycl::buffer<std::complex<double>, 1>& b,
+         sycl::buffer<std::complex<double>, 1>& y, oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zmul_sycl, queue, n, a, b, y, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<float>* a, const std::complex<float>* b, std::complex<float>* y,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cmul_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+                const std::complex<double>* a, const std::complex<double>* b,
+                std::complex<double>* y, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zmul_usm_sycl, queue, n, a, b, y,
+                         dependencies, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<float, 1>& a_re, sycl::buffer<float, 1>& a_im, sycl::buffer<float, 1>& b_re,
+         sycl::buffer<float, 1>& b_im, sycl::buffer<float, 1>& y_re, sycl::buffer<float, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, cmul_split_sycl, queue, n, a_re, a_im, b_re, b_im,
+                  y_re, y_im, mode);
+}
+void mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n,
+         sycl::buffer<double, 1>& a_re, sycl::buffer<double, 1>& a_im,
+         sycl::buffer<double, 1>& b_re, sycl::buffer<double, 1>& b_im,
+         sycl::buffer<double, 1>& y_re, sycl::buffer<double, 1>& y_im,
+         oneapi::math::vm::mode mode) {
+    CALL_TABLE_FN(function_tables, libkey, queue, zmul_split_sycl, queue, n, a_re, a_im, b_re, b_im,
+                  y_re, y_im, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const float* a_re,
+                const float* a_im, const float* b_re, const float* b_im, float* y_re, float* y_im,
+                const std::vector<sycl::event>& dependencies, oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, cmul_split_usm_sycl, queue, n, a_re, a_im,
+                         b_re, b_im, y_re, y_im, dependencies, mode);
+}
+sycl::event mul(oneapi::math::device libkey, sycl::queue& queue, std::int64_t n, const double* a_re,
+                const double* a_im, const double* b_re, const double* b_im, double* y_re,
+                double* y_im, const std::vector<sycl::event>& dependencies,
+                oneapi::math::vm::mode mode) {
+    return CALL_TABLE_FN(function_tables, libkey, queue, zmul_split_usm_sycl, queue, n, a_re, a_im,
+                         b_re, b_im, y_re, y_im, dependencies, mode);
+}
+
+} // namespace detail
+} // namespace vm
+} // namespace math
+} // namespace oneapi
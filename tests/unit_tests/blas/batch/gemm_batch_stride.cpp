@@ -48,7 +48,7 @@ extern std::vector<sycl::device*> devices;
 namespace {
 
 template <typename Ta, typename Tb, typename Tc, typename Ts>
-int test(device* dev, oneapi::math::layout layout, int64_t batch_size) {
+int test(device* dev, oneapi::math::layout layout, int64_t batch_size, int small_item = -1) {
     // Prepare data.
     int64_t m, n, k;
     int64_t lda, ldb, ldc;
@@ -83,6 +83,14 @@ int test(device* dev, oneapi::math::layout layout, int64_t batch_size) {
         transa = (oneapi::math::transpose)(std::rand() % 2);
         transb = (oneapi::math::transpose)(std::rand() % 2);
     }
+    // Sizes and operations of the small-matrix kernels of the backends
+    if (small_item >= 0) {
+        small_gemm_batch_item<Ts>(small_item, m, k, transa, transb);
+        n = 1 + std::rand() % 100;
+        lda = std::max(m, k);
+        ldb = std::max(n, k);
+        ldc = std::max(m, n);
+    }
 
     int64_t stride_a, stride_b, stride_c;
 
@@ -230,6 +238,17 @@ int test(device* dev, oneapi::math::layout layout, int64_t batch_size) {
     return (int)good;
 }
 
+// Runs every item of small_gemm_batch_item, each with a random batch of n
+template <typename Ta, typename Tb, typename Tc, typename Ts>
+int test_small_sizes(device* dev, oneapi::math::layout layout) {
+    for (int i = 0; i < small_gemm_batch_items; i++) {
+        int status = test<Ta, Tb, Tc, Ts>(dev, layout, 5, i);
+        if (status != test_passed)
+            return status;
+    }
+    return test_passed;
+}
+
 class GemmBatchStrideTests
         : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::math::layout>> {};
 
@@ -256,6 +275,8 @@ TEST_P(GemmBatchStrideTests, Int8Int8Int32Precision) {
 TEST_P(GemmBatchStrideTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(
         (test<float, float, float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test_small_sizes<float, float, float, float>(std::get<0>(GetParam()),
+                                                                    std::get<1>(GetParam()))));
 }
 
 TEST_P(GemmBatchStrideTests, RealDoublePrecision) {
@@ -263,12 +284,17 @@ TEST_P(GemmBatchStrideTests, RealDoublePrecision) {
 
     EXPECT_TRUEORSKIP((
         test<double, double, double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test_small_sizes<double, double, double, double>(std::get<0>(GetParam()),
+                                                                        std::get<1>(GetParam()))));
 }
 
 TEST_P(GemmBatchStrideTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(
         (test<std::complex<float>, std::complex<float>, std::complex<float>, std::complex<float>>(
             std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test_small_sizes<std::complex<float>, std::complex<float>,
+                                        std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()))));
 }
 
 TEST_P(GemmBatchStrideTests, ComplexDoublePrecision) {
@@ -277,6 +303,9 @@ TEST_P(GemmBatchStrideTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP(
         (test<std::complex<double>, std::complex<double>, std::complex<double>,
               std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test_small_sizes<std::complex<double>, std::complex<double>,
+                                        std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()))));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmBatchStrideTestSuite, GemmBatchStrideTests,
@@ -48,7 +48,7 @@ extern std::vector<sycl::device*> devices;
 namespace {
 
 template <typename Ta, typename Tb, typename Tc, typename Ts>
-int test(device* dev, oneapi::math::layout layout, int64_t group_count) {
+int test(device* dev, oneapi::math::layout layout, int64_t group_count, bool small_sizes = false) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const& e : exceptions) {
@@ -123,6 +123,15 @@ int test(device* dev, oneapi::math::layout layout, int64_t group_count) {
             transa[i] = (oneapi::math::transpose)(std::rand() % 2);
             transb[i] = (oneapi::math::transpose)(std::rand() % 2);
         }
+        // Sizes and operations of the small-matrix kernels of the backends, one group each
+        if (small_sizes) {
+            small_gemm_batch_item<Ts>(i % small_gemm_batch_items, m[i], k[i], transa[i],
+                                      transb[i]);
+            n[i] = 1 + std::rand() % 100;
+            lda[i] = std::max(m[i], k[i]);
+            ldb[i] = std::max(n[i], k[i]);
+            ldc[i] = std::max(m[i], n[i]);
+        }
         total_batch_count += group_size[i];
     }
 
@@ -390,6 +399,9 @@ TEST_P(GemmBatchUsmTests, Int8Int8Int32Precision) {
 TEST_P(GemmBatchUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(
         (test<float, float, float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test<float, float, float, float>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()),
+                                                        small_gemm_batch_items, true)));
 }
 
 TEST_P(GemmBatchUsmTests, RealDoublePrecision) {
@@ -397,12 +409,18 @@ TEST_P(GemmBatchUsmTests, RealDoublePrecision) {
 
     EXPECT_TRUEORSKIP((
         test<double, double, double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test<double, double, double, double>(std::get<0>(GetParam()),
+                                                            std::get<1>(GetParam()),
+                                                            small_gemm_batch_items, true)));
 }
 
 TEST_P(GemmBatchUsmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(
         (test<std::complex<float>, std::complex<float>, std::complex<float>, std::complex<float>>(
             std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>, std::complex<float>,
+                            std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 small_gemm_batch_items, true)));
 }
 
 TEST_P(GemmBatchUsmTests, ComplexDoublePrecision) {
@@ -411,6 +429,9 @@ TEST_P(GemmBatchUsmTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP(
         (test<std::complex<double>, std::complex<double>, std::complex<double>,
               std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>, std::complex<double>,
+                            std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                  small_gemm_batch_items, true)));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmBatchUsmTestSuite, GemmBatchUsmTests,
@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math/detail/config.hpp"
+#include "oneapi/math.hpp"
+#include "oneapi/math/stats.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Counters of one backend function since the last reset, all zero when it was not called
+oneapi::math::stats::routine_stats find_routine(const std::string& routine) {
+    for (auto& stats : oneapi::math::stats::snapshot()) {
+        if (stats.routine == routine)
+            return stats;
+    }
+    return {};
+}
+
+bool check_stats(const std::string& routine, std::uint64_t calls, std::uint64_t flops,
+                 std::uint64_t bytes) {
+    auto stats = find_routine(routine);
+    if (stats.domain != "blas" || stats.calls != calls || stats.flops != flops ||
+        stats.bytes != bytes) {
+        std::cout << routine << ": " << stats.calls << " calls, " << stats.flops << " flops, "
+                  << stats.bytes << " bytes, expected " << calls << " calls, " << flops
+                  << " flops, " << bytes << " bytes" << std::endl;
+        return false;
+    }
+    // reset() restarts the counters from 0, which removes the function from the snapshot
+    oneapi::math::stats::reset();
+    if (find_routine(routine).calls != 0) {
+        std::cout << routine << " is still counted after reset()" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// sgemm counts 2mnk flops and the m*k + k*n + 2*m*n elements of its operands
+int test_gemm(device* dev, int64_t calls) {
+    queue main_queue(*dev);
+    const int64_t m = 16, n = 24, k = 8;
+    auto a = sycl::malloc_shared<float>(m * k, main_queue);
+    auto b = sycl::malloc_shared<float>(k * n, main_queue);
+    auto c = sycl::malloc_shared<float>(m * n, main_queue);
+    std::fill(a, a + m * k, 1.0f);
+    std::fill(b, b + k * n, 1.0f);
+    std::fill(c, c + m * n, 0.0f);
+
+    oneapi::math::stats::reset();
+    int status = test_passed;
+    try {
+        for (int64_t i = 0; i < calls; i++) {
+            oneapi::math::blas::column_major::gemm(
+                main_queue, oneapi::math::transpose::nontrans, oneapi::math::transpose::nontrans,
+                m, n, k, 1.0f, a, m, b, k, 0.0f, c, m)
+                .wait();
+        }
+        if (!check_stats("column_major_sgemm_usm_sycl", calls, calls * 2 * m * n * k,
+                         calls * (m * k + k * n + 2 * m * n) * sizeof(float)))
+            status = test_failed;
+    }
+    catch (const oneapi::math::unimplemented& e) {
+        status = test_skipped;
+    }
+    catch (const std::exception& e) {
+        std::cout << "Error raised during execution of GEMM:\n" << e.what() << std::endl;
+        status = test_failed;
+    }
+
+    sycl::free(a, main_queue);
+    sycl::free(b, main_queue);
+    sycl::free(c, main_queue);
+    return status;
+}
+
+// cherk takes real scalars, but counts 4 real flops per complex flop of n*n*k and complex
+// operands
+int test_herk(device* dev, int64_t calls) {
+    queue main_queue(*dev);
+    const int64_t n = 16, k = 8;
+    auto a = sycl::malloc_shared<std::complex<float>>(n * k, main_queue);
+    auto c = sycl::malloc_shared<std::complex<float>>(n * n, main_queue);
+    std::fill(a, a + n * k, std::complex<float>(1.0f, -1.0f));
+    std::fill(c, c + n * n, std::complex<float>(0.0f));
+
+    oneapi::math::stats::reset();
+    int status = test_passed;
+    try {
+        for (int64_t i = 0; i < calls; i++) {
+            oneapi::math::blas::column_major::herk(main_queue, oneapi::math::uplo::upper,
+                                                   oneapi::math::transpose::nontrans, n, k, 1.0f,
+                                                   a, n, 0.0f, c, n)
+                .wait();
+        }
+        if (!check_stats("column_major_cherk_usm_sycl", calls, calls * 4 * n * n * k,
+                         calls * (n * k + n * n) * sizeof(std::complex<float>)))
+            status = test_failed;
+    }
+    catch (const oneapi::math::unimplemented& e) {
+        status = test_skipped;
+    }
+    catch (const std::exception& e) {
+        std::cout << "Error raised during execution of HERK:\n" << e.what() << std::endl;
+        status = test_failed;
+    }
+
+    sycl::free(a, main_queue);
+    sycl::free(c, main_queue);
+    return status;
+}
+
+class CallStatsTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(CallStatsTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test_gemm(GetParam(), 1));
+    EXPECT_TRUEORSKIP(test_gemm(GetParam(), 3));
+}
+
+TEST_P(CallStatsTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP(test_herk(GetParam(), 1));
+    EXPECT_TRUEORSKIP(test_herk(GetParam(), 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(CallStatsTestSuite, CallStatsTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math/detail/config.hpp"
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Makes one sgemm and one cherk call with ONEMATH_TRACE set, then exits so that the trace is
+// written. Calls that throw, e.g. unimplemented ones, are recorded as well.
+void run_traced(device* dev, const std::string& trace_file) {
+#ifdef _WIN32
+    _putenv_s("ONEMATH_TRACE", trace_file.c_str());
+#else
+    setenv("ONEMATH_TRACE", trace_file.c_str(), 1);
+#endif
+    {
+        queue main_queue(*dev);
+        const int64_t m = 16, n = 24, k = 8;
+        auto a = sycl::malloc_shared<float>(m * k, main_queue);
+        auto b = sycl::malloc_shared<float>(k * n, main_queue);
+        auto c = sycl::malloc_shared<float>(m * n, main_queue);
+        std::fill(a, a + m * k, 1.0f);
+        std::fill(b, b + k * n, 1.0f);
+        try {
+            oneapi::math::blas::column_major::gemm(
+                main_queue, oneapi::math::transpose::nontrans, oneapi::math::transpose::nontrans,
+                m, n, k, 1.0f, a, m, b, k, 0.0f, c, m)
+                .wait();
+        }
+        catch (const std::exception& e) {
+        }
+        sycl::free(a, main_queue);
+        sycl::free(b, main_queue);
+        sycl::free(c, main_queue);
+    }
+    {
+        queue main_queue(*dev);
+        const int64_t n = 16, k = 8;
+        auto a = sycl::malloc_shared<std::complex<float>>(n * k, main_queue);
+        auto c = sycl::malloc_shared<std::complex<float>>(n * n, main_queue);
+        std::fill(a, a + n * k, std::complex<float>(1.0f, -1.0f));
+        try {
+            oneapi::math::blas::column_major::herk(main_queue, oneapi::math::uplo::upper,
+                                                   oneapi::math::transpose::nontrans, n, k, 1.0f,
+                                                   a, n, 0.0f, c, n)
+                .wait();
+        }
+        catch (const std::exception& e) {
+        }
+        sycl::free(a, main_queue);
+        sycl::free(c, main_queue);
+    }
+    std::exit(0);
+}
+
+bool contains(const std::string& trace, const std::string& expected) {
+    if (trace.find(expected) != std::string::npos)
+        return true;
+    std::cout << "Trace does not contain " << expected << std::endl;
+    return false;
+}
+
+class CallTraceTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(CallTraceTests, ChromeTrace) {
+    std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::replace(name.begin(), name.end(), '/', '_');
+    const std::string trace_file =
+        (std::filesystem::temp_directory_path() / ("onemath_" + name + ".json")).string();
+    std::remove(trace_file.c_str());
+
+    // The tracer reads ONEMATH_TRACE once and writes the file at exit, so the calls are made by a
+    // fresh process running only this test
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+    EXPECT_EXIT(run_traced(GetParam(), trace_file), ::testing::ExitedWithCode(0), "");
+
+    std::ifstream in(trace_file);
+    ASSERT_TRUE(in.good()) << "No trace written to " << trace_file;
+    std::stringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    std::remove(trace_file.c_str());
+    const std::string trace = contents.str();
+
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", 0), 0u);
+    EXPECT_TRUE(trace.size() >= 4 && trace.compare(trace.size() - 4, 4, "\n]}\n") == 0);
+    EXPECT_TRUE(contains(trace, "{\"name\":\"column_major_sgemm_usm_sycl\",\"cat\":\"blas\","
+                                "\"ph\":\"X\",\"pid\":0,\"tid\":\"host "));
+    EXPECT_TRUE(contains(trace, ",\"dtype\":\"float\",\"m\":16,\"n\":24,\"k\":8,\"lda\":16,"
+                                "\"ldb\":8,\"ldc\":16}}"));
+    // The data type of cherk is the one of its matrices, not of its real alpha
+    EXPECT_TRUE(contains(trace, "{\"name\":\"column_major_cherk_usm_sycl\",\"cat\":\"blas\","
+                                "\"ph\":\"X\",\"pid\":0,\"tid\":\"host "));
+    EXPECT_TRUE(contains(trace, ",\"dtype\":\"complex<float>\",\"n\":16,\"k\":8,\"lda\":16,"
+                                "\"ldc\":16}}"));
+}
+
+INSTANTIATE_TEST_SUITE_P(CallTraceTestSuite, CallTraceTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -209,6 +209,28 @@ oneapi::math::transpose rand_trans() {
     return trans;
 }
 
+// Number of gemm_batch items sized for the small-matrix kernels of the backends, see
+// small_gemm_batch_item
+constexpr int small_gemm_batch_items = 12;
+
+// Sizes m and k and operations of item i of small_gemm_batch_items: together they cover every
+// size class of m (up to 4, 8, 16 and 32) and of k (up to 8, 16 and 32), and every pair of
+// transpose operations of fp
+template <typename fp>
+void small_gemm_batch_item(int i, int64_t& m, int64_t& k, oneapi::math::transpose& transa,
+                           oneapi::math::transpose& transb) {
+    const int64_t m_sizes[] = { 3, 8, 13, 27 };
+    const int64_t k_sizes[] = { 5, 16, 29 };
+    const oneapi::math::transpose ops[] = { oneapi::math::transpose::nontrans,
+                                            oneapi::math::transpose::trans,
+                                            oneapi::math::transpose::conjtrans };
+    const int op_count = is_complex<fp>() ? 3 : 2;
+    m = m_sizes[i % 4];
+    k = k_sizes[i / 4];
+    transa = ops[i % op_count];
+    transb = ops[(i / op_count) % op_count];
+}
+
 template <typename vec>
 void print_matrix(vec& M, oneapi::math::transpose trans, int m, int n, int ld, char* name) {
     std::cout << "Matrix " << name << ":\n";
@@ -46,7 +46,8 @@ extern std::vector<sycl::device*> devices;
 namespace {
 
 template <typename fp, typename fp_res, usm::alloc alloc_type = usm::alloc::shared>
-int test(device* dev, oneapi::math::layout layout, int64_t N, int64_t incx) {
+int test(device* dev, oneapi::math::layout layout, int64_t N, int64_t incx,
+         fp_res* result = nullptr) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const& e : exceptions) {
@@ -138,6 +139,8 @@ int test(device* dev, oneapi::math::layout layout, int64_t N, int64_t incx) {
 
     bool good = check_equal_ptr(main_queue, result_p, result_ref, N, std::cout);
 
+    if (result)
+        main_queue.memcpy(result, result_p, sizeof(fp_res)).wait();
     oneapi::math::free_usm(result_p, cxt);
 
     return (int)good;
@@ -155,6 +158,15 @@ TEST_P(AsumUsmTests, RealSinglePrecision) {
                                                                 std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(
         (::test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3)));
+    // Long vectors, shared out between threads by the netlib backend
+    EXPECT_TRUEORSKIP(test_netlib_threads<float>([&](float* result) {
+        return ::test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                    result);
+    }));
+    EXPECT_TRUEORSKIP(test_netlib_threads<float>([&](float* result) {
+        return ::test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 2,
+                                    result);
+    }));
 }
 
 TEST_P(AsumUsmTests, RealDoublePrecision) {
@@ -168,6 +180,15 @@ TEST_P(AsumUsmTests, RealDoublePrecision) {
         std::get<0>(GetParam()), std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(
         (::test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3)));
+    // Long vectors, shared out between threads by the netlib backend
+    EXPECT_TRUEORSKIP(test_netlib_threads<double>([&](double* result) {
+        return ::test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000,
+                                      1, result);
+    }));
+    EXPECT_TRUEORSKIP(test_netlib_threads<double>([&](double* result) {
+        return ::test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000,
+                                      2, result);
+    }));
 }
 
 TEST_P(AsumUsmTests, ComplexSinglePrecision) {
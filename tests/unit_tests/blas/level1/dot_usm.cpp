@@ -46,7 +46,8 @@ extern std::vector<sycl::device*> devices;
 namespace {
 
 template <typename fp, typename fp_res, usm::alloc alloc_type = usm::alloc::shared>
-int test(device* dev, oneapi::math::layout layout, int N, int incx, int incy) {
+int test(device* dev, oneapi::math::layout layout, int N, int incx, int incy,
+         fp_res* result = nullptr) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const& e : exceptions) {
@@ -137,6 +138,8 @@ int test(device* dev, oneapi::math::layout layout, int N, int incx, int incy) {
     // Compare the results of reference implementation and DPC++ implementation.
     bool good = check_equal_ptr(main_queue, result_p, result_ref, N, std::cout);
 
+    if (result)
+        main_queue.memcpy(result, result_p, sizeof(fp_res)).wait();
     oneapi::math::free_usm(result_p, cxt);
 
     return (int)good;
@@ -154,6 +157,15 @@ TEST_P(DotUsmTests, RealSinglePrecision) {
                                                               std::get<1>(GetParam()), 101, 1, 1)));
     EXPECT_TRUEORSKIP(
         (test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2)));
+    // Long vectors, shared out between threads by the netlib backend
+    EXPECT_TRUEORSKIP(test_netlib_threads<float>([&](float* result) {
+        return test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1, 1,
+                                  result);
+    }));
+    EXPECT_TRUEORSKIP(test_netlib_threads<float>([&](float* result) {
+        return test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 2, -1,
+                                  result);
+    }));
 }
 TEST_P(DotUsmTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -166,6 +178,15 @@ TEST_P(DotUsmTests, RealDoublePrecision) {
         std::get<0>(GetParam()), std::get<1>(GetParam()), 101, 1, 1)));
     EXPECT_TRUEORSKIP(
         (test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2)));
+    // Long vectors, shared out between threads by the netlib backend
+    EXPECT_TRUEORSKIP(test_netlib_threads<double>([&](double* result) {
+        return test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                    1, result);
+    }));
+    EXPECT_TRUEORSKIP(test_netlib_threads<double>([&](double* result) {
+        return test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 2,
+                                    -1, result);
+    }));
 }
 TEST_P(DotUsmTests, RealDoubleSinglePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
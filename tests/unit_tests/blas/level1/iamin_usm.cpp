@@ -45,8 +45,15 @@ extern std::vector<sycl::device*> devices;
 
 namespace {
 
+template <typename fp>
+fp nan_value() {
+    return fp(std::numeric_limits<typename complex_info<fp>::real_type>::quiet_NaN());
+}
+
+// The elements of logical indices in positions are set to value after the random fill
 template <typename fp, usm::alloc alloc_type = usm::alloc::shared>
-int test(device* dev, oneapi::math::layout layout, int N, int incx) {
+int test(device* dev, oneapi::math::layout layout, int N, int incx,
+         const std::vector<int>& positions = {}, fp value = fp(0)) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const& e : exceptions) {
@@ -71,6 +78,13 @@ int test(device* dev, oneapi::math::layout layout, int N, int incx) {
     vector<fp, decltype(ua)> x(ua);
     int64_t result_ref = -1;
     rand_vector(x, N, incx);
+    for (int i : positions) {
+        x[i * std::abs(incx)] = value;
+    }
+    // No element is read for incx = 0, but x must still be a valid allocation
+    if (x.empty()) {
+        x.resize(1);
+    }
 
     // Call Reference IAMIN.
     using fp_ref = typename ref_type_info<fp>::type;
@@ -150,6 +164,14 @@ TEST_P(IaminUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP((
         test<float, usm::alloc::device>(std::get<0>(GetParam()), std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 0)));
+    // Longer than a single work-group of the generic backend, with ties between work-groups
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1)));
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                   { 100000, 200000 }, float(0))));
+    // NaN ranks before any magnitude, the first one is returned
+    EXPECT_TRUEORSKIP((test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                   { 150000, 250000 }, nan_value<float>())));
 }
 TEST_P(IaminUsmTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -159,6 +181,14 @@ TEST_P(IaminUsmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP((test<double, usm::alloc::device>(std::get<0>(GetParam()),
                                                         std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 0)));
+    // Longer than a single work-group of the generic backend, with ties between work-groups
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1)));
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                    { 100000, 200000 }, double(0))));
+    // NaN ranks before any magnitude, the first one is returned
+    EXPECT_TRUEORSKIP((test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                    { 150000, 250000 }, nan_value<double>())));
 }
 TEST_P(IaminUsmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(
@@ -169,6 +199,18 @@ TEST_P(IaminUsmTests, ComplexSinglePrecision) {
         std::get<0>(GetParam()), std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(
         test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3));
+    EXPECT_TRUEORSKIP((test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 1357, 0)));
+    // Longer than a single work-group of the generic backend, with ties between work-groups
+    EXPECT_TRUEORSKIP((test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 300000, 1)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 300000, 1, { 100000, 200000 },
+                                                 std::complex<float>(0))));
+    // NaN ranks before any magnitude, the first one is returned
+    EXPECT_TRUEORSKIP((test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 300000, 1, { 150000, 250000 },
+                                                 nan_value<std::complex<float>>())));
 }
 TEST_P(IaminUsmTests, ComplexDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -181,6 +223,18 @@ TEST_P(IaminUsmTests, ComplexDoublePrecision) {
         std::get<0>(GetParam()), std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(
         test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3));
+    EXPECT_TRUEORSKIP((test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                  1357, 0)));
+    // Longer than a single work-group of the generic backend, with ties between work-groups
+    EXPECT_TRUEORSKIP((test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                  300000, 1)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                  300000, 1, { 100000, 200000 },
+                                                  std::complex<double>(0))));
+    // NaN ranks before any magnitude, the first one is returned
+    EXPECT_TRUEORSKIP((test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                  300000, 1, { 150000, 250000 },
+                                                  nan_value<std::complex<double>>())));
 }
 
 INSTANTIATE_TEST_SUITE_P(IaminUsmTestSuite, IaminUsmTests,
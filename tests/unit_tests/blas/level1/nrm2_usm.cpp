@@ -46,7 +46,8 @@ extern std::vector<sycl::device*> devices;
 namespace {
 
 template <typename fp, typename fp_res, usm::alloc alloc_type = usm::alloc::shared>
-int test(device* dev, oneapi::math::layout layout, int N, int incx) {
+int test(device* dev, oneapi::math::layout layout, int N, int incx, fp_res* result = nullptr,
+         fp_res scale = fp_res(1)) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const& e : exceptions) {
@@ -72,6 +73,9 @@ int test(device* dev, oneapi::math::layout layout, int N, int incx) {
     fp_res result_ref = fp_res(-1);
 
     rand_vector(x, N, incx);
+    for (auto& element : x) {
+        element *= scale;
+    }
 
     // Call Reference NRM2.
     using fp_ref = typename ref_type_info<fp>::type;
@@ -137,6 +141,8 @@ int test(device* dev, oneapi::math::layout layout, int N, int incx) {
     // Compare the results of reference implementation and DPC++ implementation.
 
     bool good = check_equal_ptr(main_queue, result_p, result_ref, N, std::cout);
+    if (result)
+        main_queue.memcpy(result, result_p, sizeof(fp_res)).wait();
     oneapi::math::free_usm(result_p, cxt);
 
     return (int)good;
@@ -154,6 +160,11 @@ TEST_P(Nrm2UsmTests, RealSinglePrecision) {
                                                               std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(
         (test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3)));
+    // Long vectors, shared out between threads by the netlib backend
+    EXPECT_TRUEORSKIP(test_netlib_threads<float>([&](float* result) {
+        return test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                  result);
+    }));
 }
 TEST_P(Nrm2UsmTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -166,6 +177,16 @@ TEST_P(Nrm2UsmTests, RealDoublePrecision) {
                                                                 std::get<1>(GetParam()), 101, 1)));
     EXPECT_TRUEORSKIP(
         (test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3)));
+    // Long vectors, shared out between threads by the netlib backend, the second one with squares
+    // overflowing unless rescaled
+    EXPECT_TRUEORSKIP(test_netlib_threads<double>([&](double* result) {
+        return test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                    result);
+    }));
+    EXPECT_TRUEORSKIP(test_netlib_threads<double>([&](double* result) {
+        return test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300000, 1,
+                                    result, 1e200);
+    }));
 }
 TEST_P(Nrm2UsmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
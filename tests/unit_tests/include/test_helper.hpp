@@ -34,6 +34,7 @@
 #include "oneapi/math/detail/config.hpp"
 #include "oneapi/math/detail/backend_selector.hpp"
 
+#include <cstdlib>
 #ifdef _WIN64
 #include <malloc.h>
 #else
@@ -146,6 +147,20 @@
 #define TEST_RUN_GENERIC_BLAS_SELECT(q, func, ...)
 #endif
 
+#ifdef ONEMATH_ENABLE_MKLCPU_BACKEND
+#define TEST_RUN_INTELCPU_VM_SELECT(q, func, ...) \
+    func(oneapi::math::backend_selector<oneapi::math::backend::mklcpu>{ q }, __VA_ARGS__)
+#else
+#define TEST_RUN_INTELCPU_VM_SELECT(q, func, ...)
+#endif
+
+#ifdef ONEMATH_ENABLE_GENERIC_VM_BACKEND
+#define TEST_RUN_GENERIC_VM_SELECT(q, func, ...) \
+    func(oneapi::math::backend_selector<oneapi::math::backend::generic>{ q }, __VA_ARGS__)
+#else
+#define TEST_RUN_GENERIC_VM_SELECT(q, func, ...)
+#endif
+
 #ifdef ONEMATH_ENABLE_CUFFT_BACKEND
 #define TEST_RUN_NVIDIAGPU_CUFFT_SELECT_NO_ARGS(q, func) \
     func(oneapi::math::backend_selector<oneapi::math::backend::cufft>{ q })
@@ -291,6 +306,19 @@
         }                                                                  \
     } while (0);
 
+#define TEST_RUN_VM_CT_SELECT(q, func, ...)                                \
+    do {                                                                   \
+        if (CHECK_HOST_OR_CPU(q))                                          \
+            TEST_RUN_INTELCPU_VM_SELECT(q, func, __VA_ARGS__);             \
+        else if (q.get_device().is_gpu()) {                                \
+            unsigned int vendor_id = static_cast<unsigned int>(            \
+                q.get_device().get_info<sycl::info::device::vendor_id>()); \
+            if (vendor_id == INTEL_ID)                                     \
+                TEST_RUN_INTELGPU_SELECT(q, func, __VA_ARGS__);            \
+        }                                                                  \
+        TEST_RUN_GENERIC_VM_SELECT(q, func, __VA_ARGS__);                  \
+    } while (0);
+
 void print_error_code(sycl::exception const& e);
 
 class DeviceNamePrint {
@@ -324,6 +352,72 @@ public:
     }
 };
 
+// Sets an environment variable until the end of the scope
+class scoped_env {
+public:
+    scoped_env(const char* name, const char* value) : name_(name) {
+        if (const char* old_value = std::getenv(name)) {
+            had_value_ = true;
+            old_value_ = old_value;
+        }
+        set(value);
+    }
+
+    ~scoped_env() {
+        if (had_value_)
+            set(old_value_.c_str());
+        else
+#ifdef _WIN64
+            _putenv_s(name_.c_str(), "");
+#else
+            unsetenv(name_.c_str());
+#endif
+    }
+
+    scoped_env(const scoped_env&) = delete;
+    scoped_env& operator=(const scoped_env&) = delete;
+
+private:
+    void set(const char* value) {
+#ifdef _WIN64
+        _putenv_s(name_.c_str(), value);
+#else
+        setenv(name_.c_str(), value, 1);
+#endif
+    }
+
+    std::string name_;
+    bool had_value_ = false;
+    std::string old_value_;
+};
+
+// Runs run(&result) with ONEMATH_NETLIB_THREADS set to several thread counts and the same random
+// data, and checks that the results are identical. The netlib backend shares long vectors out
+// between threads, and its reductions must not depend on their number.
+template <typename fp_res, typename Run>
+int test_netlib_threads(Run run) {
+    const char* thread_counts[] = { "8", "3", "1" };
+    fp_res first = fp_res(0);
+    for (int t = 0; t < 3; t++) {
+        scoped_env threads("ONEMATH_NETLIB_THREADS", thread_counts[t]);
+        std::srand(1234);
+        fp_res result = fp_res(0);
+        int status = run(&result);
+        if (status != test_passed)
+            return status;
+        if (t == 0) {
+            first = result;
+        }
+        else if (result != first) {
+            std::cout << "Result " << result << " with ONEMATH_NETLIB_THREADS="
+                      << thread_counts[t] << " differs from " << first << " with "
+                      << thread_counts[0] << std::endl;
+            return test_failed;
+        }
+    }
+    return test_passed;
+}
+
 /* to accommodate Windows and Linux differences between alligned_alloc and
    _aligned_malloc calls use oneapi::math::aligned_alloc and oneapi::math::aligned_free instead */
 namespace oneapi {
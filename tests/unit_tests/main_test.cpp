@@ -112,15 +112,16 @@ int main(int argc, char** argv) {
                     if (unique_devices.find(dev.get_info<sycl::info::device::name>()) ==
                         unique_devices.end()) {
                         unique_devices.insert(dev.get_info<sycl::info::device::name>());
-#if !defined(ONEMATH_ENABLE_MKLCPU_BACKEND) &&                 \
-    !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_INTEL_CPU) && \
-    !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) && !defined(ONEMATH_ENABLE_NETLIB_BACKEND)
+#if !defined(ONEMATH_ENABLE_MKLCPU_BACKEND) &&                                             \
+    !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_INTEL_CPU) &&                             \
+    !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) && !defined(ONEMATH_ENABLE_NETLIB_BACKEND) && \
+    !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
                         if (dev.is_cpu())
                             continue;
 #endif
 #if !defined(ONEMATH_ENABLE_MKLGPU_BACKEND) &&                 \
     !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_INTEL_GPU) && \
-    !defined(ONEMATH_ENABLE_PORTFFT_BACKEND)
+    !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) && !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
                         if (dev.is_gpu() && vendor_id == INTEL_ID)
                             continue;
 #endif
@@ -128,7 +129,7 @@ int main(int argc, char** argv) {
     !defined(ONEMATH_ENABLE_CUSOLVER_BACKEND) &&                                          \
     !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_NVIDIA_GPU) &&                           \
     !defined(ONEMATH_ENABLE_CUFFT_BACKEND) && !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) && \
-    !defined(ONEMATH_ENABLE_CUSPARSE_BACKEND)
+    !defined(ONEMATH_ENABLE_CUSPARSE_BACKEND) && !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
                         if (dev.is_gpu() && vendor_id == NVIDIA_ID)
                             continue;
 #endif
@@ -136,7 +137,7 @@ int main(int argc, char** argv) {
     !defined(ONEMATH_ENABLE_ROCSOLVER_BACKEND) &&                                           \
     !defined(ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_AMD_GPU) &&                                \
     !defined(ONEMATH_ENABLE_ROCFFT_BACKEND) && !defined(ONEMATH_ENABLE_PORTFFT_BACKEND) &&  \
-    !defined(ONEMATH_ENABLE_ROCSPARSE_BACKEND)
+    !defined(ONEMATH_ENABLE_ROCSPARSE_BACKEND) && !defined(ONEMATH_ENABLE_GENERIC_VM_BACKEND)
                         if (dev.is_gpu() && vendor_id == AMD_ID)
                             continue;
 #endif
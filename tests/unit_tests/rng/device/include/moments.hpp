@@ -27,6 +27,7 @@
 #ifndef _RNG_DEVICE_DISTR_MOMENTS_TEST_HPP_
 #define _RNG_DEVICE_DISTR_MOMENTS_TEST_HPP_
 
+#include <array>
 #include <iostream>
 
 #if __has_include(<sycl/sycl.hpp>)
@@ -60,7 +61,15 @@ public:
              std::is_same_v<
                  Distribution,
                  oneapi::math::rng::device::poisson<
-                     std::int32_t, oneapi::math::rng::device::poisson_method::devroye>>) &&
+                     std::int32_t, oneapi::math::rng::device::poisson_method::devroye>> ||
+             std::is_same_v<
+                 Distribution,
+                 oneapi::math::rng::device::poisson<
+                     std::uint32_t, oneapi::math::rng::device::poisson_method::ptrd>> ||
+             std::is_same_v<
+                 Distribution,
+                 oneapi::math::rng::device::poisson<
+                     std::int32_t, oneapi::math::rng::device::poisson_method::ptrd>>) &&
             !queue.get_device().has(sycl::aspect::fp64)) {
             status = test_skipped;
             return;
@@ -118,4 +127,125 @@ public:
     int status = test_passed;
 };
 
+// Poisson distribution with a given lambda. With set_param, every work-item constructs the
+// distribution with the default lambda and switches to the tested one through param(), as done
+// when sampling with per-element rates.
+template <class Engine, class Distribution>
+class poisson_moments_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue, double lambda, bool set_param) {
+        if (!queue.get_device().has(sycl::aspect::fp64)) {
+            status = test_skipped;
+            return;
+        }
+        using Type = typename Distribution::result_type;
+        // prepare array for random numbers
+        std::vector<Type> r(N_GEN);
+
+        try {
+            sycl::range<1> range(N_GEN / Engine::vec_size);
+
+            sycl::buffer<Type> buf(r);
+            auto event = queue.submit([&](sycl::handler& cgh) {
+                sycl::accessor acc(buf, cgh, sycl::write_only);
+                cgh.parallel_for(range, [=](sycl::item<1> item) {
+                    size_t id = item.get_id(0);
+                    Engine engine(SEED, id * Engine::vec_size);
+                    Distribution distr(set_param ? 1.0 : lambda);
+                    if (set_param)
+                        distr.param(typename Distribution::param_type(lambda));
+                    auto res = oneapi::math::rng::device::generate(distr, engine);
+                    if constexpr (Engine::vec_size == 1) {
+                        acc[id] = res;
+                    }
+                    else {
+                        res.store(id, get_multi_ptr(acc));
+                    }
+                });
+            });
+            event.wait_and_throw();
+        }
+        catch (const oneapi::math::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "Error code: " << get_error_code(e) << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        statistics_device<Distribution> stat;
+        status = stat.check(r, Distribution(lambda));
+    }
+
+    int status = test_passed;
+};
+
+// Checks every coordinate of the generated vectors against its marginal normal distribution:
+// coordinate i has mean mean[i] and variance sum_j T[i][j]^2
+template <class Engine, class Distribution>
+class multivariate_normal_moments_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue) {
+        using Type = typename Distribution::result_type;
+        constexpr std::int32_t dimen = Distribution::dimen;
+        const std::array<Type, dimen> mean = { 1.0, -1.0, 2.0 };
+        const std::array<Type, dimen * dimen> t = { 1.0, 0.0, 0.0, 0.5, 2.0, 0.0, -1.0, 0.25, 0.5 };
+        // prepare array for random numbers
+        std::vector<Type> r(N_GEN * dimen);
+
+        try {
+            sycl::range<1> range(N_GEN);
+
+            sycl::buffer<Type> buf(r);
+            auto event = queue.submit([&](sycl::handler& cgh) {
+                sycl::accessor acc(buf, cgh, sycl::write_only);
+                cgh.parallel_for(range, [=](sycl::item<1> item) {
+                    size_t id = item.get_id(0);
+                    Engine engine(SEED, id * 2 * ((dimen + 1) / 2));
+                    Distribution distr(mean, t);
+                    auto res = oneapi::math::rng::device::generate(distr, engine);
+                    for (std::int32_t i = 0; i < dimen; i++) {
+                        acc[id * dimen + i] = res[i];
+                    }
+                });
+            });
+            event.wait_and_throw();
+        }
+        catch (const oneapi::math::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "Error code: " << get_error_code(e) << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        std::vector<Type> coordinate(N_GEN);
+        for (std::int32_t i = 0; i < dimen; i++) {
+            double tD = 0.0;
+            for (std::int32_t j = 0; j <= i; j++) {
+                tD += (double)t[i * dimen + j] * (double)t[i * dimen + j];
+            }
+            for (std::int32_t k = 0; k < N_GEN; k++) {
+                coordinate[k] = r[k * dimen + i];
+            }
+            if (!compare_moments(coordinate, mean[i], tD, 720.0 * tD * tD)) {
+                status = test_failed;
+                return;
+            }
+        }
+    }
+
+    int status = test_passed;
+};
+
 #endif // _RNG_DEVICE_DISTR_MOMENTS_TEST_HPP_
@@ -910,6 +910,104 @@ INSTANTIATE_TEST_SUITE_P(Philox4x32x10GaussianBoxMuller2DeviceMomentsTestsSuite,
                          Philox4x32x10GaussianBoxMuller2DeviceMomentsTests,
                          ::testing::ValuesIn(devices), ::DeviceNamePrint());
 
+class Philox4x32x10GaussianBoxMuller2EpDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+// implementation uses double precision for accuracy
+TEST_P(Philox4x32x10GaussianBoxMuller2EpDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                     oneapi::math::rng::device::gaussian<
+                         float, oneapi::math::rng::device::gaussian_method::box_muller2_ep>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                     oneapi::math::rng::device::gaussian<
+                         float, oneapi::math::rng::device::gaussian_method::box_muller2_ep>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                     oneapi::math::rng::device::gaussian<
+                         float, oneapi::math::rng::device::gaussian_method::box_muller2_ep>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                     oneapi::math::rng::device::gaussian<
+                         double, oneapi::math::rng::device::gaussian_method::box_muller2_ep>>>
+        test4;
+    EXPECT_TRUEORSKIP((test4(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                     oneapi::math::rng::device::gaussian<
+                         double, oneapi::math::rng::device::gaussian_method::box_muller2_ep>>>
+        test5;
+    EXPECT_TRUEORSKIP((test5(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                     oneapi::math::rng::device::gaussian<
+                         double, oneapi::math::rng::device::gaussian_method::box_muller2_ep>>>
+        test6;
+    EXPECT_TRUEORSKIP((test6(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10GaussianBoxMuller2EpDeviceMomentsTestsSuite,
+                         Philox4x32x10GaussianBoxMuller2EpDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Philox4x32x10GaussianIcdfDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+// implementation uses double precision for accuracy
+TEST_P(Philox4x32x10GaussianIcdfDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                     oneapi::math::rng::device::gaussian<
+                         float, oneapi::math::rng::device::gaussian_method::icdf>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                     oneapi::math::rng::device::gaussian<
+                         float, oneapi::math::rng::device::gaussian_method::icdf>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                     oneapi::math::rng::device::gaussian<
+                         float, oneapi::math::rng::device::gaussian_method::icdf>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                     oneapi::math::rng::device::gaussian<
+                         double, oneapi::math::rng::device::gaussian_method::icdf>>>
+        test4;
+    EXPECT_TRUEORSKIP((test4(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                     oneapi::math::rng::device::gaussian<
+                         double, oneapi::math::rng::device::gaussian_method::icdf>>>
+        test5;
+    EXPECT_TRUEORSKIP((test5(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                     oneapi::math::rng::device::gaussian<
+                         double, oneapi::math::rng::device::gaussian_method::icdf>>>
+        test6;
+    EXPECT_TRUEORSKIP((test6(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10GaussianIcdfDeviceMomentsTestsSuite,
+                         Philox4x32x10GaussianIcdfDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 class Philox4x32x10LognormalBoxMuller2DeviceMomentsTests
         : public ::testing::TestWithParam<sycl::device*> {};
 
@@ -1053,6 +1151,55 @@ INSTANTIATE_TEST_SUITE_P(Philox4x32x10ExponentialIcdfAccDeviceMomentsTestsSuite,
                          Philox4x32x10ExponentialIcdfAccDeviceMomentsTests,
                          ::testing::ValuesIn(devices), ::DeviceNamePrint());
 
+class Philox4x32x10ExponentialIcdfEpDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+// implementation uses double precision for accuracy
+TEST_P(Philox4x32x10ExponentialIcdfEpDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                     oneapi::math::rng::device::exponential<
+                         float, oneapi::math::rng::device::exponential_method::icdf_ep>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                     oneapi::math::rng::device::exponential<
+                         float, oneapi::math::rng::device::exponential_method::icdf_ep>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                     oneapi::math::rng::device::exponential<
+                         float, oneapi::math::rng::device::exponential_method::icdf_ep>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                     oneapi::math::rng::device::exponential<
+                         double, oneapi::math::rng::device::exponential_method::icdf_ep>>>
+        test4;
+    EXPECT_TRUEORSKIP((test4(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                     oneapi::math::rng::device::exponential<
+                         double, oneapi::math::rng::device::exponential_method::icdf_ep>>>
+        test5;
+    EXPECT_TRUEORSKIP((test5(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                     oneapi::math::rng::device::exponential<
+                         double, oneapi::math::rng::device::exponential_method::icdf_ep>>>
+        test6;
+    EXPECT_TRUEORSKIP((test6(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10ExponentialIcdfEpDeviceMomentsTestsSuite,
+                         Philox4x32x10ExponentialIcdfEpDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 class Philox4x32x10BetaCjaDeviceMomentsTests : public ::testing::TestWithParam<sycl::device*> {};
 
 class Philox4x32x10BetaCjaAccDeviceMomentsTests : public ::testing::TestWithParam<sycl::device*> {};
@@ -1283,6 +1430,94 @@ INSTANTIATE_TEST_SUITE_P(Philox4x32x10PoissonDevroyeDeviceMomentsTestsSuite,
                          Philox4x32x10PoissonDevroyeDeviceMomentsTests,
                          ::testing::ValuesIn(devices), ::DeviceNamePrint());
 
+class Philox4x32x10PoissonPtrdDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10PoissonPtrdDeviceMomentsTests, IntegerPrecision) {
+    rng_device_test<moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                                 oneapi::math::rng::device::poisson<
+                                     int32_t, oneapi::math::rng::device::poisson_method::ptrd>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                                 oneapi::math::rng::device::poisson<
+                                     int32_t, oneapi::math::rng::device::poisson_method::ptrd>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                                 oneapi::math::rng::device::poisson<
+                                     int32_t, oneapi::math::rng::device::poisson_method::ptrd>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+TEST_P(Philox4x32x10PoissonPtrdDeviceMomentsTests, UnsignedIntegerPrecision) {
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<1>,
+                     oneapi::math::rng::device::poisson<
+                         std::uint32_t, oneapi::math::rng::device::poisson_method::ptrd>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<4>,
+                     oneapi::math::rng::device::poisson<
+                         std::uint32_t, oneapi::math::rng::device::poisson_method::ptrd>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<
+        moments_test<oneapi::math::rng::device::philox4x32x10<16>,
+                     oneapi::math::rng::device::poisson<
+                         std::uint32_t, oneapi::math::rng::device::poisson_method::ptrd>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+TEST_P(Philox4x32x10PoissonPtrdDeviceMomentsTests, IntegerPrecisionLargeLambda) {
+    rng_device_test<poisson_moments_test<
+        oneapi::math::rng::device::philox4x32x10<1>,
+        oneapi::math::rng::device::poisson<std::int32_t,
+                                           oneapi::math::rng::device::poisson_method::ptrd>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 50.0, false)));
+    rng_device_test<poisson_moments_test<
+        oneapi::math::rng::device::philox4x32x10<4>,
+        oneapi::math::rng::device::poisson<std::int32_t,
+                                           oneapi::math::rng::device::poisson_method::ptrd>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), 50.0, false)));
+    rng_device_test<poisson_moments_test<
+        oneapi::math::rng::device::philox4x32x10<16>,
+        oneapi::math::rng::device::poisson<std::int32_t,
+                                           oneapi::math::rng::device::poisson_method::ptrd>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 50.0, false)));
+}
+
+TEST_P(Philox4x32x10PoissonPtrdDeviceMomentsTests, IntegerPrecisionParamChange) {
+    rng_device_test<poisson_moments_test<
+        oneapi::math::rng::device::philox4x32x10<1>,
+        oneapi::math::rng::device::poisson<std::int32_t,
+                                           oneapi::math::rng::device::poisson_method::ptrd>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), 50.0, true)));
+    rng_device_test<poisson_moments_test<
+        oneapi::math::rng::device::philox4x32x10<4>,
+        oneapi::math::rng::device::poisson<std::int32_t,
+                                           oneapi::math::rng::device::poisson_method::ptrd>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), 50.0, true)));
+    rng_device_test<poisson_moments_test<
+        oneapi::math::rng::device::philox4x32x10<16>,
+        oneapi::math::rng::device::poisson<std::int32_t,
+                                           oneapi::math::rng::device::poisson_method::ptrd>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), 50.0, true)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10PoissonPtrdDeviceMomentsTestsSuite,
+                         Philox4x32x10PoissonPtrdDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 class Philox4x32x10BernoulliIcdfDeviceMomentsTests
         : public ::testing::TestWithParam<sycl::device*> {};
 
@@ -1511,4 +1746,49 @@ INSTANTIATE_TEST_SUITE_P(Philox4x32x10GeometricIcdfDeviceMomentsTestsSuite,
                          Philox4x32x10GeometricIcdfDeviceMomentsTests, ::testing::ValuesIn(devices),
                          ::DeviceNamePrint());
 
+class Philox4x32x10MultivariateNormalDeviceMomentsTests
+        : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10MultivariateNormalDeviceMomentsTests, RealSinglePrecision) {
+    rng_device_test<multivariate_normal_moments_test<
+        oneapi::math::rng::device::philox4x32x10<1>,
+        oneapi::math::rng::device::multivariate_normal<3, float>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<multivariate_normal_moments_test<
+        oneapi::math::rng::device::philox4x32x10<4>,
+        oneapi::math::rng::device::multivariate_normal<3, float>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<multivariate_normal_moments_test<
+        oneapi::math::rng::device::philox4x32x10<16>,
+        oneapi::math::rng::device::multivariate_normal<3, float>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+TEST_P(Philox4x32x10MultivariateNormalDeviceMomentsTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    rng_device_test<multivariate_normal_moments_test<
+        oneapi::math::rng::device::philox4x32x10<1>,
+        oneapi::math::rng::device::multivariate_normal<3, double>>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_device_test<multivariate_normal_moments_test<
+        oneapi::math::rng::device::philox4x32x10<4>,
+        oneapi::math::rng::device::multivariate_normal<3, double>>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+    rng_device_test<multivariate_normal_moments_test<
+        oneapi::math::rng::device::philox4x32x10<16>,
+        oneapi::math::rng::device::multivariate_normal<3, double>>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10MultivariateNormalDeviceMomentsTestsSuite,
+                         Philox4x32x10MultivariateNormalDeviceMomentsTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 } // anonymous namespace
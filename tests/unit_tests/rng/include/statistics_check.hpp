@@ -26,6 +26,8 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <algorithm>
+
 #include "oneapi/math.hpp"
 
 #include "rng_test_common.hpp"
@@ -176,4 +178,144 @@ struct statistics<oneapi::math::rng::poisson<Type, Method>> {
     }
 };
 
+template <typename Type, typename Method>
+struct statistics<oneapi::math::rng::exponential<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::math::rng::exponential<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double a = distr.a();
+        double beta = distr.beta();
+
+        tM = a + beta;
+        tD = beta * beta;
+        tQ = 9.0 * beta * beta * beta * beta;
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::math::rng::gamma<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::math::rng::gamma<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double alpha = distr.alpha();
+        double a = distr.a();
+        double beta = distr.beta();
+
+        tM = a + alpha * beta;
+        tD = alpha * beta * beta;
+        tQ = 3.0 * alpha * (alpha + 2.0) * beta * beta * beta * beta;
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::math::rng::beta<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::math::rng::beta<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double p = distr.p();
+        double q = distr.q();
+        double a = distr.a();
+        double b = distr.b();
+        double s = p + q;
+
+        tM = a + b * p / s;
+        tD = b * b * p * q / (s * s * (s + 1.0));
+        // Fourth central moment from the excess kurtosis of the beta distribution
+        tQ = tD * tD *
+             (3.0 + 6.0 * ((p - q) * (p - q) * (s + 1.0) - p * q * (s + 2.0)) /
+                        (p * q * (s + 2.0) * (s + 3.0)));
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::math::rng::geometric<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::math::rng::geometric<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double p = distr.p();
+        double q = 1.0 - p;
+
+        tM = q / p;
+        tD = q / (p * p);
+        tQ = tD * tD * (9.0 + p * p / q);
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+// Checks the marginal moments of every coordinate of the generated vectors, and the sample
+// covariance of every pair of coordinates against C = T * T^T
+template <typename Type, typename Method>
+struct statistics<oneapi::math::rng::multivariate_normal<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::math::rng::multivariate_normal<Type, Method>& distr) {
+        const std::int32_t dimen = distr.dimen();
+        const auto& mean = distr.mean();
+        const auto& t = distr.cholesky_factor();
+        const std::size_t n_vectors = r.size() / dimen;
+        auto cov = [&](std::int32_t i, std::int32_t j) {
+            double c = 0.0;
+            for (std::int32_t k = 0; k <= std::min(i, j); k++) {
+                c += (double)t[i * dimen + k] * (double)t[j * dimen + k];
+            }
+            return c;
+        };
+
+        std::vector<Type> coordinate(n_vectors);
+        for (std::int32_t i = 0; i < dimen; i++) {
+            for (std::size_t k = 0; k < n_vectors; k++) {
+                coordinate[k] = r[k * dimen + i];
+            }
+            double tD = cov(i, i);
+            if (!compare_moments(coordinate, mean[i], tD, 3.0 * tD * tD)) {
+                return false;
+            }
+        }
+
+        for (std::int32_t i = 0; i < dimen; i++) {
+            for (std::int32_t j = 0; j < i; j++) {
+                double sC = 0.0;
+                for (std::size_t k = 0; k < n_vectors; k++) {
+                    sC += ((double)r[k * dimen + i] - mean[i]) *
+                          ((double)r[k * dimen + j] - mean[j]);
+                }
+                sC /= (double)n_vectors;
+                // Variance of the product of two centered normal coordinates
+                double tC = cov(i, j);
+                double s = (cov(i, i) * cov(j, j) + tC * tC) / (double)n_vectors;
+                if (fabs(tC - sC) / sqrt(s) > 10.0) {
+                    std::cout << "Error: sample covariance of coordinates " << i << " and " << j
+                              << " (" << sC << ") disagrees with theory (" << tC << ")"
+                              << " N_GEN = " << n_vectors << std::endl;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Number of generated values for n_gen samples of the distribution
+template <typename Distr>
+std::int64_t output_size(const Distr& distr, std::int64_t n_gen) {
+    return n_gen;
+}
+
+template <typename Type, typename Method>
+std::int64_t output_size(const oneapi::math::rng::multivariate_normal<Type, Method>& distr,
+                         std::int64_t n_gen) {
+    return n_gen * distr.dimen();
+}
+
 #endif // _RNG_TEST_STATISTICS_CHECK_HPP__
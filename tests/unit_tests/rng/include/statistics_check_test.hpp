@@ -48,6 +48,25 @@
 
 #define POISSON_ARGS 0.5
 
+#define EXPONENTIAL_ARGS_FLOAT  0.0f, 2.0f
+#define EXPONENTIAL_ARGS_DOUBLE 0.0, 2.0
+
+#define GAMMA_ARGS_FLOAT  2.0f, 0.0f, 1.0f
+#define GAMMA_ARGS_DOUBLE 2.0, 0.0, 1.0
+
+#define BETA_ARGS_FLOAT  2.0f, 3.0f, 0.0f, 1.0f
+#define BETA_ARGS_DOUBLE 2.0, 3.0, 0.0, 1.0
+
+#define GEOMETRIC_ARGS 0.5f
+
+// Dimension, mean and row-major lower triangular Cholesky factor with non-zero off-diagonal terms
+#define MULTIVARIATE_NORMAL_ARGS_FLOAT          \
+    3, std::vector<float>{ 1.0f, -1.0f, 2.0f }, \
+        std::vector<float>{ 1.0f, 0.0f, 0.0f, 0.5f, 2.0f, 0.0f, -1.0f, 0.25f, 0.5f }
+#define MULTIVARIATE_NORMAL_ARGS_DOUBLE       \
+    3, std::vector<double>{ 1.0, -1.0, 2.0 }, \
+        std::vector<double>{ 1.0, 0.0, 0.0, 0.5, 2.0, 0.0, -1.0, 0.25, 0.5 }
+
 template <typename Distr, typename Engine>
 class statistics_test {
 public:
@@ -55,7 +74,7 @@ public:
     void operator()(Queue queue, std::int64_t n_gen, Args... args) {
         using Type = typename Distr::result_type;
 
-        std::vector<Type> r(n_gen);
+        std::vector<Type> r(output_size(Distr{ args... }, n_gen));
 
         try {
             sycl::buffer<Type, 1> r_buffer(r.data(), r.size());
@@ -96,7 +115,7 @@ public:
 #else
         auto ua = sycl::usm_allocator<Type, sycl::usm::alloc::shared, 64>(queue.get_queue());
 #endif
-        std::vector<Type, decltype(ua)> r(n_gen, ua);
+        std::vector<Type, decltype(ua)> r(output_size(Distr{ args... }, n_gen), ua);
 
         try {
             Engine engine(queue, SEED);
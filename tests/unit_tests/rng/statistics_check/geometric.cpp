@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "statistics_check_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+class GeometricIcdfTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(GeometricIcdfTests, IntegerPrecision) {
+    rng_test<statistics_test<
+        oneapi::math::rng::geometric<std::int32_t, oneapi::math::rng::geometric_method::icdf>,
+        oneapi::math::rng::philox4x32x10>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), N_GEN, GEOMETRIC_ARGS)));
+    rng_test<statistics_test<
+        oneapi::math::rng::geometric<std::int32_t, oneapi::math::rng::geometric_method::icdf>,
+        oneapi::math::rng::mrg32k3a>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), N_GEN, GEOMETRIC_ARGS)));
+}
+
+TEST_P(GeometricIcdfTests, UnsignedIntegerPrecision) {
+    rng_test<statistics_test<
+        oneapi::math::rng::geometric<std::uint32_t, oneapi::math::rng::geometric_method::icdf>,
+        oneapi::math::rng::philox4x32x10>>
+        test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), N_GEN, GEOMETRIC_ARGS)));
+    rng_test<statistics_test<
+        oneapi::math::rng::geometric<std::uint32_t, oneapi::math::rng::geometric_method::icdf>,
+        oneapi::math::rng::mrg32k3a>>
+        test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), N_GEN, GEOMETRIC_ARGS)));
+}
+
+INSTANTIATE_TEST_SUITE_P(GeometricIcdfTestSuite, GeometricIcdfTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,621 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _VM_TEST_COMMON_HPP__
+#define _VM_TEST_COMMON_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+
+#define MAX_NUM_PRINT 20
+
+// Wraps a VM function into a callable that accepts either buffers or USM pointers, going through
+// the run-time dispatcher or through every compile-time backend enabled for the queue's device
+#ifdef CALL_RT_API
+#define VM_FUNCTION(func)                                  \
+    [](sycl::queue& queue, std::int64_t n, auto... args) { \
+        func(queue, n, args...);                           \
+    }
+#else
+#define VM_FUNCTION(func)                                  \
+    [](sycl::queue& queue, std::int64_t n, auto... args) { \
+        TEST_RUN_VM_CT_SELECT(queue, func, n, args...);    \
+    }
+#endif
+
+// Accuracy modes every test runs through
+static const std::vector<oneapi::math::vm::mode> vm_modes = { oneapi::math::vm::mode::ha,
+                                                              oneapi::math::vm::mode::la,
+                                                              oneapi::math::vm::mode::ep };
+
+// Relative tolerance of the comparison against the std:: reference. ha and la allow a few tens
+// of ulp so that both the oneMKL results and the sycl:: built-ins used by the generic backend
+// pass; ep only guarantees about half of the mantissa bits.
+template <typename fp>
+fp vm_tolerance(oneapi::math::vm::mode mode) {
+    if (mode == oneapi::math::vm::mode::ep) {
+        return std::ldexp(fp(1), -(std::numeric_limits<fp>::digits / 2 - 1));
+    }
+    return std::numeric_limits<fp>::epsilon() * fp(64);
+}
+
+// Storage layouts every test runs through: contiguous vectors, strided vectors (a with increment
+// 2, b with 3 and y walked backwards with -3) and gather/scatter through n distinct random
+// indices below 2 * n
+enum class vm_layout { dense, strided, indexed };
+
+static const std::vector<vm_layout> vm_layouts = { vm_layout::dense, vm_layout::strided,
+                                                   vm_layout::indexed };
+
+// Maps the logical elements of a vector argument with the given strided-layout increment to its
+// storage; entries of the storage that are not mapped must be left untouched by the function. The
+// index array is filled for every layout so that its buffer is never empty.
+class vm_storage {
+public:
+    vm_storage(vm_layout layout, std::int64_t n) : layout_(layout), n_(n) {
+        std::vector<std::int64_t> all(2 * n);
+        for (std::int64_t i = 0; i < 2 * n; i++) {
+            all[i] = i;
+        }
+        std::shuffle(all.begin(), all.end(), std::mt19937(555));
+        index_.assign(all.begin(), all.begin() + n);
+    }
+
+    vm_layout layout() const {
+        return layout_;
+    }
+
+    std::int64_t inc(std::int64_t strided_inc) const {
+        return layout_ == vm_layout::strided ? strided_inc : 1;
+    }
+
+    std::int64_t size(std::int64_t strided_inc) const {
+        switch (layout_) {
+            case vm_layout::strided: return n_ == 0 ? 0 : 1 + (n_ - 1) * std::abs(strided_inc);
+            case vm_layout::indexed: return 2 * n_;
+            default: return n_;
+        }
+    }
+
+    std::int64_t position(std::int64_t i, std::int64_t strided_inc) const {
+        switch (layout_) {
+            case vm_layout::strided:
+                return strided_inc < 0 ? (i - n_ + 1) * strided_inc : i * strided_inc;
+            case vm_layout::indexed: return index_[i];
+            default: return i;
+        }
+    }
+
+    std::vector<std::int64_t>& index() {
+        return index_;
+    }
+
+private:
+    vm_layout layout_;
+    std::int64_t n_;
+    std::vector<std::int64_t> index_;
+};
+
+constexpr std::int64_t vm_inca = 2;
+constexpr std::int64_t vm_incb = 3;
+constexpr std::int64_t vm_incy = -3;
+
+template <typename fp>
+constexpr fp vm_sentinel() {
+    return fp(7777);
+}
+
+template <typename fp>
+void rand_vector(std::vector<fp>& v, fp lower, fp upper) {
+    std::mt19937 generator(777);
+    std::uniform_real_distribution<fp> distribution(lower, upper);
+    for (auto& x : v) {
+        x = distribution(generator);
+    }
+}
+
+template <typename fp>
+bool check_equal_vector(const std::vector<fp>& v, const std::vector<fp>& v_ref, fp tolerance,
+                        std::ostream& out) {
+    int count = 0;
+    for (std::size_t i = 0; i < v.size(); i++) {
+        fp diff = std::abs(v[i] - v_ref[i]);
+        if (diff > tolerance * std::max(std::abs(v_ref[i]), fp(1))) {
+            if (count++ < MAX_NUM_PRINT) {
+                out << "Difference in entry " << i << ": DPC++ " << v[i] << " vs. Reference "
+                    << v_ref[i] << std::endl;
+            }
+        }
+    }
+    return count == 0;
+}
+
+template <typename fp>
+bool check_equal_vector(const std::vector<std::complex<fp>>& v,
+                        const std::vector<std::complex<fp>>& v_ref, fp tolerance,
+                        std::ostream& out) {
+    int count = 0;
+    for (std::size_t i = 0; i < v.size(); i++) {
+        fp diff = std::abs(v[i] - v_ref[i]);
+        if (diff > tolerance * std::max(std::abs(v_ref[i]), fp(1))) {
+            if (count++ < MAX_NUM_PRINT) {
+                out << "Difference in entry " << i << ": DPC++ " << v[i] << " vs. Reference "
+                    << v_ref[i] << std::endl;
+            }
+        }
+    }
+    return count == 0;
+}
+
+inline auto vm_exception_handler() {
+    return [](sycl::exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (sycl::exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception:\n" << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+}
+
+// Evaluates y = f(a) for n arguments drawn from [lower, upper) through the buffer or the USM API
+// with the given layout and compares the result with the host reference ref(a)
+template <typename fp, typename Ref, typename Function>
+int test_unary(sycl::device* dev, bool use_usm, vm_layout layout, oneapi::math::vm::mode mode,
+               std::int64_t n, fp lower, fp upper, Ref ref, Function function) {
+    sycl::queue main_queue(*dev, vm_exception_handler());
+
+    vm_storage storage(layout, n);
+    const std::int64_t inca = storage.inc(vm_inca), incy = storage.inc(vm_incy);
+    const std::int64_t size_a = storage.size(vm_inca), size_y = storage.size(vm_incy);
+    std::vector<fp> a(size_a), y(size_y, vm_sentinel<fp>()), y_ref(size_y, vm_sentinel<fp>());
+    std::vector<std::int64_t>& index = storage.index();
+    rand_vector(a, lower, upper);
+    for (std::int64_t i = 0; i < n; i++) {
+        y_ref[storage.position(i, vm_incy)] = ref(a[storage.position(i, vm_inca)]);
+    }
+
+    fp* a_usm = nullptr;
+    fp* y_usm = nullptr;
+    std::int64_t* index_usm = nullptr;
+    try {
+        if (use_usm) {
+            a_usm = sycl::malloc_device<fp>(size_a, main_queue);
+            y_usm = sycl::malloc_device<fp>(size_y, main_queue);
+            main_queue.copy(a.data(), a_usm, size_a).wait();
+            main_queue.copy(y.data(), y_usm, size_y).wait();
+            if (layout == vm_layout::indexed) {
+                index_usm = sycl::malloc_device<std::int64_t>(n, main_queue);
+                main_queue.copy(index.data(), index_usm, n).wait();
+            }
+            const fp* a_in = a_usm;
+            switch (layout) {
+                case vm_layout::strided:
+                    function(main_queue, n, a_in, inca, y_usm, incy, std::vector<sycl::event>{},
+                             mode);
+                    break;
+                case vm_layout::indexed:
+                    function(main_queue, n, a_in, y_usm,
+                             static_cast<const std::int64_t*>(index_usm),
+                             std::vector<sycl::event>{}, mode);
+                    break;
+                default:
+                    function(main_queue, n, a_in, y_usm, std::vector<sycl::event>{}, mode);
+                    break;
+            }
+            main_queue.wait_and_throw();
+            main_queue.copy(y_usm, y.data(), size_y).wait();
+        }
+        else {
+            sycl::buffer<fp, 1> a_buffer(a.data(), sycl::range<1>(size_a));
+            sycl::buffer<fp, 1> y_buffer(y.data(), sycl::range<1>(size_y));
+            sycl::buffer<std::int64_t, 1> index_buffer(index.data(), sycl::range<1>(n));
+            switch (layout) {
+                case vm_layout::strided:
+                    function(main_queue, n, a_buffer, inca, y_buffer, incy, mode);
+                    break;
+                case vm_layout::indexed:
+                    function(main_queue, n, a_buffer, y_buffer, index_buffer, mode);
+                    break;
+                default: function(main_queue, n, a_buffer, y_buffer, mode); break;
+            }
+        }
+    }
+    catch (sycl::exception const& e) {
+        std::cout << "Caught synchronous SYCL exception:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+    catch (const oneapi::math::unimplemented& e) {
+        sycl::free(a_usm, main_queue);
+        sycl::free(y_usm, main_queue);
+        sycl::free(index_usm, main_queue);
+        return test_skipped;
+    }
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of VM function:\n"
+                  << error.what() << std::endl;
+    }
+    sycl::free(a_usm, main_queue);
+    sycl::free(y_usm, main_queue);
+    sycl::free(index_usm, main_queue);
+
+    return check_equal_vector(y, y_ref, vm_tolerance<fp>(mode), std::cout);
+}
+
+// Evaluates y = f(a, b) for n argument pairs drawn from [lower_a, upper_a) x [lower_b, upper_b)
+// through the buffer or the USM API with the given layout and compares the result with the host
+// reference ref(a, b)
+template <typename fp, typename Ref, typename Function>
+int test_binary(sycl::device* dev, bool use_usm, vm_layout layout, oneapi::math::vm::mode mode,
+                std::int64_t n, fp lower_a, fp upper_a, fp lower_b, fp upper_b, Ref ref,
+                Function function) {
+    sycl::queue main_queue(*dev, vm_exception_handler());
+
+    vm_storage storage(layout, n);
+    const std::int64_t inca = storage.inc(vm_inca), incb = storage.inc(vm_incb),
+                       incy = storage.inc(vm_incy);
+    const std::int64_t size_a = storage.size(vm_inca), size_b = storage.size(vm_incb),
+                       size_y = storage.size(vm_incy);
+    std::vector<fp> a(size_a), b(size_b), y(size_y, vm_sentinel<fp>()),
+        y_ref(size_y, vm_sentinel<fp>());
+    std::vector<std::int64_t>& index = storage.index();
+    rand_vector(a, lower_a, upper_a);
+    rand_vector(b, lower_b, upper_b);
+    for (std::int64_t i = 0; i < n; i++) {
+        y_ref[storage.position(i, vm_incy)] =
+            ref(a[storage.position(i, vm_inca)], b[storage.position(i, vm_incb)]);
+    }
+
+    fp* a_usm = nullptr;
+    fp* b_usm = nullptr;
+    fp* y_usm = nullptr;
+    std::int64_t* index_usm = nullptr;
+    try {
+        if (use_usm) {
+            a_usm = sycl::malloc_device<fp>(size_a, main_queue);
+            b_usm = sycl::malloc_device<fp>(size_b, main_queue);
+            y_usm = sycl::malloc_device<fp>(size_y, main_queue);
+            main_queue.copy(a.data(), a_usm, size_a).wait();
+            main_queue.copy(b.data(), b_usm, size_b).wait();
+            main_queue.copy(y.data(), y_usm, size_y).wait();
+            if (layout == vm_layout::indexed) {
+                index_usm = sycl::malloc_device<std::int64_t>(n, main_queue);
+                main_queue.copy(index.data(), index_usm, n).wait();
+            }
+            const fp* a_in = a_usm;
+            const fp* b_in = b_usm;
+            switch (layout) {
+                case vm_layout::strided:
+                    function(main_queue, n, a_in, inca, b_in, incb, y_usm, incy,
+                             std::vector<sycl::event>{}, mode);
+                    break;
+                case vm_layout::indexed:
+                    function(main_queue, n, a_in, b_in, y_usm,
+                             static_cast<const std::int64_t*>(index_usm),
+                             std::vector<sycl::event>{}, mode);
+                    break;
+                default:
+                    function(main_queue, n, a_in, b_in, y_usm, std::vector<sycl::event>{}, mode);
+                    break;
+            }
+            main_queue.wait_and_throw();
+            main_queue.copy(y_usm, y.data(), size_y).wait();
+        }
+        else {
+            sycl::buffer<fp, 1> a_buffer(a.data(), sycl::range<1>(size_a));
+            sycl::buffer<fp, 1> b_buffer(b.data(), sycl::range<1>(size_b));
+            sycl::buffer<fp, 1> y_buffer(y.data(), sycl::range<1>(size_y));
+            sycl::buffer<std::int64_t, 1> index_buffer(index.data(), sycl::range<1>(n));
+            switch (layout) {
+                case vm_layout::strided:
+                    function(main_queue, n, a_buffer, inca, b_buffer, incb, y_buffer, incy, mode);
+                    break;
+                case vm_layout::indexed:
+                    function(main_queue, n, a_buffer, b_buffer, y_buffer, index_buffer, mode);
+                    break;
+                default: function(main_queue, n, a_buffer, b_buffer, y_buffer, mode); break;
+            }
+        }
+    }
+    catch (sycl::exception const& e) {
+        std::cout << "Caught synchronous SYCL exception:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+    catch (const oneapi::math::unimplemented& e) {
+        sycl::free(a_usm, main_queue);
+        sycl::free(b_usm, main_queue);
+        sycl::free(y_usm, main_queue);
+        sycl::free(index_usm, main_queue);
+        return test_skipped;
+    }
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of VM function:\n"
+                  << error.what() << std::endl;
+    }
+    sycl::free(a_usm, main_queue);
+    sycl::free(b_usm, main_queue);
+    sycl::free(y_usm, main_queue);
+    sycl::free(index_usm, main_queue);
+
+    return check_equal_vector(y, y_ref, vm_tolerance<fp>(mode), std::cout);
+}
+
+// Storages every complex test runs through, following the DFT conventions: interleaved
+// std::complex elements (COMPLEX_COMPLEX) and separate arrays of real and imaginary parts
+// (REAL_REAL)
+enum class vm_complex_storage { interleaved, split };
+
+static const std::vector<vm_complex_storage> vm_complex_storages = {
+    vm_complex_storage::interleaved, vm_complex_storage::split
+};
+
+template <typename E>
+struct vm_element_traits {
+    using real_type = E;
+    static constexpr bool is_complex = false;
+};
+
+template <typename fp>
+struct vm_element_traits<std::complex<fp>> {
+    using real_type = fp;
+    static constexpr bool is_complex = true;
+};
+
+// Both parts of a complex element are drawn from [lower, upper)
+template <typename E, typename fp>
+E vm_random_element(std::mt19937& generator, fp lower, fp upper) {
+    std::uniform_real_distribution<fp> distribution(lower, upper);
+    if constexpr (vm_element_traits<E>::is_complex) {
+        fp re = distribution(generator);
+        fp im = distribution(generator);
+        return E(re, im);
+    }
+    else {
+        return distribution(generator);
+    }
+}
+
+// Device copy of an argument of a complex test in USM; a complex vector is split into two
+// allocations holding its real and imaginary parts when Split is set
+template <bool Split, typename E>
+class vm_usm_vector {
+    using fp = typename vm_element_traits<E>::real_type;
+    static constexpr bool parts = Split && vm_element_traits<E>::is_complex;
+
+public:
+    vm_usm_vector(sycl::queue& queue, const std::vector<E>& host)
+            : queue_(queue),
+              n_(host.size()) {
+        if constexpr (parts) {
+            std::vector<fp> re(n_), im(n_);
+            for (std::size_t i = 0; i < n_; i++) {
+                re[i] = host[i].real();
+                im[i] = host[i].imag();
+            }
+            re_ = sycl::malloc_device<fp>(n_, queue_);
+            im_ = sycl::malloc_device<fp>(n_, queue_);
+            queue_.copy(re.data(), re_, n_).wait();
+            queue_.copy(im.data(), im_, n_).wait();
+        }
+        else {
+            data_ = sycl::malloc_device<E>(n_, queue_);
+            queue_.copy(host.data(), data_, n_).wait();
+        }
+    }
+
+    ~vm_usm_vector() {
+        sycl::free(data_, queue_);
+        sycl::free(re_, queue_);
+        sycl::free(im_, queue_);
+    }
+
+    auto in_args() const {
+        if constexpr (parts) {
+            return std::make_tuple(static_cast<const fp*>(re_), static_cast<const fp*>(im_));
+        }
+        else {
+            return std::make_tuple(static_cast<const E*>(data_));
+        }
+    }
+
+    auto out_args() const {
+        if constexpr (parts) {
+            return std::make_tuple(re_, im_);
+        }
+        else {
+            return std::make_tuple(data_);
+        }
+    }
+
+    void copy_to(std::vector<E>& host) {
+        if constexpr (parts) {
+            std::vector<fp> re(n_), im(n_);
+            queue_.copy(re_, re.data(), n_).wait();
+            queue_.copy(im_, im.data(), n_).wait();
+            for (std::size_t i = 0; i < n_; i++) {
+                host[i] = E(re[i], im[i]);
+            }
+        }
+        else {
+            queue_.copy(data_, host.data(), n_).wait();
+        }
+    }
+
+private:
+    sycl::queue& queue_;
+    std::size_t n_;
+    E* data_ = nullptr;
+    fp* re_ = nullptr;
+    fp* im_ = nullptr;
+};
+
+// Buffers over an argument of a complex test, split like vm_usm_vector; the host vector is
+// updated when the object is destroyed
+template <bool Split, typename E>
+class vm_buffer_vector {
+    using fp = typename vm_element_traits<E>::real_type;
+    static constexpr bool parts = Split && vm_element_traits<E>::is_complex;
+
+public:
+    explicit vm_buffer_vector(std::vector<E>& host) : host_(host) {
+        const sycl::range<1> range(host.size());
+        if constexpr (parts) {
+            re_.resize(host.size());
+            im_.resize(host.size());
+            for (std::size_t i = 0; i < host.size(); i++) {
+                re_[i] = host[i].real();
+                im_[i] = host[i].imag();
+            }
+            re_buffer_ = std::make_unique<sycl::buffer<fp, 1>>(re_.data(), range);
+            im_buffer_ = std::make_unique<sycl::buffer<fp, 1>>(im_.data(), range);
+        }
+        else {
+            buffer_ = std::make_unique<sycl::buffer<E, 1>>(host.data(), range);
+        }
+    }
+
+    ~vm_buffer_vector() {
+        buffer_.reset();
+        re_buffer_.reset();
+        im_buffer_.reset();
+        if constexpr (parts) {
+            for (std::size_t i = 0; i < host_.size(); i++) {
+                host_[i] = E(re_[i], im_[i]);
+            }
+        }
+    }
+
+    auto args() {
+        if constexpr (parts) {
+            return std::forward_as_tuple(*re_buffer_, *im_buffer_);
+        }
+        else {
+            return std::forward_as_tuple(*buffer_);
+        }
+    }
+
+private:
+    std::vector<E>& host_;
+    std::vector<fp> re_, im_;
+    std::unique_ptr<sycl::buffer<E, 1>> buffer_;
+    std::unique_ptr<sycl::buffer<fp, 1>> re_buffer_, im_buffer_;
+};
+
+// Evaluates y = f(a[, b]) for the complex functions, the arguments having the types In and y the
+// type Out (real or std::complex). Every part of the arguments is drawn from [lower, upper), the
+// function is called through the buffer or the USM API with the given storage and the result is
+// compared with the host reference ref(a[, b]).
+template <typename fp, typename Out, typename... In, typename Ref, typename Function>
+int test_complex(sycl::device* dev, bool use_usm, vm_complex_storage storage,
+                 oneapi::math::vm::mode mode, std::int64_t n, fp lower, fp upper, Ref ref,
+                 Function function) {
+    sycl::queue main_queue(*dev, vm_exception_handler());
+
+    std::mt19937 generator(777);
+    std::tuple<std::vector<In>...> inputs{ std::vector<In>(n)... };
+    std::vector<Out> y(n), y_ref(n);
+    std::apply(
+        [&](auto&... v) {
+            auto fill = [&](auto& x) {
+                for (auto& e : x) {
+                    e = vm_random_element<std::decay_t<decltype(e)>>(generator, lower, upper);
+                }
+            };
+            (fill(v), ...);
+            for (std::int64_t i = 0; i < n; i++) {
+                y_ref[i] = ref(v[i]...);
+            }
+        },
+        inputs);
+
+    auto run = [&](auto split) {
+        constexpr bool Split = decltype(split)::value;
+        if (use_usm) {
+            auto in = std::apply(
+                [&](auto&... v) {
+                    return std::make_tuple(
+                        std::make_unique<vm_usm_vector<Split, In>>(main_queue, v)...);
+                },
+                inputs);
+            vm_usm_vector<Split, Out> y_device(main_queue, y);
+            auto in_args =
+                std::apply([](auto&... x) { return std::tuple_cat(x->in_args()...); }, in);
+            std::apply(function,
+                       std::tuple_cat(std::forward_as_tuple(main_queue, n), in_args,
+                                      y_device.out_args(),
+                                      std::make_tuple(std::vector<sycl::event>{}, mode)));
+            main_queue.wait_and_throw();
+            y_device.copy_to(y);
+        }
+        else {
+            auto in = std::apply(
+                [&](auto&... v) {
+                    return std::make_tuple(std::make_unique<vm_buffer_vector<Split, In>>(v)...);
+                },
+                inputs);
+            vm_buffer_vector<Split, Out> y_device(y);
+            auto in_args = std::apply([](auto&... x) { return std::tuple_cat(x->args()...); }, in);
+            std::apply(function, std::tuple_cat(std::forward_as_tuple(main_queue, n), in_args,
+                                                y_device.args(), std::make_tuple(mode)));
+        }
+    };
+
+    try {
+        if (storage == vm_complex_storage::split) {
+            run(std::true_type{});
+        }
+        else {
+            run(std::false_type{});
+        }
+    }
+    catch (sycl::exception const& e) {
+        std::cout << "Caught synchronous SYCL exception:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+    catch (const oneapi::math::unimplemented& e) {
+        return test_skipped;
+    }
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of VM function:\n"
+                  << error.what() << std::endl;
+    }
+
+    return check_equal_vector(y, y_ref, vm_tolerance<fp>(mode), std::cout);
+}
+
+#endif /* header guard */
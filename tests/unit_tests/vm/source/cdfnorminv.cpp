@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Newton iterations in long double on cdfnorm(y) = min(p, 1 - p), starting from y = 0. The normal
+// cdf is convex on y <= 0, so the iterates decrease monotonically towards the root.
+template <typename fp>
+fp cdfnorminv_ref(fp a) {
+    const long double p = std::min(static_cast<long double>(a), 1.0L - a);
+    const long double sqrt2 = std::sqrt(2.0L);
+    const long double inv_sqrt2pi = 1.0L / std::sqrt(2.0L * std::acos(-1.0L));
+    long double y = 0.0L;
+    for (int i = 0; i < 200; i++) {
+        long double f = 0.5L * std::erfc(-y / sqrt2) - p;
+        long double step = f / (inv_sqrt2pi * std::exp(-0.5L * y * y));
+        y -= step;
+        if (std::abs(step) <= std::numeric_limits<long double>::epsilon() * std::abs(y)) {
+            break;
+        }
+    }
+    return static_cast<fp>(a < fp(0.5) ? y : -y);
+}
+
+class CdfnorminvTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(CdfnorminvTests, RealSinglePrecision) {
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), false, layout, mode, 1357, 0.0001f,
+                                                 0.9999f, cdfnorminv_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::cdfnorminv))));
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), true, layout, mode, 1357, 0.0001f,
+                                                 0.9999f, cdfnorminv_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::cdfnorminv))));
+        }
+    }
+}
+
+TEST_P(CdfnorminvTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), false, layout, mode, 1357, 0.0001,
+                                                  0.9999, cdfnorminv_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::cdfnorminv))));
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), true, layout, mode, 1357, 0.0001,
+                                                  0.9999, cdfnorminv_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::cdfnorminv))));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CdfnorminvTestSuite, CdfnorminvTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
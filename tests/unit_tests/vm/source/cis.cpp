@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+std::complex<fp> cis_complex_ref(fp a) {
+    return std::complex<fp>(std::cos(static_cast<long double>(a)),
+                            std::sin(static_cast<long double>(a)));
+}
+
+class CisTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(CisTests, ComplexSinglePrecision) {
+    using complex_fp = std::complex<float>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, float>(
+                GetParam(), false, storage, mode, 1357, -10.0f, 10.0f, cis_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::cis))));
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, float>(
+                GetParam(), true, storage, mode, 1357, -10.0f, 10.0f, cis_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::cis))));
+        }
+    }
+}
+
+TEST_P(CisTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    using complex_fp = std::complex<double>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, double>(
+                GetParam(), false, storage, mode, 1357, -10.0, 10.0, cis_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::cis))));
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, double>(
+                GetParam(), true, storage, mode, 1357, -10.0, 10.0, cis_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::cis))));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CisTestSuite, CisTests, ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Newton iterations in long double on erf(y) = |a|, starting from y = 0. erf is concave on
+// y >= 0, so the iterates increase monotonically towards the root.
+template <typename fp>
+fp erfinv_ref(fp a) {
+    const long double x = std::abs(static_cast<long double>(a));
+    const long double two_over_sqrtpi = 2.0L / std::sqrt(std::acos(-1.0L));
+    long double y = 0.0L;
+    for (int i = 0; i < 200; i++) {
+        long double step = (std::erf(y) - x) / (two_over_sqrtpi * std::exp(-y * y));
+        y -= step;
+        if (std::abs(step) <= std::numeric_limits<long double>::epsilon() * std::abs(y)) {
+            break;
+        }
+    }
+    return static_cast<fp>(std::copysign(y, static_cast<long double>(a)));
+}
+
+class ErfinvTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(ErfinvTests, RealSinglePrecision) {
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), false, layout, mode, 1357, -0.99f,
+                                                 0.99f, erfinv_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::erfinv))));
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), true, layout, mode, 1357, -0.99f,
+                                                 0.99f, erfinv_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::erfinv))));
+        }
+    }
+}
+
+TEST_P(ErfinvTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), false, layout, mode, 1357, -0.99,
+                                                  0.99, erfinv_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::erfinv))));
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), true, layout, mode, 1357, -0.99, 0.99,
+                                                  erfinv_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::erfinv))));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ErfinvTestSuite, ErfinvTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// y = a * exp(b * x + c) - x / sqrt(x * x + 1), evaluated in one kernel with x read with
+// increment incx and y written with increment incy
+template <typename fp>
+int test_eval(sycl::device* dev, bool use_usm, oneapi::math::vm::mode mode, std::int64_t n,
+              std::int64_t incx, std::int64_t incy) {
+    namespace vm = oneapi::math::vm;
+    sycl::queue main_queue(*dev, vm_exception_handler());
+
+    const fp a = fp(1.5), b = fp(-0.75), c = fp(0.25);
+    const std::int64_t size_x = 1 + (n - 1) * std::abs(incx);
+    const std::int64_t size_y = 1 + (n - 1) * std::abs(incy);
+    std::vector<fp> x(size_x), y(size_y, vm_sentinel<fp>()), y_ref(size_y, vm_sentinel<fp>());
+    rand_vector(x, fp(-5), fp(5));
+    for (std::int64_t i = 0; i < n; i++) {
+        const fp xi = x[incx < 0 ? (i - n + 1) * incx : i * incx];
+        y_ref[incy < 0 ? (i - n + 1) * incy : i * incy] =
+            a * std::exp(b * xi + c) - xi / std::sqrt(xi * xi + fp(1));
+    }
+
+    fp* x_usm = nullptr;
+    fp* y_usm = nullptr;
+    try {
+        if (use_usm) {
+            x_usm = sycl::malloc_device<fp>(size_x, main_queue);
+            y_usm = sycl::malloc_device<fp>(size_y, main_queue);
+            main_queue.copy(x.data(), x_usm, size_x).wait();
+            main_queue.copy(y.data(), y_usm, size_y).wait();
+            auto xe = vm::input(x_usm, incx);
+            auto done = vm::eval(main_queue, n, y_usm, incy,
+                                 a * vm::exp(b * xe + c) - xe / vm::sqrt(xe * xe + 1), {}, mode);
+            done.wait_and_throw();
+            main_queue.copy(y_usm, y.data(), size_y).wait();
+        }
+        else {
+            sycl::buffer<fp, 1> x_buffer(x.data(), sycl::range<1>(size_x));
+            sycl::buffer<fp, 1> y_buffer(y.data(), sycl::range<1>(size_y));
+            auto xe = vm::input(x_buffer, incx);
+            vm::eval(main_queue, n, y_buffer, incy,
+                     a * vm::exp(b * xe + c) - xe / vm::sqrt(xe * xe + 1), mode);
+        }
+    }
+    catch (sycl::exception const& e) {
+        std::cout << "Caught synchronous SYCL exception:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of VM expression:\n"
+                  << error.what() << std::endl;
+    }
+    sycl::free(x_usm, main_queue);
+    sycl::free(y_usm, main_queue);
+
+    // Rounding errors of the five operations add up on top of the error of exp
+    return check_equal_vector(y, y_ref, vm_tolerance<fp>(mode) * fp(4), std::cout);
+}
+
+class EvalTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(EvalTests, RealSinglePrecision) {
+    for (auto mode : vm_modes) {
+        EXPECT_TRUEORSKIP((test_eval<float>(GetParam(), false, mode, 1357, 1, 1)));
+        EXPECT_TRUEORSKIP((test_eval<float>(GetParam(), true, mode, 1357, 1, 1)));
+        EXPECT_TRUEORSKIP((test_eval<float>(GetParam(), false, mode, 1357, 2, -3)));
+        EXPECT_TRUEORSKIP((test_eval<float>(GetParam(), true, mode, 1357, 2, -3)));
+    }
+}
+
+TEST_P(EvalTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (auto mode : vm_modes) {
+        EXPECT_TRUEORSKIP((test_eval<double>(GetParam(), false, mode, 1357, 1, 1)));
+        EXPECT_TRUEORSKIP((test_eval<double>(GetParam(), true, mode, 1357, 1, 1)));
+        EXPECT_TRUEORSKIP((test_eval<double>(GetParam(), false, mode, 1357, 2, -3)));
+        EXPECT_TRUEORSKIP((test_eval<double>(GetParam(), true, mode, 1357, 2, -3)));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(EvalTestSuite, EvalTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+fp exp_ref(fp a) {
+    return std::exp(a);
+}
+
+template <typename fp>
+std::complex<fp> exp_complex_ref(std::complex<fp> a) {
+    return std::complex<fp>(std::exp(std::complex<long double>(a)));
+}
+
+class ExpTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(ExpTests, RealSinglePrecision) {
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), false, layout, mode, 1357, -20.0f,
+                                                 20.0f, exp_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::exp))));
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), true, layout, mode, 1357, -20.0f,
+                                                 20.0f, exp_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::exp))));
+        }
+    }
+}
+
+TEST_P(ExpTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), false, layout, mode, 1357, -20.0,
+                                                  20.0, exp_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::exp))));
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), true, layout, mode, 1357, -20.0, 20.0,
+                                                  exp_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::exp))));
+        }
+    }
+}
+
+TEST_P(ExpTests, ComplexSinglePrecision) {
+    using complex_fp = std::complex<float>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, complex_fp>(
+                GetParam(), false, storage, mode, 1357, -10.0f, 10.0f, exp_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::exp))));
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, complex_fp>(
+                GetParam(), true, storage, mode, 1357, -10.0f, 10.0f, exp_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::exp))));
+        }
+    }
+}
+
+TEST_P(ExpTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    using complex_fp = std::complex<double>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, complex_fp>(
+                GetParam(), false, storage, mode, 1357, -10.0, 10.0, exp_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::exp))));
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, complex_fp>(
+                GetParam(), true, storage, mode, 1357, -10.0, 10.0, exp_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::exp))));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ExpTestSuite, ExpTests, ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
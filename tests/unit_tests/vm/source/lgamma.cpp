@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+fp lgamma_ref(fp a) {
+    return std::lgamma(a);
+}
+
+class LgammaTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(LgammaTests, RealSinglePrecision) {
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), false, layout, mode, 1357, 0.1f, 20.0f,
+                                                 lgamma_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::lgamma))));
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), true, layout, mode, 1357, 0.1f, 20.0f,
+                                                 lgamma_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::lgamma))));
+        }
+    }
+}
+
+TEST_P(LgammaTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), false, layout, mode, 1357, 0.1, 20.0,
+                                                  lgamma_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::lgamma))));
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), true, layout, mode, 1357, 0.1, 20.0,
+                                                  lgamma_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::lgamma))));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(LgammaTestSuite, LgammaTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
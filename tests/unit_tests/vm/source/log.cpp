@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+fp log_ref(fp a) {
+    return std::log(a);
+}
+
+template <typename fp>
+std::complex<fp> log_complex_ref(std::complex<fp> a) {
+    return std::complex<fp>(std::log(std::complex<long double>(a)));
+}
+
+class LogTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(LogTests, RealSinglePrecision) {
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), false, layout, mode, 1357, 0.1f,
+                                                 100.0f, log_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::log))));
+            EXPECT_TRUEORSKIP((test_unary<float>(GetParam(), true, layout, mode, 1357, 0.1f, 100.0f,
+                                                 log_ref<float>,
+                                                 VM_FUNCTION(oneapi::math::vm::log))));
+        }
+    }
+}
+
+TEST_P(LogTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), false, layout, mode, 1357, 0.1, 100.0,
+                                                  log_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::log))));
+            EXPECT_TRUEORSKIP((test_unary<double>(GetParam(), true, layout, mode, 1357, 0.1, 100.0,
+                                                  log_ref<double>,
+                                                  VM_FUNCTION(oneapi::math::vm::log))));
+        }
+    }
+}
+
+TEST_P(LogTests, ComplexSinglePrecision) {
+    using complex_fp = std::complex<float>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, complex_fp>(
+                GetParam(), false, storage, mode, 1357, -10.0f, 10.0f, log_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::log))));
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, complex_fp>(
+                GetParam(), true, storage, mode, 1357, -10.0f, 10.0f, log_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::log))));
+        }
+    }
+}
+
+TEST_P(LogTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    using complex_fp = std::complex<double>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, complex_fp>(
+                GetParam(), false, storage, mode, 1357, -10.0, 10.0, log_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::log))));
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, complex_fp>(
+                GetParam(), true, storage, mode, 1357, -10.0, 10.0, log_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::log))));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(LogTestSuite, LogTests, ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
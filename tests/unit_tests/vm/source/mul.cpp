@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+#include "vm_test_common.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+fp mul_ref(fp a, fp b) {
+    return a * b;
+}
+
+template <typename fp>
+std::complex<fp> mul_complex_ref(std::complex<fp> a, std::complex<fp> b) {
+    return std::complex<fp>(std::complex<long double>(a) * std::complex<long double>(b));
+}
+
+class MulTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(MulTests, RealSinglePrecision) {
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_binary<float>(GetParam(), false, layout, mode, 1357, -100.0f,
+                                                  100.0f, -100.0f, 100.0f, mul_ref<float>,
+                                                  VM_FUNCTION(oneapi::math::vm::mul))));
+            EXPECT_TRUEORSKIP((test_binary<float>(GetParam(), true, layout, mode, 1357, -100.0f,
+                                                  100.0f, -100.0f, 100.0f, mul_ref<float>,
+                                                  VM_FUNCTION(oneapi::math::vm::mul))));
+        }
+    }
+}
+
+TEST_P(MulTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    for (auto layout : vm_layouts) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_binary<double>(GetParam(), false, layout, mode, 1357, -100.0,
+                                                   100.0, -100.0, 100.0, mul_ref<double>,
+                                                   VM_FUNCTION(oneapi::math::vm::mul))));
+            EXPECT_TRUEORSKIP((test_binary<double>(GetParam(), true, layout, mode, 1357, -100.0,
+                                                   100.0, -100.0, 100.0, mul_ref<double>,
+                                                   VM_FUNCTION(oneapi::math::vm::mul))));
+        }
+    }
+}
+
+TEST_P(MulTests, ComplexSinglePrecision) {
+    using complex_fp = std::complex<float>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, complex_fp, complex_fp>(
+                GetParam(), false, storage, mode, 1357, -10.0f, 10.0f, mul_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::mul))));
+            EXPECT_TRUEORSKIP((test_complex<float, complex_fp, complex_fp, complex_fp>(
+                GetParam(), true, storage, mode, 1357, -10.0f, 10.0f, mul_complex_ref<float>,
+                VM_FUNCTION(oneapi::math::vm::mul))));
+        }
+    }
+}
+
+TEST_P(MulTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(GetParam());
+
+    using complex_fp = std::complex<double>;
+
+    for (auto storage : vm_complex_storages) {
+        for (auto mode : vm_modes) {
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, complex_fp, complex_fp>(
+                GetParam(), false, storage, mode, 1357, -10.0, 10.0, mul_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::mul))));
+            EXPECT_TRUEORSKIP((test_complex<double, complex_fp, complex_fp, complex_fp>(
+                GetParam(), true, storage, mode, 1357, -10.0, 10.0, mul_complex_ref<double>,
+                VM_FUNCTION(oneapi::math::vm::mul))));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(MulTestSuite, MulTests, ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace